@@ -0,0 +1,180 @@
+#include <bench.h>
+
+#include <set/irb_set.h>
+#include <set/isc_hash_set.h>
+#include <set/ioa_hash_set.h>
+#include <set/ibitwise_set.h>
+#include <set/iroaring_set.h>
+#include <memory/tracking_memory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/// @brief Resets tracking allocator and starts measurement.
+/// @param bench Benchmark settings.
+/// @return Clock value at start of measurement.
+clock_t _algebra_start(bench_s const * const bench);
+
+void algebra_bench(bench_s const * const bench) {
+    size_t state = (size_t)(0x9E3779B97F4A7C15ull);
+    size_t const length = bench->length;
+    size_t size = bench->size;
+
+    // second set's keys start halfway into first one's, so half of them overlap
+    size_t * const keys_one = bench_keys(0, length, &state);
+    size_t * const keys_two = bench_keys(length / 2, length, &state);
+    char * const one = keys_one ? bench_elements(bench, keys_one, length) : NULL;
+    char * const two = keys_two ? bench_elements(bench, keys_two, length) : NULL;
+    if (!one || !two) {
+        fprintf(stderr, "algebra_bench: memory allocation failed\n");
+        free(keys_one); free(keys_two); free(one); free(two);
+        return;
+    }
+
+    irb_set_s rb_one = make_irb_set(size, bench_compare, NULL, bench->tracking);
+    irb_set_s rb_two = make_irb_set(size, bench_compare, NULL, bench->tracking);
+    isc_hash_set_s sc_one = make_isc_hash_set(size, bench_hash, NULL, bench_compare, NULL, bench->tracking);
+    isc_hash_set_s sc_two = make_isc_hash_set(size, bench_hash, NULL, bench_compare, NULL, bench->tracking);
+    ioa_hash_set_s oa_one = make_ioa_hash_set(size, bench_hash, NULL, bench_compare, NULL, bench->tracking);
+    ioa_hash_set_s oa_two = make_ioa_hash_set(size, bench_hash, NULL, bench_compare, NULL, bench->tracking);
+    ibitwise_set_s bitwise_one = make_ibitwise_set(bench->tracking);
+    ibitwise_set_s bitwise_two = make_ibitwise_set(bench->tracking);
+    iroaring_set_s roaring_one = make_iroaring_set(bench->tracking);
+    iroaring_set_s roaring_two = make_iroaring_set(bench->tracking);
+    for (size_t i = 0; i < length; ++i) {
+        insert_irb_set(&rb_one, one + (i * size)); insert_irb_set(&rb_two, two + (i * size));
+        insert_isc_hash_set(&sc_one, one + (i * size)); insert_isc_hash_set(&sc_two, two + (i * size));
+        insert_ioa_hash_set(&oa_one, one + (i * size)); insert_ioa_hash_set(&oa_two, two + (i * size));
+        insert_ibitwise_set(&bitwise_one, keys_one[i]); insert_ibitwise_set(&bitwise_two, keys_two[i]);
+        insert_iroaring_set(&roaring_one, keys_one[i]); insert_iroaring_set(&roaring_two, keys_two[i]);
+    }
+
+    // each operation reads both sets, so it's reported per element of both
+    size_t const operations = length * 2;
+
+    clock_t start = _algebra_start(bench);
+    irb_set_s rb = union_irb_set(&rb_one, &rb_two, bench_copy, &size);
+    bench_track("irb_set_union", operations, bench_elapsed(start), bench->tracking, rb.length);
+    destroy_irb_set(&rb, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    rb = intersect_irb_set(&rb_one, &rb_two, bench_copy, &size);
+    bench_track("irb_set_intersect", operations, bench_elapsed(start), bench->tracking, rb.length);
+    destroy_irb_set(&rb, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    rb = subtract_irb_set(&rb_one, &rb_two, bench_copy, &size);
+    bench_track("irb_set_subtract", operations, bench_elapsed(start), bench->tracking, rb.length);
+    destroy_irb_set(&rb, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    rb = exclude_irb_set(&rb_one, &rb_two, bench_copy, &size);
+    bench_track("irb_set_exclude", operations, bench_elapsed(start), bench->tracking, rb.length);
+    destroy_irb_set(&rb, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    isc_hash_set_s sc = union_isc_hash_set(&sc_one, &sc_two, bench_copy, &size);
+    bench_track("isc_hash_set_union", operations, bench_elapsed(start), bench->tracking, sc.length);
+    destroy_isc_hash_set(&sc, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    sc = intersect_isc_hash_set(&sc_one, &sc_two, bench_copy, &size);
+    bench_track("isc_hash_set_intersect", operations, bench_elapsed(start), bench->tracking, sc.length);
+    destroy_isc_hash_set(&sc, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    sc = subtract_isc_hash_set(&sc_one, &sc_two, bench_copy, &size);
+    bench_track("isc_hash_set_subtract", operations, bench_elapsed(start), bench->tracking, sc.length);
+    destroy_isc_hash_set(&sc, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    sc = exclude_isc_hash_set(&sc_one, &sc_two, bench_copy, &size);
+    bench_track("isc_hash_set_exclude", operations, bench_elapsed(start), bench->tracking, sc.length);
+    destroy_isc_hash_set(&sc, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    ioa_hash_set_s oa = union_ioa_hash_set(&oa_one, &oa_two, bench_copy, &size);
+    bench_track("ioa_hash_set_union", operations, bench_elapsed(start), bench->tracking, oa.length);
+    destroy_ioa_hash_set(&oa, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    oa = intersect_ioa_hash_set(&oa_one, &oa_two, bench_copy, &size);
+    bench_track("ioa_hash_set_intersect", operations, bench_elapsed(start), bench->tracking, oa.length);
+    destroy_ioa_hash_set(&oa, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    oa = subtract_ioa_hash_set(&oa_one, &oa_two, bench_copy, &size);
+    bench_track("ioa_hash_set_subtract", operations, bench_elapsed(start), bench->tracking, oa.length);
+    destroy_ioa_hash_set(&oa, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    oa = exclude_ioa_hash_set(&oa_one, &oa_two, bench_copy, &size);
+    bench_track("ioa_hash_set_exclude", operations, bench_elapsed(start), bench->tracking, oa.length);
+    destroy_ioa_hash_set(&oa, bench_destroy, NULL);
+
+    start = _algebra_start(bench);
+    ibitwise_set_s bitwise = union_ibitwise_set(&bitwise_one, &bitwise_two);
+    bench_track("ibitwise_set_union", operations, bench_elapsed(start), bench->tracking, bitwise.length);
+    destroy_ibitwise_set(&bitwise);
+
+    start = _algebra_start(bench);
+    bitwise = intersect_ibitwise_set(&bitwise_one, &bitwise_two);
+    bench_track("ibitwise_set_intersect", operations, bench_elapsed(start), bench->tracking, bitwise.length);
+    destroy_ibitwise_set(&bitwise);
+
+    start = _algebra_start(bench);
+    bitwise = subtract_ibitwise_set(&bitwise_one, &bitwise_two);
+    bench_track("ibitwise_set_subtract", operations, bench_elapsed(start), bench->tracking, bitwise.length);
+    destroy_ibitwise_set(&bitwise);
+
+    start = _algebra_start(bench);
+    bitwise = exclude_ibitwise_set(&bitwise_one, &bitwise_two);
+    bench_track("ibitwise_set_exclude", operations, bench_elapsed(start), bench->tracking, bitwise.length);
+    destroy_ibitwise_set(&bitwise);
+
+    // in place union is copied into before measurement, so only combining without allocating is measured
+    bitwise = copy_ibitwise_set(&bitwise_one);
+    start = _algebra_start(bench);
+    union_into_ibitwise_set(&bitwise, &bitwise_two);
+    bench_track("ibitwise_set_union_into", operations, bench_elapsed(start), bench->tracking, bitwise.length);
+    destroy_ibitwise_set(&bitwise);
+
+    ibitwise_set_s const bitwise_all[] = { bitwise_one, bitwise_two, };
+    start = _algebra_start(bench);
+    bitwise = intersect_all_ibitwise_set(bitwise_all, 2);
+    bench_track("ibitwise_set_intersect_all", operations, bench_elapsed(start), bench->tracking, bitwise.length);
+    destroy_ibitwise_set(&bitwise);
+
+    start = _algebra_start(bench);
+    iroaring_set_s roaring = union_iroaring_set(&roaring_one, &roaring_two);
+    bench_track("iroaring_set_union", operations, bench_elapsed(start), bench->tracking, roaring.length);
+    destroy_iroaring_set(&roaring);
+
+    start = _algebra_start(bench);
+    roaring = intersect_iroaring_set(&roaring_one, &roaring_two);
+    bench_track("iroaring_set_intersect", operations, bench_elapsed(start), bench->tracking, roaring.length);
+    destroy_iroaring_set(&roaring);
+
+    start = _algebra_start(bench);
+    roaring = subtract_iroaring_set(&roaring_one, &roaring_two);
+    bench_track("iroaring_set_subtract", operations, bench_elapsed(start), bench->tracking, roaring.length);
+    destroy_iroaring_set(&roaring);
+
+    start = _algebra_start(bench);
+    roaring = exclude_iroaring_set(&roaring_one, &roaring_two);
+    bench_track("iroaring_set_exclude", operations, bench_elapsed(start), bench->tracking, roaring.length);
+    destroy_iroaring_set(&roaring);
+
+    destroy_irb_set(&rb_one, bench_destroy, NULL); destroy_irb_set(&rb_two, bench_destroy, NULL);
+    destroy_isc_hash_set(&sc_one, bench_destroy, NULL); destroy_isc_hash_set(&sc_two, bench_destroy, NULL);
+    destroy_ioa_hash_set(&oa_one, bench_destroy, NULL); destroy_ioa_hash_set(&oa_two, bench_destroy, NULL);
+    destroy_ibitwise_set(&bitwise_one); destroy_ibitwise_set(&bitwise_two);
+    destroy_iroaring_set(&roaring_one); destroy_iroaring_set(&roaring_two);
+
+    free(keys_one); free(keys_two); free(one); free(two);
+}
+
+clock_t _algebra_start(bench_s const * const bench) {
+    reset_tracking_memory(bench->tracking);
+    return clock();
+}
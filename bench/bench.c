@@ -0,0 +1,197 @@
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   if !defined(_XOPEN_SOURCE) || _XOPEN_SOURCE < 600
+#       undef _XOPEN_SOURCE
+#       define _XOPEN_SOURCE 600 // imports getrusage() in strict C99
+#   endif
+#   include <sys/resource.h>
+#endif
+
+#include <bench.h>
+
+#include <memory/tracking_memory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Format results are printed in.
+bench_format_e bench_format = CSV_FORMAT;
+
+/// @brief Number of results printed so far, used to separate JSON objects.
+size_t bench_count = 0;
+
+/// @brief Prints single result line in current format.
+/// @param name Name of benchmarked function.
+/// @param operations Number of operations performed.
+/// @param nanoseconds Time it took to perform operations.
+/// @param stats Allocation statistics, or NULL if untracked.
+/// @param checksum Value derived from results.
+void _bench_print(char const * const name, size_t const operations, double const nanoseconds, tracking_memory_stats_s const * const stats, size_t const checksum);
+
+size_t bench_random(size_t * const state) {
+    size_t x = (*state);
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    return (*state) = x;
+}
+
+double bench_elapsed(clock_t const start) {
+    return (double)(clock() - start) * 1e9 / (double)(CLOCKS_PER_SEC);
+}
+
+void bench_open(bench_format_e const format) {
+    bench_format = format;
+    bench_count = 0;
+
+    if (CSV_FORMAT == format) {
+        printf("benchmark,operations,ns_per_op,allocs_per_op,peak_bytes,rss_kib,checksum\n");
+    } else {
+        printf("[\n");
+    }
+    fflush(stdout);
+}
+
+void bench_close(void) {
+    if (JSON_FORMAT == bench_format) {
+        printf("%s]\n", bench_count ? "\n" : "");
+    }
+    fflush(stdout);
+}
+
+void bench_report(char const * const name, size_t const operations, double const nanoseconds, size_t const checksum) {
+    _bench_print(name, operations, nanoseconds, NULL, checksum);
+}
+
+void bench_track(char const * const name, size_t const operations, double const nanoseconds, memory_s const * const tracking, size_t const checksum) {
+    tracking_memory_stats_s const stats = stats_tracking_memory(tracking);
+    _bench_print(name, operations, nanoseconds, &stats, checksum);
+}
+
+size_t bench_rss(void) {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? (size_t)(counters.PeakWorkingSetSize / 1024) : 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage)) {
+        return 0;
+    }
+#   if defined(__APPLE__)
+    return (size_t)(usage.ru_maxrss) / 1024; // macOS reports bytes
+#   else
+    return (size_t)(usage.ru_maxrss); // linux and BSDs report kibibytes
+#   endif
+#endif
+}
+
+char * bench_elements(bench_s const * const bench, size_t const * const keys, size_t const length) {
+    char * const elements = malloc(length * bench->size);
+    if (!elements) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < length; ++i) {
+        char * const element = elements + (i * bench->size);
+        memset(element, (int)(keys[i] & 0xFF), bench->size);
+        memcpy(element, keys + i, sizeof(size_t));
+    }
+
+    return elements;
+}
+
+size_t * bench_keys(size_t const first, size_t const length, size_t * const state) {
+    size_t * const keys = malloc(length * sizeof(size_t));
+    if (!keys) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < length; ++i) {
+        keys[i] = first + i;
+    }
+
+    // Fisher-Yates shuffle
+    for (size_t i = length - 1; state && i > 0; --i) {
+        size_t const j = bench_random(state) % (i + 1);
+        size_t const temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+
+    return keys;
+}
+
+size_t bench_key(void const * const element) {
+    size_t key = 0;
+    memcpy(&key, element, sizeof(size_t));
+
+    return key;
+}
+
+int bench_compare(void const * const a, void const * const b, void * arg) {
+    (void)(arg);
+
+    size_t const key_a = bench_key(a), key_b = bench_key(b);
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+size_t bench_hash(void const * const element, void * arg) {
+    (void)(arg);
+
+    // fast-hash mixer, same as 'inthshmurmur' but over whole key
+    size_t key = bench_key(element);
+    key ^= key >> 23;
+    key *= (size_t)(0x2127599bf4325c37ull);
+    key ^= key >> 47;
+
+    return key;
+}
+
+void * bench_copy(void * const destination, void const * const source, void * arg) {
+    return memcpy(destination, source, *(size_t*)(arg));
+}
+
+void bench_destroy(void * const element, void * arg) {
+    (void)(element);
+    (void)(arg);
+}
+
+bool bench_sum(void * const element, void * arg) {
+    (*(size_t*)(arg)) += bench_key(element);
+
+    return true;
+}
+
+void _bench_print(char const * const name, size_t const operations, double const nanoseconds, tracking_memory_stats_s const * const stats, size_t const checksum) {
+    double const per_operation = operations ? nanoseconds / (double)(operations) : 0.0;
+    size_t const rss = bench_rss();
+
+    if (CSV_FORMAT == bench_format) {
+        printf("%s,%lu,%.2f,", name, (unsigned long)(operations), per_operation);
+        if (stats) {
+            double const allocations = (double)(stats->allocs + stats->reallocs);
+            printf("%.4f,%lu,", operations ? allocations / (double)(operations) : 0.0, (unsigned long)(stats->peak));
+        } else {
+            printf(",,");
+        }
+        printf("%lu,%lu\n", (unsigned long)(rss), (unsigned long)(checksum));
+    } else {
+        printf("%s  {\"benchmark\": \"%s\", \"operations\": %lu, \"ns_per_op\": %.2f, ", bench_count ? ",\n" : "", name, (unsigned long)(operations), per_operation);
+        if (stats) {
+            double const allocations = (double)(stats->allocs + stats->reallocs);
+            printf("\"allocs_per_op\": %.4f, \"peak_bytes\": %lu, ", operations ? allocations / (double)(operations) : 0.0, (unsigned long)(stats->peak));
+        } else {
+            printf("\"allocs_per_op\": null, \"peak_bytes\": null, ");
+        }
+        printf("\"rss_kib\": %lu, \"checksum\": %lu}", (unsigned long)(rss), (unsigned long)(checksum));
+    }
+
+    bench_count++;
+    fflush(stdout);
+}
@@ -0,0 +1,129 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <cerpec.h>
+
+#include <stddef.h>
+#include <time.h>
+
+#define BENCH_LENGTH (1 << 20)
+
+/// @brief Largest number of vertices adjacency matrix graph workloads use, since its memory grows quadratically.
+#define BENCH_VERTICES 2048
+
+/// @brief Number of random edges inserted per vertex in graph workloads.
+#define BENCH_DEGREE 8
+
+/// @brief Output format of benchmark results.
+typedef enum bench_format {
+    CSV_FORMAT,  // header line followed by one comma separated line per result
+    JSON_FORMAT, // array of one object per result
+} bench_format_e;
+
+/// @brief Benchmark settings shared by standardized workloads.
+typedef struct bench {
+    size_t length;             // number of elements (operations) per workload
+    size_t size;               // size of single element, key is stored in its first 'sizeof(size_t)' bytes
+    memory_s const * tracking; // tracking allocator every benchmarked structure is made with
+} bench_s;
+
+/// @brief Generates next pseudo-random value (xorshift) and advances state.
+/// @param state Non-zero random generator state.
+/// @return Pseudo-random value.
+size_t bench_random(size_t * const state);
+
+/// @brief Gets processor time elapsed since start.
+/// @param start Clock value at start of measurement.
+/// @return Elapsed time in nanoseconds.
+double bench_elapsed(clock_t const start);
+
+/// @brief Starts printing results in format.
+/// @param format Format to print results in.
+void bench_open(bench_format_e const format);
+
+/// @brief Finishes printing results.
+void bench_close(void);
+
+/// @brief Prints untracked benchmark result, leaving allocation and memory columns empty.
+/// @param name Name of benchmarked function.
+/// @param operations Number of operations performed.
+/// @param nanoseconds Time it took to perform operations.
+/// @param checksum Value derived from results to keep them from being optimized away.
+void bench_report(char const * const name, size_t const operations, double const nanoseconds, size_t const checksum);
+
+/// @brief Prints benchmark result with allocation calls and peak bytes recorded by tracking allocator.
+/// @param name Name of benchmarked function.
+/// @param operations Number of operations performed.
+/// @param nanoseconds Time it took to perform operations.
+/// @param tracking Tracking allocator that was reset before operations started.
+/// @param checksum Value derived from results to keep them from being optimized away.
+void bench_track(char const * const name, size_t const operations, double const nanoseconds, memory_s const * const tracking, size_t const checksum);
+
+/// @brief Gets peak resident set size of process.
+/// @return Peak resident set size in kibibytes, or zero if platform can't report it.
+size_t bench_rss(void);
+
+/// @brief Creates array of elements with keys, the rest of each element is filled with key's lowest byte.
+/// @param bench Benchmark settings.
+/// @param keys Array of keys.
+/// @param length Number of keys.
+/// @return Array of elements, or NULL if allocation failed.
+char * bench_elements(bench_s const * const bench, size_t const * const keys, size_t const length);
+
+/// @brief Creates array of keys from 'first' to 'first + length - 1', shuffled if state isn't NULL.
+/// @param first First key.
+/// @param length Number of keys.
+/// @param state Random generator state, or NULL to keep keys sorted.
+/// @return Array of keys, or NULL if allocation failed.
+size_t * bench_keys(size_t const first, size_t const length, size_t * const state);
+
+/// @brief Gets key of element.
+/// @param element Element to get key from.
+/// @return Key of element.
+size_t bench_key(void const * const element);
+
+/// @brief Compares elements by key.
+int bench_compare(void const * const a, void const * const b, void * arg);
+
+/// @brief Hashes element's key.
+size_t bench_hash(void const * const element, void * arg);
+
+/// @brief Copies element of size pointed to by argument.
+void * bench_copy(void * const destination, void const * const source, void * arg);
+
+/// @brief Does nothing, since elements own no memory.
+void bench_destroy(void * const element, void * arg);
+
+/// @brief Adds element's key to size_t sum pointed to by argument.
+bool bench_sum(void * const element, void * arg);
+
+/// @brief Benchmarks single key against batched lookups in separate chaining hash sets and maps.
+/// @param length Number of elements inserted and looked up.
+void hash_lookup_bench(size_t const length);
+
+/// @brief Benchmarks and stress tests concurrent hash map with mixed reads and writes from 1 to 64 threads.
+/// @param length Number of keys in map and operations per thread count.
+void concurrent_bench(size_t const length);
+
+/// @brief Benchmarks producer/consumer bursts on infinite queue and deque with standard, pool and cached node allocation.
+/// @param length Number of elements enqueued and dequeued.
+void sequence_bench(size_t const length);
+
+/// @brief Runs standardized insert, lookup, iteration and remove workloads on every infinite container.
+/// @param bench Benchmark settings.
+void workload_bench(bench_s const * const bench);
+
+/// @brief Runs union, intersection, subtraction and exclusion of half overlapping sets on every infinite set.
+/// @param bench Benchmark settings.
+void algebra_bench(bench_s const * const bench);
+
+/// @brief Runs searches and spanning trees on random adjacency matrix graph.
+/// @param bench Benchmark settings, length is capped at BENCH_VERTICES vertices.
+void graph_bench(bench_s const * const bench);
+
+/// @brief Compares linear scan and indexed heap Dijkstra on adjacency matrix graph with sparse row graph's,
+/// on random graphs of 1k to 50k vertices.
+/// @param bench Benchmark settings, length caps number of vertices.
+void search_bench(bench_s const * const bench);
+
+#endif // BENCH_H
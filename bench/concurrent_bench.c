@@ -0,0 +1,185 @@
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#       undef _POSIX_C_SOURCE
+#       define _POSIX_C_SOURCE 200112L // imports pthreads and clock_gettime() in strict C99
+#   endif
+#   include <pthread.h>
+#endif
+
+#include <bench.h>
+
+#include <misc/ccsc_hash_map.h>
+#include <dodac.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CONCURRENT_BENCH_THREADS 64
+#define CONCURRENT_BENCH_WRITES 10 // percentage of operations that write
+
+/// @brief Arguments and results of a single worker thread.
+typedef struct concurrent_bench_worker {
+    ccsc_hash_map_s * map;
+    size_t operations, length, state, checksum;
+    size_t start, inserted, removed; // private key range [start + removed, start + inserted) added by worker
+} concurrent_bench_worker_s;
+
+/// @brief Gets monotonic wall time.
+/// @return Time in nanoseconds.
+double _concurrent_bench_now(void);
+
+/// @brief Runs mixed read/write workload on shared map.
+/// @param worker Worker arguments and results.
+void _concurrent_bench_work(concurrent_bench_worker_s * const worker);
+
+/// @brief Counts each visited key.
+/// @param element Key to count.
+/// @param count Pointer to size_t counter.
+/// @return 'true' to continue iteration.
+bool _concurrent_bench_count(void * const element, void * count);
+
+#if defined(_WIN32)
+DWORD WINAPI _concurrent_bench_thread(LPVOID argument) {
+    _concurrent_bench_work(argument);
+    return 0;
+}
+#else
+void * _concurrent_bench_thread(void * argument) {
+    _concurrent_bench_work(argument);
+    return NULL;
+}
+#endif
+
+void concurrent_bench(size_t const length) {
+    size_t const shard_counts[] = { 1, CCSC_HASH_MAP_SHARDS, };
+    for (size_t s = 0; s < sizeof(shard_counts) / sizeof(shard_counts[0]); ++s) {
+        ccsc_hash_map_s map = make_ccsc_hash_map(sizeof(int), sizeof(int), shard_counts[s], inthshmurmur, NULL, intcmp, NULL, &standard);
+        for (size_t i = 0; i < length; ++i) {
+            int const key = (int)(i), value = key;
+            insert_ccsc_hash_map(&map, &key, &value);
+        }
+
+        for (size_t threads = 1; threads <= CONCURRENT_BENCH_THREADS; threads *= 2) {
+            concurrent_bench_worker_s workers[CONCURRENT_BENCH_THREADS];
+#if defined(_WIN32)
+            HANDLE handles[CONCURRENT_BENCH_THREADS];
+#else
+            pthread_t handles[CONCURRENT_BENCH_THREADS];
+#endif
+
+            double const start = _concurrent_bench_now();
+            for (size_t t = 0; t < threads; ++t) {
+                workers[t] = (concurrent_bench_worker_s) {
+                    .map = &map, .operations = length / threads, .length = length, .state = (t + 1) * 0x9E3779B9u,
+                    .start = length + t * (length / threads),
+                };
+#if defined(_WIN32)
+                handles[t] = CreateThread(NULL, 0, _concurrent_bench_thread, workers + t, 0, NULL);
+                if (!handles[t]) { fprintf(stderr, "thread creation failed\n"); exit(EXIT_FAILURE); }
+#else
+                if (pthread_create(handles + t, NULL, _concurrent_bench_thread, workers + t)) {
+                    fprintf(stderr, "thread creation failed\n");
+                    exit(EXIT_FAILURE);
+                }
+#endif
+            }
+
+            size_t checksum = 0, operations = 0;
+            for (size_t t = 0; t < threads; ++t) {
+#if defined(_WIN32)
+                WaitForSingleObject(handles[t], INFINITE);
+                CloseHandle(handles[t]);
+#else
+                pthread_join(handles[t], NULL);
+#endif
+                checksum += workers[t].checksum;
+                operations += workers[t].operations;
+            }
+            double const elapsed = _concurrent_bench_now() - start;
+
+            char name[64];
+            sprintf(name, "ccsc_hash_map_%lu_shards_%lu_threads", (unsigned long)(shard_counts[s]), (unsigned long)(threads));
+            bench_report(name, operations, elapsed, checksum);
+        }
+
+        // stress check, writers only ever set value to its key and removed all their own keys, so only initial ones remain
+        size_t count = 0;
+        each_key_ccsc_hash_map(&map, _concurrent_bench_count, &count);
+        if (count != length) {
+            fprintf(stderr, "ccsc_hash_map has %lu keys instead of %lu\n", (unsigned long)(count), (unsigned long)(length));
+            exit(EXIT_FAILURE);
+        }
+        for (size_t i = 0; i < length; ++i) {
+            int const key = (int)(i);
+            int value = -1;
+            get_value_ccsc_hash_map(&map, &key, &value);
+            if (key != value) {
+                fprintf(stderr, "ccsc_hash_map corrupted at key %d\n", key);
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        destroy_ccsc_hash_map(&map, intdst, NULL, intdst, NULL);
+    }
+}
+
+double _concurrent_bench_now(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)(counter.QuadPart) * 1e9 / (double)(frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec) * 1e9 + (double)(now.tv_nsec);
+#endif
+}
+
+void _concurrent_bench_work(concurrent_bench_worker_s * const worker) {
+    for (size_t i = 0; i < worker->operations; ++i) {
+        size_t const random = bench_random(&(worker->state));
+        int const key = (int)(random % worker->length);
+
+        if ((random >> 16) % 100 < CONCURRENT_BENCH_WRITES) {
+            // writes are split between overwrites of shared keys and inserts/removes of private ones that resize shards
+            size_t const kind = (random >> 24) % 3;
+            if (kind == 0) {
+                int const value = key;
+                int buffer = -1;
+                set_ccsc_hash_map(worker->map, &key, &value, &buffer);
+                worker->checksum += (size_t)(buffer);
+            } else if (kind == 1 || worker->removed == worker->inserted) {
+                int const fresh = (int)(worker->start + worker->inserted++), value = fresh;
+                insert_ccsc_hash_map(worker->map, &fresh, &value);
+                worker->checksum += (size_t)(fresh);
+            } else {
+                int const stale = (int)(worker->start + worker->removed++);
+                int key_buffer = -1, value_buffer = -1;
+                remove_ccsc_hash_map(worker->map, &stale, &key_buffer, &value_buffer);
+                worker->checksum += (size_t)(value_buffer);
+            }
+        } else {
+            int value = -1;
+            get_value_ccsc_hash_map(worker->map, &key, &value);
+            worker->checksum += (size_t)(value);
+        }
+    }
+
+    // leave shared map as it was so next thread count starts from same length
+    while (worker->removed < worker->inserted) {
+        int const stale = (int)(worker->start + worker->removed++);
+        int key_buffer = -1, value_buffer = -1;
+        remove_ccsc_hash_map(worker->map, &stale, &key_buffer, &value_buffer);
+    }
+}
+
+bool _concurrent_bench_count(void * const element, void * count) {
+    (void)(element);
+    ++(*(size_t *)(count));
+
+    return true;
+}
@@ -0,0 +1,194 @@
+#include <bench.h>
+
+#include <graph/iam_graph.h>
+#include <memory/tracking_memory.h>
+#include <dodac.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+/// @brief Largest random edge weight, weights start at one since zero is graph's non-edge.
+#define GRAPH_BENCH_WEIGHT 100
+
+/// @brief Runs search or spanning tree function on graph and reports its result.
+/// @param bench Benchmark settings.
+/// @param graph Graph to search.
+/// @param name Name of benchmark.
+/// @param search Search function to run from vertex zero to every vertex.
+void _graph_search(bench_s const * const bench, iam_graph_s const * const graph, char const * const name,
+    void (*search)(iam_graph_s const * const, table_s * const, size_t const, size_t const));
+
+/// @brief Runs Prim's algorithm from vertex zero, adapted to search function signature.
+/// @param graph Graph to span.
+/// @param table Cost table.
+/// @param start Starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_prim(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs Kruskal's algorithm, adapted to search function signature.
+/// @param graph Graph to span.
+/// @param table Cost table.
+/// @param start Ignored starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_kruskal(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs filter Kruskal's algorithm, adapted to search function signature.
+/// @param graph Graph to span.
+/// @param table Cost table.
+/// @param start Ignored starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_filter_kruskal(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs radix Kruskal's algorithm, adapted to search function signature.
+/// @param graph Graph to span.
+/// @param table Cost table.
+/// @param start Ignored starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_radix_kruskal(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs Boruvka's algorithm on a single thread, adapted to search function signature.
+/// @param graph Graph to span.
+/// @param table Cost table.
+/// @param start Ignored starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_boruvka(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs Dijkstra's algorithm to middle vertex, adapted to search function signature.
+/// @param graph Graph to search.
+/// @param table Cost table.
+/// @param start Starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_point_dijkstra(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs bidirectional breadth first search to middle vertex, adapted to search function signature.
+/// @param graph Graph to search.
+/// @param table Cost table.
+/// @param start Starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_bidirectional_bfs(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Runs bidirectional Dijkstra's algorithm to middle vertex, adapted to search function signature.
+/// @param graph Graph to search.
+/// @param table Cost table.
+/// @param start Starting vertex index.
+/// @param end Ignored end vertex index.
+void _graph_bidirectional_dijkstra(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+void graph_bench(bench_s const * const bench) {
+    size_t const vertices = bench->length < BENCH_VERTICES ? bench->length : BENCH_VERTICES;
+    if (vertices < 2) {
+        return;
+    }
+
+    size_t const keys[] = { 0, };
+    char * const vertex = bench_elements(bench, keys, 1);
+    if (!vertex) {
+        fprintf(stderr, "graph_bench: memory allocation failed\n");
+        return;
+    }
+
+    int none = 0;
+    iam_graph_s graph = make_iam_graph(bench->size, sizeof(int), intcmp, NULL, &none, bench->tracking);
+
+    reset_tracking_memory(bench->tracking);
+    clock_t start = clock();
+    for (size_t i = 0; i < vertices; ++i) {
+        memcpy(vertex, &i, sizeof(size_t));
+        insert_vertex_iam_graph(&graph, vertex);
+    }
+    bench_track("iam_graph_insert_vertex", vertices, bench_elapsed(start), bench->tracking, graph.vertex_length);
+
+    // ring keeps graph connected, random chords give each vertex about BENCH_DEGREE neighbors
+    size_t state = (size_t)(0x9E3779B97F4A7C15ull);
+    size_t const edges = vertices * (BENCH_DEGREE / 2);
+    reset_tracking_memory(bench->tracking);
+    start = clock();
+    for (size_t i = 0; i < edges; ++i) {
+        size_t const one = i % vertices;
+        size_t const two = i < vertices ? (i + 1) % vertices : bench_random(&state) % vertices;
+        if (one == two || contains_weight_iam_graph(&graph, one, two)) {
+            continue;
+        }
+
+        int const weight = (int)(bench_random(&state) % GRAPH_BENCH_WEIGHT) + 1;
+        insert_weight_iam_graph(&graph, one, two, &weight);
+    }
+    bench_track("iam_graph_insert_weight", edges, bench_elapsed(start), bench->tracking, graph.edge_length);
+
+    _graph_search(bench, &graph, "iam_graph_bfs", bfs_iam_graph);
+    _graph_search(bench, &graph, "iam_graph_dfs", dfs_iam_graph);
+    _graph_search(bench, &graph, "iam_graph_dijkstra", dijkstra_iam_graph);
+    _graph_search(bench, &graph, "iam_graph_prim", _graph_prim);
+    _graph_search(bench, &graph, "iam_graph_kruskal", _graph_kruskal);
+    _graph_search(bench, &graph, "iam_graph_filter_kruskal", _graph_filter_kruskal);
+    _graph_search(bench, &graph, "iam_graph_radix_kruskal", _graph_radix_kruskal);
+    _graph_search(bench, &graph, "iam_graph_boruvka", _graph_boruvka);
+    _graph_search(bench, &graph, "iam_graph_point_dijkstra", _graph_point_dijkstra);
+    _graph_search(bench, &graph, "iam_graph_bidirectional_bfs", _graph_bidirectional_bfs);
+    _graph_search(bench, &graph, "iam_graph_bidirectional_dijkstra", _graph_bidirectional_dijkstra);
+
+    destroy_iam_graph(&graph, bench_destroy, NULL, intdst, NULL);
+    free(vertex);
+}
+
+void _graph_search(bench_s const * const bench, iam_graph_s const * const graph, char const * const name,
+    void (*search)(iam_graph_s const * const, table_s * const, size_t const, size_t const)) {
+    int zero = 0, infinite = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &infinite);
+
+    reset_tracking_memory(bench->tracking);
+    clock_t const start = clock();
+    search(graph, &table, 0, IAM_SPECIAL);
+    double const elapsed = bench_elapsed(start);
+
+    // sum of previous indexes of reached vertices depends on every step of search
+    size_t checksum = 0;
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        checksum += IAM_SPECIAL == table.previous[i] ? 0 : table.previous[i];
+    }
+    bench_track(name, graph->vertex_length, elapsed, bench->tracking, checksum);
+
+    destroy_iam_table(&table);
+}
+
+void _graph_prim(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(end);
+    prim_iam_graph(graph, table, start);
+}
+
+void _graph_kruskal(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(start); (void)(end);
+    kruskal_iam_graph(graph, table);
+}
+
+void _graph_filter_kruskal(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(start); (void)(end);
+    filter_kruskal_iam_graph(graph, table);
+}
+
+void _graph_radix_kruskal(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(start); (void)(end);
+    radix_kruskal_iam_graph(graph, table, intkey, NULL);
+}
+
+void _graph_boruvka(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(start); (void)(end);
+    boruvka_iam_graph(graph, table, 1);
+}
+
+void _graph_point_dijkstra(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(end);
+    dijkstra_iam_graph(graph, table, start, graph->vertex_length / 2);
+}
+
+void _graph_bidirectional_bfs(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(end);
+    bidirectional_bfs_iam_graph(graph, table, start, graph->vertex_length / 2);
+}
+
+void _graph_bidirectional_dijkstra(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    (void)(end);
+    bidirectional_dijkstra_iam_graph(graph, table, start, graph->vertex_length / 2);
+}
@@ -0,0 +1,110 @@
+#include <bench.h>
+
+#include <set/isc_hash_set.h>
+#include <set/fsc_hash_set.h>
+#include <misc/isc_hash_map.h>
+#include <misc/fsc_hash_map.h>
+#include <dodac.h>
+
+#include <stdlib.h>
+
+/// @brief Counts 'true' results of batched lookup.
+/// @param results Array of results.
+/// @param length Length of array.
+/// @return Number of 'true' results.
+size_t _count_results(bool const * const results, size_t const length);
+
+void hash_lookup_bench(size_t const length) {
+    int * keys = malloc(length * sizeof(int));
+    int * misses = malloc(length * sizeof(int)); // half of queries miss
+    int * hits = malloc(length * sizeof(int)); // all queries hit
+    int * values = malloc(length * sizeof(int));
+    bool * results = malloc(length * sizeof(bool));
+    if (!keys || !misses || !hits || !values || !results) {
+        free(keys); free(misses); free(hits); free(values); free(results);
+        return;
+    }
+
+    size_t state = (size_t)(0x9E3779B97F4A7C15ull);
+    for (size_t i = 0; i < length; ++i) {
+        keys[i] = values[i] = (int)(i * 2);
+        misses[i] = (int)(bench_random(&state) % (length * 2));
+    }
+    // hits are drawn only after every key is written
+    for (size_t i = 0; i < length; ++i) {
+        hits[i] = keys[bench_random(&state) % length];
+    }
+
+    isc_hash_set_s isc_set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    fsc_hash_set_s fsc_set = create_fsc_hash_set(sizeof(int), length, inthshmurmur, NULL, intcmp, NULL);
+    isc_hash_map_s isc_map = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    fsc_hash_map_s fsc_map = create_fsc_hash_map(sizeof(int), sizeof(int), length, inthshmurmur, NULL, intcmp, NULL);
+    for (size_t i = 0; i < length; ++i) {
+        insert_isc_hash_set(&isc_set, keys + i);
+        insert_fsc_hash_set(&fsc_set, keys + i);
+        insert_isc_hash_map(&isc_map, keys + i, values + i);
+        insert_fsc_hash_map(&fsc_map, keys + i, values + i);
+    }
+
+    size_t checksum = 0;
+    clock_t start = clock();
+    for (size_t i = 0; i < length; ++i) { checksum += contains_isc_hash_set(&isc_set, misses + i); }
+    bench_report("contains_isc_hash_set", length, bench_elapsed(start), checksum);
+
+    start = clock();
+    contains_many_isc_hash_set(&isc_set, misses, length, results);
+    bench_report("contains_many_isc_hash_set", length, bench_elapsed(start), _count_results(results, length));
+
+    checksum = 0;
+    start = clock();
+    for (size_t i = 0; i < length; ++i) { checksum += contains_fsc_hash_set(&fsc_set, misses + i); }
+    bench_report("contains_fsc_hash_set", length, bench_elapsed(start), checksum);
+
+    start = clock();
+    contains_many_fsc_hash_set(&fsc_set, misses, length, results);
+    bench_report("contains_many_fsc_hash_set", length, bench_elapsed(start), _count_results(results, length));
+
+    checksum = 0;
+    start = clock();
+    for (size_t i = 0; i < length; ++i) {
+        get_value_isc_hash_map(&isc_map, hits + i, values + i);
+        checksum += (size_t)(values[i]);
+    }
+    bench_report("get_value_isc_hash_map", length, bench_elapsed(start), checksum);
+
+    checksum = 0;
+    start = clock();
+    get_values_isc_hash_map(&isc_map, hits, length, values);
+    for (size_t i = 0; i < length; ++i) { checksum += (size_t)(values[i]); }
+    bench_report("get_values_isc_hash_map", length, bench_elapsed(start), checksum);
+
+    checksum = 0;
+    start = clock();
+    for (size_t i = 0; i < length; ++i) {
+        get_value_fsc_hash_map(&fsc_map, hits + i, values + i);
+        checksum += (size_t)(values[i]);
+    }
+    bench_report("get_value_fsc_hash_map", length, bench_elapsed(start), checksum);
+
+    checksum = 0;
+    start = clock();
+    get_values_fsc_hash_map(&fsc_map, hits, length, values);
+    for (size_t i = 0; i < length; ++i) { checksum += (size_t)(values[i]); }
+    bench_report("get_values_fsc_hash_map", length, bench_elapsed(start), checksum);
+
+    destroy_isc_hash_set(&isc_set, intdst, NULL);
+    destroy_fsc_hash_set(&fsc_set, intdst, NULL);
+    destroy_isc_hash_map(&isc_map, intdst, NULL, intdst, NULL);
+    destroy_fsc_hash_map(&fsc_map, intdst, NULL, intdst, NULL);
+
+    free(keys); free(misses); free(hits); free(values); free(results);
+}
+
+size_t _count_results(bool const * const results, size_t const length) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; ++i) {
+        count += results[i];
+    }
+
+    return count;
+}
@@ -0,0 +1,87 @@
+#include <bench.h>
+
+#include <memory/tracking_memory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_MAXIMUM ((size_t)(1) << 28)
+
+/// @brief Names of benchmark groups that can be selected with '-b' option, in order they're run.
+char const * const groups[] = { "hash", "concurrent", "sequence", "workload", "algebra", "graph", "search", };
+
+/// @brief Prints usage and returns failure.
+/// @param program Name of program.
+/// @return EXIT_FAILURE.
+int _usage(char const * const program);
+
+int main(int const argc, char ** argv) {
+    bench_s bench = { .length = BENCH_LENGTH, .size = sizeof(size_t), };
+    bench_format_e format = CSV_FORMAT;
+    bool selected[sizeof(groups) / sizeof(groups[0])] = { 0 };
+    bool any = false;
+
+    for (int i = 1; i < argc; ++i) {
+        char const * const option = argv[i];
+        char const * const value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!strcmp(option, "-n") && value) {
+            bench.length = (size_t)(strtoul(value, NULL, 10));
+        } else if (!strcmp(option, "-s") && value) {
+            bench.size = (size_t)(strtoul(value, NULL, 10));
+        } else if (!strcmp(option, "-f") && value && (!strcmp(value, "csv") || !strcmp(value, "json"))) {
+            format = strcmp(value, "csv") ? JSON_FORMAT : CSV_FORMAT;
+        } else if (!strcmp(option, "-b") && value) {
+            size_t g = 0;
+            while (g < sizeof(groups) / sizeof(groups[0]) && strcmp(value, groups[g])) { g++; }
+            if (g == sizeof(groups) / sizeof(groups[0])) {
+                return _usage(argv[0]);
+            }
+            selected[g] = any = true;
+        } else if (1 == i && option[0] >= '0' && option[0] <= '9') {
+            bench.length = (size_t)(strtoul(option, NULL, 10)); // legacy 'cerpec_bench [length]' form
+            continue;
+        } else {
+            return _usage(argv[0]);
+        }
+        i++; // skip option's value
+    }
+
+    if (!bench.length || bench.length > BENCH_MAXIMUM || bench.size < sizeof(size_t) || bench.size > BENCH_MAXIMUM / bench.length) {
+        return _usage(argv[0]);
+    }
+
+    memory_s tracking = make_tracking_memory(&standard);
+    bench.tracking = &tracking;
+
+    bench_open(format);
+
+    if (!any || selected[0]) { hash_lookup_bench(bench.length); }
+    if (!any || selected[1]) { concurrent_bench(bench.length); }
+    if (!any || selected[2]) { sequence_bench(bench.length); }
+    if (!any || selected[3]) { workload_bench(&bench); }
+    if (!any || selected[4]) { algebra_bench(&bench); }
+    if (!any || selected[5]) { graph_bench(&bench); }
+    if (!any || selected[6]) { search_bench(&bench); }
+
+    bench_close();
+
+    destroy_tracking_memory(&tracking);
+
+    return EXIT_SUCCESS;
+}
+
+int _usage(char const * const program) {
+    fprintf(stderr, "usage: %s [-n length] [-s element size] [-f csv|json] [-b group]...\n", program);
+    fprintf(stderr, "  -n  elements per workload, from 1 to %lu (default %d)\n", (unsigned long)(BENCH_MAXIMUM), BENCH_LENGTH);
+    fprintf(stderr, "  -s  element size in bytes, at least %lu (default %lu)\n", (unsigned long)(sizeof(size_t)), (unsigned long)(sizeof(size_t)));
+    fprintf(stderr, "  -f  output format (default csv)\n");
+    fprintf(stderr, "  -b  run only group, repeatable:");
+    for (size_t g = 0; g < sizeof(groups) / sizeof(groups[0]); ++g) {
+        fprintf(stderr, " %s", groups[g]);
+    }
+    fprintf(stderr, "\n");
+
+    return EXIT_FAILURE;
+}
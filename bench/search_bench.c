@@ -0,0 +1,254 @@
+#include <bench.h>
+
+#include <graph/iam_graph.h>
+#include <graph/icsr_graph.h>
+#include <memory/tracking_memory.h>
+#include <dodac.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+/// @brief Largest adjacency matrix weight array in bytes, bigger graphs are only searched as sparse rows.
+#define SEARCH_BENCH_MATRIX ((size_t)(1) << 28)
+
+/// @brief Number of random point to point queries per graph.
+#define SEARCH_BENCH_QUERIES 8
+
+/// @brief Largest random edge weight, weights start at one since zero is matrix graph's non-edge.
+#define SEARCH_BENCH_WEIGHT 100
+
+/// @brief Signature shared by benchmarked shortest path searches.
+typedef void (*search_fn) (void const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Signature shared by benchmarked shortest path searches that reuse a workspace.
+typedef void (*reuse_fn) (void const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Runs full search from vertex zero and point to point searches, and reports their results.
+/// @param bench Benchmark settings.
+/// @param graph Graph to search.
+/// @param name Name of benchmark, suffixed by vertex count.
+/// @param vertices Number of vertices in graph.
+/// @param search Search function to run.
+/// @param destroy Table destroy function of searched graph.
+void _search_run(bench_s const * const bench, void const * const graph, char const * const name, size_t const vertices,
+    search_fn const search, void (*destroy)(table_s * const));
+
+/// @brief Runs point to point searches that share one workspace, and reports their results.
+/// @param bench Benchmark settings.
+/// @param graph Graph to search.
+/// @param name Name of benchmark, suffixed by vertex count.
+/// @param vertices Number of vertices in graph.
+/// @param search Search function to run.
+void _search_reuse(bench_s const * const bench, void const * const graph, char const * const name, size_t const vertices,
+    reuse_fn const search);
+
+/// @brief Linear minimum scan Dijkstra that adjacency matrix graph used before its indexed heap.
+/// @param graph Adjacency matrix graph to search.
+/// @param table Cost table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or IAM_SPECIAL.
+void _search_scan(void const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Adapts adjacency matrix graph's Dijkstra to search function signature.
+void _search_heap(void const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Adapts sparse row graph's Dijkstra to search function signature.
+void _search_sparse(void const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Adapts adjacency matrix graph's workspace Dijkstra to reused search function signature.
+void _search_heap_reuse(void const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Adapts sparse row graph's workspace Dijkstra to reused search function signature.
+void _search_sparse_reuse(void const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+void search_bench(bench_s const * const bench) {
+    size_t const sizes[] = { 1000, 2000, 5000, 10000, 20000, 50000, };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && sizes[s] <= bench->length; ++s) {
+        size_t const vertices = sizes[s];
+        bool const dense = (vertices * (vertices - 1)) / 2 <= SEARCH_BENCH_MATRIX / sizeof(int);
+
+        int none = 0;
+        iam_graph_s matrix = make_iam_graph(sizeof(size_t), sizeof(int), intcmp, NULL, &none, bench->tracking);
+        icsr_graph_s sparse = make_icsr_graph(sizeof(size_t), sizeof(int), bench->tracking);
+
+        for (size_t i = 0; i < vertices; ++i) {
+            if (dense) { insert_vertex_iam_graph(&matrix, &i); }
+            insert_vertex_icsr_graph(&sparse, &i);
+        }
+
+        // ring keeps graph connected, distinct forward chords shorter than half the ring give about BENCH_DEGREE neighbors
+        size_t state = (size_t)(0x9E3779B97F4A7C15ull);
+        for (size_t i = 0; i < vertices; ++i) {
+            size_t offsets[BENCH_DEGREE / 2] = { 1, };
+            for (size_t k = 0; k < BENCH_DEGREE / 2; ++k) {
+                if (k) { offsets[k] = 2 + (bench_random(&state) % ((vertices / 2) - 2)); }
+
+                // skip chord that repeats an earlier one of same vertex
+                size_t p = 0;
+                while (p < k && offsets[p] != offsets[k]) { p++; }
+                if (p < k) { continue; }
+
+                int const weight = (int)(bench_random(&state) % SEARCH_BENCH_WEIGHT) + 1;
+                if (dense) { insert_weight_iam_graph(&matrix, i, (i + offsets[k]) % vertices, &weight); }
+                insert_weight_icsr_graph(&sparse, i, (i + offsets[k]) % vertices, &weight);
+            }
+        }
+        compact_icsr_graph(&sparse);
+
+        if (dense) {
+            _search_run(bench, &matrix, "iam_graph_dijkstra_scan", vertices, _search_scan, destroy_iam_table);
+            _search_run(bench, &matrix, "iam_graph_dijkstra_heap", vertices, _search_heap, destroy_iam_table);
+            _search_reuse(bench, &matrix, "iam_graph_dijkstra_workspace", vertices, _search_heap_reuse);
+        }
+        _search_run(bench, &sparse, "icsr_graph_dijkstra", vertices, _search_sparse, destroy_icsr_table);
+        _search_reuse(bench, &sparse, "icsr_graph_dijkstra_workspace", vertices, _search_sparse_reuse);
+
+        destroy_iam_graph(&matrix, bench_destroy, NULL, intdst, NULL);
+        destroy_icsr_graph(&sparse, bench_destroy, NULL, intdst, NULL);
+    }
+}
+
+void _search_run(bench_s const * const bench, void const * const graph, char const * const name, size_t const vertices,
+    search_fn const search, void (*destroy)(table_s * const)) {
+    int zero = 0, infinite = INT_MAX;
+    char label[64];
+
+    // full search visits every vertex, checksum is sum of all shortest distances
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &infinite);
+    reset_tracking_memory(bench->tracking);
+    clock_t start = clock();
+    search(graph, &table, 0, IAM_SPECIAL);
+    double elapsed = bench_elapsed(start);
+
+    size_t checksum = 0;
+    for (size_t i = 0; i < vertices; ++i) {
+        checksum += (size_t)(((int *)(table.costs))[i]);
+    }
+    destroy(&table);
+
+    snprintf(label, sizeof(label), "%s_%lu", name, (unsigned long)(vertices));
+    bench_track(label, vertices, elapsed, bench->tracking, checksum);
+
+    // point to point queries stop once end vertex is closest, checksum is sum of their distances
+    size_t state = (size_t)(0xD1B54A32D192ED03ull);
+    checksum = 0;
+    elapsed = 0.0;
+    reset_tracking_memory(bench->tracking);
+    for (size_t q = 0; q < SEARCH_BENCH_QUERIES; ++q) {
+        size_t const one = bench_random(&state) % vertices, two = bench_random(&state) % vertices;
+
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &infinite);
+        start = clock();
+        search(graph, &table, one, two);
+        elapsed += bench_elapsed(start);
+
+        checksum += (size_t)(((int *)(table.costs))[two]);
+        destroy(&table);
+    }
+
+    snprintf(label, sizeof(label), "%s_point_%lu", name, (unsigned long)(vertices));
+    bench_track(label, SEARCH_BENCH_QUERIES, elapsed, bench->tracking, checksum);
+}
+
+void _search_reuse(bench_s const * const bench, void const * const graph, char const * const name, size_t const vertices,
+    reuse_fn const search) {
+    int zero = 0, infinite = INT_MAX;
+    char label[64];
+
+    // same queries as point to point searches with new tables, workspace is created once outside of timing
+    table_s const table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &infinite);
+    graph_workspace_s workspace = make_graph_workspace(vertices, &table, bench->tracking);
+
+    size_t state = (size_t)(0xD1B54A32D192ED03ull), checksum = 0;
+    double elapsed = 0.0;
+    reset_tracking_memory(bench->tracking);
+    for (size_t q = 0; q < SEARCH_BENCH_QUERIES; ++q) {
+        size_t const one = bench_random(&state) % vertices, two = bench_random(&state) % vertices;
+
+        clock_t const start = clock();
+        search(graph, &workspace, one, two);
+        elapsed += bench_elapsed(start);
+
+        checksum += (size_t)(((int *)(workspace.table.costs))[two]);
+    }
+
+    snprintf(label, sizeof(label), "%s_point_%lu", name, (unsigned long)(vertices));
+    bench_track(label, SEARCH_BENCH_QUERIES, elapsed, bench->tracking, checksum);
+
+    destroy_graph_workspace(&workspace);
+}
+
+void _search_scan(void const * const graph, table_s * const table, size_t const start, size_t const end) {
+    iam_graph_s const * matrix = graph;
+
+    table->graph = matrix;
+    table->costs = matrix->allocator->alloc(matrix->vertex_length * table->size, matrix->allocator->arg);
+    table->previous = matrix->allocator->alloc(matrix->vertex_length * sizeof(size_t), matrix->allocator->arg);
+    bool * visited = matrix->allocator->alloc(matrix->vertex_length * sizeof(bool), matrix->allocator->arg);
+    char * buffer = matrix->allocator->alloc(2 * table->size, matrix->allocator->arg);
+    if (!table->costs || !table->previous || !visited || !buffer) {
+        fprintf(stderr, "search_bench: memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < matrix->vertex_length; ++i) {
+        memcpy(table->costs + (i * table->size), table->infinite, table->size);
+        table->previous[i] = IAM_SPECIAL;
+        visited[i] = false;
+    }
+    memcpy(table->costs + (start * table->size), table->zero, table->size);
+
+    // each step scans every vertex' cost for next closest vertex while relaxing its neighbors
+    char * minimum = buffer, * sum = buffer + table->size;
+    memcpy(minimum, table->zero, table->size);
+    for (size_t i = 0, v = start; i < matrix->vertex_length - 1 && end != v && IAM_SPECIAL != v; ++i) {
+        void const * v_cost = table->costs + (v * table->size);
+        size_t next = IAM_SPECIAL;
+        memcpy(minimum, table->infinite, table->size);
+        visited[v] = true;
+
+        size_t const v_off = (v * (v - 1)) / 2;
+        for (size_t j = 0; j < matrix->vertex_length - 1; j++) {
+            size_t const u = (j < v) ? j : j + 1;
+            size_t const e = v <= j ? ((j * (j + 1)) / 2) + v : v_off + j;
+            if (visited[u]) { continue; }
+
+            void const * edge = matrix->edges + (e * matrix->weight_size);
+            void * g_cost = table->costs + (u * table->size);
+            bool const can_sum = matrix->compare(edge, matrix->none, matrix->ac);
+            memmove(sum, can_sum ? table->sum(table->juggle(sum, edge, table->aj), v_cost, table->as) : table->infinite, table->size);
+
+            if (table->compare(sum, g_cost, table->ac) < 0) {
+                table->previous[u] = v;
+                memcpy(g_cost, sum, table->size);
+            }
+            if (table->compare(minimum, g_cost, table->ac) > 0) {
+                memcpy(minimum, g_cost, table->size);
+                next = u;
+            }
+        }
+        v = next;
+    }
+
+    matrix->allocator->free(visited, matrix->allocator->arg);
+    matrix->allocator->free(buffer, matrix->allocator->arg);
+}
+
+void _search_heap(void const * const graph, table_s * const table, size_t const start, size_t const end) {
+    dijkstra_iam_graph(graph, table, start, end);
+}
+
+void _search_sparse(void const * const graph, table_s * const table, size_t const start, size_t const end) {
+    dijkstra_icsr_graph(graph, table, start, end);
+}
+
+void _search_heap_reuse(void const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    dijkstra_workspace_iam_graph(graph, workspace, start, end);
+}
+
+void _search_sparse_reuse(void const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    dijkstra_workspace_icsr_graph(graph, workspace, start, end);
+}
@@ -0,0 +1,118 @@
+#include <bench.h>
+
+#include <sequence/iqueue.h>
+#include <sequence/ideque.h>
+#include <memory/pool_memory.h>
+#include <dodac.h>
+
+/// @brief Number of elements a producer enqueues before consumer drains them.
+#define SEQUENCE_BENCH_BURST (IQUEUE_CHUNK * 8)
+
+/// @brief Number of drained nodes kept by cached structures.
+#define SEQUENCE_BENCH_CACHE 8
+
+/// @brief Cache line sized element, so chunk nodes are too large for allocator's small size caches.
+struct sequence_bench_element {
+    size_t key;
+    char payload[64 - sizeof(size_t)];
+};
+
+/// @brief Runs producer/consumer bursts on queue, so chunk nodes get drained and allocated again.
+/// @param queue Queue structure to benchmark.
+/// @param length Number of elements to enqueue and dequeue.
+/// @return Checksum of dequeued elements.
+size_t _iqueue_bursts(iqueue_s * const queue, size_t const length);
+
+/// @brief Runs producer/consumer bursts on deque, so chunk nodes get drained and allocated again.
+/// @param deque Deque structure to benchmark.
+/// @param length Number of elements to enqueue and dequeue.
+/// @return Checksum of dequeued elements.
+size_t _ideque_bursts(ideque_s * const deque, size_t const length);
+
+void sequence_bench(size_t const length) {
+    memory_s pool = make_pool_memory();
+
+    iqueue_s queue = create_iqueue(sizeof(struct sequence_bench_element));
+    clock_t start = clock();
+    size_t checksum = _iqueue_bursts(&queue, length);
+    bench_report("iqueue_standard", length, bench_elapsed(start), checksum);
+    destroy_iqueue(&queue, intdst, NULL);
+
+    queue = make_iqueue(sizeof(struct sequence_bench_element), &pool);
+    start = clock();
+    checksum = _iqueue_bursts(&queue, length);
+    bench_report("iqueue_pool", length, bench_elapsed(start), checksum);
+    destroy_iqueue(&queue, intdst, NULL);
+
+    queue = create_iqueue(sizeof(struct sequence_bench_element));
+    cache_iqueue(&queue, SEQUENCE_BENCH_CACHE);
+    start = clock();
+    checksum = _iqueue_bursts(&queue, length);
+    bench_report("iqueue_cache", length, bench_elapsed(start), checksum);
+    destroy_iqueue(&queue, intdst, NULL);
+
+    ideque_s deque = create_ideque(sizeof(struct sequence_bench_element));
+    start = clock();
+    checksum = _ideque_bursts(&deque, length);
+    bench_report("ideque_standard", length, bench_elapsed(start), checksum);
+    destroy_ideque(&deque, intdst, NULL);
+
+    deque = make_ideque(sizeof(struct sequence_bench_element), &pool);
+    start = clock();
+    checksum = _ideque_bursts(&deque, length);
+    bench_report("ideque_pool", length, bench_elapsed(start), checksum);
+    destroy_ideque(&deque, intdst, NULL);
+
+    deque = create_ideque(sizeof(struct sequence_bench_element));
+    cache_ideque(&deque, SEQUENCE_BENCH_CACHE);
+    start = clock();
+    checksum = _ideque_bursts(&deque, length);
+    bench_report("ideque_cache", length, bench_elapsed(start), checksum);
+    destroy_ideque(&deque, intdst, NULL);
+
+    destroy_pool_memory(&pool);
+}
+
+size_t _iqueue_bursts(iqueue_s * const queue, size_t const length) {
+    size_t checksum = 0;
+    for (size_t done = 0; done < length;) {
+        size_t const burst = length - done < SEQUENCE_BENCH_BURST ? length - done : SEQUENCE_BENCH_BURST;
+
+        for (size_t i = 0; i < burst; ++i) {
+            struct sequence_bench_element const element = { .key = done + i, };
+            enqueue_iqueue(queue, &element);
+        }
+
+        for (size_t i = 0; i < burst; ++i) {
+            struct sequence_bench_element element = { 0 };
+            dequeue_iqueue(queue, &element);
+            checksum += element.key;
+        }
+
+        done += burst;
+    }
+
+    return checksum;
+}
+
+size_t _ideque_bursts(ideque_s * const deque, size_t const length) {
+    size_t checksum = 0;
+    for (size_t done = 0; done < length;) {
+        size_t const burst = length - done < SEQUENCE_BENCH_BURST ? length - done : SEQUENCE_BENCH_BURST;
+
+        for (size_t i = 0; i < burst; ++i) {
+            struct sequence_bench_element const element = { .key = done + i, };
+            enqueue_back_ideque(deque, &element);
+        }
+
+        for (size_t i = 0; i < burst; ++i) {
+            struct sequence_bench_element element = { 0 };
+            dequeue_front_ideque(deque, &element);
+            checksum += element.key;
+        }
+
+        done += burst;
+    }
+
+    return checksum;
+}
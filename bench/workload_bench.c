@@ -0,0 +1,469 @@
+#include <bench.h>
+
+#include <sequence/istack.h>
+#include <sequence/iqueue.h>
+#include <sequence/ideque.h>
+#include <list/istraight_list.h>
+#include <list/icircular_list.h>
+#include <list/idouble_list.h>
+#include <tree/irb_tree.h>
+#include <tree/iavl_tree.h>
+#include <tree/ibsearch_tree.h>
+#include <set/irb_set.h>
+#include <set/isc_hash_set.h>
+#include <set/ioa_hash_set.h>
+#include <set/ibitwise_set.h>
+#include <misc/ibinary_heap.h>
+#include <misc/isc_hash_map.h>
+#include <memory/tracking_memory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Storage big enough for any benchmarked container.
+typedef union workload_container {
+    istack_s stack;
+    iqueue_s queue;
+    ideque_s deque;
+    istraight_list_s straight_list;
+    icircular_list_s circular_list;
+    idouble_list_s double_list;
+    irb_tree_s rb_tree;
+    iavl_tree_s avl_tree;
+    ibsearch_tree_s bsearch_tree;
+    irb_set_s rb_set;
+    isc_hash_set_s sc_set;
+    ioa_hash_set_s oa_set;
+    ibitwise_set_s bitwise_set;
+    ibinary_heap_s binary_heap;
+    isc_hash_map_s sc_map;
+} workload_container_u;
+
+/// @brief Uniform view over a container's operations, so every structure runs the same workloads.
+typedef struct workload_adapter {
+    char const * name;
+    bool sequential; // 'false' if inserting sorted keys degenerates structure (unbalanced trees)
+    void (*create)  (workload_container_u * const container, bench_s const * const bench);
+    void (*insert)  (workload_container_u * const container, void const * const element);
+    bool (*contains)(workload_container_u const * const container, void const * const element); // NULL if unsearchable
+    void (*remove)  (workload_container_u * const container, void const * const element, void * const buffer);
+    void (*each)    (workload_container_u const * const container, manage_fn const manage, void * const am);
+    void (*destroy) (workload_container_u * const container);
+} workload_adapter_s;
+
+/// @brief Runs every workload on a single container.
+/// @param bench Benchmark settings.
+/// @param adapter Container's adapter.
+/// @param sorted Elements with sorted keys from zero to length - 1.
+/// @param shuffled Elements with shuffled keys from zero to length - 1.
+/// @param misses Elements with shuffled keys from length to 2 * length - 1.
+/// @param buffer Buffer to save removed elements into.
+void _workload_run(bench_s const * const bench, workload_adapter_s const * const adapter,
+    char const * const sorted, char const * const shuffled, char const * const misses, char * const buffer);
+
+/// @brief Prints workload result as 'container_workload'.
+/// @param bench Benchmark settings.
+/// @param adapter Container's adapter.
+/// @param workload Name of workload.
+/// @param start Clock value at start of workload.
+/// @param checksum Value derived from workload results.
+void _workload_report(bench_s const * const bench, workload_adapter_s const * const adapter, char const * const workload, clock_t const start, size_t const checksum);
+
+// stack adapter, removes last pushed element
+void _workload_istack_create(workload_container_u * const container, bench_s const * const bench) {
+    container->stack = make_istack(bench->size, bench->tracking);
+}
+void _workload_istack_insert(workload_container_u * const container, void const * const element) {
+    push_istack(&(container->stack), element);
+}
+void _workload_istack_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    pop_istack(&(container->stack), buffer);
+}
+void _workload_istack_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_istack(&(container->stack), manage, am);
+}
+void _workload_istack_destroy(workload_container_u * const container) {
+    destroy_istack(&(container->stack), bench_destroy, NULL);
+}
+
+// queue adapter, removes first enqueued element
+void _workload_iqueue_create(workload_container_u * const container, bench_s const * const bench) {
+    container->queue = make_iqueue(bench->size, bench->tracking);
+}
+void _workload_iqueue_insert(workload_container_u * const container, void const * const element) {
+    enqueue_iqueue(&(container->queue), element);
+}
+void _workload_iqueue_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    dequeue_iqueue(&(container->queue), buffer);
+}
+void _workload_iqueue_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_iqueue(&(container->queue), manage, am);
+}
+void _workload_iqueue_destroy(workload_container_u * const container) {
+    destroy_iqueue(&(container->queue), bench_destroy, NULL);
+}
+
+// deque adapter, enqueues to back and dequeues from front
+void _workload_ideque_create(workload_container_u * const container, bench_s const * const bench) {
+    container->deque = make_ideque(bench->size, bench->tracking);
+}
+void _workload_ideque_insert(workload_container_u * const container, void const * const element) {
+    enqueue_back_ideque(&(container->deque), element);
+}
+void _workload_ideque_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    dequeue_front_ideque(&(container->deque), buffer);
+}
+void _workload_ideque_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_front_ideque(&(container->deque), manage, am);
+}
+void _workload_ideque_destroy(workload_container_u * const container) {
+    destroy_ideque(&(container->deque), bench_destroy, NULL);
+}
+
+// straight list adapter, inserts and removes at head since any other index is a linear walk
+void _workload_istraight_list_create(workload_container_u * const container, bench_s const * const bench) {
+    container->straight_list = make_istraight_list(bench->size, bench->tracking);
+}
+void _workload_istraight_list_insert(workload_container_u * const container, void const * const element) {
+    insert_at_istraight_list(&(container->straight_list), element, 0);
+}
+void _workload_istraight_list_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    remove_at_istraight_list(&(container->straight_list), 0, buffer);
+}
+void _workload_istraight_list_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_istraight_list(&(container->straight_list), manage, am);
+}
+void _workload_istraight_list_destroy(workload_container_u * const container) {
+    destroy_istraight_list(&(container->straight_list), bench_destroy, NULL);
+}
+
+// circular list adapter, inserts and removes at head since any other index is a linear walk
+void _workload_icircular_list_create(workload_container_u * const container, bench_s const * const bench) {
+    container->circular_list = make_icircular_list(bench->size, bench->tracking);
+}
+void _workload_icircular_list_insert(workload_container_u * const container, void const * const element) {
+    insert_at_icircular_list(&(container->circular_list), element, 0);
+}
+void _workload_icircular_list_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    remove_at_icircular_list(&(container->circular_list), 0, buffer);
+}
+void _workload_icircular_list_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_icircular_list(&(container->circular_list), manage, am);
+}
+void _workload_icircular_list_destroy(workload_container_u * const container) {
+    destroy_icircular_list(&(container->circular_list), bench_destroy, NULL);
+}
+
+// double list adapter, inserts and removes at head since any other index is a linear walk
+void _workload_idouble_list_create(workload_container_u * const container, bench_s const * const bench) {
+    container->double_list = make_idouble_list(bench->size, bench->tracking);
+}
+void _workload_idouble_list_insert(workload_container_u * const container, void const * const element) {
+    insert_at_idouble_list(&(container->double_list), element, 0);
+}
+void _workload_idouble_list_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    remove_at_idouble_list(&(container->double_list), 0, buffer);
+}
+void _workload_idouble_list_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_next_idouble_list(&(container->double_list), manage, am);
+}
+void _workload_idouble_list_destroy(workload_container_u * const container) {
+    destroy_idouble_list(&(container->double_list), bench_destroy, NULL);
+}
+
+// red-black tree adapter
+void _workload_irb_tree_create(workload_container_u * const container, bench_s const * const bench) {
+    container->rb_tree = make_irb_tree(bench->size, bench_compare, NULL, bench->tracking);
+}
+void _workload_irb_tree_insert(workload_container_u * const container, void const * const element) {
+    insert_irb_tree(&(container->rb_tree), element);
+}
+bool _workload_irb_tree_contains(workload_container_u const * const container, void const * const element) {
+    return contains_irb_tree(&(container->rb_tree), element);
+}
+void _workload_irb_tree_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_irb_tree(&(container->rb_tree), element, buffer);
+}
+void _workload_irb_tree_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    in_order_irb_tree(&(container->rb_tree), manage, am);
+}
+void _workload_irb_tree_destroy(workload_container_u * const container) {
+    destroy_irb_tree(&(container->rb_tree), bench_destroy, NULL);
+}
+
+// AVL tree adapter
+void _workload_iavl_tree_create(workload_container_u * const container, bench_s const * const bench) {
+    container->avl_tree = make_iavl_tree(bench->size, bench_compare, NULL, bench->tracking);
+}
+void _workload_iavl_tree_insert(workload_container_u * const container, void const * const element) {
+    insert_iavl_tree(&(container->avl_tree), element);
+}
+bool _workload_iavl_tree_contains(workload_container_u const * const container, void const * const element) {
+    return contains_iavl_tree(&(container->avl_tree), element);
+}
+void _workload_iavl_tree_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_iavl_tree(&(container->avl_tree), element, buffer);
+}
+void _workload_iavl_tree_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    in_order_iavl_tree(&(container->avl_tree), manage, am);
+}
+void _workload_iavl_tree_destroy(workload_container_u * const container) {
+    destroy_iavl_tree(&(container->avl_tree), bench_destroy, NULL);
+}
+
+// binary search tree adapter
+void _workload_ibsearch_tree_create(workload_container_u * const container, bench_s const * const bench) {
+    container->bsearch_tree = make_ibsearch_tree(bench->size, bench_compare, NULL, bench->tracking);
+}
+void _workload_ibsearch_tree_insert(workload_container_u * const container, void const * const element) {
+    insert_ibsearch_tree(&(container->bsearch_tree), element);
+}
+bool _workload_ibsearch_tree_contains(workload_container_u const * const container, void const * const element) {
+    return contains_ibsearch_tree(&(container->bsearch_tree), element);
+}
+void _workload_ibsearch_tree_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_ibsearch_tree(&(container->bsearch_tree), element, buffer);
+}
+void _workload_ibsearch_tree_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    in_order_ibsearch_tree(&(container->bsearch_tree), manage, am);
+}
+void _workload_ibsearch_tree_destroy(workload_container_u * const container) {
+    destroy_ibsearch_tree(&(container->bsearch_tree), bench_destroy, NULL);
+}
+
+// red-black set adapter
+void _workload_irb_set_create(workload_container_u * const container, bench_s const * const bench) {
+    container->rb_set = make_irb_set(bench->size, bench_compare, NULL, bench->tracking);
+}
+void _workload_irb_set_insert(workload_container_u * const container, void const * const element) {
+    insert_irb_set(&(container->rb_set), element);
+}
+bool _workload_irb_set_contains(workload_container_u const * const container, void const * const element) {
+    return contains_irb_set(&(container->rb_set), element);
+}
+void _workload_irb_set_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_irb_set(&(container->rb_set), element, buffer);
+}
+void _workload_irb_set_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_irb_set(&(container->rb_set), manage, am);
+}
+void _workload_irb_set_destroy(workload_container_u * const container) {
+    destroy_irb_set(&(container->rb_set), bench_destroy, NULL);
+}
+
+// separate chaining hash set adapter
+void _workload_isc_hash_set_create(workload_container_u * const container, bench_s const * const bench) {
+    container->sc_set = make_isc_hash_set(bench->size, bench_hash, NULL, bench_compare, NULL, bench->tracking);
+}
+void _workload_isc_hash_set_insert(workload_container_u * const container, void const * const element) {
+    insert_isc_hash_set(&(container->sc_set), element);
+}
+bool _workload_isc_hash_set_contains(workload_container_u const * const container, void const * const element) {
+    return contains_isc_hash_set(&(container->sc_set), element);
+}
+void _workload_isc_hash_set_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_isc_hash_set(&(container->sc_set), element, buffer);
+}
+void _workload_isc_hash_set_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_isc_hash_set(&(container->sc_set), manage, am);
+}
+void _workload_isc_hash_set_destroy(workload_container_u * const container) {
+    destroy_isc_hash_set(&(container->sc_set), bench_destroy, NULL);
+}
+
+// open addressing hash set adapter
+void _workload_ioa_hash_set_create(workload_container_u * const container, bench_s const * const bench) {
+    container->oa_set = make_ioa_hash_set(bench->size, bench_hash, NULL, bench_compare, NULL, bench->tracking);
+}
+void _workload_ioa_hash_set_insert(workload_container_u * const container, void const * const element) {
+    insert_ioa_hash_set(&(container->oa_set), element);
+}
+bool _workload_ioa_hash_set_contains(workload_container_u const * const container, void const * const element) {
+    return contains_ioa_hash_set(&(container->oa_set), element);
+}
+void _workload_ioa_hash_set_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_ioa_hash_set(&(container->oa_set), element, buffer);
+}
+void _workload_ioa_hash_set_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_ioa_hash_set(&(container->oa_set), manage, am);
+}
+void _workload_ioa_hash_set_destroy(workload_container_u * const container) {
+    destroy_ioa_hash_set(&(container->oa_set), bench_destroy, NULL);
+}
+
+// bitwise set adapter, stores element keys as indexes and ignores element size
+void _workload_ibitwise_set_create(workload_container_u * const container, bench_s const * const bench) {
+    container->bitwise_set = make_ibitwise_set(bench->tracking);
+}
+void _workload_ibitwise_set_insert(workload_container_u * const container, void const * const element) {
+    insert_ibitwise_set(&(container->bitwise_set), bench_key(element));
+}
+bool _workload_ibitwise_set_contains(workload_container_u const * const container, void const * const element) {
+    return contains_ibitwise_set(&(container->bitwise_set), bench_key(element));
+}
+void _workload_ibitwise_set_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    remove_ibitwise_set(&(container->bitwise_set), bench_key(element));
+    memcpy(buffer, element, sizeof(size_t));
+}
+void _workload_ibitwise_set_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_index_ibitwise_set(&(container->bitwise_set), manage, am);
+}
+void _workload_ibitwise_set_destroy(workload_container_u * const container) {
+    destroy_ibitwise_set(&(container->bitwise_set));
+}
+
+// binary heap adapter, removes smallest element
+void _workload_ibinary_heap_create(workload_container_u * const container, bench_s const * const bench) {
+    container->binary_heap = make_ibinary_heap(bench->size, bench_compare, NULL, bench->tracking);
+}
+void _workload_ibinary_heap_insert(workload_container_u * const container, void const * const element) {
+    push_ibinary_heap(&(container->binary_heap), element);
+}
+void _workload_ibinary_heap_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    (void)(element);
+    pop_ibinary_heap(&(container->binary_heap), buffer);
+}
+void _workload_ibinary_heap_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_ibinary_heap(&(container->binary_heap), manage, am);
+}
+void _workload_ibinary_heap_destroy(workload_container_u * const container) {
+    destroy_ibinary_heap(&(container->binary_heap), bench_destroy, NULL);
+}
+
+// separate chaining hash map adapter, maps each element to its key
+void _workload_isc_hash_map_create(workload_container_u * const container, bench_s const * const bench) {
+    container->sc_map = make_isc_hash_map(bench->size, sizeof(size_t), bench_hash, NULL, bench_compare, NULL, bench->tracking);
+}
+void _workload_isc_hash_map_insert(workload_container_u * const container, void const * const element) {
+    size_t const value = bench_key(element);
+    insert_isc_hash_map(&(container->sc_map), element, &value);
+}
+bool _workload_isc_hash_map_contains(workload_container_u const * const container, void const * const element) {
+    return contains_key_isc_hash_map(&(container->sc_map), element);
+}
+void _workload_isc_hash_map_remove(workload_container_u * const container, void const * const element, void * const buffer) {
+    size_t value = 0;
+    remove_isc_hash_map(&(container->sc_map), element, buffer, &value);
+}
+void _workload_isc_hash_map_each(workload_container_u const * const container, manage_fn const manage, void * const am) {
+    each_key_isc_hash_map(&(container->sc_map), manage, am);
+}
+void _workload_isc_hash_map_destroy(workload_container_u * const container) {
+    destroy_isc_hash_map(&(container->sc_map), bench_destroy, NULL, bench_destroy, NULL);
+}
+
+void workload_bench(bench_s const * const bench) {
+    workload_adapter_s const adapters[] = {
+        { "istack", true, _workload_istack_create, _workload_istack_insert, NULL, _workload_istack_remove, _workload_istack_each, _workload_istack_destroy, },
+        { "iqueue", true, _workload_iqueue_create, _workload_iqueue_insert, NULL, _workload_iqueue_remove, _workload_iqueue_each, _workload_iqueue_destroy, },
+        { "ideque", true, _workload_ideque_create, _workload_ideque_insert, NULL, _workload_ideque_remove, _workload_ideque_each, _workload_ideque_destroy, },
+        { "istraight_list", true, _workload_istraight_list_create, _workload_istraight_list_insert, NULL, _workload_istraight_list_remove, _workload_istraight_list_each, _workload_istraight_list_destroy, },
+        { "icircular_list", true, _workload_icircular_list_create, _workload_icircular_list_insert, NULL, _workload_icircular_list_remove, _workload_icircular_list_each, _workload_icircular_list_destroy, },
+        { "idouble_list", true, _workload_idouble_list_create, _workload_idouble_list_insert, NULL, _workload_idouble_list_remove, _workload_idouble_list_each, _workload_idouble_list_destroy, },
+        { "irb_tree", true, _workload_irb_tree_create, _workload_irb_tree_insert, _workload_irb_tree_contains, _workload_irb_tree_remove, _workload_irb_tree_each, _workload_irb_tree_destroy, },
+        { "iavl_tree", true, _workload_iavl_tree_create, _workload_iavl_tree_insert, _workload_iavl_tree_contains, _workload_iavl_tree_remove, _workload_iavl_tree_each, _workload_iavl_tree_destroy, },
+        { "ibsearch_tree", false, _workload_ibsearch_tree_create, _workload_ibsearch_tree_insert, _workload_ibsearch_tree_contains, _workload_ibsearch_tree_remove, _workload_ibsearch_tree_each, _workload_ibsearch_tree_destroy, },
+        { "irb_set", true, _workload_irb_set_create, _workload_irb_set_insert, _workload_irb_set_contains, _workload_irb_set_remove, _workload_irb_set_each, _workload_irb_set_destroy, },
+        { "isc_hash_set", true, _workload_isc_hash_set_create, _workload_isc_hash_set_insert, _workload_isc_hash_set_contains, _workload_isc_hash_set_remove, _workload_isc_hash_set_each, _workload_isc_hash_set_destroy, },
+        { "ioa_hash_set", true, _workload_ioa_hash_set_create, _workload_ioa_hash_set_insert, _workload_ioa_hash_set_contains, _workload_ioa_hash_set_remove, _workload_ioa_hash_set_each, _workload_ioa_hash_set_destroy, },
+        { "ibitwise_set", true, _workload_ibitwise_set_create, _workload_ibitwise_set_insert, _workload_ibitwise_set_contains, _workload_ibitwise_set_remove, _workload_ibitwise_set_each, _workload_ibitwise_set_destroy, },
+        { "ibinary_heap", true, _workload_ibinary_heap_create, _workload_ibinary_heap_insert, NULL, _workload_ibinary_heap_remove, _workload_ibinary_heap_each, _workload_ibinary_heap_destroy, },
+        { "isc_hash_map", true, _workload_isc_hash_map_create, _workload_isc_hash_map_insert, _workload_isc_hash_map_contains, _workload_isc_hash_map_remove, _workload_isc_hash_map_each, _workload_isc_hash_map_destroy, },
+    };
+
+    size_t state = (size_t)(0x9E3779B97F4A7C15ull);
+    size_t * const sorted_keys = bench_keys(0, bench->length, NULL);
+    size_t * const shuffled_keys = bench_keys(0, bench->length, &state);
+    size_t * const miss_keys = bench_keys(bench->length, bench->length, &state);
+    char * const sorted = sorted_keys ? bench_elements(bench, sorted_keys, bench->length) : NULL;
+    char * const shuffled = shuffled_keys ? bench_elements(bench, shuffled_keys, bench->length) : NULL;
+    char * const misses = miss_keys ? bench_elements(bench, miss_keys, bench->length) : NULL;
+    char * const buffer = malloc(bench->size);
+
+    if (sorted && shuffled && misses && buffer) {
+        for (size_t i = 0; i < sizeof(adapters) / sizeof(adapters[0]); ++i) {
+            _workload_run(bench, adapters + i, sorted, shuffled, misses, buffer);
+        }
+    } else {
+        fprintf(stderr, "workload_bench: memory allocation failed\n");
+    }
+
+    free(sorted_keys); free(shuffled_keys); free(miss_keys);
+    free(sorted); free(shuffled); free(misses); free(buffer);
+}
+
+void _workload_run(bench_s const * const bench, workload_adapter_s const * const adapter,
+    char const * const sorted, char const * const shuffled, char const * const misses, char * const buffer) {
+    workload_container_u container;
+    size_t const length = bench->length, size = bench->size;
+
+    if (adapter->sequential) {
+        adapter->create(&container, bench);
+        reset_tracking_memory(bench->tracking);
+        clock_t const start = clock();
+        for (size_t i = 0; i < length; ++i) {
+            adapter->insert(&container, sorted + (i * size));
+        }
+        _workload_report(bench, adapter, "insert_sequential", start, length);
+        adapter->destroy(&container);
+    }
+
+    adapter->create(&container, bench);
+    reset_tracking_memory(bench->tracking);
+    clock_t start = clock();
+    for (size_t i = 0; i < length; ++i) {
+        adapter->insert(&container, shuffled + (i * size));
+    }
+    _workload_report(bench, adapter, "insert_random", start, length);
+
+    if (adapter->contains) {
+        // shuffled keys are looked up in reverse, so hits don't follow insertion order
+        size_t checksum = 0;
+        reset_tracking_memory(bench->tracking);
+        start = clock();
+        for (size_t i = length; i; --i) {
+            checksum += adapter->contains(&container, shuffled + ((i - 1) * size));
+        }
+        _workload_report(bench, adapter, "lookup_hit", start, checksum);
+
+        checksum = 0;
+        reset_tracking_memory(bench->tracking);
+        start = clock();
+        for (size_t i = 0; i < length; ++i) {
+            checksum += adapter->contains(&container, misses + (i * size));
+        }
+        _workload_report(bench, adapter, "lookup_miss", start, checksum);
+    }
+
+    size_t checksum = 0;
+    reset_tracking_memory(bench->tracking);
+    start = clock();
+    adapter->each(&container, bench_sum, &checksum);
+    _workload_report(bench, adapter, "iterate", start, checksum);
+
+    checksum = 0;
+    reset_tracking_memory(bench->tracking);
+    start = clock();
+    for (size_t i = 0; i < length; ++i) {
+        adapter->remove(&container, sorted + (i * size), buffer); // ignored by structures that remove their next element
+        checksum += bench_key(buffer);
+    }
+    _workload_report(bench, adapter, "remove", start, checksum);
+
+    adapter->destroy(&container);
+}
+
+void _workload_report(bench_s const * const bench, workload_adapter_s const * const adapter, char const * const workload, clock_t const start, size_t const checksum) {
+    double const elapsed = bench_elapsed(start);
+
+    char name[64] = { 0 };
+    snprintf(name, sizeof(name), "%s_%s", adapter->name, workload);
+    bench_track(name, bench->length, elapsed, bench->tracking, checksum);
+}
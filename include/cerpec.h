@@ -16,6 +16,23 @@
 #   error "Chunk size must be a power of 2."
 #endif
 
+// define number of keys hashed and prefetched at once by batched lookups
+#if !defined(CERPEC_BATCH)
+#   define CERPEC_BATCH 16
+#elif CERPEC_BATCH <= 0
+#   error "Batch size must be greater than zero."
+#endif
+
+// define prefetch hint to pull memory into cache before it's accessed (does nothing if unsupported)
+#if defined(__GNUC__) || defined(__clang__)
+#   define prefetch(address) __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#   include <xmmintrin.h>
+#   define prefetch(address) _mm_prefetch((char const *)(address), _MM_HINT_T0)
+#else
+#   define prefetch(address) (void)(address)
+#endif
+
 #ifdef NDEBUG
 #   define NVALID
 #   define NERROR
@@ -55,9 +72,48 @@ memory_s compose_memory(alloc_fn const alloc, realloc_fn const realloc, free_fn
 /// @brief Cerpec's default standard memory allocator (just malloc, realloc and free).
 extern const memory_s standard;
 
+/// @brief Growth and shrink policy of infinite structures that keep elements in resizable arrays.
+typedef struct growth {
+    size_t factor; // full structure's capacity expands to its length times factor
+    size_t chunk;  // capacity of first expansion, non-empty structure won't shrink if its length is at most chunk
+    size_t shrink; // structure shrinks once length drops to capacity / shrink, zero never shrinks
+} growth_s;
+
+// default growth policy with minimum chunk, doubles capacity and shrinks when half empty
+#define CERPEC_GROWTH(minimum) ((growth_s) { .factor = CERPEC_FACTOR, .chunk = (minimum), .shrink = CERPEC_FACTOR, })
+
+/// @brief Compose custom growth policy structure.
+/// @param factor Multiplier of full structure's length on expansion, must be greater than one.
+/// @param chunk Capacity of first expansion, must be greater than zero.
+/// @param shrink Divisor of capacity at which structure shrinks, either zero to never shrink or at least factor.
+/// @return Growth policy structure.
+/// @note Shrunk capacity is length * shrink / factor, so a shrink larger than factor leaves room to grow before
+/// expanding again and avoids thrashing when length oscillates around the boundary.
+growth_s compose_growth(size_t const factor, size_t const chunk, size_t const shrink);
+
+/// @brief Calculates capacity of full structure after expansion.
+/// @param growth Growth policy of structure.
+/// @param length Current length of full structure.
+/// @return Expanded capacity.
+size_t expand_growth(growth_s const * const growth, size_t const length);
+
+/// @brief Calculates capacity of structure after removal.
+/// @param growth Growth policy of structure.
+/// @param length Current length of structure.
+/// @param capacity Current capacity of structure.
+/// @return Shrunk capacity, or same capacity if structure shouldn't shrink.
+size_t shrink_growth(growth_s const * const growth, size_t const length, size_t const capacity);
+
+/// @brief Bucket indexing modes for separate chaining hash structures.
+typedef enum bucket_index {
+    MODULO_INDEX = 0, // hash value modulo bucket count, works for any bucket count
+    MASK_INDEX,       // mixed hash value masked by power of two bucket count, avoids integer division
+} index_e;
+
 typedef void   (*set_fn)     (void * const element, void * arg);
 typedef void * (*copy_fn)    (void * const destination, void const * const source, void * arg);
 typedef size_t (*hash_fn)    (void const * const element, void * arg);
+typedef size_t (*key_fn)     (void const * const element, void * arg);
 typedef int    (*compare_fn) (void const * const a, void const * const b, void * arg);
 typedef bool   (*filter_fn)  (void const * const element, void * arg);
 typedef bool   (*manage_fn)  (void * const element, void * arg);
@@ -122,6 +122,8 @@ size_t inthshsame(void const * const element, void * arg);
 
 size_t inthshmurmur(void const * const element, void * arg);
 
+size_t intkey(void const * const element, void * arg);
+
 int intcmp(void const * const a, void const * const b, void * arg);
 
 int intrcmp(void const * const a, void const * const b, void * arg);
@@ -150,6 +152,8 @@ void * uintsum(void * const sum, void const * const addent, void * arg);
 
 size_t uinthshsame(void const * const element, void * arg);
 
+size_t uintkey(void const * const element, void * arg);
+
 int uintcmp(void const * const a, void const * const b, void * arg);
 
 int uintrcmp(void const * const a, void const * const b, void * arg);
@@ -3,6 +3,7 @@
 
 #include <cerpec.h>
 #include <graph/table.h>
+#include <graph/workspace.h>
 
 #if !defined(IAM_GRAPH_CHUNK)
 #   define IAM_GRAPH_CHUNK CERPEC_CHUNK
@@ -14,6 +15,34 @@
 
 #define IAM_SPECIAL ((size_t)(-1))
 
+// parallel breadth first search switches to bottom-up once frontier's edges exceed unexplored ones divided by alpha
+#if !defined(IAM_GRAPH_ALPHA)
+#   define IAM_GRAPH_ALPHA 14
+#elif IAM_GRAPH_ALPHA <= 0
+#   error "Alpha must be greater than zero."
+#endif
+
+// parallel breadth first search switches back to top-down once frontier has less than vertices divided by beta
+#if !defined(IAM_GRAPH_BETA)
+#   define IAM_GRAPH_BETA 24
+#elif IAM_GRAPH_BETA <= 0
+#   error "Beta must be greater than zero."
+#endif
+
+// filter Kruskal sorts edge partitions of at most this many edges instead of partitioning them further
+#if !defined(IAM_GRAPH_FILTER)
+#   define IAM_GRAPH_FILTER 64
+#elif IAM_GRAPH_FILTER <= 0
+#   error "Filter size must be greater than zero."
+#endif
+
+// all pairs shortest paths relax square tiles of this many vertices, so three tiles of int costs fit in L1 cache
+#if !defined(IAM_GRAPH_TILE)
+#   define IAM_GRAPH_TILE 64
+#elif IAM_GRAPH_TILE <= 0
+#   error "Tile size must be greater than zero."
+#endif
+
 /// @brief Infinte adjacency matrix graph data structure.
 typedef struct infinite_adjacency_matrix_graph {
     char * vertices, * edges; // arrays of vertices and edges
@@ -22,6 +51,7 @@ typedef struct infinite_adjacency_matrix_graph {
     void * ac;
     size_t vertex_size, weight_size; // sizes of single vertex and edge
     size_t vertex_length, edge_length, capacity; // vertex and edge count and graph's vertex capacity
+    growth_s growth;                             // policy to expand and shrink vertex capacity with
     memory_s const * allocator;
     size_t * degrees;
 } iam_graph_s;
@@ -83,6 +113,20 @@ iam_graph_s copy_iam_graph(iam_graph_s const * const graph, copy_fn const copy_v
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_iam_graph(iam_graph_s const * const graph);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param graph Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_iam_graph(iam_graph_s * const graph, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity vertices without reallocating.
+/// @param graph Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_iam_graph(iam_graph_s * const graph, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param graph Structure to shrink.
+void shrink_to_fit_iam_graph(iam_graph_s * const graph);
+
 /// @brief A graph is complete if every distinct pair of vertices is connected by a unique edge.
 /// @param graph Structure to check.
 /// @return 'true' if graph is complete, 'false' otherwise.
@@ -103,7 +147,7 @@ bool is_tree_iam_graph(iam_graph_s const * const graph);
 /// @brief A graph is cyclic if its connected components contain loops.
 /// @param graph Structure to check.
 /// @return 'true' if graph is a cyclic, 'false' otherwise.
-/// @note The algorithm uses DFS to determine circularity.
+/// @note The algorithm joins each edge's vertices in a disjoint set, edge of already joined ones closes a cycle.
 /// Since graph doesn't need to be connected, cycles are checked for all subgraph vertices.
 bool is_cyclic_iam_graph(iam_graph_s const * const graph);
 
@@ -172,6 +216,26 @@ size_t degree_iam_graph(iam_graph_s const * const graph, size_t const index);
 /// @param end Last vertex index, or 'IAM_SPECIAL' if all vertex shortest weightless path.
 void bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
 
+/// @brief Traverses the vertices of the specified structure using direction optimizing breadth first search on threads.
+/// @param graph Structure to traverse.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IAM_SPECIAL' if all vertex shortest weightless path.
+/// @param threads Number of threads, including calling one, that split each level's vertices between themselves.
+/// @note Each level is expanded top-down from frontier or bottom-up from unvisited vertices based on frontier size.
+/// @note Previous vertex is always smallest neighbor on previous level, so table doesn't depend on thread count.
+/// @note Compare and juggle functions are called by many threads at once, but never on the same cost.
+void parallel_bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end, size_t const threads);
+
+/// @brief Traverses the vertices of the specified structure using breadth first search from both start and end.
+/// @param graph Structure to traverse.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index.
+/// @note Level of smaller frontier is expanded until searches meet, then path from meeting vertex to 'end' is
+/// written into table, so 'end' can be traversed back to 'start' like after 'bfs_iam_graph'.
+void bidirectional_bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
 /// @brief Traverses the vertices of the specified structure using depth first search.
 /// @param graph Structure to traverse.
 /// @param table Cost structure that defines the distance properties in table.
@@ -184,8 +248,18 @@ void dfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_
 /// @param start Starting vertex index.
 /// @param end Last vertex index, or 'IAM_SPECIAL' if all vertex shortest path.
 /// @param table Cost structure that defines the distance properties in table.
+/// @note Closest vertex is taken from an indexed binary heap, so search stops as soon as 'end' is closest.
 void dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
 
+/// @brief Generate a Dijkstra lookup array table by searching from both start and end.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index.
+/// @note Search with closer heap top settles its vertex until heap tops' sum reaches shortest path found so far,
+/// then path through its meeting vertex to 'end' is written into table like after 'dijkstra_iam_graph'.
+void bidirectional_dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
 /// @brief Generate an A* lookup array table with nodes' edges and previous indexes.
 /// @param graph Structure to generate from.
 /// @param start Starting vertex index.
@@ -193,6 +267,7 @@ void dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table,
 /// @param table Cost structure that defines the distance properties in table.
 /// @param heuristic Function pointer to calculate heuristic cost based on two vectices.
 /// @param ah Arguments for heuristic function pointer.
+/// @note Vertex with smallest estimate is taken from an indexed binary heap, so search stops as soon as 'end' is.
 void a_star_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end, operate_fn const heuristic, void * const ah);
 
 /// @brief Generate a Prim lookup array table with nodes' edges and previous indexes.
@@ -201,19 +276,97 @@ void a_star_iam_graph(iam_graph_s const * const graph, table_s * const table, si
 /// @param table Cost structure that defines the distance properties in table.
 void prim_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start);
 
-/// @brief Generate a Kruskal lookup array table with nodes' ranks and previous indexes.
+/// @brief Traverses the vertices of the specified structure using breadth first search, reusing workspace.
+/// @param graph Structure to traverse.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IAM_SPECIAL' if all vertex shortest weightless path.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void bfs_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Traverses the vertices of the specified structure using depth first search, reusing workspace.
+/// @param graph Structure to traverse.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IAM_SPECIAL' if all vertex paths.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void dfs_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Generate a Dijkstra lookup array table into workspace, reusing its buffers.
+/// @param graph Structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IAM_SPECIAL' if all vertex shortest path.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void dijkstra_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Generate an A* lookup array table into workspace, reusing its buffers.
+/// @param graph Structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index.
+/// @param heuristic Function pointer to calculate heuristic cost based on two vectices.
+/// @param ah Arguments for heuristic function pointer.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void a_star_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end, operate_fn const heuristic, void * const ah);
+
+/// @brief Generate a Prim lookup array table into workspace, reusing its buffers.
+/// @param graph Structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void prim_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start);
+
+/// @brief Generate a Kruskal lookup array table with spanning forest's costs and previous indexes.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @note Edges are sorted with graph's compare function, each vertex' previous index is root of its set and
+/// root's cost is sum of its spanning tree's edges, while other vertices' costs remain zero.
+void kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table);
+
+/// @brief Generate a Kruskal lookup array table by partitioning edges around pivots and filtering out heavier
+/// edges whose vertices are already connected.
 /// @param graph Structure to generate from.
-/// @param sort Function pointer to sort special array of edge-vertices - 'iam_edge_s', for Kruskal's algorithm.
 /// @param table Cost structure that defines the distance properties in table.
-/// @param as Arguments for sorting function.
-/// @param inc Function pointer to increment rank cost by one.
-/// @param ai Arguments for increment function pointer.
-void kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table, process_fn const sort, void * const as, set_fn const inc, void * const ai);
+/// @note Table is the same as 'kruskal_iam_graph', but only partitions of at most 'IAM_GRAPH_FILTER' edges are
+/// sorted, which skips most edges of dense graphs.
+void filter_kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table);
+
+/// @brief Generate a Kruskal lookup array table by radix sorting edges' integer keys.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param key Function pointer to extract edge weight's unsigned key that keeps weights' order.
+/// @param ak Arguments for key function pointer.
+/// @note Table is the same as 'kruskal_iam_graph', signed or floating point weights must be mapped to keys that
+/// keep their order.
+void radix_kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table, key_fn const key, void * const ak);
+
+/// @brief Generate a Boruvka lookup array table, where threads find each set's cheapest leaving edge in parallel.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param threads Maximum number of threads, including calling one.
+/// @note Table is the same as 'kruskal_iam_graph', equal weights are ordered by their vertex indexes.
+void boruvka_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const threads);
+
+/// @brief Generate an all pairs shortest path table with tiled Floyd-Warshall algorithm.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param threads Maximum number of threads, including calling one.
+/// @note Costs and previous indexes are row-major matrices of vertex length squared, where row 'i' is the table of
+/// a search from vertex 'i', and must be destroyed with 'destroy_all_iam_table'.
+/// @note Edge weights must not be negative, costs summed with 'intsum' or 'doublesum' and compared with 'intcmp'
+/// or 'doublecmp' from 'dodac.h' are relaxed without calling function pointers.
+void floyd_warshall_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const threads);
 
 /// @brief Destroys a structure, and its elements and makes it unusable.
 /// @param table Structure to destroy.
+/// @note Workspace's table is owned by workspace and is destroyed with 'destroy_graph_workspace' instead.
 void destroy_iam_table(table_s * const table);
 
+/// @brief Destroys an all pairs structure, and its elements and makes it unusable.
+/// @param table Structure to destroy.
+void destroy_all_iam_table(table_s * const table);
+
 /// @brief Creates a subgraph copy of specified graph based on its table.
 /// @param table Structure to reference.
 /// @param copy_vertex Function pointer to create a deep/shallow copy of a single vertex element.
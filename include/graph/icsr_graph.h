@@ -0,0 +1,290 @@
+#ifndef ICSR_GRAPH_H
+#define ICSR_GRAPH_H
+
+#include <cerpec.h>
+#include <graph/table.h>
+#include <graph/workspace.h>
+
+#if !defined(ICSR_GRAPH_CHUNK)
+#   define ICSR_GRAPH_CHUNK CERPEC_CHUNK
+#elif ICSR_GRAPH_CHUNK <= 0
+#   error "Chunk size must be greater than zero."
+#elif (ICSR_GRAPH_CHUNK & (ICSR_GRAPH_CHUNK - 1))
+#   error "Chunk size must be a power of 2."
+#endif
+
+#define ICSR_SPECIAL ((size_t)(-1))
+
+/// @brief Infinite compressed sparse row graph data structure.
+/// @note Edges are kept once in insertion order and indexed into rows of neighbors by compaction, edges
+/// inserted after last compaction form a buffer that isn't part of the rows until graph is compacted again.
+typedef struct infinite_compressed_sparse_row_graph {
+    char * vertices, * weights;    // arrays of vertices and edge weights
+    size_t * ends;                 // pairs of vertex indexes for each edge weight
+    size_t * offsets, * adjacency; // compacted row offsets and row's pairs of neighbor vertex and edge indexes
+    size_t * degrees;
+    size_t vertex_size, weight_size; // sizes of single vertex and edge weight
+    size_t vertex_length, edge_length, capacity, edge_capacity; // vertex and edge count, and their capacities
+    size_t row_length, compact_length; // vertex and edge count covered by compacted rows
+    growth_s growth;                   // policy to expand and shrink vertex and edge capacity with
+    memory_s const * allocator;
+} icsr_graph_s;
+
+/// @brief Graph edge represented by its weight and two vertex indexes.
+typedef struct infinite_compressed_sparse_row_graph_edge {
+    char * weight;
+    size_t vertices[2];
+} icsr_edge_s;
+
+/// @brief Creates an empty structure.
+/// @param vertex_size Size of a single vertex element.
+/// @param weight_size Size of a single edge element.
+/// @return Graph structure.
+icsr_graph_s create_icsr_graph(size_t const vertex_size, size_t const weight_size);
+
+/// @brief Creates an empty structure.
+/// @param vertex_size Size of a single vertex element.
+/// @param weight_size Size of a single edge element.
+/// @param allocator Custom allocator structure.
+/// @return Graph structure.
+icsr_graph_s make_icsr_graph(size_t const vertex_size, size_t const weight_size, memory_s const * const allocator);
+
+/// @brief Destroys a structure and its elements, but makes it unusable.
+/// @param graph Structure to destroy.
+/// @param destroy_vertex Function pointer to destroy a single vertex element.
+/// @param adv Arguments for destroy function pointer.
+/// @param destroy_weight Function pointer to destroy a single edge weight element.
+/// @param adw Arguments for destroy function pointer.
+void destroy_icsr_graph(icsr_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw);
+
+/// @brief Clears a structure and destroys its elements, but remains usable.
+/// @param graph Structure to destroy.
+/// @param destroy_vertex Function pointer to destroy a single vertex element.
+/// @param adv Arguments for destroy function pointer.
+/// @param destroy_weight Function pointer to destroy a single edge weight element.
+/// @param adw Arguments for destroy function pointer.
+void clear_icsr_graph(icsr_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw);
+
+/// @brief Creates a copy of a structure and all its elements.
+/// @param graph Structure to copy.
+/// @param copy_vertex Function pointer to create a deep/shallow copy of a single vertex element.
+/// @param acv Arguments for copy vertex function pointer.
+/// @param copy_weight Function pointer to create a deep/shallow copy of a single edge weight element.
+/// @param acw Arguments for copy edge function pointer.
+/// @return Graph structure.
+icsr_graph_s copy_icsr_graph(icsr_graph_s const * const graph, copy_fn const copy_vertex, void * const acv, copy_fn const copy_weight, void * const acw);
+
+/// @brief Checks if structure is empty.
+/// @param graph Structure to check.
+/// @return 'true' if empty, 'false' if not.
+bool is_empty_icsr_graph(icsr_graph_s const * const graph);
+
+/// @brief Checks if every vertex and edge in structure is part of its compacted rows.
+/// @param graph Structure to check.
+/// @return 'true' if compact, 'false' if not.
+bool is_compact_icsr_graph(icsr_graph_s const * const graph);
+
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param graph Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_icsr_graph(icsr_graph_s * const graph, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity vertices without reallocating.
+/// @param graph Structure to reserve capacity for.
+/// @param capacity Minimum vertex capacity.
+/// @param edge_capacity Minimum edge capacity.
+void reserve_icsr_graph(icsr_graph_s * const graph, size_t const capacity, size_t const edge_capacity);
+
+/// @brief Shrinks structure's capacities to its lengths, freeing unused memory.
+/// @param graph Structure to shrink.
+void shrink_to_fit_icsr_graph(icsr_graph_s * const graph);
+
+/// @brief Compacts inserted edges into rows of neighbors sorted by vertex index.
+/// @param graph Structure to compact.
+/// @note Compaction rebuilds all rows in linear time and must be done before traversing or searching graph.
+void compact_icsr_graph(icsr_graph_s * const graph);
+
+/// @brief Inserts a single vertex element into the structure.
+/// @param graph Structure to insert into.
+/// @param vertex Element buffer to insert.
+/// @return Index of element in vertex array.
+size_t insert_vertex_icsr_graph(icsr_graph_s * const graph, void const * const vertex);
+
+/// @brief Remove specified vertex element at index from structure.
+/// @param graph Structure to remove from.
+/// @param index Index location of vertex.
+/// @param buffer Element buffer to save vertex.
+/// @param destroy_weight Function pointer to destroy single edge weight element associated wtih removed vertex.
+/// @param adw Arguments for destroy function pointer.
+/// @return Index of last swapped element in vertex array.
+/// @note The last vertex in elements array (including its edges) gets swapped with the removed index vertex.
+size_t remove_vertex_icsr_graph(icsr_graph_s * const graph, size_t const index, void * const buffer, set_fn const destroy_weight, void * const adw);
+
+/// @brief Gets the vertex element at index in structure.
+/// @param graph Structure to get from.
+/// @param index Index location of vertex.
+/// @param buffer Element buffer to save vertex.
+void get_vertex_icsr_graph(icsr_graph_s const * const graph, size_t const index, void * const buffer);
+
+/// @brief Inserts a single edge weight element into the structure's edge buffer.
+/// @param graph Structure to insert into.
+/// @param index_one Index location of first vertex.
+/// @param index_two Index location of second vertex.
+/// @param weight Element buffer to insert.
+/// @note An edge between vertices mustn't exist yet, parallel edges are detected on compaction.
+void insert_weight_icsr_graph(icsr_graph_s * const graph, size_t const index_one, size_t const index_two, void const * const weight);
+
+/// @brief Remove specified edge weight element at vertex indices from structure.
+/// @param graph Structure to remove from.
+/// @param index_one Index location of first vertex.
+/// @param index_two Index location of second vertex.
+/// @param buffer Element buffer to save removed.
+/// @note Removal uncompacts structure.
+void remove_weight_icsr_graph(icsr_graph_s * const graph, size_t const index_one, size_t const index_two, void * const buffer);
+
+/// @brief Checks if edge weight exists between two vertices.
+/// @param graph Structure to check.
+/// @param index_one Index location of first vertex.
+/// @param index_two Index location of second vertex.
+/// @return 'true' if an edge exists, 'false' otherwise.
+bool contains_weight_icsr_graph(icsr_graph_s const * const graph, size_t const index_one, size_t const index_two);
+
+/// @brief Gets the edge weight element at vertex indices in structure.
+/// @param graph Structure to get from.
+/// @param index_one First vertex index of edge.
+/// @param index_two Second vertex index of edge.
+/// @param buffer Element buffer to save edge.
+void get_weight_icsr_graph(icsr_graph_s const * const graph, size_t const index_one, size_t const index_two, void * const buffer);
+
+/// @brief Calculates the number of edges that are incident to the vertex index.
+/// @param graph Structure to get from.
+/// @param index Vertex index.
+/// @return Degree of vertex.
+size_t degree_icsr_graph(icsr_graph_s const * const graph, size_t const index);
+
+/// @brief Traverses the vertices of the specified structure using breadth first search.
+/// @param graph Compacted structure to traverse.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'ICSR_SPECIAL' if all vertex shortest weightless path.
+void bfs_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Traverses the vertices of the specified structure using depth first search.
+/// @param graph Compacted structure to traverse.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'ICSR_SPECIAL' if all vertex paths.
+void dfs_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Generate a Dijkstra lookup array table with nodes' edge sums and previous indexes.
+/// @param graph Compacted structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'ICSR_SPECIAL' if all vertex shortest path.
+/// @note Vertices are visited in order of a binary heap, making the search O((V + E) log V).
+void dijkstra_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Generate an A* lookup array table with nodes' edges and previous indexes.
+/// @param graph Compacted structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index.
+/// @param heuristic Function pointer to calculate heuristic cost based on two vectices.
+/// @param ah Arguments for heuristic function pointer.
+void a_star_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end, operate_fn const heuristic, void * const ah);
+
+/// @brief Generate a Prim lookup array table with nodes' edges and previous indexes.
+/// @param graph Compacted structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+void prim_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start);
+
+/// @brief Traverses the vertices of the specified structure using breadth first search, reusing workspace.
+/// @param graph Compacted structure to traverse.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'ICSR_SPECIAL' if all vertex shortest weightless path.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void bfs_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Traverses the vertices of the specified structure using depth first search, reusing workspace.
+/// @param graph Compacted structure to traverse.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'ICSR_SPECIAL' if all vertex paths.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void dfs_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Generate a Dijkstra lookup array table into workspace, reusing its buffers.
+/// @param graph Compacted structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'ICSR_SPECIAL' if all vertex shortest path.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void dijkstra_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Generate an A* lookup array table into workspace, reusing its buffers.
+/// @param graph Compacted structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index.
+/// @param heuristic Function pointer to calculate heuristic cost based on two vectices.
+/// @param ah Arguments for heuristic function pointer.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void a_star_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end, operate_fn const heuristic, void * const ah);
+
+/// @brief Generate a Prim lookup array table into workspace, reusing its buffers.
+/// @param graph Compacted structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void prim_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start);
+
+/// @brief Generate a Kruskal lookup array table with spanning forest's costs and previous indexes.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @note Edges are juggled into costs and sorted with table's compare function, each vertex' previous index is
+/// root of its set and root's cost is sum of its spanning tree's edges, while other vertices' costs remain zero.
+void kruskal_icsr_graph(icsr_graph_s const * const graph, table_s * const table);
+
+/// @brief Destroys a structure, and its elements and makes it unusable.
+/// @param table Structure to destroy.
+/// @note Workspace's table is owned by workspace and is destroyed with 'destroy_graph_workspace' instead.
+void destroy_icsr_table(table_s * const table);
+
+/// @brief Iterates over each vertex element in structure starting from the beginning.
+/// @param graph Structure to iterate.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Arguments for handle function pointer.
+void each_vertex_icsr_graph(icsr_graph_s const * const graph, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each edge element in structure in insertion order.
+/// @param graph Structure to iterate.
+/// @param manage Function pointer to handle each edge-vertices (icsr_edge_s) element reference using generic arguments.
+/// @param am Arguments for handle function pointer.
+void each_edge_icsr_graph(icsr_graph_s const * const graph, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each neighbor of a vertex index in ascending index order.
+/// @param graph Compacted structure to iterate.
+/// @param index Index of vertex to iterate neighbors.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Arguments for handle function pointer.
+void each_neighbor_icsr_graph(icsr_graph_s const * const graph, size_t const index, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each cost element in structure starting from the beginning.
+/// @param table Structure to iterate.
+/// @param manage Operate function pointer to operate on each vertex.
+/// @param am Arguments for handle function pointer.
+void each_cost_icsr_graph(table_s const * const table, manage_fn const manage, void * const am);
+
+/// @brief Traverses the costs paths of the specified structure using a generated table.
+/// @param table Structure to traverse.
+/// @param end End vertex index to recursively travel to from starting vertex.
+/// @param manage Operate function pointer to operate on each vertex.
+/// @param am Arguments for handle function pointer.
+/// @return 'true' if path exists, 'false' otherwise.
+/// @note The algorithm should be used with shortest path find implementations, i.e. Dijkstra and A*,
+/// to traverse the path from 'end' vertex to the start one, but one can also traverse MSP tables with it.
+bool each_path_icsr_graph(table_s const * const table, size_t const end, manage_fn const manage, void * const am);
+
+#endif // ICSR_GRAPH_H
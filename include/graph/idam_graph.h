@@ -0,0 +1,241 @@
+#ifndef IDAM_GRAPH_H
+#define IDAM_GRAPH_H
+
+#include <cerpec.h>
+#include <graph/table.h>
+#include <graph/workspace.h>
+
+#include <stdint.h>
+
+#if !defined(IDAM_GRAPH_CHUNK)
+#   define IDAM_GRAPH_CHUNK CERPEC_CHUNK
+#elif IDAM_GRAPH_CHUNK <= 0
+#   error "Chunk size must be greater than zero."
+#elif (IDAM_GRAPH_CHUNK & (IDAM_GRAPH_CHUNK - 1))
+#   error "Chunk size must be a power of 2."
+#endif
+
+#define IDAM_SPECIAL ((size_t)(-1))
+
+/// @brief Infinite directed adjacency matrix graph data structure.
+/// @note Weight of edge from vertex 'v' to 'u' is at row 'v' and column 'u' of a row-major matrix, while a packed
+/// bitset with the same layout marks which edges exist, so rows are scanned a 64 bit word of edges at a time.
+typedef struct infinite_directed_adjacency_matrix_graph {
+    char * vertices, * weights; // arrays of vertices and row-major edge weights with 'capacity' columns per row
+    uint64_t * bits;            // row-major edge presence bits with 'ceil(capacity / 64)' words per row
+    size_t * in_degrees, * out_degrees;
+    size_t vertex_size, weight_size; // sizes of single vertex and edge weight
+    size_t vertex_length, edge_length, capacity; // vertex and edge count and graph's vertex capacity
+    growth_s growth;                             // policy to expand and shrink vertex capacity with
+    memory_s const * allocator;
+} idam_graph_s;
+
+/// @brief Graph edge represented by its weight, and source and destination vertex indexes.
+typedef struct infinite_directed_adjacency_matrix_graph_edge {
+    char * weight;
+    size_t vertices[2]; // source and destination vertex indexes
+} idam_edge_s;
+
+/// @brief Creates an empty structure.
+/// @param vertex_size Size of a single vertex element.
+/// @param weight_size Size of a single edge element.
+/// @return Graph structure.
+idam_graph_s create_idam_graph(size_t const vertex_size, size_t const weight_size);
+
+/// @brief Creates an empty structure.
+/// @param vertex_size Size of a single vertex element.
+/// @param weight_size Size of a single edge element.
+/// @param allocator Custom allocator structure.
+/// @return Graph structure.
+idam_graph_s make_idam_graph(size_t const vertex_size, size_t const weight_size, memory_s const * const allocator);
+
+/// @brief Destroys a structure and its elements, but makes it unusable.
+/// @param graph Structure to destroy.
+/// @param destroy_vertex Function pointer to destroy a single vertex element.
+/// @param adv Arguments for destroy function pointer.
+/// @param destroy_weight Function pointer to destroy a single edge weight element.
+/// @param adw Arguments for destroy function pointer.
+void destroy_idam_graph(idam_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw);
+
+/// @brief Clears a structure and destroys its elements, but remains usable.
+/// @param graph Structure to destroy.
+/// @param destroy_vertex Function pointer to destroy a single vertex element.
+/// @param adv Arguments for destroy function pointer.
+/// @param destroy_weight Function pointer to destroy a single edge weight element.
+/// @param adw Arguments for destroy function pointer.
+void clear_idam_graph(idam_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw);
+
+/// @brief Creates a copy of a structure and all its elements.
+/// @param graph Structure to copy.
+/// @param copy_vertex Function pointer to create a deep/shallow copy of a single vertex element.
+/// @param acv Arguments for copy vertex function pointer.
+/// @param copy_weight Function pointer to create a deep/shallow copy of a single edge weight element.
+/// @param acw Arguments for copy edge function pointer.
+/// @return Graph structure.
+idam_graph_s copy_idam_graph(idam_graph_s const * const graph, copy_fn const copy_vertex, void * const acv, copy_fn const copy_weight, void * const acw);
+
+/// @brief Checks if structure is empty.
+/// @param graph Structure to check.
+/// @return 'true' if empty, 'false' if not.
+bool is_empty_idam_graph(idam_graph_s const * const graph);
+
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param graph Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_idam_graph(idam_graph_s * const graph, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity vertices without reallocating.
+/// @param graph Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_idam_graph(idam_graph_s * const graph, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param graph Structure to shrink.
+void shrink_to_fit_idam_graph(idam_graph_s * const graph);
+
+/// @brief Inserts a single vertex element into the structure.
+/// @param graph Structure to insert into.
+/// @param vertex Element buffer to insert.
+/// @return Index of element in vertex array.
+size_t insert_vertex_idam_graph(idam_graph_s * const graph, void const * const vertex);
+
+/// @brief Remove specified vertex element at index from structure.
+/// @param graph Structure to remove from.
+/// @param index Index location of vertex.
+/// @param buffer Element buffer to save vertex.
+/// @param destroy_weight Function pointer to destroy single edge weight element associated wtih removed vertex.
+/// @param adw Arguments for destroy function pointer.
+/// @return Index of last swapped element in vertex array.
+/// @note The last vertex in elements array (including its edges) gets swapped with the removed index vertex.
+size_t remove_vertex_idam_graph(idam_graph_s * const graph, size_t const index, void * const buffer, set_fn const destroy_weight, void * const adw);
+
+/// @brief Gets the vertex element at index in structure.
+/// @param graph Structure to get from.
+/// @param index Index location of vertex.
+/// @param buffer Element buffer to save vertex.
+void get_vertex_idam_graph(idam_graph_s const * const graph, size_t const index, void * const buffer);
+
+/// @brief Inserts a single edge weight element from source to destination vertex into the structure.
+/// @param graph Structure to insert into.
+/// @param source Index location of source vertex.
+/// @param destination Index location of destination vertex.
+/// @param weight Element buffer to insert.
+/// @note An edge from source to destination mustn't exist yet, while an edge in opposite direction may.
+void insert_weight_idam_graph(idam_graph_s * const graph, size_t const source, size_t const destination, void const * const weight);
+
+/// @brief Remove edge weight element from source to destination vertex from structure.
+/// @param graph Structure to remove from.
+/// @param source Index location of source vertex.
+/// @param destination Index location of destination vertex.
+/// @param buffer Element buffer to save removed.
+void remove_weight_idam_graph(idam_graph_s * const graph, size_t const source, size_t const destination, void * const buffer);
+
+/// @brief Checks if edge weight exists from source to destination vertex.
+/// @param graph Structure to check.
+/// @param source Index location of source vertex.
+/// @param destination Index location of destination vertex.
+/// @return 'true' if an edge exists, 'false' otherwise.
+bool contains_weight_idam_graph(idam_graph_s const * const graph, size_t const source, size_t const destination);
+
+/// @brief Gets the edge weight element from source to destination vertex in structure.
+/// @param graph Structure to get from.
+/// @param source Index location of source vertex.
+/// @param destination Index location of destination vertex.
+/// @param buffer Element buffer to save edge.
+void get_weight_idam_graph(idam_graph_s const * const graph, size_t const source, size_t const destination, void * const buffer);
+
+/// @brief Calculates the number of edges that end in the vertex index.
+/// @param graph Structure to get from.
+/// @param index Vertex index.
+/// @return In-degree of vertex.
+size_t in_degree_idam_graph(idam_graph_s const * const graph, size_t const index);
+
+/// @brief Calculates the number of edges that start in the vertex index.
+/// @param graph Structure to get from.
+/// @param index Vertex index.
+/// @return Out-degree of vertex.
+size_t out_degree_idam_graph(idam_graph_s const * const graph, size_t const index);
+
+/// @brief Orders vertices so that every edge goes from an earlier to a later vertex using Kahn's algorithm.
+/// @param graph Structure to sort.
+/// @param order Buffer of at least vertex length indexes to save sorted vertex indexes into.
+/// @return 'true' if graph is acyclic and order is complete, 'false' if a cycle left some vertices unsorted.
+bool topological_sort_idam_graph(idam_graph_s const * const graph, size_t * const order);
+
+/// @brief Labels each vertex with its strongly connected component using an iterative Tarjan's algorithm.
+/// @param graph Structure to label.
+/// @param components Buffer of at least vertex length indexes to save each vertex' component into.
+/// @return Number of strongly connected components.
+/// @note Components are numbered in reverse topological order of the condensed graph, i.e. an edge between two
+/// components always goes from a bigger to a smaller or equal component number.
+size_t strongly_connected_idam_graph(idam_graph_s const * const graph, size_t * const components);
+
+/// @brief Traverses the vertices of the specified structure along edge directions using breadth first search.
+/// @param graph Structure to traverse.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IDAM_SPECIAL' if all vertex shortest weightless path.
+void bfs_idam_graph(idam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Traverses the vertices of the specified structure using breadth first search, reusing workspace.
+/// @param graph Structure to traverse.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IDAM_SPECIAL' if all vertex shortest weightless path.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void bfs_workspace_idam_graph(idam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Generate a Dijkstra lookup array table with nodes' edge sums and previous indexes along edge directions.
+/// @param graph Structure to generate from.
+/// @param table Cost structure that defines the distance properties in table.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IDAM_SPECIAL' if all vertex shortest path.
+void dijkstra_idam_graph(idam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end);
+
+/// @brief Generate a Dijkstra lookup array table into workspace, reusing its buffers.
+/// @param graph Structure to generate from.
+/// @param workspace Workspace sized for at least graph's vertices, whose table holds the result.
+/// @param start Starting vertex index.
+/// @param end Last vertex index, or 'IDAM_SPECIAL' if all vertex shortest path.
+/// @note Workspace is reset in time proportional to vertices reached by its previous search.
+void dijkstra_workspace_idam_graph(idam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end);
+
+/// @brief Destroys a structure, and its elements and makes it unusable.
+/// @param table Structure to destroy.
+/// @note Workspace's table is owned by workspace and is destroyed with 'destroy_graph_workspace' instead.
+void destroy_idam_table(table_s * const table);
+
+/// @brief Iterates over each vertex element in structure starting from the beginning.
+/// @param graph Structure to iterate.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Arguments for handle function pointer.
+void each_vertex_idam_graph(idam_graph_s const * const graph, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each edge element in structure ordered by source, then destination vertex.
+/// @param graph Structure to iterate.
+/// @param manage Function pointer to handle each edge-vertices (idam_edge_s) element reference using generic arguments.
+/// @param am Arguments for handle function pointer.
+void each_edge_idam_graph(idam_graph_s const * const graph, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each vertex an edge from vertex index goes to, in ascending index order.
+/// @param graph Structure to iterate.
+/// @param index Index of vertex to iterate neighbors.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Arguments for handle function pointer.
+void each_neighbor_idam_graph(idam_graph_s const * const graph, size_t const index, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each cost element in structure starting from the beginning.
+/// @param table Structure to iterate.
+/// @param manage Operate function pointer to operate on each vertex.
+/// @param am Arguments for handle function pointer.
+void each_cost_idam_graph(table_s const * const table, manage_fn const manage, void * const am);
+
+/// @brief Traverses the costs paths of the specified structure using a generated table.
+/// @param table Structure to traverse.
+/// @param end End vertex index to recursively travel to from starting vertex.
+/// @param manage Operate function pointer to operate on each vertex.
+/// @param am Arguments for handle function pointer.
+/// @return 'true' if path exists, 'false' otherwise.
+bool each_path_idam_graph(table_s const * const table, size_t const end, manage_fn const manage, void * const am);
+
+#endif // IDAM_GRAPH_H
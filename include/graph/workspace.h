@@ -0,0 +1,65 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <graph/table.h>
+
+/// @brief Special workspace value for vertex without previous vertex or heap index.
+#define WORKSPACE_SPECIAL ((size_t)(-1))
+
+/// @brief Reusable search buffers sized once per graph and reset in time proportional to vertices last search reached.
+typedef struct graph_workspace {
+    table_s table; // result of last search, its costs and previous indexes are owned by workspace
+    size_t * reached, * visited; // epoch each vertex was last reached and visited in, older epoch means not yet
+    size_t * touched; // vertices reached by last search, their costs and previous indexes are reset before next one
+    size_t * array, * position; // queue, stack or indexed binary heap of vertices and each reached vertex' heap index
+    char * scratch; // a cost estimate per vertex followed by two cost buffers
+    size_t length, touched_length, heap_length, epoch;
+    memory_s const * allocator;
+} graph_workspace_s;
+
+/// @brief Creates workspace for graph with at most 'length' vertices.
+/// @param length Number of vertices workspace is sized for.
+/// @param table Table whose cost properties are used, its costs and previous indexes are ignored.
+/// @return Workspace structure.
+graph_workspace_s create_graph_workspace(size_t const length, table_s const * const table);
+
+/// @brief Creates workspace for graph with at most 'length' vertices using allocator.
+/// @param length Number of vertices workspace is sized for.
+/// @param table Table whose cost properties are used, its costs and previous indexes are ignored.
+/// @param allocator Memory allocator for buffers.
+/// @return Workspace structure.
+graph_workspace_s make_graph_workspace(size_t const length, table_s const * const table, memory_s const * const allocator);
+
+/// @brief Destroys workspace and its buffers, including costs of its table.
+/// @param workspace Workspace structure.
+void destroy_graph_workspace(graph_workspace_s * const workspace);
+
+/// @brief Moves result of last search into table and destroys rest of workspace.
+/// @param workspace Workspace structure.
+/// @param table Table to take ownership of costs and previous indexes.
+/// @note Table's costs and previous indexes must be freed with workspace's allocator.
+void release_graph_workspace(graph_workspace_s * const workspace, table_s * const table);
+
+/// @brief Prepares workspace for next search by resetting only vertices the last one reached.
+/// @param workspace Workspace structure.
+void reset_graph_workspace(graph_workspace_s * const workspace);
+
+/// @brief Marks vertex as reached by current search, so it gets reset before next one.
+/// @param workspace Workspace structure.
+/// @param vertex Index of vertex.
+/// @return 'true' if vertex wasn't reached yet, 'false' otherwise.
+bool reach_graph_workspace(graph_workspace_s * const workspace, size_t const vertex);
+
+/// @brief Inserts reached vertex into workspace's heap, or moves it up if its key decreased.
+/// @param workspace Workspace structure.
+/// @param keys Keys of vertices to order heap by, key of vertex 'v' is at 'keys + (v * table.size)'.
+/// @param vertex Index of reached vertex.
+void push_graph_workspace(graph_workspace_s * const workspace, char const * const keys, size_t const vertex);
+
+/// @brief Removes vertex with smallest key from workspace's heap, ties are broken by smaller vertex index.
+/// @param workspace Workspace structure.
+/// @param keys Keys of vertices heap is ordered by.
+/// @return Index of removed vertex.
+size_t pop_graph_workspace(graph_workspace_s * const workspace, char const * const keys);
+
+#endif // WORKSPACE_H
@@ -17,6 +17,7 @@ typedef struct infinite_circular_list {
     size_t * next; // array to store next indexes
     size_t size, length, capacity, tail; // list size and head index parameter
     size_t empty; // empty stack's size and head
+    growth_s growth; // policy to expand and shrink capacity with
     memory_s const * allocator;
 } icircular_list_s;
 
@@ -55,6 +56,20 @@ icircular_list_s copy_icircular_list(icircular_list_s const * const list, copy_f
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_icircular_list(icircular_list_s const * const list);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param list Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_icircular_list(icircular_list_s * const list, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param list Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_icircular_list(icircular_list_s * const list, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param list Structure to shrink.
+void shrink_to_fit_icircular_list(icircular_list_s * const list);
+
 /// @brief Inserts a single element at the index of the structure.
 /// @param list Structure to insert into.
 /// @param element Element buffer to insert.
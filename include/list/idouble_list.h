@@ -19,6 +19,7 @@ typedef struct infinite_double_list {
     char * elements; // array to store elements
     size_t * node[IDL_NODE]; // array to store next indexes
     size_t size, length, capacity, head; // list size and head index parameter
+    growth_s growth; // policy to expand and shrink capacity with
     memory_s const * allocator;
 } idouble_list_s;
 
@@ -57,6 +58,20 @@ idouble_list_s copy_idouble_list(idouble_list_s const * const list, copy_fn cons
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_idouble_list(idouble_list_s const * const list);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param list Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_idouble_list(idouble_list_s * const list, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param list Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_idouble_list(idouble_list_s * const list, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param list Structure to shrink.
+void shrink_to_fit_idouble_list(idouble_list_s * const list);
+
 /// @brief Inserts a single element at the index of the structure.
 /// @param list Structure to insert into.
 /// @param element Element buffer to insert.
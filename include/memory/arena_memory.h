@@ -0,0 +1,31 @@
+#ifndef ARENA_MEMORY_H
+#define ARENA_MEMORY_H
+
+#include <cerpec.h>
+
+#if !defined(ARENA_MEMORY_ALIGN)
+#   define ARENA_MEMORY_ALIGN 16
+#elif ARENA_MEMORY_ALIGN <= 0
+#   error "Alignment must be greater than zero."
+#elif (ARENA_MEMORY_ALIGN & (ARENA_MEMORY_ALIGN - 1))
+#   error "Alignment must be a power of 2."
+#endif
+
+/// @brief Creates arena (bump) allocator that hands out memory from blocks of at least capacity bytes.
+/// @param capacity Size of each arena block in bytes.
+/// @return Memory allocator structure.
+/// @note Free does nothing, realloc extends the last allocation in place if its block has space left.
+/// @note Arena allocator isn't thread-safe.
+memory_s make_arena_memory(size_t const capacity);
+
+/// @brief Frees every arena block and makes allocator unusable.
+/// @param arena Arena allocator to destroy.
+/// @note Every structure using arena must not be used afterwards.
+void destroy_arena_memory(memory_s * const arena);
+
+/// @brief Releases every allocation at once while keeping arena blocks for reuse.
+/// @param arena Arena allocator to reset.
+/// @note Every structure using arena must not be used afterwards.
+void reset_arena_memory(memory_s const * const arena);
+
+#endif // ARENA_MEMORY_H
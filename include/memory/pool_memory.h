@@ -0,0 +1,29 @@
+#ifndef POOL_MEMORY_H
+#define POOL_MEMORY_H
+
+#include <cerpec.h>
+
+#if !defined(POOL_MEMORY_ALIGN)
+#   define POOL_MEMORY_ALIGN 16
+#elif POOL_MEMORY_ALIGN <= 0
+#   error "Alignment must be greater than zero."
+#elif (POOL_MEMORY_ALIGN & (POOL_MEMORY_ALIGN - 1))
+#   error "Alignment must be a power of 2."
+#endif
+
+/// @brief Creates pool allocator that keeps freed memory in per-size free lists for reuse.
+/// @return Memory allocator structure.
+/// @note Sizes are rounded up to POOL_MEMORY_ALIGN, each rounded size gets its own free list.
+/// @note Pool allocator isn't thread-safe.
+memory_s make_pool_memory(void);
+
+/// @brief Frees pooled memory and free lists, making allocator unusable.
+/// @param pool Pool allocator to destroy.
+/// @note Every structure using pool must be destroyed before, memory still in use isn't freed.
+void destroy_pool_memory(memory_s * const pool);
+
+/// @brief Returns every pooled (freed but retained) memory block back to the system.
+/// @param pool Pool allocator to trim.
+void trim_pool_memory(memory_s const * const pool);
+
+#endif // POOL_MEMORY_H
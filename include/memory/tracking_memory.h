@@ -0,0 +1,55 @@
+#ifndef TRACKING_MEMORY_H
+#define TRACKING_MEMORY_H
+
+#include <cerpec.h>
+
+#include <stdio.h>
+#include <limits.h>
+
+#if !defined(TRACKING_MEMORY_ALIGN)
+#   define TRACKING_MEMORY_ALIGN 16
+#elif TRACKING_MEMORY_ALIGN <= 0
+#   error "Alignment must be greater than zero."
+#elif (TRACKING_MEMORY_ALIGN & (TRACKING_MEMORY_ALIGN - 1))
+#   error "Alignment must be a power of 2."
+#endif
+
+// one histogram bucket for each power of two a requested size can fall into
+#define TRACKING_MEMORY_BUCKETS (sizeof(size_t) * CHAR_BIT)
+
+/// @brief Allocation statistics gathered by tracking allocator.
+typedef struct tracking_memory_stats {
+    size_t live, peak;              // currently allocated and largest ever allocated number of bytes
+    size_t allocs, reallocs, frees; // number of alloc, realloc and free calls
+    size_t copied;                  // number of bytes moved by reallocations that changed memory's address
+    size_t histogram[TRACKING_MEMORY_BUCKETS]; // bucket 'i' counts requested sizes in range [2^i, 2^(i + 1))
+} tracking_memory_stats_s;
+
+/// @brief Creates tracking allocator that forwards to inner allocator and records allocation statistics.
+/// @param inner Allocator to forward allocations to, must outlive tracking allocator.
+/// @return Memory allocator structure.
+/// @note Each allocation is prefixed with TRACKING_MEMORY_ALIGN bytes to remember its size.
+/// @note Tracking allocator isn't thread-safe.
+memory_s make_tracking_memory(memory_s const * const inner);
+
+/// @brief Frees tracking state, making allocator unusable.
+/// @param tracking Tracking allocator to destroy.
+/// @note Every structure using tracking allocator must be destroyed before.
+void destroy_tracking_memory(memory_s * const tracking);
+
+/// @brief Gets allocation statistics gathered so far.
+/// @param tracking Tracking allocator to query.
+/// @return Statistics structure.
+tracking_memory_stats_s stats_tracking_memory(memory_s const * const tracking);
+
+/// @brief Resets call counters, copy volume and histogram, peak is reset to live bytes.
+/// @param tracking Tracking allocator to reset.
+void reset_tracking_memory(memory_s const * const tracking);
+
+/// @brief Writes allocation statistics as a single JSON object.
+/// @param tracking Tracking allocator to dump.
+/// @param stream Stream to write into.
+/// @note Histogram is written as array of '[bucket lower bound, count]' pairs for non-empty buckets.
+void dump_tracking_memory(memory_s const * const tracking, FILE * const stream);
+
+#endif // TRACKING_MEMORY_H
@@ -0,0 +1,127 @@
+#ifndef CCSC_HASH_MAP_H
+#define CCSC_HASH_MAP_H
+
+#include <misc/isc_hash_map.h>
+
+#if !defined(CCSC_HASH_MAP_SHARDS)
+#   define CCSC_HASH_MAP_SHARDS 64
+#elif CCSC_HASH_MAP_SHARDS <= 0
+#   error "Shard count must be greater than zero."
+#elif (CCSC_HASH_MAP_SHARDS & (CCSC_HASH_MAP_SHARDS - 1))
+#   error "Shard count must be a power of 2."
+#endif
+
+/// @brief Concurrent hash map shard with its own reader-writer lock (defined in source file).
+struct concurrent_separate_chaining_hash_map_shard;
+
+/// @brief Concurrent hash map structure.
+/// @note Keys are partitioned across independently locked infinite hash maps using high bits of their mixed hash.
+/// @note Custom allocator must be thread-safe if structure is used by multiple threads.
+typedef struct concurrent_separate_chaining_hash_map {
+    hash_fn hash_key;
+    void * ahk;
+    struct concurrent_separate_chaining_hash_map_shard * shards;
+    size_t key_size, value_size, count;
+    memory_s const * allocator;
+} ccsc_hash_map_s;
+
+/// @brief Creates an empty structure with CCSC_HASH_MAP_SHARDS shards.
+/// @param key_size Size of a single key.
+/// @param value_size Size of a single value.
+/// @param hash_key Function pointer to hash element into value.
+/// @param ahk Arguments for hash function pointer.
+/// @param compare_key Function pointer to compare keys.
+/// @param ack Arguments for compare function pointer.
+/// @return Map structure.
+ccsc_hash_map_s create_ccsc_hash_map(size_t const key_size, size_t const value_size, hash_fn const hash_key, void * const ahk, compare_fn const compare_key, void * const ack);
+
+/// @brief Creates an empty structure.
+/// @param key_size Size of a single key.
+/// @param value_size Size of a single value.
+/// @param count Number of shards, must be a power of two.
+/// @param hash_key Function pointer to hash element into value.
+/// @param ahk Arguments for hash function pointer.
+/// @param compare_key Function pointer to compare keys.
+/// @param ack Arguments for compare function pointer.
+/// @param allocator Custom allocator structure.
+/// @return Map structure.
+ccsc_hash_map_s make_ccsc_hash_map(size_t const key_size, size_t const value_size, size_t const count, hash_fn const hash_key, void * const ahk, compare_fn const compare_key, void * const ack, memory_s const * const allocator);
+
+/// @brief Destroys a structure and its elements, but makes it unusable.
+/// @param map Structure to destroy.
+/// @param destroy_key Function pointer to destroy a single key.
+/// @param adk Arguments for key destroy function pointer.
+/// @param destroy_value Function pointer to destroy a single value.
+/// @param adv Arguments for value destroy function pointer.
+/// @note Not thread-safe, no other thread may use structure while or after it's destroyed.
+void destroy_ccsc_hash_map(ccsc_hash_map_s * const map, set_fn const destroy_key, void * const adk, set_fn const destroy_value, void * const adv);
+
+/// @brief Clears a structure and destroys its elements, but remains usable.
+/// @param map Structure to destroy.
+/// @param destroy_key Function pointer to destroy a single key.
+/// @param adk Arguments for key destroy function pointer.
+/// @param destroy_value Function pointer to destroy a single value.
+/// @param adv Arguments for value destroy function pointer.
+/// @note Shards are cleared one at a time, so concurrent inserts may survive the clear.
+void clear_ccsc_hash_map(ccsc_hash_map_s * const map, set_fn const destroy_key, void * const adk, set_fn const destroy_value, void * const adv);
+
+/// @brief Creates a copy of a structure and all its elements.
+/// @param map Structure to copy.
+/// @param copy_key Function pointer to create a deep/shallow copy of a single key.
+/// @param ack Arguments for copy key function pointer.
+/// @param copy_value Function pointer to create a deep/shallow copy of a single value.
+/// @param acv Arguments for copy value function pointer.
+/// @return Map structure.
+ccsc_hash_map_s copy_ccsc_hash_map(ccsc_hash_map_s const * const map, copy_fn const copy_key, void * const ack, copy_fn const copy_value, void * const acv);
+
+/// @brief Checks if structure is empty.
+/// @param map Structure to check.
+/// @return 'true' if empty, 'false' if not.
+bool is_empty_ccsc_hash_map(ccsc_hash_map_s const * const map);
+
+/// @brief Inserts unique key and value into structure.
+/// @param map Structure to insert into.
+/// @param key Key to insert.
+/// @param value Value to insert.
+void insert_ccsc_hash_map(ccsc_hash_map_s * const map, void const * const key, void const * const value);
+
+/// @brief Removes key and value from structure.
+/// @param map Structure to remove from.
+/// @param key Key to search.
+/// @param key_buffer Key buffer to save removed key.
+/// @param value_buffer Value buffer to save removed value.
+void remove_ccsc_hash_map(ccsc_hash_map_s * const map, void const * const key, void * const key_buffer, void * const value_buffer);
+
+/// @brief Checks if structure contains key.
+/// @param map Structure to check.
+/// @param key Key to check.
+/// @return 'true' if contained, 'false' otherwise.
+bool contains_key_ccsc_hash_map(ccsc_hash_map_s const * const map, void const * const key);
+
+/// @brief Gets value based on key.
+/// @param map Structure to set value.
+/// @param key Key to value.
+/// @param value_buffer Value buffer to save retrieved value.
+void get_value_ccsc_hash_map(ccsc_hash_map_s const * const map, void const * const key, void * const value_buffer);
+
+/// @brief Sets value based on key.
+/// @param map Structure to get value.
+/// @param key Key to value.
+/// @param value New value to insert.
+/// @param value_buffer Old value buffer to save replaced value.
+/// @note When key doesn't exist it performs an insert, otherwise the old value is replace with the new one.
+void set_ccsc_hash_map(ccsc_hash_map_s * const map, void const * const key, void const * const value, void * const value_buffer);
+
+/// @brief Iterates over each key in structure, one read locked shard at a time.
+/// @param map Structure to iterate over.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Generic arguments to use in function pointer.
+void each_key_ccsc_hash_map(ccsc_hash_map_s const * const map, manage_fn const manage, void * const am);
+
+/// @brief Iterates over each value in structure, one read locked shard at a time.
+/// @param map Structure to iterate over.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Generic arguments to use in function pointer.
+void each_value_ccsc_hash_map(ccsc_hash_map_s const * const map, manage_fn const manage, void * const am);
+
+#endif // CCSC_HASH_MAP_H
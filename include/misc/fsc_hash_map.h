@@ -11,7 +11,8 @@ typedef struct finite_separate_chaining_hash_map {
     void * ack;
     char * keys, * values;
     size_t * next, * prev, * head, * hashes;
-    size_t key_size, value_size, length, max;
+    size_t key_size, value_size, length, max, mask;
+    index_e indexing;
     memory_s const * allocator;
 } fsc_hash_map_s;
 
@@ -73,6 +74,12 @@ bool is_empty_fsc_hash_map(fsc_hash_map_s const * const map);
 /// @return 'true' if full, 'false' if not.
 bool is_full_fsc_hash_map(fsc_hash_map_s const * const map);
 
+/// @brief Changes how hashes are reduced into bucket indexes and rehashes keys.
+/// @param map Structure to reindex.
+/// @param indexing New bucket indexing mode.
+/// @note MASK_INDEX only uses the largest power of two buckets that fits into maximum length.
+void reindex_fsc_hash_map(fsc_hash_map_s * const map, index_e const indexing);
+
 /// @brief Inserts unique key/value pair into structure.
 /// @param map Structure to insert element into.
 /// @param key Key to insert.
@@ -98,6 +105,13 @@ bool contains_key_fsc_hash_map(fsc_hash_map_s const * const map, void const * co
 /// @param value_buffer Value buffer to save retrieved value.
 void get_value_fsc_hash_map(fsc_hash_map_s const * const map, void const * const key, void * const value_buffer);
 
+/// @brief Gets values based on array of keys, hashing and prefetching them in batches.
+/// @param map Structure to get values from.
+/// @param keys Array of keys to values.
+/// @param count Number of keys in array.
+/// @param values_buffer Values buffer to save retrieved values at same indexes as their keys.
+void get_values_fsc_hash_map(fsc_hash_map_s const * const map, void const * const keys, size_t const count, void * const values_buffer);
+
 /// @brief Sets value based on key.
 /// @param map Structure to set value.
 /// @param key Key to value.
@@ -17,6 +17,7 @@ typedef struct infinite_binary_heap {
     void * ac;
     char * elements;    // elements array
     size_t size, length, capacity;
+    growth_s growth;    // policy to expand and shrink capacity with
     memory_s const * allocator;
 } ibinary_heap_s;
 
@@ -59,6 +60,20 @@ ibinary_heap_s copy_ibinary_heap(ibinary_heap_s const * const heap, copy_fn cons
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_ibinary_heap(ibinary_heap_s const * const heap);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param heap Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_ibinary_heap(ibinary_heap_s * const heap, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param heap Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_ibinary_heap(ibinary_heap_s * const heap, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param heap Structure to shrink.
+void shrink_to_fit_ibinary_heap(ibinary_heap_s * const heap);
+
 /// @brief Pushes a single element to the top of the structure.
 /// @param heap Structure to push into.
 /// @param element Element buffer to push.
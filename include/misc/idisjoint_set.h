@@ -0,0 +1,110 @@
+#ifndef IDISJOINT_SET_H
+#define IDISJOINT_SET_H
+
+#include <cerpec.h>
+
+#if !defined(IDISJOINT_SET_CHUNK)
+#   define IDISJOINT_SET_CHUNK CERPEC_CHUNK
+#elif IDISJOINT_SET_CHUNK <= 0
+#   error "Chunk size must be greater than zero."
+#elif (IDISJOINT_SET_CHUNK & (IDISJOINT_SET_CHUNK - 1))
+#   error "Chunk size must be a power of 2."
+#endif
+
+/// @brief Infinite disjoint set (union-find) structure of element indexes.
+/// @note Find halves paths it walks and union attaches smaller set under bigger one, so both take near constant time.
+typedef struct infinite_disjoint_set {
+    size_t * parents, * sizes; // parent of each element and size of each root's set
+    size_t length, capacity, count; // number of elements, capacity and number of disjoint sets
+    growth_s growth;                // policy to expand and shrink capacity with
+    memory_s const * allocator;
+} idisjoint_set_s;
+
+/// @brief Creates an empty structure.
+/// @return Disjoint set structure.
+idisjoint_set_s create_idisjoint_set(void);
+
+/// @brief Creates an empty structure.
+/// @param allocator Custom allocator structure.
+/// @return Disjoint set structure.
+idisjoint_set_s make_idisjoint_set(memory_s const * const allocator);
+
+/// @brief Destroys a structure, but makes it unusable.
+/// @param set Structure to destroy.
+void destroy_idisjoint_set(idisjoint_set_s * const set);
+
+/// @brief Clears a structure, but remains usable.
+/// @param set Structure to clear.
+void clear_idisjoint_set(idisjoint_set_s * const set);
+
+/// @brief Creates a copy of a structure.
+/// @param set Structure to copy.
+/// @return Disjoint set structure.
+idisjoint_set_s copy_idisjoint_set(idisjoint_set_s const * const set);
+
+/// @brief Checks if structure is empty.
+/// @param set Structure to check.
+/// @return 'true' if empty, 'false' if not.
+bool is_empty_idisjoint_set(idisjoint_set_s const * const set);
+
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param set Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_idisjoint_set(idisjoint_set_s * const set, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param set Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_idisjoint_set(idisjoint_set_s * const set, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param set Structure to shrink.
+void shrink_to_fit_idisjoint_set(idisjoint_set_s * const set);
+
+/// @brief Inserts new element into structure as its own single element set.
+/// @param set Structure to insert into.
+/// @return Index of inserted element.
+size_t insert_idisjoint_set(idisjoint_set_s * const set);
+
+/// @brief Finds root element that represents element's set.
+/// @param set Structure to search.
+/// @param element Index of element.
+/// @return Index of root element.
+/// @note Every element on path to root is moved to its grandparent.
+size_t find_idisjoint_set(idisjoint_set_s * const set, size_t const element);
+
+/// @brief Unites sets of two elements into one.
+/// @param set Structure to unite in.
+/// @param one Index of first element.
+/// @param two Index of second element.
+/// @return 'true' if elements were in different sets, 'false' if they already shared one.
+bool union_idisjoint_set(idisjoint_set_s * const set, size_t const one, size_t const two);
+
+/// @brief Checks if two elements are in the same set.
+/// @param set Structure to check.
+/// @param one Index of first element.
+/// @param two Index of second element.
+/// @return 'true' if elements share a set, 'false' otherwise.
+bool is_joint_idisjoint_set(idisjoint_set_s * const set, size_t const one, size_t const two);
+
+/// @brief Gets number of elements in element's set.
+/// @param set Structure to check.
+/// @param element Index of element.
+/// @return Size of element's set.
+size_t size_idisjoint_set(idisjoint_set_s * const set, size_t const element);
+
+/// @brief Finds root elements of many elements at once.
+/// @param set Structure to search.
+/// @param elements Array of element indexes.
+/// @param length Number of elements.
+/// @param roots Array to save each element's root index into, may be the same as elements array.
+void find_many_idisjoint_set(idisjoint_set_s * const set, size_t const * const elements, size_t const length, size_t * const roots);
+
+/// @brief Unites sets of many element pairs at once.
+/// @param set Structure to unite in.
+/// @param pairs Array of element index pairs, pair 'i' is at indexes '2 * i' and '2 * i + 1'.
+/// @param length Number of pairs.
+/// @return Number of pairs whose elements were in different sets.
+size_t union_many_idisjoint_set(idisjoint_set_s * const set, size_t const * const pairs, size_t const length);
+
+#endif // IDISJOINT_SET_H
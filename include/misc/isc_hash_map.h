@@ -19,15 +19,25 @@
 #   error "Load factor can't be greater than 1.00."
 #endif
 
+#if !defined(ISC_HASH_MAP_STEP)
+#   define ISC_HASH_MAP_STEP 16
+#elif ISC_HASH_MAP_STEP <= 0
+#   error "Rehash step must be greater than zero."
+#endif
+
 /// @brief Infinite hash map structure.
+/// @note While incrementally rehashing, buckets below 'migrated' in 'old_head' were already moved into 'head'.
 typedef struct infinite_separate_chaining_hash_map {
     hash_fn hash_key;
     void * ahk;
     compare_fn compare_key;
     void * ack;
     char * keys, * values;
-    size_t * next, * prev, * head, * hashes;
-    size_t key_size, value_size, length, capacity;
+    size_t * next, * prev, * head, * hashes, * old_head;
+    size_t key_size, value_size, length, capacity, old_capacity, migrated;
+    index_e indexing;
+    bool incremental;
+    growth_s growth;
     memory_s const * allocator;
 } isc_hash_map_s;
 
@@ -82,6 +92,41 @@ isc_hash_map_s copy_isc_hash_map(isc_hash_map_s const * const map, copy_fn const
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_isc_hash_map(isc_hash_map_s const * const map);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param map Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_isc_hash_map(isc_hash_map_s * const map, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity key-value pairs without reallocating.
+/// @param map Structure to reserve capacity for.
+/// @param capacity Minimum number of key-value pairs, scaled by ISC_HASH_MAP_LOAD.
+void reserve_isc_hash_map(isc_hash_map_s * const map, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param map Structure to shrink.
+void shrink_to_fit_isc_hash_map(isc_hash_map_s * const map);
+
+/// @brief Changes how hashes are reduced into bucket indexes and rehashes keys.
+/// @param map Structure to reindex.
+/// @param indexing New bucket indexing mode.
+/// @note MASK_INDEX rounds capacity up to a power of two and keeps it that way.
+void reindex_isc_hash_map(isc_hash_map_s * const map, index_e const indexing);
+
+/// @brief Enables or disables incremental rehashing, disabling it finishes pending rehash.
+/// @param map Structure to change.
+/// @param incremental 'true' to spread bucket migration over insert, remove and set operations.
+/// @note Each mutating operation migrates at most ISC_HASH_MAP_STEP old buckets.
+void incremental_isc_hash_map(isc_hash_map_s * const map, bool const incremental);
+
+/// @brief Gets number of old buckets left to migrate by incremental rehash.
+/// @param map Structure to check.
+/// @return Number of buckets left to migrate, zero if no rehash is in progress.
+size_t pending_rehash_isc_hash_map(isc_hash_map_s const * const map);
+
+/// @brief Migrates all old buckets left by incremental rehash.
+/// @param map Structure to finish rehashing.
+void finish_rehash_isc_hash_map(isc_hash_map_s * const map);
+
 /// @brief Inserts unique key/value pair into structure.
 /// @param map Structure to insert element into.
 /// @param key Key to insert.
@@ -107,6 +152,13 @@ bool contains_key_isc_hash_map(isc_hash_map_s const * const map, void const * co
 /// @param value_buffer Value buffer to save retrieved value.
 void get_value_isc_hash_map(isc_hash_map_s const * const map, void const * const key, void * const value_buffer);
 
+/// @brief Gets values based on array of keys, hashing and prefetching them in batches.
+/// @param map Structure to get values from.
+/// @param keys Array of keys to values.
+/// @param count Number of keys in array.
+/// @param values_buffer Values buffer to save retrieved values at same indexes as their keys.
+void get_values_isc_hash_map(isc_hash_map_s const * const map, void const * const keys, size_t const count, void * const values_buffer);
+
 /// @brief Sets value based on key.
 /// @param map Structure to get value.
 /// @param key Key to value.
@@ -20,7 +20,9 @@ struct infinite_deque_node {
 /// @brief Inifnite deque data structure.
 typedef struct infinite_deque {
     struct infinite_deque_node * head;
+    struct infinite_deque_node * spare; // list of drained nodes kept for reuse
     size_t current, size, length; // current index, element size and structure length
+    size_t spares, cache;         // number of spare nodes and maximum number of them to keep
     memory_s const * allocator;
 } ideque_s;
 
@@ -59,6 +61,11 @@ ideque_s copy_ideque(ideque_s const * const deque, copy_fn const copy, void * co
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_ideque(ideque_s const * const deque);
 
+/// @brief Sets maximum number of drained chunk nodes kept for reuse instead of being freed.
+/// @param deque Structure to set cache for.
+/// @param cache Maximum number of spare nodes, zero frees every drained node.
+void cache_ideque(ideque_s * const deque, size_t const cache);
+
 /// @brief Enqueues a single element to the front of the structure.
 /// @param deque Structure to enqueue into.
 /// @param element Element buffer to enqueue.
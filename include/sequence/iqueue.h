@@ -18,8 +18,10 @@ struct infinite_queue_node {
 
 /// @brief Infinite queue data structure.
 typedef struct infinite_queue {
-    struct infinite_queue_node * tail; // tail node to append next elements while enqueue-ing
-    size_t size, current, length;      // current index, element size and structure length
+    struct infinite_queue_node * tail;  // tail node to append next elements while enqueue-ing
+    struct infinite_queue_node * spare; // list of drained nodes kept for reuse
+    size_t size, current, length;       // current index, element size and structure length
+    size_t spares, cache;               // number of spare nodes and maximum number of them to keep
     memory_s const * allocator;
 } iqueue_s;
 
@@ -58,6 +60,11 @@ iqueue_s copy_iqueue(iqueue_s const * const queue, copy_fn const copy, void * co
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_iqueue(iqueue_s const * const queue);
 
+/// @brief Sets maximum number of drained chunk nodes kept for reuse instead of being freed.
+/// @param queue Structure to set cache for.
+/// @param cache Maximum number of spare nodes, zero frees every drained node.
+void cache_iqueue(iqueue_s * const queue, size_t const cache);
+
 /// @brief Enqueues a single element to the end of the structure.
 /// @param queue Structure to enqueue into.
 /// @param element Element buffer to enqueue.
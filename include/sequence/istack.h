@@ -15,6 +15,7 @@
 typedef struct infinite_stack {
     char * elements;               // array of elements
     size_t size, length, capacity; // size of single element, structure length and its capacity
+    growth_s growth;               // policy to expand and shrink capacity with
     memory_s const * allocator;
 } istack_s;
 
@@ -53,6 +54,20 @@ istack_s copy_istack(istack_s const * const stack, copy_fn const copy, void * co
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_istack(istack_s const * const stack);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param stack Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_istack(istack_s * const stack, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param stack Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_istack(istack_s * const stack, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param stack Structure to shrink.
+void shrink_to_fit_istack(istack_s * const stack);
+
 /// @brief Pushes a single element to the top of the structure.
 /// @param stack Structure to push into.
 /// @param element Element buffer to push.
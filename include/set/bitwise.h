@@ -0,0 +1,50 @@
+#ifndef BITWISE_H
+#define BITWISE_H
+
+#include <cerpec.h>
+
+#include <stdint.h>
+#include <limits.h>
+
+// number of bits in a single word of bitwise sets
+#define BITWISE_WORD (sizeof(uint64_t) * CHAR_BIT)
+
+/// @brief Operation to combine two word arrays with.
+typedef enum bitwise_operation {
+    OR_BITWISE,     // union, 'one | two'
+    AND_BITWISE,    // intersection, 'one & two'
+    ANDNOT_BITWISE, // subtraction, 'one & ~two'
+    XOR_BITWISE,    // exclusion, 'one ^ two'
+} bitwise_e;
+
+/// @brief Combines two word arrays into result array and counts result's set bits in the same pass.
+/// @param result Array to save combined words into, may be the same as either operand.
+/// @param one First operand array.
+/// @param two Second operand array.
+/// @param words Number of words in every array.
+/// @param operation Operation to combine words with.
+/// @return Number of set bits in result array.
+/// @note Uses AVX2 kernel if processor supports it, else a portable word loop.
+size_t operate_bitwise(uint64_t * const result, uint64_t const * const one, uint64_t const * const two, size_t const words, bitwise_e const operation);
+
+/// @brief Counts set bits in word array.
+/// @param array Array of words to count.
+/// @param words Number of words in array.
+/// @return Number of set bits.
+size_t count_bitwise(uint64_t const * const array, size_t const words);
+
+/// @brief Checks if every set bit of subset array is also set in superset array.
+/// @param superset Superset array to check with.
+/// @param subset Subset array to check from.
+/// @param words Number of words in both arrays.
+/// @return 'true' if subset, 'false' otherwise.
+bool is_subset_bitwise(uint64_t const * const superset, uint64_t const * const subset, size_t const words);
+
+/// @brief Checks if arrays share no set bits.
+/// @param one First array to check.
+/// @param two Second array to check.
+/// @param words Number of words in both arrays.
+/// @return 'true' if disjoint, 'false' otherwise.
+bool is_disjoint_bitwise(uint64_t const * const one, uint64_t const * const two, size_t const words);
+
+#endif // BITWISE_H
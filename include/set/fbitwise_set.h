@@ -2,10 +2,11 @@
 #define FBITWISE_SET_H
 
 #include <cerpec.h>
+#include <set/bitwise.h>
 
 /// @brief Finite hash set structure.
 typedef struct finite_bitwise_set {
-    unsigned * bits;
+    uint64_t * bits;
     size_t length, max; // number of indexes and bit-based capacity
     memory_s const * allocator;
 } fbitwise_set_s;
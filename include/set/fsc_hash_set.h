@@ -11,7 +11,8 @@ typedef struct finite_separate_chaining_hash_set {
     void * ac;
     char * elements;
     size_t * next, * prev, * head, * hashes;
-    size_t size, length, max;
+    size_t size, length, max, mask;
+    index_e indexing;
     memory_s const * allocator;
 } fsc_hash_set_s;
 
@@ -65,6 +66,12 @@ bool is_empty_fsc_hash_set(fsc_hash_set_s const * const set);
 /// @return 'true' if full, 'false' if not.
 bool is_full_fsc_hash_set(fsc_hash_set_s const * const set);
 
+/// @brief Changes how hashes are reduced into bucket indexes and rehashes elements.
+/// @param set Structure to reindex.
+/// @param indexing New bucket indexing mode.
+/// @note MASK_INDEX only uses the largest power of two buckets that fits into maximum length.
+void reindex_fsc_hash_set(fsc_hash_set_s * const set, index_e const indexing);
+
 /// @brief Inserts unique element into structure.
 /// @param set Structure to insert element into.
 /// @param element Element to insert.
@@ -82,6 +89,13 @@ void remove_fsc_hash_set(fsc_hash_set_s * const set, void const * const element,
 /// @return 'true' if contained, 'false' otherwise.
 bool contains_fsc_hash_set(fsc_hash_set_s const * const set, void const * const element);
 
+/// @brief Checks if structure contains each element in array, hashing and prefetching them in batches.
+/// @param set Structure to check.
+/// @param elements Array of elements to check.
+/// @param count Number of elements in array.
+/// @param results Array to save 'true' if element at same index is contained, 'false' otherwise.
+void contains_many_fsc_hash_set(fsc_hash_set_s const * const set, void const * const elements, size_t const count, bool * const results);
+
 /// @brief Performs union of two structures and returns a new copy.
 /// @param set_one First structure to union.
 /// @param set_two Second structure to union.
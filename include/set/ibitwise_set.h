@@ -2,18 +2,26 @@
 #define IBITWISE_SET_H
 
 #include <cerpec.h>
+#include <set/bitwise.h>
 
 // doesn't need to check if chunk is power of 2 since it works with bit indexes needs to resize linearly
 #if !defined(IBITWISE_SET_CHUNK)
 #   define IBITWISE_SET_CHUNK CERPEC_CHUNK
 #elif IBITWISE_SET_CHUNK <= 0
 #   error "Chunk size must be greater than zero."
+#elif IBITWISE_SET_CHUNK % 64
+#   error "Chunk size must be a multiple of 64 bit word."
 #endif
 
+// returned by next and previous element queries if there is no such element
+#define IBITWISE_SPECIAL ((size_t)(-1))
+
 /// @brief Infinite hash set structure.
 typedef struct infinite_bitwise_set {
-    unsigned * bits;
+    uint64_t * bits;
     size_t length, capacity; // number of indexes and bit-based capacity
+    size_t * ranks;          // number of indexes before each block of words, built lazily by rank queries
+    bool indexed;            // if ranks match current bits, cleared by every change to structure
     memory_s const * allocator;
 } ibitwise_set_s;
 
@@ -44,6 +52,16 @@ ibitwise_set_s copy_ibitwise_set(ibitwise_set_s const * const set);
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_ibitwise_set(ibitwise_set_s const * const set);
 
+/// @brief Expands structure's bit-based capacity so indexes below capacity are inserted without reallocating.
+/// @param set Structure to reserve capacity for.
+/// @param capacity Minimum bit-based capacity, rounded up to a multiple of IBITWISE_SET_CHUNK.
+/// @note Removing an element still trims empty trailing chunks.
+void reserve_ibitwise_set(ibitwise_set_s * const set, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to last chunk containing an element, freeing unused memory.
+/// @param set Structure to shrink.
+void shrink_to_fit_ibitwise_set(ibitwise_set_s * const set);
+
 /// @brief Inserts unique element into structure.
 /// @param set Structure to insert element into.
 /// @param index Element to insert.
@@ -60,6 +78,27 @@ void remove_ibitwise_set(ibitwise_set_s * const set, size_t const index);
 /// @return 'true' if contained, 'false' otherwise.
 bool contains_ibitwise_set(ibitwise_set_s const * const set, size_t const index);
 
+/// @brief Inserts every element in [start, end) range that structure doesn't contain yet.
+/// @param set Structure to insert elements into.
+/// @param start First element of range.
+/// @param end Element after last element of range.
+/// @note Range is set a word at a time, with only first and last word masked.
+void insert_range_ibitwise_set(ibitwise_set_s * const set, size_t const start, size_t const end);
+
+/// @brief Removes every element in [start, end) range that structure contains.
+/// @param set Structure to remove elements from.
+/// @param start First element of range.
+/// @param end Element after last element of range.
+/// @note Range is cleared a word at a time, with only first and last word masked.
+void remove_range_ibitwise_set(ibitwise_set_s * const set, size_t const start, size_t const end);
+
+/// @brief Checks if structure contains every element in [start, end) range.
+/// @param set Structure to check.
+/// @param start First element of range.
+/// @param end Element after last element of range.
+/// @return 'true' if every element is contained or range is empty, 'false' otherwise.
+bool contains_range_ibitwise_set(ibitwise_set_s const * const set, size_t const start, size_t const end);
+
 /// @brief Performs union of two structures and returns a new copy.
 /// @param set_one First structure to union.
 /// @param set_two Second structure to union.
@@ -84,6 +123,39 @@ ibitwise_set_s subtract_ibitwise_set(ibitwise_set_s const * const minuend, ibitw
 /// @return Exclude structure.
 ibitwise_set_s exclude_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set_s const * const set_two);
 
+/// @brief Performs union of two structures into destination structure without allocating a new one.
+/// @param destination Structure to union into, expanded if source has a larger capacity.
+/// @param source Structure to union with.
+void union_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source);
+
+/// @brief Performs intersection of two structures into destination structure without allocating a new one.
+/// @param destination Structure to intersect into, trimmed to last chunk containing an element.
+/// @param source Structure to intersect with.
+void intersect_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source);
+
+/// @brief Performs subtraction of two structures into destination structure without allocating a new one.
+/// @param destination Structure to subtract from, trimmed to last chunk containing an element.
+/// @param source Structure to subtract with.
+void subtract_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source);
+
+/// @brief Performs exclusion (symmetric difference) of two structures into destination structure without allocating a new one.
+/// @param destination Structure to exclude into, expanded or trimmed to last chunk containing an element.
+/// @param source Structure to exclude with.
+void exclude_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source);
+
+/// @brief Performs union of many structures in a single pass and returns a new copy.
+/// @param sets Array of structures to union.
+/// @param length Number of structures in array.
+/// @return Union structure that uses first structure's allocator.
+ibitwise_set_s union_all_ibitwise_set(ibitwise_set_s const * const sets, size_t const length);
+
+/// @brief Performs intersection of many structures in a single pass and returns a new copy.
+/// @param sets Array of structures to intersect.
+/// @param length Number of structures in array.
+/// @return Intersect structure that uses first structure's allocator.
+/// @note Once a block of words is empty, remaining structures' words in that block aren't read.
+ibitwise_set_s intersect_all_ibitwise_set(ibitwise_set_s const * const sets, size_t const length);
+
 /// @brief Checks if structure is subset of another structure.
 /// @param superset Superset structure to check with.
 /// @param subset Subset structure to check from.
@@ -102,6 +174,34 @@ bool is_proper_subset_ibitwise_set(ibitwise_set_s const * const superset, ibitwi
 /// @return 'true' if structures are disjoint, 'false' otherwise.
 bool is_disjoint_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set_s const * const set_two);
 
+/// @brief Counts structure's elements smaller than index.
+/// @param set Structure to count elements in.
+/// @param index Element to count below, may be outside of structure's capacity.
+/// @return Number of smaller elements.
+/// @note Builds rank index if structure changed since last query, after that rank takes constant time.
+size_t rank_ibitwise_set(ibitwise_set_s * const set, size_t const index);
+
+/// @brief Finds structure's element with rank number of smaller elements.
+/// @param set Structure to find element in.
+/// @param rank Zero-based position of element in ascending order, must be smaller than length.
+/// @return Found element.
+/// @note Builds rank index if structure changed since last query, after that select takes logarithmic time.
+size_t select_ibitwise_set(ibitwise_set_s * const set, size_t const rank);
+
+/// @brief Finds smallest structure's element at or after index.
+/// @param set Structure to find element in.
+/// @param index Element to start searching from.
+/// @return Found element, or 'IBITWISE_SPECIAL' if there isn't one.
+/// @note Uses rank index if element isn't in the same word as index.
+size_t next_ibitwise_set(ibitwise_set_s * const set, size_t const index);
+
+/// @brief Finds largest structure's element at or before index.
+/// @param set Structure to find element in.
+/// @param index Element to start searching from.
+/// @return Found element, or 'IBITWISE_SPECIAL' if there isn't one.
+/// @note Uses rank index if element isn't in the same word as index.
+size_t prev_ibitwise_set(ibitwise_set_s * const set, size_t const index);
+
 /// @brief Iterates over each element in structure.
 /// @param set Structure to iterate over.
 /// @param manage Function pointer to handle each element reference using generic arguments.
@@ -109,4 +209,11 @@ bool is_disjoint_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set
 /// @note Function does not change the set indexes.
 void each_index_ibitwise_set(ibitwise_set_s const * const set, manage_fn const manage, void * const am);
 
+/// @brief Iterates over each maximal run of consecutive elements in structure in ascending order.
+/// @param set Structure to iterate over.
+/// @param manage Function pointer to handle each run using generic arguments.
+/// @param am Generic arguments to use in function pointer.
+/// @note Run reference is an array of two 'size_t' with run's first element and element after its last one.
+void each_run_ibitwise_set(ibitwise_set_s const * const set, manage_fn const manage, void * const am);
+
 #endif // IBITWISE_SET_H
@@ -0,0 +1,153 @@
+#ifndef IOA_HASH_SET_H
+#define IOA_HASH_SET_H
+
+#include <cerpec.h>
+
+#if !defined(IOA_HASH_SET_CHUNK)
+#   define IOA_HASH_SET_CHUNK CERPEC_CHUNK
+#elif IOA_HASH_SET_CHUNK <= 0
+#   error "Chunk size must be greater than zero."
+#elif (IOA_HASH_SET_CHUNK & (IOA_HASH_SET_CHUNK - 1))
+#   error "Chunk size must be a power of 2."
+#endif
+
+/// @brief Infinite open addressing hash set structure.
+/// @note Elements are kept in slots tagged by one control byte each, control bytes are probed a group at a time.
+typedef struct infinite_open_addressing_hash_set {
+    hash_fn hash;
+    void * ah;
+    compare_fn compare;
+    void * ac;
+    char * elements;
+    unsigned char * control;
+    size_t size, length, capacity, tombs;
+    memory_s const * allocator;
+} ioa_hash_set_s;
+
+/// @brief Creates an empty structure.
+/// @param size Size of a single element.
+/// @param hash Function pointer to hash element into value.
+/// @param ah Arguments for hash function pointer.
+/// @param compare Function pointer to compare elements.
+/// @param ac Arguments for compare function pointer.
+/// @return Set structure.
+ioa_hash_set_s create_ioa_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac);
+
+/// @brief Creates an empty structure.
+/// @param size Size of a single element.
+/// @param hash Function pointer to hash element into value.
+/// @param ah Arguments for hash function pointer.
+/// @param compare Function pointer to compare elements.
+/// @param ac Arguments for compare function pointer.
+/// @param allocator Custom allocator structure.
+/// @return Set structure.
+ioa_hash_set_s make_ioa_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator);
+
+/// @brief Destroys a structure and its elements, but makes it unusable.
+/// @param set Structure to destroy.
+/// @param destroy Function pointer to destroy a single element.
+/// @param ad Arguments for destroy function pointer.
+void destroy_ioa_hash_set(ioa_hash_set_s * const set, set_fn const destroy, void * const ad);
+
+/// @brief Clears a structure and destroys its elements, but remains usable.
+/// @param set Structure to destroy.
+/// @param destroy Function pointer to destroy a single element.
+/// @param ad Arguments for destroy function pointer.
+void clear_ioa_hash_set(ioa_hash_set_s * const set, set_fn const destroy, void * const ad);
+
+/// @brief Creates a copy of a structure and all its elements.
+/// @param set Structure to copy.
+/// @param copy Function pointer to create a deep/shallow copy of a single element.
+/// @param ac Arguments for copy function pointer.
+/// @return Set structure.
+ioa_hash_set_s copy_ioa_hash_set(ioa_hash_set_s const * const set, copy_fn const copy, void * const ac);
+
+/// @brief Checks if structure is empty.
+/// @param set Structure to check.
+/// @return 'true' if empty, 'false' if not.
+bool is_empty_ioa_hash_set(ioa_hash_set_s const * const set);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without rehashing.
+/// @param set Structure to reserve capacity for.
+/// @param capacity Minimum number of elements.
+/// @note Capacity stays a power of two and accounts for maximum load factor.
+void reserve_ioa_hash_set(ioa_hash_set_s * const set, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to smallest power of two that fits its length, freeing unused memory.
+/// @param set Structure to shrink.
+void shrink_to_fit_ioa_hash_set(ioa_hash_set_s * const set);
+
+/// @brief Inserts unique element into structure.
+/// @param set Structure to insert element into.
+/// @param element Element to insert.
+void insert_ioa_hash_set(ioa_hash_set_s * const set, void const * const element);
+
+/// @brief Removes unique element from structure.
+/// @param set Structure to remove element into.
+/// @param element Element to remove.
+/// @param buffer Element buffer to save removed element.
+void remove_ioa_hash_set(ioa_hash_set_s * const set, void const * const element, void * const buffer);
+
+/// @brief Checks if structure contains element.
+/// @param set Structure to check.
+/// @param element Element to check.
+/// @return 'true' if contained, 'false' otherwise.
+bool contains_ioa_hash_set(ioa_hash_set_s const * const set, void const * const element);
+
+/// @brief Performs union of two structures and returns a new copy.
+/// @param set_one First structure to union.
+/// @param set_two Second structure to union.
+/// @param copy Function pointer to create a deep/shallow copy of a single element.
+/// @param ac Arguments for copy function pointer.
+/// @return Union structure.
+ioa_hash_set_s union_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two, copy_fn const copy, void * const ac);
+
+/// @brief Performs intersection of two structures and returns a new copy.
+/// @param set_one First structure to intersect.
+/// @param set_two Second structure to intersect.
+/// @param copy Function pointer to create a deep/shallow copy of a single element.
+/// @param ac Arguments for copy function pointer.
+/// @return Intersect structure.
+ioa_hash_set_s intersect_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two, copy_fn const copy, void * const ac);
+
+/// @brief Performs subtraction of two structures and returns a new copy.
+/// @param minuend Structure to subtract from.
+/// @param subtrahend Structure to subtract with.
+/// @param copy Function pointer to create a deep/shallow copy of a single element.
+/// @param ac Arguments for copy function pointer.
+/// @return Subtract structure.
+ioa_hash_set_s subtract_ioa_hash_set(ioa_hash_set_s const * const minuend, ioa_hash_set_s const * const subtrahend, copy_fn const copy, void * const ac);
+
+/// @brief Performs exclusion (symmetric difference) of two structures and returns a new copy.
+/// @param set_one First structure to exclude.
+/// @param set_two Second structure to exclude.
+/// @param copy Function pointer to create a deep/shallow copy of a single element.
+/// @param ac Arguments for copy function pointer.
+/// @return Exclude structure.
+ioa_hash_set_s exclude_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two, copy_fn const copy, void * const ac);
+
+/// @brief Checks if structure is subset of another structure.
+/// @param superset Superset structure to check with.
+/// @param subset Subset structure to check from.
+/// @return 'true' if structure is subset, 'false' otherwise.
+bool is_subset_ioa_hash_set(ioa_hash_set_s const * const superset, ioa_hash_set_s const * const subset);
+
+/// @brief Checks if structure is proper subset of another structure.
+/// @param superset Superset structure to check with.
+/// @param subset Subset structure to check from.
+/// @return 'true' if structure is proper subset, 'false' otherwise.
+bool is_proper_subset_ioa_hash_set(ioa_hash_set_s const * const superset, ioa_hash_set_s const * const subset);
+
+/// @brief Checks if structures are disjoint from each other.
+/// @param set_one First structure to check.
+/// @param set_two Second structure to check.
+/// @return 'true' if structures are disjoint, 'false' otherwise.
+bool is_disjoint_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two);
+
+/// @brief Iterates over each element in structure.
+/// @param set Structure to iterate over.
+/// @param manage Function pointer to mamage each element reference using generic arguments.
+/// @param am Generic arguments to use in function pointer.
+void each_ioa_hash_set(ioa_hash_set_s const * const set, manage_fn const manage, void * const am);
+
+#endif // IOA_HASH_SET_H
@@ -26,6 +26,7 @@ typedef struct infinite_red_black_set {
     size_t * node[IRB_SET_NODE_COUNT];
     bool * color;
     size_t size, length, capacity, root;
+    growth_s growth; // policy to expand and shrink capacity with
     memory_s const * allocator;
 } irb_set_s;
 
@@ -68,6 +69,20 @@ irb_set_s copy_irb_set(irb_set_s const * const set, copy_fn const copy, void * c
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_irb_set(irb_set_s const * const set);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param set Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_irb_set(irb_set_s * const set, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param set Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_irb_set(irb_set_s * const set, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param set Structure to shrink.
+void shrink_to_fit_irb_set(irb_set_s * const set);
+
 /// @brief Inserts unique element into structure.
 /// @param set Structure to insert element into.
 /// @param element Element to insert.
@@ -0,0 +1,151 @@
+#ifndef IROARING_SET_H
+#define IROARING_SET_H
+
+#include <cerpec.h>
+#include <set/bitwise.h>
+
+#if !defined(IROARING_SET_CHUNK)
+#   define IROARING_SET_CHUNK CERPEC_CHUNK
+#elif IROARING_SET_CHUNK <= 0
+#   error "Chunk size must be greater than zero."
+#elif (IROARING_SET_CHUNK & (IROARING_SET_CHUNK - 1))
+#   error "Chunk size must be a power of 2."
+#endif
+
+// number of low index bits kept by containers, each container holds indexes that share remaining high bits
+#define IROARING_SET_BITS 16
+// number of indexes a single container spans
+#define IROARING_SET_SPAN ((size_t)(1) << IROARING_SET_BITS)
+// number of words in bitmap container
+#define IROARING_SET_WORDS (IROARING_SET_SPAN / BITWISE_WORD)
+// maximum number of values in array container, more take as much memory as a bitmap
+#define IROARING_SET_ARRAY (IROARING_SET_SPAN / 16)
+
+/// @brief Encoding of a single container's indexes.
+typedef enum iroaring_type {
+    ARRAY_IROARING,  // sorted array of 16-bit values, for sparse containers
+    BITMAP_IROARING, // bitmap of all 2^16 values, for dense containers
+    RUN_IROARING,    // sorted array of 16-bit start and length minus one pairs, for clustered containers
+} iroaring_e;
+
+/// @brief Container of indexes that share the same high bits.
+typedef struct infinite_roaring_container {
+    void * data;           // array values, bitmap words or run pairs based on type
+    size_t key;            // high bits shared by every index in container
+    size_t cardinality;    // number of indexes in container
+    size_t size, capacity; // number of used and allocated array values or run pairs, unused by bitmap
+    iroaring_e type;
+} iroaring_container_s;
+
+/// @brief Infinite compressed (roaring) bitmap set structure.
+/// @note Unlike 'ibitwise_set_s' memory depends on number and clustering of indexes instead of largest index.
+typedef struct infinite_roaring_set {
+    iroaring_container_s * containers; // containers sorted by key
+    size_t length, count, capacity;    // number of indexes, number of containers and capacity of containers
+    growth_s growth;                   // policy to expand and shrink containers' capacity with
+    memory_s const * allocator;
+} iroaring_set_s;
+
+/// @brief Creates an empty structure.
+/// @return Set structure.
+iroaring_set_s create_iroaring_set(void);
+
+/// @brief Creates an empty structure.
+/// @param allocator Custom allocator structure.
+/// @return Set structure.
+iroaring_set_s make_iroaring_set(memory_s const * const allocator);
+
+/// @brief Destroys a structure and its elements, but makes it unusable.
+/// @param set Structure to destroy.
+void destroy_iroaring_set(iroaring_set_s * const set);
+
+/// @brief Clears a structure and destroys its elements, but remains usable.
+/// @param set Structure to destroy.
+void clear_iroaring_set(iroaring_set_s * const set);
+
+/// @brief Creates a copy of a structure and all its elements.
+/// @param set Structure to copy.
+/// @return Set structure.
+iroaring_set_s copy_iroaring_set(iroaring_set_s const * const set);
+
+/// @brief Checks if structure is empty.
+/// @param set Structure to check.
+/// @return 'true' if empty, 'false' if not.
+bool is_empty_iroaring_set(iroaring_set_s const * const set);
+
+/// @brief Sets growth and shrink policy used when structure's containers expand or contract.
+/// @param set Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_iroaring_set(iroaring_set_s * const set, growth_s const growth);
+
+/// @brief Re-encodes every container into its smallest encoding and frees unused memory.
+/// @param set Structure to shrink.
+/// @note Insertions don't turn containers into runs, so clustered structures should be shrunk once built.
+void shrink_to_fit_iroaring_set(iroaring_set_s * const set);
+
+/// @brief Inserts unique element into structure.
+/// @param set Structure to insert element into.
+/// @param index Element to insert.
+void insert_iroaring_set(iroaring_set_s * const set, size_t const index);
+
+/// @brief Removes unique element from structure.
+/// @param set Structure to remove element into.
+/// @param index Element to remove.
+void remove_iroaring_set(iroaring_set_s * const set, size_t const index);
+
+/// @brief Checks if structure contains element.
+/// @param set Structure to check.
+/// @param index Element to check.
+/// @return 'true' if contained, 'false' otherwise.
+bool contains_iroaring_set(iroaring_set_s const * const set, size_t const index);
+
+/// @brief Performs union of two structures and returns a new copy.
+/// @param set_one First structure to union.
+/// @param set_two Second structure to union.
+/// @return Union structure.
+iroaring_set_s union_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two);
+
+/// @brief Performs intersection of two structures and returns a new copy.
+/// @param set_one First structure to intersect.
+/// @param set_two Second structure to intersect.
+/// @return Intersect structure.
+iroaring_set_s intersect_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two);
+
+/// @brief Performs subtraction of two structures and returns a new copy.
+/// @param minuend Structure to subtract from.
+/// @param subtrahend Structure to subtract with.
+/// @return Subtract structure.
+iroaring_set_s subtract_iroaring_set(iroaring_set_s const * const minuend, iroaring_set_s const * const subtrahend);
+
+/// @brief Performs exclusion (symmetric difference) of two structures and returns a new copy.
+/// @param set_one First structure to exclude.
+/// @param set_two Second structure to exclude.
+/// @return Exclude structure.
+iroaring_set_s exclude_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two);
+
+/// @brief Checks if structure is subset of another structure.
+/// @param superset Superset structure to check with.
+/// @param subset Subset structure to check from.
+/// @return 'true' if structure is subset, 'false' otherwise.
+bool is_subset_iroaring_set(iroaring_set_s const * const superset, iroaring_set_s const * const subset);
+
+/// @brief Checks if structure is proper subset of another structure.
+/// @param superset Superset structure to check with.
+/// @param subset Subset structure to check from.
+/// @return 'true' if structure is proper subset, 'false' otherwise.
+bool is_proper_subset_iroaring_set(iroaring_set_s const * const superset, iroaring_set_s const * const subset);
+
+/// @brief Checks if structures are disjoint from each other.
+/// @param set_one First structure to check.
+/// @param set_two Second structure to check.
+/// @return 'true' if structures are disjoint, 'false' otherwise.
+bool is_disjoint_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two);
+
+/// @brief Iterates over each element in structure in ascending order.
+/// @param set Structure to iterate over.
+/// @param manage Function pointer to handle each element reference using generic arguments.
+/// @param am Generic arguments to use in function pointer.
+/// @note Function does not change the set indexes.
+void each_index_iroaring_set(iroaring_set_s const * const set, manage_fn const manage, void * const am);
+
+#endif // IROARING_SET_H
@@ -20,6 +20,8 @@ typedef struct infinite_separate_chaining_hash_set {
     char * elements;
     size_t * next, * prev, * head, * hashes;
     size_t size, length, capacity;
+    index_e indexing;
+    growth_s growth;
     memory_s const * allocator;
 } isc_hash_set_s;
 
@@ -66,6 +68,26 @@ isc_hash_set_s copy_isc_hash_set(isc_hash_set_s const * const set, copy_fn const
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_isc_hash_set(isc_hash_set_s const * const set);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param set Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_isc_hash_set(isc_hash_set_s * const set, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param set Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_isc_hash_set(isc_hash_set_s * const set, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param set Structure to shrink.
+void shrink_to_fit_isc_hash_set(isc_hash_set_s * const set);
+
+/// @brief Changes how hashes are reduced into bucket indexes and rehashes elements.
+/// @param set Structure to reindex.
+/// @param indexing New bucket indexing mode.
+/// @note MASK_INDEX rounds capacity up to a power of two and keeps it that way.
+void reindex_isc_hash_set(isc_hash_set_s * const set, index_e const indexing);
+
 /// @brief Inserts unique element into structure.
 /// @param set Structure to insert element into.
 /// @param element Element to insert.
@@ -83,6 +105,13 @@ void remove_isc_hash_set(isc_hash_set_s * const set, void const * const element,
 /// @return 'true' if contained, 'false' otherwise.
 bool contains_isc_hash_set(isc_hash_set_s const * const set, void const * const element);
 
+/// @brief Checks if structure contains each element in array, hashing and prefetching them in batches.
+/// @param set Structure to check.
+/// @param elements Array of elements to check.
+/// @param count Number of elements in array.
+/// @param results Array to save 'true' if element at same index is contained, 'false' otherwise.
+void contains_many_isc_hash_set(isc_hash_set_s const * const set, void const * const elements, size_t const count, bool * const results);
+
 /// @brief Performs union of two structures and returns a new copy.
 /// @param set_one First structure to union.
 /// @param set_two Second structure to union.
@@ -23,6 +23,7 @@ typedef struct infinite_adelson_velsky_landis_tree {
     size_t * node[IAVLT_NODE_COUNT];
     size_t * height;
     size_t size, length, capacity, root;
+    growth_s growth; // policy to expand and shrink capacity with
     memory_s const * allocator;
 } iavl_tree_s;
 
@@ -65,6 +66,20 @@ iavl_tree_s copy_iavl_tree(iavl_tree_s const * const tree, copy_fn const copy, v
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_iavl_tree(iavl_tree_s const * const tree);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param tree Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_iavl_tree(iavl_tree_s * const tree, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param tree Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_iavl_tree(iavl_tree_s * const tree, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param tree Structure to shrink.
+void shrink_to_fit_iavl_tree(iavl_tree_s * const tree);
+
 /// @brief Inserts a single element into the structure.
 /// @param tree Structure to insert into.
 /// @param element Element buffer to insert.
@@ -23,6 +23,7 @@ typedef struct infinite_binary_search_tree {
     size_t * parent;
     size_t * node[IBSEARCH_TREE_NODE_COUNT];
     size_t size, length, capacity, root;
+    growth_s growth; // policy to expand and shrink capacity with
     memory_s const * allocator;
 } ibsearch_tree_s;
 
@@ -65,6 +66,20 @@ ibsearch_tree_s copy_ibsearch_tree(ibsearch_tree_s const * const tree, copy_fn c
 /// @return 'true' if empty, 'false' if not.
 bool is_empty_ibsearch_tree(ibsearch_tree_s const * const tree);
 
+/// @brief Sets growth and shrink policy used when structure expands or contracts.
+/// @param tree Structure to set policy for.
+/// @param growth Growth policy structure.
+void growth_ibsearch_tree(ibsearch_tree_s * const tree, growth_s const growth);
+
+/// @brief Expands structure's capacity to fit at least capacity elements without reallocating.
+/// @param tree Structure to reserve capacity for.
+/// @param capacity Minimum capacity.
+void reserve_ibsearch_tree(ibsearch_tree_s * const tree, size_t const capacity);
+
+/// @brief Shrinks structure's capacity to its length, freeing unused memory.
+/// @param tree Structure to shrink.
+void shrink_to_fit_ibsearch_tree(ibsearch_tree_s * const tree);
+
 /// @brief Inserts a single element into the structure.
 /// @param tree Structure to insert into.
 /// @param element Element buffer to insert.
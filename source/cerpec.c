@@ -36,3 +36,40 @@ memory_s compose_memory(const alloc_fn alloc, const realloc_fn realloc, const fr
 
     return (memory_s) { .alloc = alloc, .free = free, .realloc = realloc, .arg = arg, };
 }
+
+growth_s compose_growth(size_t const factor, size_t const chunk, size_t const shrink) {
+    error(factor > 1 && "Factor must be greater than one.");
+    error(chunk && "Chunk can't be zero.");
+    error((!shrink || shrink >= factor) && "Shrink must be zero or at least factor.");
+
+    return (growth_s) { .factor = factor, .chunk = chunk, .shrink = shrink, };
+}
+
+size_t expand_growth(growth_s const * const growth, size_t const length) {
+    error(growth && "Paremeter can't be NULL.");
+
+    valid(growth->factor > 1 && "Factor must be greater than one.");
+    valid(growth->chunk && "Chunk can't be zero.");
+
+    if (!length) {
+        return growth->chunk;
+    }
+
+    error(length <= (size_t)(-1) / growth->factor && "Capacity will overflow.");
+    return length * growth->factor;
+}
+
+size_t shrink_growth(growth_s const * const growth, size_t const length, size_t const capacity) {
+    error(growth && "Paremeter can't be NULL.");
+
+    valid(length <= capacity && "Length exceeds capacity.");
+    valid((!growth->shrink || growth->shrink >= growth->factor) && "Shrink must be zero or at least factor.");
+
+    // never shrink, or too many elements left, or small non-empty structure
+    if (!growth->shrink || length > capacity / growth->shrink || (length && length <= growth->chunk)) {
+        return capacity;
+    }
+
+    // leave room of shrink / factor times length, equals length with default policy
+    return length * growth->shrink / growth->factor;
+}
@@ -4,6 +4,7 @@
 #include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 void voiddst(void * const element, void * arg) {
     (void)(element);
@@ -411,6 +412,12 @@ size_t inthshmurmur(void const * const element, void * arg) {
     return key;
 }
 
+size_t intkey(void const * const element, void * arg) {
+    (void)(arg);
+    // flipping sign bit maps integers to unsigned keys in same order
+    return (size_t)((unsigned)(*(int*)element) ^ (~(UINT_MAX >> 1)));
+}
+
 int intcmp(void const * const a, void const * const b, void * arg) {
     (void)(arg);
     return (*(int*)a) - (*(int*)b);
@@ -490,6 +497,11 @@ size_t uinthshsame(void const * const element, void * arg) {
     return (size_t)(*(unsigned*)element);
 }
 
+size_t uintkey(void const * const element, void * arg) {
+    (void)(arg);
+    return (size_t)(*(unsigned*)element);
+}
+
 int uintcmp(void const * const a, void const * const b, void * arg) {
     (void)(arg);
     unsigned const a_temp = (*(unsigned*)a);
@@ -1,8 +1,26 @@
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#       undef _POSIX_C_SOURCE
+#       define _POSIX_C_SOURCE 200112L // imports pthread_t and condition variables in strict C99
+#   endif
+#   include <pthread.h>
+#endif
+
 #include <graph/iam_graph.h>
+#include <misc/idisjoint_set.h>
+#include <dodac.h>
 
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+/// @brief Number of bits in a single frontier or visited bitmap word, same as in 'ibitwise_set_s'.
+#define IAM_GRAPH_BIT_COUNT (sizeof(uint64_t) * CHAR_BIT)
+
 struct iam_graph_queue {
     size_t * array;
     size_t length, current;
@@ -27,9 +45,87 @@ struct family_stack {
     size_t length;
 };
 
-struct visited_list_array {
-    bool * set;
-    size_t head, length, * next, * prev;
+/// @brief Edge with its radix sort key.
+struct iam_graph_keyed {
+    size_t key;
+    iam_edge_s edge;
+};
+
+/// @brief Boruvka round state shared by every thread.
+struct iam_graph_boruvka {
+    iam_graph_s const * graph;
+    size_t * components, * cheapest; // root of each vertex' set and neighbor of its cheapest edge leaving set
+    size_t threads;
+};
+
+/// @brief Thread of Boruvka round that owns a contiguous range of vertices.
+struct iam_graph_boruvka_worker {
+    struct iam_graph_boruvka * boruvka;
+    size_t index;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+};
+
+/// @brief Relaxation kernels of all pairs shortest paths, known cost types skip function pointer calls.
+enum iam_graph_kernel {
+    IAM_GRAPH_GENERIC_KERNEL = 0, IAM_GRAPH_INT_KERNEL, IAM_GRAPH_DOUBLE_KERNEL,
+};
+
+/// @brief Tiled Floyd-Warshall phase state shared by every thread.
+struct iam_graph_floyd {
+    table_s * table;
+    char * scratch; // temporary cost for each thread
+    size_t length, tiles, threads, diagonal; // vertex count, tiles per side, thread count and current diagonal tile
+    bool cross; // 'true' if phase relaxes diagonal tile's row and column, 'false' if it relaxes remaining tiles
+    enum iam_graph_kernel kernel;
+};
+
+/// @brief Thread of Floyd-Warshall phase that owns a contiguous range of tile rows.
+struct iam_graph_floyd_worker {
+    struct iam_graph_floyd * floyd;
+    size_t index;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+};
+
+/// @brief Barrier whose last arriving thread advances parallel search to next level before releasing others.
+struct iam_graph_barrier {
+#if defined(_WIN32)
+    SRWLOCK lock;
+    CONDITION_VARIABLE condition;
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t condition;
+#endif
+    size_t waiting, generation;
+};
+
+/// @brief Level synchronous breadth first search state shared by every thread.
+struct iam_graph_parallel {
+    iam_graph_s const * graph;
+    table_s * table;
+    uint64_t * visited, * frontier, * next; // bitmaps with 'ibitwise_set_s' word size, lowest bit first
+    size_t * counts, * degrees; // number of vertices and sum of their degrees each thread added to next frontier
+    size_t words, threads, end, unexplored; // unexplored is sum of unvisited vertices' degrees
+    bool bottom_up, done;
+    struct iam_graph_barrier barrier;
+};
+
+/// @brief Thread of parallel search that owns a contiguous range of bitmap words.
+struct iam_graph_worker {
+    struct iam_graph_parallel * parallel;
+    size_t index;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
 };
 
 /// @brief Resize function for graph.
@@ -37,27 +133,185 @@ struct visited_list_array {
 /// @param size New size to resize into.
 void _iam_graph_resize(iam_graph_s * const graph, size_t const size);
 
-/// @brief Initialize set table
-/// @param table
-/// @param vertex_length
-void _make_set(table_s const * table, size_t const vertex_length);
-
-/// @brief Find parent helper funtion for union set function used in Kruskal's MST algorithm.
-/// @param table Kruskal table structure to for parent.
-/// @param vertex Index of child vertex to search parent.
-/// @return Parent vertex index.
-/// @note  Also known as find-set in disjoint sets.
-size_t _find_parent(table_s const * const table, size_t const vertex);
-
-/// @brief Union set function to union two disjoint sets commonly used in Kruskal's MST algorithm.
-/// @param table Table of vertices with costs/ranks.
-/// @param source Source vertex index to union.
-/// @param destination Destination vertex idnex to union.
-/// @param increment Increment function pointer to increment source parent's rank.
-/// @param increment_args Increment function pointer arguments.
-void _union_set(table_s const * const table, size_t const source, size_t const destination, set_fn const increment, void * increment_args);
-
-void _set_visited(struct visited_list_array * const visited, size_t const index);
+/// @brief Resets workspace and marks start vertex as reached with zero cost.
+/// @param graph Graph to search.
+/// @param workspace Workspace to search with.
+/// @param start Starting vertex index.
+void _iam_graph_start(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start);
+
+/// @brief Prepares table and disjoint set with each vertex in its own set and with zero cost.
+/// @param graph Graph to span.
+/// @param table Table to prepare.
+/// @param set Disjoint set to fill.
+void _iam_graph_kruskal_start(iam_graph_s const * const graph, table_s * const table, idisjoint_set_s * const set);
+
+/// @brief Sets each vertex' previous index to root of its set and destroys disjoint set.
+/// @param graph Graph to span.
+/// @param table Table to finish.
+/// @param set Disjoint set to destroy.
+void _iam_graph_kruskal_end(iam_graph_s const * const graph, table_s * const table, idisjoint_set_s * const set);
+
+/// @brief Saves every edge into array by walking packed edges in memory order.
+/// @param graph Graph to get edges from.
+/// @param edges Array of at least graph's edge length edges.
+void _iam_graph_collect(iam_graph_s const * const graph, iam_edge_s * const edges);
+
+/// @brief Joins edge's vertices' sets and adds edge's cost into joined set's root.
+/// @param table Table with costs.
+/// @param set Disjoint set of vertices.
+/// @param edge Edge to join.
+/// @param cost Temporary cost to juggle edge into.
+/// @return 'true' if vertices were in different sets, 'false' otherwise.
+bool _iam_graph_join(table_s * const table, idisjoint_set_s * const set, iam_edge_s const * const edge, void * const cost);
+
+/// @brief Sorts edges by their weights using graph's compare function.
+/// @param graph Graph of edges.
+/// @param edges Array of edges.
+/// @param length Number of edges.
+void _iam_graph_sort(iam_graph_s const * const graph, iam_edge_s * const edges, size_t const length);
+
+/// @brief Filter Kruskal step that joins edges lighter than pivot before filtering heavier ones.
+/// @param graph Graph of edges.
+/// @param table Table with costs.
+/// @param set Disjoint set of vertices.
+/// @param edges Array of edges.
+/// @param length Number of edges.
+/// @param cost Temporary cost to juggle edges into.
+void _iam_graph_filter(iam_graph_s const * const graph, table_s * const table, idisjoint_set_s * const set, iam_edge_s * const edges, size_t const length, void * const cost);
+
+/// @brief Expands one level of bidirectional breadth first search's side.
+/// @param graph Graph to search.
+/// @param side Workspace of expanded side.
+/// @param other Workspace of other side.
+/// @param queue Queue of expanded side.
+/// @return Index of vertex both sides reached, or 'IAM_SPECIAL' if searches didn't meet.
+size_t _iam_graph_bfs_level(iam_graph_s const * const graph, graph_workspace_s * const side, graph_workspace_s const * const other, struct iam_graph_queue * const queue);
+
+/// @brief Settles closest vertex of bidirectional Dijkstra's side and updates shortest path through its neighbors.
+/// @param graph Graph to search.
+/// @param side Workspace of settled side.
+/// @param other Workspace of other side.
+/// @param best Cost of shortest path found so far.
+/// @param meet Index of shortest path's meeting vertex.
+void _iam_graph_settle(iam_graph_s const * const graph, graph_workspace_s * const side, graph_workspace_s * const other, void * const best, size_t * const meet);
+
+/// @brief Writes backward search's path from meeting vertex to its start into forward search's table.
+/// @param graph Graph that was searched.
+/// @param forward Workspace of forward search.
+/// @param backward Workspace of backward search.
+/// @param meet Index of meeting vertex, or 'IAM_SPECIAL' if searches didn't meet.
+/// @param cumulative 'true' if costs are summed along path, 'false' if each is its edge's cost.
+void _iam_graph_meet(iam_graph_s const * const graph, graph_workspace_s * const forward, graph_workspace_s const * const backward, size_t const meet, bool const cumulative);
+
+/// @brief Counts trailing zero bits of non-zero bitmap word, i.e. index of its lowest set bit.
+/// @param word Non-zero bitmap word.
+/// @return Index of lowest set bit.
+size_t _iam_graph_trailing(uint64_t const word);
+
+/// @brief Gets edge weight between two different vertices.
+/// @param graph Graph to get edge from.
+/// @param one First vertex index.
+/// @param two Second vertex index.
+/// @return Pointer to edge weight, which may be graph's non-edge.
+char const * _iam_graph_edge(iam_graph_s const * const graph, size_t const one, size_t const two);
+
+/// @brief Runs parallel search's levels on worker's range of vertices until search is done.
+/// @param worker Worker to run.
+void _iam_graph_traverse(struct iam_graph_worker * const worker);
+
+/// @brief Expands frontier top-down by checking each frontier vertex' edges into worker's unvisited vertices.
+/// @param worker Worker whose vertices are expanded.
+void _iam_graph_top_down(struct iam_graph_worker * const worker);
+
+/// @brief Expands frontier bottom-up by searching a frontier neighbor for each of worker's unvisited vertices.
+/// @param worker Worker whose vertices are expanded.
+void _iam_graph_bottom_up(struct iam_graph_worker * const worker);
+
+/// @brief Sets vertex' previous index and cost and counts it into worker's part of next frontier.
+/// @param worker Worker that owns vertex.
+/// @param vertex Newly visited vertex.
+/// @param parent Frontier vertex it was reached from.
+void _iam_graph_claim(struct iam_graph_worker * const worker, size_t const vertex, size_t const parent);
+
+/// @brief Advances parallel search to next level and chooses its direction, called by one thread only.
+/// @param parallel Search state.
+void _iam_graph_level(struct iam_graph_parallel * const parallel);
+
+/// @brief Initializes barrier for parallel search.
+/// @param barrier Barrier to initialize.
+void _iam_graph_barrier_init(struct iam_graph_barrier * const barrier);
+
+/// @brief Frees barrier for parallel search.
+/// @param barrier Barrier to free.
+void _iam_graph_barrier_free(struct iam_graph_barrier * const barrier);
+
+/// @brief Waits until every thread of parallel search finishes its level, last one advances search to next level.
+/// @param parallel Search state.
+/// @return 'true' if search is done, 'false' otherwise.
+bool _iam_graph_barrier_wait(struct iam_graph_parallel * const parallel);
+
+/// @brief Checks if first edge is lighter than second, equal weights are ordered by edges' packed indexes.
+/// @param graph Graph of edges.
+/// @param one Pair of first edge's vertex indexes.
+/// @param two Pair of second edge's vertex indexes.
+/// @return 'true' if first edge is lighter, 'false' otherwise.
+bool _iam_graph_lighter(iam_graph_s const * const graph, size_t const one[2], size_t const two[2]);
+
+/// @brief Finds cheapest edge leaving its set for each of worker's vertices.
+/// @param worker Worker whose vertices are searched.
+void _iam_graph_cheapest(struct iam_graph_boruvka_worker * const worker);
+
+/// @brief Relaxes costs of a tile through intermediate vertices of another tile.
+/// @param floyd Floyd-Warshall state.
+/// @param scratch Temporary cost.
+/// @param row Tile row of relaxed costs' sources.
+/// @param column Tile column of relaxed costs' destinations.
+/// @param middle Tile of intermediate vertices.
+void _iam_graph_relax(struct iam_graph_floyd const * const floyd, void * const scratch, size_t const row, size_t const column, size_t const middle);
+
+/// @brief Relaxes worker's range of tiles in current Floyd-Warshall phase.
+/// @param worker Worker whose tiles are relaxed.
+void _iam_graph_phase(struct iam_graph_floyd_worker * const worker);
+
+/// @brief Runs current Floyd-Warshall phase on every worker, calling thread works as first one.
+/// @param workers Array of workers.
+void _iam_graph_parallel_phase(struct iam_graph_floyd_worker * const workers);
+
+#if defined(_WIN32)
+/// @brief Thread entry point of parallel search.
+/// @param worker Worker to run.
+/// @return Zero.
+DWORD WINAPI _iam_graph_thread(LPVOID worker);
+#else
+/// @brief Thread entry point of parallel search.
+/// @param worker Worker to run.
+/// @return NULL.
+void * _iam_graph_thread(void * worker);
+#endif
+
+#if defined(_WIN32)
+/// @brief Thread entry point of Boruvka round.
+/// @param worker Worker to run.
+/// @return Zero.
+DWORD WINAPI _iam_graph_boruvka_thread(LPVOID worker);
+#else
+/// @brief Thread entry point of Boruvka round.
+/// @param worker Worker to run.
+/// @return NULL.
+void * _iam_graph_boruvka_thread(void * worker);
+#endif
+
+#if defined(_WIN32)
+/// @brief Thread entry point of Floyd-Warshall phase.
+/// @param worker Worker to run.
+/// @return Zero.
+DWORD WINAPI _iam_graph_floyd_thread(LPVOID worker);
+#else
+/// @brief Thread entry point of Floyd-Warshall phase.
+/// @param worker Worker to run.
+/// @return NULL.
+void * _iam_graph_floyd_thread(void * worker);
+#endif
 
 iam_graph_s create_iam_graph(size_t const vertex_size, size_t const weight_size, compare_fn const compare, void * const ac, void * const none) {
     error(vertex_size && "Parameter can't be zero.");
@@ -67,7 +321,7 @@ iam_graph_s create_iam_graph(size_t const vertex_size, size_t const weight_size,
 
     return (iam_graph_s) {
         .vertex_size = vertex_size, .weight_size = weight_size, .compare = compare, .ac = ac, .none = none,
-        .allocator = &standard,
+        .allocator = &standard, .growth = CERPEC_GROWTH(IAM_GRAPH_CHUNK),
     };
 }
 
@@ -80,7 +334,7 @@ iam_graph_s make_iam_graph(size_t const vertex_size, size_t const weight_size, c
 
     return (iam_graph_s) {
         .vertex_size = vertex_size, .weight_size = weight_size, .compare = compare, .ac = ac, .none = none,
-        .allocator = allocator,
+        .allocator = allocator, .growth = CERPEC_GROWTH(IAM_GRAPH_CHUNK),
     };
 }
 
@@ -163,7 +417,7 @@ iam_graph_s copy_iam_graph(iam_graph_s const * const graph, copy_fn const copy_v
         .vertex_length = graph->vertex_length, .edge_length = graph->edge_length, .capacity = graph->capacity,
 
         .none = graph->none,
-        .allocator = graph->allocator,
+        .allocator = graph->allocator, .growth = graph->growth,
 
         .degrees = graph->allocator->alloc(graph->capacity * sizeof(size_t), graph->allocator->arg),
         .vertices = graph->allocator->alloc(graph->capacity * graph->vertex_size, graph->allocator->arg),
@@ -206,6 +460,49 @@ bool is_empty_iam_graph(iam_graph_s const * const graph) {
     return !(graph->vertex_length);
 }
 
+void growth_iam_graph(iam_graph_s * const graph, growth_s const growth) {
+    error(graph && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph->growth = growth;
+}
+
+void reserve_iam_graph(iam_graph_s * const graph, size_t const capacity) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (capacity > graph->capacity) {
+        _iam_graph_resize(graph, capacity);
+    }
+}
+
+void shrink_to_fit_iam_graph(iam_graph_s * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (graph->vertex_length != graph->capacity) {
+        _iam_graph_resize(graph, graph->vertex_length);
+    }
+}
+
 bool is_complete_iam_graph(iam_graph_s const * const graph) {
     error(graph && "Parameter can't be NULL.");
 
@@ -350,82 +647,23 @@ bool is_cyclic_iam_graph(iam_graph_s const * const graph) {
         return false;
     }
 
-    // initialize visited list array set for best access, removal and unvisited non-connected graphs
-    struct visited_list_array visited = {
-        .set = graph->allocator->alloc(graph->vertex_length * sizeof(bool), graph->allocator->arg),
-        .next = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg),
-        .prev = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg),
-        .length = graph->vertex_length,
-    };
-    error(visited.set && "Memory allocation failed.");
-    error(visited.next && "Memory allocation failed.");
-    error(visited.prev && "Memory allocation failed.");
-
-    // set visited set to false
-    memset(visited.set, 0, sizeof(bool) * graph->vertex_length);
-
-    // initialize visited list array to circualr doubly linked list
+    idisjoint_set_s set = make_idisjoint_set(graph->allocator);
+    reserve_idisjoint_set(&set, graph->vertex_length);
     for (size_t i = 0; i < graph->vertex_length; ++i) {
-        visited.next[i] = i + 1;
-        visited.prev[i] = i - 1;
+        insert_idisjoint_set(&set);
     }
-    // since vertex length is not zero (thanks to early return), no underflow array access should occur
-    visited.next[graph->vertex_length - 1] = 0;
-    visited.prev[0] = graph->vertex_length - 1;
-
-    // double vertex stack to store both parent and child node
-    struct family_stack stack = {
-        .array = graph->allocator->alloc(sizeof(struct family) * graph->vertex_length, graph->allocator->arg),
-    };
-    error(stack.array && "Memory allocation failed.");
 
-    // set contains cycle flag for goto cleanup in nested loops
+    // an edge whose vertices are already connected closes a cycle, no matter which component it's in
     bool contains_cycle = false;
-    while (visited.length) {
-        // get unvisited head vertex in case of non-connected graph, set it to visited and add it to the stack
-        size_t const current = visited.head;
-        stack.array[stack.length++] = (struct family) { .parent = IAM_SPECIAL, .child = current };
-        _set_visited(&visited, current);
-
-        // loop until stack is empty
-        // end program if cycle was found by goto jumping to cleanup
-        while (stack.length) {
-            // get visited vertex from child pair
-            struct family const pair = stack.array[--stack.length];
-            size_t const v = pair.child;
-
-            // while each neighbor of v is iterated
-            size_t const v_off = (v * (v - 1)) / 2;
-            for (size_t i = 0; i < graph->vertex_length - 1; i++) {
-                size_t const i_off = (i * (i + 1)) / 2;
-
-                // get neighbor index and edge weight array position
-                size_t const u = (i < v) ? i : i + 1;
-                size_t const e = v <= i ? i_off + v : v_off + i;
-
-                // get edge weight and check if it is valid
-                void const * edge = graph->edges + (e * graph->weight_size);
-                if (!graph->compare(graph->none, edge, graph->ac)) { continue; }
-
-                // if vertex u wasn't visited, then visit it and add pair to stack
-                // else if neighbor isn't parent, then cycle was found (leave nested loops)
-                if (!visited.set[u]) {
-                    _set_visited(&visited, u);
-                    stack.array[stack.length++] = (struct family) { .parent = v, .child = u };
-                } else if (pair.parent != u) {
-                    contains_cycle = true;
-                    goto CLEANUP;
-                }
-            }
+    for (size_t j = 1; j < graph->vertex_length && !contains_cycle; ++j) {
+        size_t const offset = (j * (j - 1)) / 2;
+        for (size_t i = 0; i < j && !contains_cycle; ++i) {
+            void const * edge = graph->edges + ((offset + i) * graph->weight_size);
+            contains_cycle = graph->compare(graph->none, edge, graph->ac) && !union_idisjoint_set(&set, i, j);
         }
     }
 
-CLEANUP:
-    graph->allocator->free(stack.array, graph->allocator->arg);
-
-    graph->allocator->free(visited.set, graph->allocator->arg);
-    graph->allocator->free(visited.next, graph->allocator->arg);
-    graph->allocator->free(visited.prev, graph->allocator->arg);
+    destroy_idisjoint_set(&set);
 
     return contains_cycle;
 }
@@ -441,8 +679,7 @@ size_t insert_vertex_iam_graph(iam_graph_s * const graph, void const * const ver
     valid(graph->allocator && "Allocator can't be NULL.");
 
     if (graph->vertex_length == graph->capacity) {
-        size_t const capacity = graph->vertex_length ? graph->vertex_length * CERPEC_FACTOR : IAM_GRAPH_CHUNK;
-        _iam_graph_resize(graph, capacity);
+        _iam_graph_resize(graph, expand_growth(&(graph->growth), graph->vertex_length));
     }
 
     graph->degrees[graph->vertex_length] = 0;
@@ -516,9 +753,9 @@ size_t remove_vertex_iam_graph(iam_graph_s * const graph, size_t const index, vo
     memmove(removed, last, graph->vertex_size); // memmove since removed could be last
 
     // shrink graph if elements fit into smaller memory chunk
-    if (graph->vertex_length <= graph->capacity / CERPEC_FACTOR &&
-        (graph->vertex_length > IAM_GRAPH_CHUNK || !graph->vertex_length)) {
-        _iam_graph_resize(graph, graph->vertex_length);
+    size_t const capacity = shrink_growth(&(graph->growth), graph->vertex_length, graph->capacity);
+    if (capacity != graph->capacity) {
+        _iam_graph_resize(graph, capacity);
     }
 
     // if last index was removed return an invalid index, else return the last vertex' index before it was moved
@@ -586,9 +823,9 @@ void remove_weight_iam_graph(iam_graph_s * const graph, size_t const index_one,
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    // reflect edge insertion in vertex one's and two's degrees
-    graph->degrees[index_one]++;
-    graph->degrees[index_two]++;
+    // reflect edge removal in vertex one's and two's degrees
+    graph->degrees[index_one]--;
+    graph->degrees[index_two]--;
 
     // get smallest and largest vertex index for edge removal calculations
     size_t const minimum = index_one < index_two ? index_one : index_two;
@@ -647,7 +884,7 @@ void get_weight_iam_graph(iam_graph_s const * const graph, size_t const index_on
     // assert that an edge exists between vertices
     assert(graph->compare(graph->none, graph->edges + ((start_row + minimum) * graph->weight_size), graph->ac));
 
-    memcpy(buffer, graph->edges + ((start_row + minimum) + graph->weight_size), graph->weight_size);
+    memcpy(buffer, graph->edges + ((start_row + minimum) * graph->weight_size), graph->weight_size);
 }
 
 size_t degree_iam_graph(iam_graph_s const * const graph, size_t const index) {
@@ -666,8 +903,20 @@ size_t degree_iam_graph(iam_graph_s const * const graph, size_t const index) {
 void bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
     error(graph && "Parameter can't be NULL.");
     error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    bfs_workspace_iam_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void bfs_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
     error(start < graph->vertex_length && "Parameter can't exceed length.");
     error((end < graph->vertex_length || end == IAM_SPECIAL) && "Parameter can't exceed length.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
 
     valid(graph->compare && "Compare function can't be NULL.");
     valid(graph->weight_size && "Edge size can't be zero.");
@@ -675,31 +924,12 @@ void bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    bool * visited = graph->allocator->alloc(sizeof(bool) * graph->vertex_length, graph->allocator->arg);
-    error((!graph->vertex_length || visited) && "Memory allocation failed.");
-
-    table->graph = graph;
-    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
-    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
-    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
-    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
-
-    for (size_t i = 0; i < graph->vertex_length; ++i) {
-        visited[i] = false;
-        memcpy(table->costs + (i * table->size), table->infinite, table->size);
-        table->previous[i] = IAM_SPECIAL;
-    }
-    memcpy(table->costs + (table->size * start), table->zero, table->size);
-
-    struct iam_graph_queue queue = {
-        .array = graph->allocator->alloc(sizeof(size_t) * graph->vertex_length, graph->allocator->arg),
-    };
-    error((!graph->vertex_length || queue.array) && "Memory allocation failed.");
+    table_s * table = &workspace->table;
+    _iam_graph_start(graph, workspace, start);
 
-    if (graph->vertex_length) {
-        visited[start] = true;
-        queue.array[queue.length++] = start;
-    }
+    // reached vertices double as visited ones, since each vertex is queued only once
+    struct iam_graph_queue queue = { .array = workspace->array, };
+    queue.array[queue.length++] = start;
 
     while (queue.length && end != queue.array[queue.current]) {
         size_t const v = queue.array[queue.current++];
@@ -713,26 +943,23 @@ void bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_
             size_t const e = v <= i ? i_off + v : v_off + i;
 
             void const * edge = graph->edges + (e * graph->weight_size);
-            if (graph->compare(graph->none, edge, graph->ac) && !visited[u]) {
-                visited[u] = true;
+            if (graph->compare(graph->none, edge, graph->ac) && reach_graph_workspace(workspace, u)) {
                 queue.array[queue.current + queue.length++] = u;
 
                 table->previous[u] = v;
                 memcpy(table->costs + (u * table->size), table->zero, table->size);
-                table->juggle(table->costs + (u * table->size), edge, table->as);
+                table->juggle(table->costs + (u * table->size), edge, table->aj);
             }
         }
     }
-
-    graph->allocator->free(queue.array, graph->allocator->arg);
-    graph->allocator->free(visited, graph->allocator->arg);
 }
 
-void dfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+void parallel_bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end, size_t const threads) {
     error(graph && "Parameter can't be NULL.");
     error(table && "Parameter can't be NULL.");
     error(start < graph->vertex_length && "Parameter can't exceed length.");
     error((end < graph->vertex_length || end == IAM_SPECIAL) && "Parameter can't exceed length.");
+    error(threads && "Parameter can't be zero.");
 
     valid(graph->compare && "Compare function can't be NULL.");
     valid(graph->weight_size && "Edge size can't be zero.");
@@ -740,32 +967,153 @@ void dfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    bool * visited = graph->allocator->alloc(sizeof(bool) * graph->vertex_length, graph->allocator->arg);
-    error((!graph->vertex_length || visited) && "Memory allocation failed.");
+    // every thread owns at least one bitmap word, so no two threads ever write the same word
+    size_t const words = (graph->vertex_length + IAM_GRAPH_BIT_COUNT - 1) / IAM_GRAPH_BIT_COUNT;
+    struct iam_graph_parallel parallel = {
+        .graph = graph, .table = table, .words = words, .threads = threads < words ? threads : words, .end = end,
+    };
+
+    parallel.visited = graph->allocator->alloc(3 * words * sizeof(uint64_t), graph->allocator->arg);
+    error(parallel.visited && "Memory allocation failed.");
+    parallel.frontier = parallel.visited + words;
+    parallel.next = parallel.frontier + words;
+    memset(parallel.visited, 0, 3 * words * sizeof(uint64_t));
+
+    parallel.counts = graph->allocator->alloc(2 * parallel.threads * sizeof(size_t), graph->allocator->arg);
+    error(parallel.counts && "Memory allocation failed.");
+    parallel.degrees = parallel.counts + parallel.threads;
+
+    struct iam_graph_worker * workers = graph->allocator->alloc(parallel.threads * sizeof(struct iam_graph_worker), graph->allocator->arg);
+    error(workers && "Memory allocation failed.");
 
     table->graph = graph;
     table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
-    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
+    error(table->costs && "Memory allocation failed.");
     table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
-    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
+    error(table->previous && "Memory allocation failed.");
 
     for (size_t i = 0; i < graph->vertex_length; ++i) {
-        visited[i] = false;
         memcpy(table->costs + (i * table->size), table->infinite, table->size);
         table->previous[i] = IAM_SPECIAL;
+        parallel.unexplored += graph->degrees[i];
     }
-    memcpy(table->costs + (table->size * start), table->zero, table->size);
 
-    struct iam_graph_stack stack = {
-        .array = graph->allocator->alloc(sizeof(size_t) * graph->vertex_length, graph->allocator->arg),
-    };
-    error((!graph->vertex_length || stack.array) && "Memory allocation failed.");
+    // bits past last vertex count as visited, so they never get claimed
+    for (size_t i = graph->vertex_length; i < words * IAM_GRAPH_BIT_COUNT; ++i) {
+        parallel.visited[i / IAM_GRAPH_BIT_COUNT] |= (uint64_t)1 << (i % IAM_GRAPH_BIT_COUNT);
+    }
+
+    parallel.visited[start / IAM_GRAPH_BIT_COUNT] |= (uint64_t)1 << (start % IAM_GRAPH_BIT_COUNT);
+    parallel.frontier[start / IAM_GRAPH_BIT_COUNT] |= (uint64_t)1 << (start % IAM_GRAPH_BIT_COUNT);
+    parallel.unexplored -= graph->degrees[start];
+    parallel.done = (start == end);
+    memcpy(table->costs + (start * table->size), table->zero, table->size);
+
+    // calling thread works as first worker, the rest are created for the duration of search
+    bool const search = !parallel.done;
+    _iam_graph_barrier_init(&parallel.barrier);
+    for (size_t i = 0; i < parallel.threads; ++i) {
+        workers[i] = (struct iam_graph_worker) { .parallel = &parallel, .index = i, };
+    }
+
+    for (size_t i = 1; i < parallel.threads && search; ++i) {
+#if defined(_WIN32)
+        workers[i].handle = CreateThread(NULL, 0, _iam_graph_thread, workers + i, 0, NULL);
+        error(workers[i].handle && "Thread creation failed.");
+#else
+        int const result = pthread_create(&(workers[i].handle), NULL, _iam_graph_thread, workers + i);
+        error(!result && "Thread creation failed.");
+        (void)(result);
+#endif
+    }
+
+    if (search) {
+        _iam_graph_traverse(workers);
+    }
+
+    for (size_t i = 1; i < parallel.threads && search; ++i) {
+#if defined(_WIN32)
+        WaitForSingleObject(workers[i].handle, INFINITE);
+        CloseHandle(workers[i].handle);
+#else
+        pthread_join(workers[i].handle, NULL);
+#endif
+    }
+    _iam_graph_barrier_free(&parallel.barrier);
+
+    graph->allocator->free(parallel.visited, graph->allocator->arg);
+    graph->allocator->free(parallel.counts, graph->allocator->arg);
+    graph->allocator->free(workers, graph->allocator->arg);
+}
+
+void bidirectional_bfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error(end < graph->vertex_length && "Parameter can't exceed length.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s forward = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    graph_workspace_s backward = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    _iam_graph_start(graph, &forward, start);
+    _iam_graph_start(graph, &backward, end);
 
-    if (graph->vertex_length) {
-        visited[start] = true;
-        stack.array[stack.length++] = start;
+    struct iam_graph_queue forward_queue = { .array = forward.array, }, backward_queue = { .array = backward.array, };
+    forward_queue.array[forward_queue.length++] = start;
+    backward_queue.array[backward_queue.length++] = end;
+
+    // smaller frontier is expanded, so both searches stay about as wide as their meeting point
+    size_t meet = start == end ? start : IAM_SPECIAL;
+    while (IAM_SPECIAL == meet && forward_queue.length && backward_queue.length) {
+        if (forward_queue.length <= backward_queue.length) {
+            meet = _iam_graph_bfs_level(graph, &forward, &backward, &forward_queue);
+        } else {
+            meet = _iam_graph_bfs_level(graph, &backward, &forward, &backward_queue);
+        }
     }
 
+    _iam_graph_meet(graph, &forward, &backward, meet, false);
+
+    release_graph_workspace(&forward, table);
+    destroy_graph_workspace(&backward);
+}
+
+void dfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    dfs_workspace_iam_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void dfs_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error((end < graph->vertex_length || end == IAM_SPECIAL) && "Parameter can't exceed length.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _iam_graph_start(graph, workspace, start);
+
+    // reached vertices double as visited ones, since each vertex is stacked only once
+    struct iam_graph_stack stack = { .array = workspace->array, };
+    stack.array[stack.length++] = start;
+
     while (stack.length && end != stack.array[stack.length - 1]) {
         size_t const v = stack.array[--stack.length];
 
@@ -777,26 +1125,34 @@ void dfs_iam_graph(iam_graph_s const * const graph, table_s * const table, size_
             size_t const e = v <= i ? i_off + v : v_off + i;
 
             void const * edge = graph->edges + (e * graph->weight_size);
-            if (graph->compare(graph->none, edge, graph->ac) && !visited[u]) {
-                visited[u] = true;
+            if (graph->compare(graph->none, edge, graph->ac) && reach_graph_workspace(workspace, u)) {
                 stack.array[stack.length++] = u;
 
                 table->previous[u] = v;
                 memcpy(table->costs + (u * table->size), table->zero, table->size);
-                table->juggle(table->costs + (u * table->size), edge, table->as);
+                table->juggle(table->costs + (u * table->size), edge, table->aj);
             }
         }
     }
-
-    graph->allocator->free(stack.array, graph->allocator->arg);
-    graph->allocator->free(visited, graph->allocator->arg);
 }
 
 void dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
     error(graph && "Parameter can't be NULL.");
     error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    dijkstra_workspace_iam_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void dijkstra_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
     error(start < graph->vertex_length && "Parameter can't exceed length.");
     error((end < graph->vertex_length || end == IAM_SPECIAL) && "Parameter can't exceed length.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
 
     valid(graph->compare && "Compare function can't be NULL.");
     valid(graph->weight_size && "Edge size can't be zero.");
@@ -804,42 +1160,21 @@ void dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table,
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    table->graph = graph;
-    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
-    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
-    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
-    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
-
-    for (size_t i = 0; i < graph->vertex_length; ++i) {
-        memcpy(table->costs + (i * table->size), table->infinite, table->size);
-        table->previous[i] = IAM_SPECIAL;
-    }
-    memcpy(table->costs + (table->size * start), table->zero, table->size);
-
-    // initialize visited array
-    bool * visited = graph->allocator->alloc(sizeof(bool) * graph->vertex_length, graph->allocator->arg);
-    error((!graph->vertex_length || visited) && "Memory allocation failed.");
-    memset(visited, 0, sizeof(bool) * graph->vertex_length);
-
-    // allocate for both minimum and sum
-    char * buffer = graph->allocator->alloc(2 * table->size, graph->allocator->arg);
-    error(buffer && "Memory allocation failed.");
+    table_s * table = &workspace->table;
+    _iam_graph_start(graph, workspace, start);
 
-    // initialize current minimum vertex
-    struct iam_graph_smallest minimum = {
-        .vertex = start, .cost = buffer,
-    };
-    memcpy(minimum.cost, table->zero, table->size);
+    char * sum = workspace->scratch + (workspace->length * table->size);
 
-    char * sum = buffer + table->size;
-    for (size_t i = 0; i < graph->vertex_length - 1 && end != minimum.vertex && IAM_SPECIAL != minimum.vertex; ++i) {
-        size_t const v = minimum.vertex;
-        void const * v_cost = table->costs + (minimum.vertex * table->size);
+    // heap is keyed by vertex costs, so lowering a cost only needs to move vertex up
+    push_graph_workspace(workspace, table->costs, start);
 
-        minimum.vertex = IAM_SPECIAL;
-        memcpy(minimum.cost, table->infinite, table->size);
+    // next closest vertex is popped instead of scanning all costs, and search ends as soon as end vertex is closest
+    while (workspace->heap_length) {
+        size_t const v = pop_graph_workspace(workspace, table->costs);
+        if (end == v) { break; }
 
-        visited[v] = true;
+        workspace->visited[v] = workspace->epoch;
+        void const * v_cost = table->costs + (v * table->size);
 
         size_t const v_off = (v * (v - 1)) / 2;
         for (size_t j = 0; j < graph->vertex_length - 1; j++) {
@@ -848,41 +1183,91 @@ void dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table,
             size_t const u = (j < v) ? j : j + 1;
             size_t const e = v <= j ? i_off + v : v_off + j;
 
-            if (visited[u]) { continue; }
-
             // save edges for access
             void const * edge = graph->edges + (e * graph->weight_size);
-            void * g_cost = table->costs + (u * table->size);
+            if (workspace->epoch == workspace->visited[u] || !graph->compare(edge, graph->none, graph->ac)) { continue; }
 
-            bool const can_sum = graph->compare(edge, graph->none, graph->ac);
-            void const * temp = can_sum ? table->sum(table->juggle(sum, edge, table->as), v_cost, table->aj) : table->infinite;
-            memmove(sum, temp, table->size);
+            memcpy(sum, table->zero, table->size);
+            memmove(sum, table->sum(table->juggle(sum, edge, table->aj), v_cost, table->as), table->size);
 
-            // if G's cost is smaller destroy table's non-infinite and set it to sum
+            // if sum is smaller than vertex' cost then vertex moves up in heap
+            void * g_cost = table->costs + (u * table->size);
             if (table->compare(sum, g_cost, table->ac) < 0) {
+                reach_graph_workspace(workspace, u);
                 table->previous[u] = v;
                 memcpy(g_cost, sum, table->size);
+                push_graph_workspace(workspace, table->costs, u);
             }
+        }
+    }
+}
 
-            // if index edge exists and either distance edge is none or distance edge is bigger than index edge
-            // then make index edge the new distance edge, and set minimum node to loop index
-            if (table->compare(minimum.cost, g_cost, table->ac) > 0) {
-                memcpy(minimum.cost, g_cost, table->size);
-                minimum.vertex = u;
-            }
+void bidirectional_dijkstra_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error(end < graph->vertex_length && "Parameter can't exceed length.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s forward = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    graph_workspace_s backward = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    _iam_graph_start(graph, &forward, start);
+    _iam_graph_start(graph, &backward, end);
+
+    push_graph_workspace(&forward, forward.table.costs, start);
+    push_graph_workspace(&backward, backward.table.costs, end);
+
+    // unused cost estimates of both workspaces hold shortest path's cost and sum of heap tops
+    char * best = forward.scratch, * tops = backward.scratch;
+    memcpy(best, table->infinite, table->size);
+
+    size_t meet = start == end ? start : IAM_SPECIAL;
+    while (start != end && forward.heap_length && backward.heap_length) {
+        char const * forward_top = forward.table.costs + (forward.array[0] * table->size);
+        char const * backward_top = backward.table.costs + (backward.array[0] * table->size);
+
+        // no unsettled vertex can be on a shorter path once heap tops sum up to shortest path
+        memcpy(tops, forward_top, table->size);
+        if (IAM_SPECIAL != meet && table->compare(table->sum(tops, backward_top, table->as), best, table->ac) >= 0) {
+            break;
+        }
+
+        if (table->compare(forward_top, backward_top, table->ac) <= 0) {
+            _iam_graph_settle(graph, &forward, &backward, best, &meet);
+        } else {
+            _iam_graph_settle(graph, &backward, &forward, best, &meet);
         }
     }
 
-    graph->allocator->free(visited, graph->allocator->arg);
-    graph->allocator->free(buffer, graph->allocator->arg);
+    _iam_graph_meet(graph, &forward, &backward, meet, true);
+
+    release_graph_workspace(&forward, table);
+    destroy_graph_workspace(&backward);
 }
 
 void a_star_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end, operate_fn const heuristic, void * const ah) {
     error(graph && "Parameter can't be NULL.");
     error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    a_star_workspace_iam_graph(graph, &workspace, start, end, heuristic, ah);
+    release_graph_workspace(&workspace, table);
+}
+
+void a_star_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end, operate_fn const heuristic, void * const ah) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
     error(start < graph->vertex_length && "Parameter can't exceed length.");
     error(end < graph->vertex_length && "Parameter can't exceed length.");
     error(heuristic && "Parameter can't be NULL.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
 
     valid(graph->compare && "Compare function can't be NULL.");
     valid(graph->weight_size && "Edge size can't be zero.");
@@ -890,44 +1275,29 @@ void a_star_iam_graph(iam_graph_s const * const graph, table_s * const table, si
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    table->graph = graph;
-    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
-    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
-    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
-    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
-
-    for (size_t i = 0; i < graph->vertex_length; ++i) {
-        memcpy(table->costs + (i * table->size), table->infinite, table->size);
-        table->previous[i] = IAM_SPECIAL;
-    }
-    memcpy(table->costs + (table->size * start), table->zero, table->size);
+    table_s * table = &workspace->table;
+    _iam_graph_start(graph, workspace, start);
 
-    // initialize visited array
-    bool * visited = graph->allocator->alloc(sizeof(bool) * graph->vertex_length, graph->allocator->arg);
-    error((!graph->vertex_length || visited) && "Memory allocation failed.");
-    memset(visited, 0, sizeof(bool) * graph->vertex_length);
+    // F(n) estimates of each vertex are followed by sum and H(n) costs, only reached vertices' estimates are read
+    char * estimates = workspace->scratch;
+    char * sum = estimates + (workspace->length * table->size);
+    char * h_cost = sum + table->size;
 
-    // allocate for all costs to later free at once
-    char * buffer = graph->allocator->alloc(4 * table->size, graph->allocator->arg);
-    error(buffer && "Memory allocation failed.");
+    void const * target = graph->vertices + (end * graph->vertex_size);
 
-    // initialize current minimum vertex
-    struct iam_graph_smallest minimum = {
-        .vertex = start, .cost = buffer,
-    };
-    memcpy(minimum.cost, table->zero, table->size);
+    // start's F(n) is its H(n), since its G(n) is zero
+    heuristic(h_cost, graph->vertices + (start * graph->vertex_size), target, ah);
+    memcpy(estimates + (start * table->size), h_cost, table->size);
 
-    char * sum = buffer + table->size;
-    char * h_cost = buffer + (2 * table->size);
-    char * f_cost = buffer + (3 * table->size);
-    for (size_t i = 0; i < graph->vertex_length - 1 && end != minimum.vertex && IAM_SPECIAL != minimum.vertex; ++i) {
-        size_t const v = minimum.vertex;
-        void const * v_cost = table->costs + (minimum.vertex * table->size);
+    // heap is keyed by F(n) estimates instead of G(n) costs
+    push_graph_workspace(workspace, estimates, start);
 
-        minimum.vertex = IAM_SPECIAL;
-        memcpy(minimum.cost, table->infinite, table->size);
+    while (workspace->heap_length) {
+        size_t const v = pop_graph_workspace(workspace, estimates);
+        if (end == v) { break; }
 
-        visited[v] = true;
+        workspace->visited[v] = workspace->epoch;
+        void const * v_cost = table->costs + (v * table->size);
 
         size_t const v_off = (v * (v - 1)) / 2;
         for (size_t j = 0; j < graph->vertex_length - 1; j++) {
@@ -936,44 +1306,49 @@ void a_star_iam_graph(iam_graph_s const * const graph, table_s * const table, si
             size_t const u = (j < v) ? j : j + 1;
             size_t const e = v <= j ? i_off + v : v_off + j;
 
-            if (visited[u]) { continue; }
-
             // save edges for access
             void const * edge = graph->edges + (e * graph->weight_size);
-            void * g_cost = table->costs + (u * table->size);
+            if (workspace->epoch == workspace->visited[u] || !graph->compare(edge, graph->none, graph->ac)) { continue; }
 
-            bool const can_add = graph->compare(edge, graph->none, graph->ac);
-            void const * temp = can_add ? table->sum(table->juggle(sum, edge, table->as), v_cost, table->aj) : table->infinite;
-            memmove(sum, temp, table->size);
+            memcpy(sum, table->zero, table->size);
+            memmove(sum, table->sum(table->juggle(sum, edge, table->aj), v_cost, table->as), table->size);
 
-            // if G's cost is smaller destroy table's non-infinite and set it to sum
-            if (table->compare(sum, g_cost, table->ac) < 0) {
-                table->previous[u] = v;
-                memcpy(g_cost, sum, table->size);
-            }
+            // if G's cost isn't smaller then neither is F(n)
+            void * g_cost = table->costs + (u * table->size);
+            if (table->compare(sum, g_cost, table->ac) >= 0) { continue; }
+
+            reach_graph_workspace(workspace, u);
+            table->previous[u] = v;
+            memcpy(g_cost, sum, table->size);
 
             // after vertex cost was updated determine F(n) by adding updated G(n) {as vertex cost} and H(n) together
-            heuristic(h_cost, graph->vertices + (v * graph->vertex_size), graph->vertices + (end * graph->vertex_size), ah);
-            // neither g_cost nor h_cost is infinite (used to prevent potential overflow while summing)
-            bool const can_sum = table->compare(g_cost, table->infinite, table->ac) && table->compare(h_cost, table->infinite, table->ac);
-            memcpy(f_cost, can_sum ? table->sum(h_cost, g_cost, table->aj) : table->infinite, table->size);
-
-            // if F(n)'s cost is smaller than the current minimum cost then set minimum cost to F(n)'s
-            if (table->compare(minimum.cost, f_cost, table->ac) > 0) {
-                memcpy(minimum.cost, f_cost, table->size);
-                minimum.vertex = u;
-            }
+            // unless H(n) is infinite (used to prevent potential overflow while summing)
+            void * f_cost = estimates + (u * table->size);
+            heuristic(h_cost, graph->vertices + (u * graph->vertex_size), target, ah);
+            bool const can_sum = table->compare(h_cost, table->infinite, table->ac);
+            memmove(f_cost, can_sum ? table->sum(sum, h_cost, table->as) : table->infinite, table->size);
+
+            push_graph_workspace(workspace, estimates, u);
         }
     }
-
-    graph->allocator->free(visited, graph->allocator->arg);
-    graph->allocator->free(buffer, graph->allocator->arg);
 }
 
 void prim_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const start) {
     error(graph && "Parameter can't be NULL.");
     error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    prim_workspace_iam_graph(graph, &workspace, start);
+    release_graph_workspace(&workspace, table);
+}
+
+void prim_workspace_iam_graph(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
     error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
 
     valid(graph->compare && "Compare function can't be NULL.");
     valid(graph->weight_size && "Edge size can't be zero.");
@@ -981,41 +1356,23 @@ void prim_iam_graph(iam_graph_s const * const graph, table_s * const table, size
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    table->graph = graph;
-    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
-    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
-    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
-    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
-
-    for (size_t i = 0; i < graph->vertex_length; ++i) {
-        memcpy(table->costs + (i * table->size), table->infinite, table->size);
-        table->previous[i] = IAM_SPECIAL;
-    }
-    memcpy(table->costs + (table->size * start), table->zero, table->size);
-
-    // initialize visited array
-    bool * visited = graph->allocator->alloc(sizeof(bool) * graph->vertex_length, graph->allocator->arg);
-    error((!graph->vertex_length || visited) && "Memory allocation failed.");
-    memset(visited, 0, sizeof(bool) * graph->vertex_length);
-
-    // allocate for both minimum and sum
-    char * buffer = graph->allocator->alloc(2 * table->size, graph->allocator->arg);
-    error(buffer && "Memory allocation failed.");
+    table_s * table = &workspace->table;
+    _iam_graph_start(graph, workspace, start);
 
-    // initialize current minimum vertex
+    // initialize current minimum vertex with first of workspace's two cost buffers
     struct iam_graph_smallest minimum = {
-        .vertex = start, .cost = buffer,
+        .vertex = start, .cost = workspace->scratch + (workspace->length * table->size),
     };
     memcpy(minimum.cost, table->zero, table->size);
 
-    char * weight_cost = buffer + table->size;
+    char * weight_cost = (char *)(minimum.cost) + table->size;
     for (size_t i = 0; i < graph->vertex_length - 1 && IAM_SPECIAL != minimum.vertex; ++i) {
         size_t const v = minimum.vertex;
 
         minimum.vertex = IAM_SPECIAL;
         memcpy(minimum.cost, table->infinite, table->size);
 
-        visited[v] = true;
+        workspace->visited[v] = workspace->epoch;
 
         size_t const v_off = (v * (v - 1)) / 2;
         for (size_t j = 0; j < graph->vertex_length - 1; j++) {
@@ -1024,17 +1381,19 @@ void prim_iam_graph(iam_graph_s const * const graph, table_s * const table, size
             size_t const u = (j < v) ? j : j + 1;
             size_t const e = v <= j ? i_off + v : v_off + j;
 
-            if (visited[u]) { continue; }
+            if (workspace->epoch == workspace->visited[u]) { continue; }
 
             // save edges for access
             void const * edge = graph->edges + (e * graph->weight_size);
             void * g_cost = table->costs + (u * table->size);
 
             bool const can_juggle = graph->compare(edge, graph->none, graph->ac);
-            memmove(weight_cost, can_juggle ? table->juggle(weight_cost, edge, table->as) : table->infinite, table->size);
+            memcpy(weight_cost, can_juggle ? table->zero : table->infinite, table->size);
+            if (can_juggle) { table->juggle(weight_cost, edge, table->aj); }
 
             // if G's cost is smaller destroy table's non-infinite and set it to sum
             if (table->compare(weight_cost, g_cost, table->ac) < 0) {
+                reach_graph_workspace(workspace, u);
                 table->previous[u] = v;
                 memcpy(g_cost, weight_cost, table->size);
             }
@@ -1047,16 +1406,42 @@ void prim_iam_graph(iam_graph_s const * const graph, table_s * const table, size
             }
         }
     }
+}
 
-    graph->allocator->free(visited, graph->allocator->arg);
-    graph->allocator->free(buffer, graph->allocator->arg);
+void kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    idisjoint_set_s set = make_idisjoint_set(graph->allocator);
+    _iam_graph_kruskal_start(graph, table, &set);
+
+    iam_edge_s * edges = graph->allocator->alloc(graph->edge_length * sizeof(iam_edge_s), graph->allocator->arg);
+    error((!graph->edge_length || edges) && "Memory allocation failed.");
+    void * cost = graph->allocator->alloc(table->size, graph->allocator->arg);
+    error(cost && "Memory allocation failed.");
+
+    _iam_graph_collect(graph, edges);
+    _iam_graph_sort(graph, edges, graph->edge_length);
+
+    // Kruskal's algorithm with sorted edges, stops once every vertex is in a single set
+    for (size_t i = 0; i < graph->edge_length && set.count > 1; ++i) {
+        _iam_graph_join(table, &set, edges + i, cost);
+    }
+
+    graph->allocator->free(cost, graph->allocator->arg);
+    graph->allocator->free(edges, graph->allocator->arg);
+    _iam_graph_kruskal_end(graph, table, &set);
 }
 
-void kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table, process_fn const sort, void * const as, set_fn const inc, void * const ai) {
+void filter_kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table) {
     error(graph && "Parameter can't be NULL.");
     error(table && "Parameter can't be NULL.");
-    error(sort && "Parameter can't be NULL.");
-    error(inc && "Parameter can't be NULL.");
 
     valid(graph->compare && "Compare function can't be NULL.");
     valid(graph->weight_size && "Edge size can't be zero.");
@@ -1064,49 +1449,260 @@ void kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table, p
     valid(graph->none && "Non-edge can't be NULL.");
     valid(graph->allocator && "Allocator can't be NULL.");
 
-    table->graph = graph;
-    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
-    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
-    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
-    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
+    idisjoint_set_s set = make_idisjoint_set(graph->allocator);
+    _iam_graph_kruskal_start(graph, table, &set);
 
-    // initialize edge array defined by the edge itself and vertices making it up
-    iam_edge_s * kruskal_edges = graph->allocator->alloc(graph->edge_length * sizeof(iam_edge_s), graph->allocator->arg);
-    error((!graph->edge_length || kruskal_edges) && "Memory allocation failed.");
+    iam_edge_s * edges = graph->allocator->alloc(graph->edge_length * sizeof(iam_edge_s), graph->allocator->arg);
+    error((!graph->edge_length || edges) && "Memory allocation failed.");
+    void * cost = graph->allocator->alloc(table->size, graph->allocator->arg);
+    error(cost && "Memory allocation failed.");
 
-    _make_set(table, graph->vertex_length);
+    _iam_graph_collect(graph, edges);
+    _iam_graph_filter(graph, table, &set, edges, graph->edge_length, cost);
 
-    // initialize edge array
-    size_t edge_index = 0;
-    for (size_t i = 0; i < graph->vertex_length; ++i) {
-        // initialize edge array to sort
-        for (size_t j = i + 1; j < graph->vertex_length; ++j) {
-            size_t const offset = (j * (j - 1)) / 2;
-            void * edge_weight = graph->edges + ((offset + i) * graph->weight_size);
+    graph->allocator->free(cost, graph->allocator->arg);
+    graph->allocator->free(edges, graph->allocator->arg);
+    _iam_graph_kruskal_end(graph, table, &set);
+}
+
+void radix_kruskal_iam_graph(iam_graph_s const * const graph, table_s * const table, key_fn const key, void * const ak) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+    error(key && "Parameter can't be NULL.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    idisjoint_set_s set = make_idisjoint_set(graph->allocator);
+    _iam_graph_kruskal_start(graph, table, &set);
+
+    size_t const length = graph->edge_length;
+    struct iam_graph_keyed * keyed = graph->allocator->alloc(length * sizeof(struct iam_graph_keyed), graph->allocator->arg);
+    error((!length || keyed) && "Memory allocation failed.");
+    struct iam_graph_keyed * swap = graph->allocator->alloc(length * sizeof(struct iam_graph_keyed), graph->allocator->arg);
+    error((!length || swap) && "Memory allocation failed.");
+    void * cost = graph->allocator->alloc(table->size, graph->allocator->arg);
+    error(cost && "Memory allocation failed.");
+
+    // collect edges into unused swap array before keying them
+    iam_edge_s * edges = (iam_edge_s *)(swap);
+    _iam_graph_collect(graph, edges);
+    for (size_t i = 0; i < length; ++i) {
+        keyed[i] = (struct iam_graph_keyed) { .key = key(edges[i].weight, ak), .edge = edges[i], };
+    }
+
+    // count every byte's buckets in a single pass
+    size_t counts[sizeof(size_t)][UCHAR_MAX + 1] = { 0 };
+    for (size_t i = 0; i < length; ++i) {
+        for (size_t b = 0; b < sizeof(size_t); ++b) {
+            counts[b][(keyed[i].key >> (b * CHAR_BIT)) & UCHAR_MAX]++;
+        }
+    }
+
+    // least significant digit radix sort, skipping bytes that are the same in every key
+    for (size_t b = 0; b < sizeof(size_t); ++b) {
+        size_t const shift = b * CHAR_BIT;
+        if (!length || length == counts[b][(keyed[0].key >> shift) & UCHAR_MAX]) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t d = 0; d <= UCHAR_MAX; ++d) {
+            size_t const count = counts[b][d];
+            counts[b][d] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < length; ++i) {
+            swap[counts[b][(keyed[i].key >> shift) & UCHAR_MAX]++] = keyed[i];
+        }
+
+        struct iam_graph_keyed * const temporary = keyed;
+        keyed = swap;
+        swap = temporary;
+    }
+
+    // Kruskal's algorithm with sorted edges, stops once every vertex is in a single set
+    for (size_t i = 0; i < length && set.count > 1; ++i) {
+        _iam_graph_join(table, &set, &(keyed[i].edge), cost);
+    }
+
+    graph->allocator->free(cost, graph->allocator->arg);
+    graph->allocator->free(swap, graph->allocator->arg);
+    graph->allocator->free(keyed, graph->allocator->arg);
+    _iam_graph_kruskal_end(graph, table, &set);
+}
+
+void boruvka_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const threads) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+    error(threads && "Parameter can't be zero.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    idisjoint_set_s set = make_idisjoint_set(graph->allocator);
+    _iam_graph_kruskal_start(graph, table, &set);
+
+    // every thread owns at least one vertex
+    size_t const length = graph->vertex_length;
+    struct iam_graph_boruvka boruvka = {
+        .graph = graph, .threads = threads < length ? threads : length,
+    };
 
-            if (graph->compare(edge_weight, graph->none, graph->ac)) {
-                valid(edge_index < graph->edge_length && "Edge index exceeds lenght.");
-                kruskal_edges[edge_index++] = (iam_edge_s) { .weight = edge_weight, .vertices = { i, j }};
+    boruvka.components = graph->allocator->alloc(3 * length * sizeof(size_t), graph->allocator->arg);
+    error((!length || boruvka.components) && "Memory allocation failed.");
+    boruvka.cheapest = boruvka.components + length;
+    size_t * picked = boruvka.cheapest + length; // vertex with set's cheapest leaving edge for each root
+
+    struct iam_graph_boruvka_worker * workers = graph->allocator->alloc(boruvka.threads * sizeof(struct iam_graph_boruvka_worker), graph->allocator->arg);
+    error((!boruvka.threads || workers) && "Memory allocation failed.");
+    void * cost = graph->allocator->alloc(table->size, graph->allocator->arg);
+    error(cost && "Memory allocation failed.");
+
+    for (size_t i = 0; i < boruvka.threads; ++i) {
+        workers[i] = (struct iam_graph_boruvka_worker) { .boruvka = &boruvka, .index = i, };
+    }
+
+    // each round joins every set with its cheapest leaving edge, which at least halves number of sets
+    bool joined = true;
+    while (joined && set.count > 1) {
+        for (size_t i = 0; i < length; ++i) {
+            boruvka.components[i] = find_idisjoint_set(&set, i);
+            picked[i] = IAM_SPECIAL;
+        }
+
+        // calling thread works as first worker, the rest are created for the duration of round
+        for (size_t i = 1; i < boruvka.threads; ++i) {
+#if defined(_WIN32)
+            workers[i].handle = CreateThread(NULL, 0, _iam_graph_boruvka_thread, workers + i, 0, NULL);
+            error(workers[i].handle && "Thread creation failed.");
+#else
+            int const result = pthread_create(&(workers[i].handle), NULL, _iam_graph_boruvka_thread, workers + i);
+            error(!result && "Thread creation failed.");
+            (void)(result);
+#endif
+        }
+
+        _iam_graph_cheapest(workers);
+
+        for (size_t i = 1; i < boruvka.threads; ++i) {
+#if defined(_WIN32)
+            WaitForSingleObject(workers[i].handle, INFINITE);
+            CloseHandle(workers[i].handle);
+#else
+            pthread_join(workers[i].handle, NULL);
+#endif
+        }
+
+        // reduce vertices' cheapest edges into their set's cheapest edge
+        for (size_t i = 0; i < length; ++i) {
+            size_t const root = boruvka.components[i], other = picked[root];
+            if (IAM_SPECIAL == boruvka.cheapest[i]) {
+                continue;
             }
+
+            size_t const edge[2] = { i, boruvka.cheapest[i], };
+            if (IAM_SPECIAL == other || _iam_graph_lighter(graph, edge, (size_t[2]) { other, boruvka.cheapest[other], })) {
+                picked[root] = i;
+            }
+        }
+
+        // strict edge order makes picked edges a forest, so only two sets picking the same edge can fail to join
+        joined = false;
+        for (size_t i = 0; i < length; ++i) {
+            if (IAM_SPECIAL == picked[i]) {
+                continue;
+            }
+
+            size_t const vertex = picked[i], neighbor = boruvka.cheapest[vertex];
+            iam_edge_s const edge = { .weight = (char *)(_iam_graph_edge(graph, vertex, neighbor)), .vertices = { vertex, neighbor, }, };
+            joined |= _iam_graph_join(table, &set, &edge, cost);
         }
     }
 
-    // sort edge array based on its edge (weight)
-    sort(kruskal_edges, graph->vertex_length, as);
+    graph->allocator->free(cost, graph->allocator->arg);
+    graph->allocator->free(workers, graph->allocator->arg);
+    graph->allocator->free(boruvka.components, graph->allocator->arg);
+    _iam_graph_kruskal_end(graph, table, &set);
+}
 
-    // Kruskal's algorithm with sorted edges
-    for (int i = 0; i < graph->edge_length; ++i) {
-        iam_edge_s const smallest = kruskal_edges[i]; // get the next smallest edge from sorted array of edges
+void floyd_warshall_iam_graph(iam_graph_s const * const graph, table_s * const table, size_t const threads) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+    error(threads && "Parameter can't be zero.");
+
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
 
-        size_t const source      = _find_parent(table, smallest.vertices[0]);
-        size_t const destination = _find_parent(table, smallest.vertices[1]);
+    size_t const length = graph->vertex_length, tiles = (length + IAM_GRAPH_TILE - 1) / IAM_GRAPH_TILE;
 
-        if (source != destination) {
-            _union_set(table, source, destination, inc, ai);
+    table->graph = graph;
+    table->costs = graph->allocator->alloc(length * length * table->size, graph->allocator->arg);
+    error((!length || table->costs) && "Memory allocation failed.");
+    table->previous = graph->allocator->alloc(length * length * sizeof(size_t), graph->allocator->arg);
+    error((!length || table->previous) && "Memory allocation failed.");
+
+    // every vertex reaches itself with zero cost and its neighbors with their edge's cost
+    for (size_t i = 0; i < length; ++i) {
+        for (size_t j = 0; j < length; ++j) {
+            char * cost = table->costs + ((i * length + j) * table->size);
+            char const * edge = i == j ? graph->none : _iam_graph_edge(graph, i, j);
+
+            bool const is_edge = i != j && graph->compare(edge, graph->none, graph->ac);
+            if (is_edge) {
+                // juggle may read its destination, so it starts from zero cost like other searches
+                memcpy(cost, table->zero, table->size);
+                table->juggle(cost, edge, table->aj);
+            } else {
+                memcpy(cost, i == j ? table->zero : table->infinite, table->size);
+            }
+            table->previous[i * length + j] = is_edge ? i : IAM_SPECIAL;
         }
     }
 
-    graph->allocator->free(kruskal_edges, graph->allocator->arg);
+    // every thread owns at least one tile row
+    struct iam_graph_floyd floyd = {
+        .table = table, .length = length, .tiles = tiles, .threads = threads < tiles ? threads : tiles,
+    };
+    if (intsum == table->sum && intcmp == table->compare) {
+        floyd.kernel = IAM_GRAPH_INT_KERNEL;
+    } else if (doublesum == table->sum && doublecmp == table->compare) {
+        floyd.kernel = IAM_GRAPH_DOUBLE_KERNEL;
+    }
+
+    floyd.scratch = graph->allocator->alloc(floyd.threads * table->size, graph->allocator->arg);
+    error((!floyd.threads || floyd.scratch) && "Memory allocation failed.");
+    struct iam_graph_floyd_worker * workers = graph->allocator->alloc(floyd.threads * sizeof(struct iam_graph_floyd_worker), graph->allocator->arg);
+    error((!floyd.threads || workers) && "Memory allocation failed.");
+
+    for (size_t i = 0; i < floyd.threads; ++i) {
+        workers[i] = (struct iam_graph_floyd_worker) { .floyd = &floyd, .index = i, };
+    }
+
+    // each diagonal tile is relaxed by itself first, then its row and column, and lastly every remaining tile
+    for (size_t d = 0; d < tiles; ++d) {
+        floyd.diagonal = d;
+        _iam_graph_relax(&floyd, floyd.scratch, d, d, d);
+
+        floyd.cross = true;
+        _iam_graph_parallel_phase(workers);
+
+        floyd.cross = false;
+        _iam_graph_parallel_phase(workers);
+    }
+
+    graph->allocator->free(workers, graph->allocator->arg);
+    graph->allocator->free(floyd.scratch, graph->allocator->arg);
 }
 
 void destroy_iam_table(table_s * const table) {
@@ -1131,6 +1727,28 @@ void destroy_iam_table(table_s * const table) {
     memset(table, 0, sizeof(table_s));
 }
 
+void destroy_all_iam_table(table_s * const table) {
+    error(table && "Parameter can't be NULL.");
+
+    iam_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->compare && "Compare function can't be NULL.");
+    valid(graph->weight_size && "Edge size can't be zero.");
+    valid(graph->vertex_size && "Edge size can't be zero.");
+    valid(graph->none && "Non-edge can't be NULL.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < graph->vertex_length * graph->vertex_length; ++i) {
+        table->destroy(table->costs + (i * table->size), table->ad);
+    }
+
+    graph->allocator->free(table->costs, graph->allocator->arg);
+    graph->allocator->free(table->previous, graph->allocator->arg);
+
+    memset(table, 0, sizeof(table_s));
+}
+
 iam_graph_s subgraph_iam_graph(table_s const * const table, copy_fn const copy_vertex, void * const acv, copy_fn const copy_edge, void * const ace) {
     error(table && "Parameter can't be NULL.");
     error(copy_vertex && "Parameter can't be NULL.");
@@ -1149,7 +1767,7 @@ iam_graph_s subgraph_iam_graph(table_s const * const table, copy_fn const copy_v
     iam_graph_s const subgraph = {
         .vertex_size = graph->vertex_size, .weight_size = graph->weight_size, .compare = graph->compare,
         .none = graph->none, .vertex_length = graph->vertex_length, .capacity = graph->capacity,
-        .allocator = graph->allocator,
+        .allocator = graph->allocator, .growth = graph->growth,
 
         .vertices = graph->allocator->alloc(graph->capacity * graph->vertex_size, graph->allocator->arg),
         .edges = graph->allocator->alloc(edge_capacity * graph->weight_size, graph->allocator->arg),
@@ -1368,52 +1986,669 @@ void _iam_graph_resize(iam_graph_s * const graph, size_t const size) {
     graph->degrees = graph->allocator->realloc(graph->degrees, size * sizeof(size_t), graph->allocator->arg);
 }
 
-void _make_set(table_s const * table, size_t const vertex_length) {
-    for (size_t i = 0; i < vertex_length; ++i) {
-        // initializer table's previous and rank costs
+void _iam_graph_start(iam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start) {
+    reset_graph_workspace(workspace);
+    workspace->table.graph = graph;
+
+    reach_graph_workspace(workspace, start);
+    memcpy(workspace->table.costs + (workspace->table.size * start), workspace->table.zero, workspace->table.size);
+}
+
+size_t _iam_graph_trailing(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(__builtin_ctzll(word));
+#else
+    size_t count = 0;
+    for (uint64_t w = word; !(w & 1u); w >>= 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+char const * _iam_graph_edge(iam_graph_s const * const graph, size_t const one, size_t const two) {
+    size_t const minimum = one < two ? one : two;
+    size_t const maximum = one >= two ? one : two;
+
+    return graph->edges + ((((maximum * (maximum - 1)) / 2) + minimum) * graph->weight_size);
+}
+
+void _iam_graph_traverse(struct iam_graph_worker * const worker) {
+    struct iam_graph_parallel * parallel = worker->parallel;
+
+    // direction is only changed by last thread at barrier, so every thread expands level the same way
+    bool done = false;
+    while (!done) {
+        if (parallel->bottom_up) {
+            _iam_graph_bottom_up(worker);
+        } else {
+            _iam_graph_top_down(worker);
+        }
+
+        done = _iam_graph_barrier_wait(parallel);
+    }
+}
+
+void _iam_graph_top_down(struct iam_graph_worker * const worker) {
+    struct iam_graph_parallel * parallel = worker->parallel;
+    iam_graph_s const * graph = parallel->graph;
+
+    size_t const low = (worker->index * parallel->words) / parallel->threads;
+    size_t const high = ((worker->index + 1) * parallel->words) / parallel->threads;
+
+    parallel->counts[worker->index] = parallel->degrees[worker->index] = 0;
+    for (size_t w = low; w < high; ++w) {
+        parallel->next[w] = 0;
+    }
+
+    // frontier is walked in ascending order, so each vertex is claimed by its smallest frontier neighbor
+    for (size_t f = 0; f < parallel->words; ++f) {
+        for (uint64_t frontier = parallel->frontier[f]; frontier; frontier &= frontier - 1) {
+            size_t const v = (f * IAM_GRAPH_BIT_COUNT) + _iam_graph_trailing(frontier);
+
+            for (size_t w = low; w < high; ++w) {
+                for (uint64_t unvisited = ~(parallel->visited[w]); unvisited; unvisited &= unvisited - 1) {
+                    size_t const bit = _iam_graph_trailing(unvisited);
+                    size_t const u = (w * IAM_GRAPH_BIT_COUNT) + bit;
+
+                    if (!graph->compare(graph->none, _iam_graph_edge(graph, v, u), graph->ac)) { continue; }
+
+                    _iam_graph_claim(worker, u, v);
+                    parallel->visited[w] |= (uint64_t)1 << bit;
+                    parallel->next[w] |= (uint64_t)1 << bit;
+                }
+            }
+        }
+    }
+}
+
+void _iam_graph_bottom_up(struct iam_graph_worker * const worker) {
+    struct iam_graph_parallel * parallel = worker->parallel;
+    iam_graph_s const * graph = parallel->graph;
+
+    size_t const low = (worker->index * parallel->words) / parallel->threads;
+    size_t const high = ((worker->index + 1) * parallel->words) / parallel->threads;
+
+    parallel->counts[worker->index] = parallel->degrees[worker->index] = 0;
+    for (size_t w = low; w < high; ++w) {
+        uint64_t found = 0;
+
+        // each unvisited vertex stops at its first frontier neighbor instead of checking all of them
+        for (uint64_t unvisited = ~(parallel->visited[w]); unvisited; unvisited &= unvisited - 1) {
+            size_t const bit = _iam_graph_trailing(unvisited);
+            size_t const u = (w * IAM_GRAPH_BIT_COUNT) + bit;
+
+            for (size_t f = 0; f < parallel->words && !(found & ((uint64_t)1 << bit)); ++f) {
+                for (uint64_t frontier = parallel->frontier[f]; frontier; frontier &= frontier - 1) {
+                    size_t const v = (f * IAM_GRAPH_BIT_COUNT) + _iam_graph_trailing(frontier);
+
+                    if (graph->compare(graph->none, _iam_graph_edge(graph, u, v), graph->ac)) {
+                        _iam_graph_claim(worker, u, v);
+                        found |= (uint64_t)1 << bit;
+                        break;
+                    }
+                }
+            }
+        }
+
+        parallel->visited[w] |= found;
+        parallel->next[w] = found;
+    }
+}
+
+void _iam_graph_claim(struct iam_graph_worker * const worker, size_t const vertex, size_t const parent) {
+    struct iam_graph_parallel * parallel = worker->parallel;
+    table_s const * table = parallel->table;
+
+    char * cost = table->costs + (vertex * table->size);
+    table->previous[vertex] = parent;
+    memcpy(cost, table->zero, table->size);
+    table->juggle(cost, _iam_graph_edge(parallel->graph, vertex, parent), table->aj);
+
+    parallel->counts[worker->index]++;
+    parallel->degrees[worker->index] += parallel->graph->degrees[vertex];
+}
+
+void _iam_graph_level(struct iam_graph_parallel * const parallel) {
+    size_t length = 0, degree = 0;
+    for (size_t i = 0; i < parallel->threads; ++i) {
+        length += parallel->counts[i];
+        degree += parallel->degrees[i];
+    }
+
+    uint64_t * swap = parallel->frontier;
+    parallel->frontier = parallel->next;
+    parallel->next = swap;
+
+    parallel->unexplored = degree < parallel->unexplored ? parallel->unexplored - degree : 0;
+
+    size_t const end = parallel->end;
+    if (!length || (IAM_SPECIAL != end && (parallel->visited[end / IAM_GRAPH_BIT_COUNT] & ((uint64_t)1 << (end % IAM_GRAPH_BIT_COUNT))))) {
+        parallel->done = true;
+    } else if (!parallel->bottom_up && degree > parallel->unexplored / IAM_GRAPH_ALPHA) {
+        parallel->bottom_up = true; // frontier's edges outweigh unexplored ones, so unvisited vertices look for parents
+    } else if (parallel->bottom_up && length < parallel->graph->vertex_length / IAM_GRAPH_BETA) {
+        parallel->bottom_up = false; // frontier became small again, so it looks for children instead
+    }
+}
+
+void _iam_graph_barrier_init(struct iam_graph_barrier * const barrier) {
+    barrier->waiting = barrier->generation = 0;
+#if defined(_WIN32)
+    InitializeSRWLock(&(barrier->lock));
+    InitializeConditionVariable(&(barrier->condition));
+#else
+    int const lock = pthread_mutex_init(&(barrier->lock), NULL);
+    error(!lock && "Lock initialization failed.");
+    int const condition = pthread_cond_init(&(barrier->condition), NULL);
+    error(!condition && "Condition initialization failed.");
+    (void)(lock); (void)(condition);
+#endif
+}
+
+void _iam_graph_barrier_free(struct iam_graph_barrier * const barrier) {
+#if defined(_WIN32)
+    (void)(barrier); // slim reader-writer locks and condition variables don't need to be freed
+#else
+    pthread_mutex_destroy(&(barrier->lock));
+    pthread_cond_destroy(&(barrier->condition));
+#endif
+}
+
+bool _iam_graph_barrier_wait(struct iam_graph_parallel * const parallel) {
+    struct iam_graph_barrier * barrier = &(parallel->barrier);
+
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&(barrier->lock));
+#else
+    pthread_mutex_lock(&(barrier->lock));
+#endif
+
+    // last thread advances level while others wait, lock makes its writes visible to them
+    size_t const generation = barrier->generation;
+    if (++barrier->waiting == parallel->threads) {
+        _iam_graph_level(parallel);
+
+        barrier->waiting = 0;
+        barrier->generation++;
+#if defined(_WIN32)
+        WakeAllConditionVariable(&(barrier->condition));
+#else
+        pthread_cond_broadcast(&(barrier->condition));
+#endif
+    } else while (generation == barrier->generation) {
+#if defined(_WIN32)
+        SleepConditionVariableSRW(&(barrier->condition), &(barrier->lock), INFINITE, 0);
+#else
+        pthread_cond_wait(&(barrier->condition), &(barrier->lock));
+#endif
+    }
+
+    bool const done = parallel->done;
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&(barrier->lock));
+#else
+    pthread_mutex_unlock(&(barrier->lock));
+#endif
+
+    return done;
+}
+
+#if defined(_WIN32)
+DWORD WINAPI _iam_graph_thread(LPVOID worker) {
+    _iam_graph_traverse(worker);
+    return 0;
+}
+#else
+void * _iam_graph_thread(void * worker) {
+    _iam_graph_traverse(worker);
+    return NULL;
+}
+#endif
+
+void _iam_graph_kruskal_start(iam_graph_s const * const graph, table_s * const table, idisjoint_set_s * const set) {
+    table->graph = graph;
+    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
+    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
+    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
+    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
+
+    // make each vertex its own set with zero cost
+    reserve_idisjoint_set(set, graph->vertex_length);
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
         memcpy(table->costs + (i * table->size), table->zero, table->size);
-        table->previous[i] = i;
+        insert_idisjoint_set(set);
+    }
+}
+
+void _iam_graph_kruskal_end(iam_graph_s const * const graph, table_s * const table, idisjoint_set_s * const set) {
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        table->previous[i] = find_idisjoint_set(set, i);
     }
+
+    destroy_idisjoint_set(set);
 }
 
-size_t _find_parent(table_s const * const table, size_t const vertex) {
-    // non-recursive find-parent (find-set) algorithm
-    size_t start = vertex;
-    while (start != table->previous[vertex]) {
-        start = table->previous[start];
+void _iam_graph_collect(iam_graph_s const * const graph, iam_edge_s * const edges) {
+    size_t length = 0;
+    char * weight = graph->edges;
+    for (size_t j = 1; j < graph->vertex_length; ++j) {
+        for (size_t i = 0; i < j; ++i, weight += graph->weight_size) {
+            if (graph->compare(weight, graph->none, graph->ac)) {
+                valid(length < graph->edge_length && "Edge index exceeds lenght.");
+                edges[length++] = (iam_edge_s) { .weight = weight, .vertices = { i, j }, };
+            }
+        }
     }
+}
 
-    return start;
+bool _iam_graph_join(table_s * const table, idisjoint_set_s * const set, iam_edge_s const * const edge, void * const cost) {
+    size_t const one = find_idisjoint_set(set, edge->vertices[0]), two = find_idisjoint_set(set, edge->vertices[1]);
+    if (!union_idisjoint_set(set, one, two)) {
+        return false;
+    }
+
+    // joined root takes other root's cost and edge's cost, while other root goes back to zero
+    size_t const root = find_idisjoint_set(set, one), other = root == one ? two : one;
+    char * const root_cost = table->costs + (root * table->size), * const other_cost = table->costs + (other * table->size);
+
+    table->sum(root_cost, other_cost, table->as);
+    memcpy(cost, table->zero, table->size);
+    table->sum(root_cost, table->juggle(cost, edge->weight, table->aj), table->as);
+    memcpy(other_cost, table->zero, table->size);
+
+    return true;
 }
 
-void _union_set(table_s const * const table, size_t const source, size_t const destination, set_fn const increment, void * increment_args) {
-    // find source and destination roots
-    size_t const source_root      = _find_parent(table, source);
-    size_t const destination_root = _find_parent(table, destination);
+void _iam_graph_sort(iam_graph_s const * const graph, iam_edge_s * const edges, size_t const length) {
+    size_t left = 0, right = length;
+
+    // quicksort loops over bigger partition and recurses into smaller one, so stack is at most logarithmic
+    while (right - left > CERPEC_BATCH) {
+        // median of three pivot is moved to middle
+        size_t const middle = left + (right - left) / 2;
+        if (graph->compare(edges[middle].weight, edges[left].weight, graph->ac) < 0) {
+            iam_edge_s const temporary = edges[middle]; edges[middle] = edges[left]; edges[left] = temporary;
+        }
+        if (graph->compare(edges[right - 1].weight, edges[middle].weight, graph->ac) < 0) {
+            iam_edge_s const temporary = edges[middle]; edges[middle] = edges[right - 1]; edges[right - 1] = temporary;
+            if (graph->compare(edges[middle].weight, edges[left].weight, graph->ac) < 0) {
+                iam_edge_s const swap = edges[middle]; edges[middle] = edges[left]; edges[left] = swap;
+            }
+        }
+
+        char const * const pivot = edges[middle].weight;
+        size_t i = left, j = right - 1;
+        while (true) {
+            while (graph->compare(edges[i].weight, pivot, graph->ac) < 0) { i++; }
+            while (graph->compare(edges[j].weight, pivot, graph->ac) > 0) { j--; }
+            if (i >= j) {
+                break;
+            }
+
+            iam_edge_s const temporary = edges[i]; edges[i] = edges[j]; edges[j] = temporary;
+            i++; j--;
+        }
+
+        // partitions are [left, j] and [j + 1, right)
+        if (j + 1 - left < right - (j + 1)) {
+            _iam_graph_sort(graph, edges + left, j + 1 - left);
+            left = j + 1;
+        } else {
+            _iam_graph_sort(graph, edges + j + 1, right - (j + 1));
+            right = j + 1;
+        }
+    }
+
+    // insertion sort for small partition
+    for (size_t i = left + 1; i < right; ++i) {
+        iam_edge_s const edge = edges[i];
 
-    // union set algorithm
-    void * source_cost = table->costs + (source_root * table->size);
-    void const * destination_cost = table->costs + (destination_root * table->size);
-    if (table->compare(source_cost, destination_cost, table->ac) < 0) {
-        table->previous[source_root] = destination_root;
-    } else if (table->compare(source_cost, destination_cost, table->ac) > 0) {
-        table->previous[destination_root] = source_root;
-    } else {
-        table->previous[destination_root] = source_root;
-        increment(source_cost, increment_args);
+        size_t j = i;
+        for (; j > left && graph->compare(edge.weight, edges[j - 1].weight, graph->ac) < 0; --j) {
+            edges[j] = edges[j - 1];
+        }
+        edges[j] = edge;
     }
 }
 
-void _set_visited(struct visited_list_array * const visited, size_t const index) {
-    visited->set[index] = true;
+void _iam_graph_filter(iam_graph_s const * const graph, table_s * const table, idisjoint_set_s * const set, iam_edge_s * const edges, size_t const length, void * const cost) {
+    iam_edge_s * current = edges;
+    size_t count = length;
+
+    while (count && set->count > 1) {
+        if (count <= IAM_GRAPH_FILTER) {
+            _iam_graph_sort(graph, current, count);
+            for (size_t i = 0; i < count && set->count > 1; ++i) {
+                _iam_graph_join(table, set, current + i, cost);
+            }
+
+            return;
+        }
+
+        // three way partition into lighter [0, lighter), equal [lighter, heavier) and heavier [heavier, count)
+        char const * const pivot = current[count / 2].weight;
+        size_t lighter = 0, i = 0, heavier = count;
+        while (i < heavier) {
+            int const comparison = graph->compare(current[i].weight, pivot, graph->ac);
+            if (comparison < 0) {
+                iam_edge_s const temporary = current[i]; current[i++] = current[lighter]; current[lighter++] = temporary;
+            } else if (comparison > 0) {
+                iam_edge_s const temporary = current[i]; current[i] = current[--heavier]; current[heavier] = temporary;
+            } else {
+                i++;
+            }
+        }
+
+        _iam_graph_filter(graph, table, set, current, lighter, cost);
 
-    // if index is head, thne head must be updated to its next node index
-    if (index == visited->head) {
-        visited->head = visited->next[index];
+        // equal edges need no sorting among themselves
+        for (size_t e = lighter; e < heavier && set->count > 1; ++e) {
+            _iam_graph_join(table, set, current + e, cost);
+        }
+
+        // filter out heavier edges whose vertices were connected by lighter ones
+        size_t kept = 0;
+        for (size_t e = heavier; e < count; ++e) {
+            if (find_idisjoint_set(set, current[e].vertices[0]) != find_idisjoint_set(set, current[e].vertices[1])) {
+                current[kept++] = current[e];
+            }
+        }
+
+        count = kept;
     }
-    // cur out visited index node from visited set list
-    visited->prev[visited->next[index]] = visited->prev[index];
-    visited->next[visited->prev[index]] = visited->next[index];
+}
+
+bool _iam_graph_lighter(iam_graph_s const * const graph, size_t const one[2], size_t const two[2]) {
+    int const comparison = graph->compare(_iam_graph_edge(graph, one[0], one[1]), _iam_graph_edge(graph, two[0], two[1]), graph->ac);
+    if (comparison) {
+        return comparison < 0;
+    }
+
+    size_t const one_max = one[0] > one[1] ? one[0] : one[1], one_min = one[0] > one[1] ? one[1] : one[0];
+    size_t const two_max = two[0] > two[1] ? two[0] : two[1], two_min = two[0] > two[1] ? two[1] : two[0];
+
+    return ((one_max * (one_max - 1)) / 2 + one_min) < ((two_max * (two_max - 1)) / 2 + two_min);
+}
 
-    visited->length--;
+void _iam_graph_cheapest(struct iam_graph_boruvka_worker * const worker) {
+    struct iam_graph_boruvka * boruvka = worker->boruvka;
+    iam_graph_s const * graph = boruvka->graph;
+
+    size_t const low = (worker->index * graph->vertex_length) / boruvka->threads;
+    size_t const high = ((worker->index + 1) * graph->vertex_length) / boruvka->threads;
+
+    // threads only read shared components and write their own vertices' cheapest edges
+    for (size_t v = low; v < high; ++v) {
+        size_t const component = boruvka->components[v];
+
+        size_t cheapest = IAM_SPECIAL;
+        for (size_t u = 0; u < graph->vertex_length; ++u) {
+            if (u == v || component == boruvka->components[u]) {
+                continue;
+            }
+
+            if (!graph->compare(_iam_graph_edge(graph, v, u), graph->none, graph->ac)) {
+                continue;
+            }
+
+            size_t const edge[2] = { v, u, };
+            if (IAM_SPECIAL == cheapest || _iam_graph_lighter(graph, edge, (size_t[2]) { v, cheapest, })) {
+                cheapest = u;
+            }
+        }
+
+        boruvka->cheapest[v] = cheapest;
+    }
+}
+
+#if defined(_WIN32)
+DWORD WINAPI _iam_graph_boruvka_thread(LPVOID worker) {
+    _iam_graph_cheapest(worker);
+    return 0;
+}
+#else
+void * _iam_graph_boruvka_thread(void * worker) {
+    _iam_graph_cheapest(worker);
+    return NULL;
+}
+#endif
+
+void _iam_graph_relax(struct iam_graph_floyd const * const floyd, void * const scratch, size_t const row, size_t const column, size_t const middle) {
+    table_s const * table = floyd->table;
+    size_t const n = floyd->length;
+
+    size_t const row_low = row * IAM_GRAPH_TILE, column_low = column * IAM_GRAPH_TILE, middle_low = middle * IAM_GRAPH_TILE;
+    size_t const row_high = row_low + IAM_GRAPH_TILE < n ? row_low + IAM_GRAPH_TILE : n;
+    size_t const column_high = column_low + IAM_GRAPH_TILE < n ? column_low + IAM_GRAPH_TILE : n;
+    size_t const middle_high = middle_low + IAM_GRAPH_TILE < n ? middle_low + IAM_GRAPH_TILE : n;
+
+    size_t * previous = table->previous;
+    switch (floyd->kernel) {
+        case IAM_GRAPH_INT_KERNEL: {
+            int * costs = (int *)(table->costs);
+            int const infinite = *(int *)(table->infinite);
+            for (size_t k = middle_low; k < middle_high; ++k) {
+                for (size_t i = row_low; i < row_high; ++i) {
+                    int const through = costs[i * n + k];
+                    if (infinite == through) { continue; }
+
+                    for (size_t j = column_low; j < column_high; ++j) {
+                        int const last = costs[k * n + j];
+                        if (infinite != last && through + last < costs[i * n + j]) {
+                            costs[i * n + j] = through + last;
+                            previous[i * n + j] = previous[k * n + j];
+                        }
+                    }
+                }
+            }
+            break;
+        }
+
+        case IAM_GRAPH_DOUBLE_KERNEL: {
+            double * costs = (double *)(table->costs);
+            double const infinite = *(double *)(table->infinite);
+            for (size_t k = middle_low; k < middle_high; ++k) {
+                for (size_t i = row_low; i < row_high; ++i) {
+                    double const through = costs[i * n + k];
+                    if (!(through < infinite)) { continue; }
+
+                    for (size_t j = column_low; j < column_high; ++j) {
+                        double const last = costs[k * n + j];
+                        if (last < infinite && through + last < costs[i * n + j]) {
+                            costs[i * n + j] = through + last;
+                            previous[i * n + j] = previous[k * n + j];
+                        }
+                    }
+                }
+            }
+            break;
+        }
+
+        default: {
+            size_t const size = table->size;
+            for (size_t k = middle_low; k < middle_high; ++k) {
+                for (size_t i = row_low; i < row_high; ++i) {
+                    char const * through = table->costs + ((i * n + k) * size);
+                    if (!table->compare(through, table->infinite, table->ac)) { continue; }
+
+                    for (size_t j = column_low; j < column_high; ++j) {
+                        char const * last = table->costs + ((k * n + j) * size);
+                        if (!table->compare(last, table->infinite, table->ac)) { continue; }
+
+                        char * cost = table->costs + ((i * n + j) * size);
+                        memcpy(scratch, through, size);
+                        if (table->compare(table->sum(scratch, last, table->as), cost, table->ac) < 0) {
+                            memcpy(cost, scratch, size);
+                            previous[i * n + j] = previous[k * n + j];
+                        }
+                    }
+                }
+            }
+            break;
+        }
+    }
+}
+
+void _iam_graph_phase(struct iam_graph_floyd_worker * const worker) {
+    struct iam_graph_floyd const * floyd = worker->floyd;
+
+    size_t const low = (worker->index * floyd->tiles) / floyd->threads;
+    size_t const high = ((worker->index + 1) * floyd->tiles) / floyd->threads;
+
+    void * scratch = floyd->scratch + (worker->index * floyd->table->size);
+    size_t const d = floyd->diagonal;
+
+    // tiles only read diagonal's finished row and column tiles, so no two threads write or read same tile
+    for (size_t t = low; t < high; ++t) {
+        if (d == t) {
+            continue;
+        }
+
+        if (floyd->cross) {
+            _iam_graph_relax(floyd, scratch, d, t, d);
+            _iam_graph_relax(floyd, scratch, t, d, d);
+        } else for (size_t c = 0; c < floyd->tiles; ++c) {
+            if (d != c) {
+                _iam_graph_relax(floyd, scratch, t, c, d);
+            }
+        }
+    }
+}
+
+void _iam_graph_parallel_phase(struct iam_graph_floyd_worker * const workers) {
+    size_t const threads = workers->floyd->threads;
+
+    for (size_t i = 1; i < threads; ++i) {
+#if defined(_WIN32)
+        workers[i].handle = CreateThread(NULL, 0, _iam_graph_floyd_thread, workers + i, 0, NULL);
+        error(workers[i].handle && "Thread creation failed.");
+#else
+        int const result = pthread_create(&(workers[i].handle), NULL, _iam_graph_floyd_thread, workers + i);
+        error(!result && "Thread creation failed.");
+        (void)(result);
+#endif
+    }
+
+    _iam_graph_phase(workers);
+
+    for (size_t i = 1; i < threads; ++i) {
+#if defined(_WIN32)
+        WaitForSingleObject(workers[i].handle, INFINITE);
+        CloseHandle(workers[i].handle);
+#else
+        pthread_join(workers[i].handle, NULL);
+#endif
+    }
+}
+
+#if defined(_WIN32)
+DWORD WINAPI _iam_graph_floyd_thread(LPVOID worker) {
+    _iam_graph_phase(worker);
+    return 0;
+}
+#else
+void * _iam_graph_floyd_thread(void * worker) {
+    _iam_graph_phase(worker);
+    return NULL;
+}
+#endif
+
+size_t _iam_graph_bfs_level(iam_graph_s const * const graph, graph_workspace_s * const side, graph_workspace_s const * const other, struct iam_graph_queue * const queue) {
+    table_s * table = &side->table;
+
+    for (size_t count = queue->length; count; --count) {
+        size_t const v = queue->array[queue->current++];
+        queue->length--;
+
+        size_t const v_off = (v * (v - 1)) / 2;
+        for (size_t i = 0; i < graph->vertex_length - 1; i++) {
+            size_t const i_off = (i * (i + 1)) / 2;
+
+            size_t const u = (i < v) ? i : i + 1;
+            size_t const e = v <= i ? i_off + v : v_off + i;
+
+            void const * edge = graph->edges + (e * graph->weight_size);
+            if (!graph->compare(graph->none, edge, graph->ac) || !reach_graph_workspace(side, u)) {
+                continue;
+            }
+
+            table->previous[u] = v;
+            memcpy(table->costs + (u * table->size), table->zero, table->size);
+            table->juggle(table->costs + (u * table->size), edge, table->aj);
+
+            // levels are expanded whole, so first vertex reached by both sides is on a shortest path
+            if (other->epoch == other->reached[u]) {
+                return u;
+            }
+            queue->array[queue->current + queue->length++] = u;
+        }
+    }
+
+    return IAM_SPECIAL;
+}
+
+void _iam_graph_settle(iam_graph_s const * const graph, graph_workspace_s * const side, graph_workspace_s * const other, void * const best, size_t * const meet) {
+    table_s * table = &side->table;
+    char * sum = side->scratch + (side->length * table->size), * total = sum + table->size;
+
+    size_t const v = pop_graph_workspace(side, table->costs);
+    side->visited[v] = side->epoch;
+    void const * v_cost = table->costs + (v * table->size);
+
+    size_t const v_off = (v * (v - 1)) / 2;
+    for (size_t j = 0; j < graph->vertex_length - 1; j++) {
+        size_t const i_off = (j * (j + 1)) / 2;
+
+        size_t const u = (j < v) ? j : j + 1;
+        size_t const e = v <= j ? i_off + v : v_off + j;
+
+        void const * edge = graph->edges + (e * graph->weight_size);
+        if (side->epoch == side->visited[u] || !graph->compare(edge, graph->none, graph->ac)) { continue; }
+
+        memcpy(sum, table->zero, table->size);
+        memmove(sum, table->sum(table->juggle(sum, edge, table->aj), v_cost, table->as), table->size);
+
+        void * g_cost = table->costs + (u * table->size);
+        if (table->compare(sum, g_cost, table->ac) < 0) {
+            reach_graph_workspace(side, u);
+            table->previous[u] = v;
+            memcpy(g_cost, sum, table->size);
+            push_graph_workspace(side, table->costs, u);
+        }
+
+        // vertex reached by other side joins both searches into a path
+        if (other->epoch == other->reached[u] && side->epoch == side->reached[u]) {
+            memcpy(total, g_cost, table->size);
+            if (table->compare(table->sum(total, other->table.costs + (u * table->size), table->as), best, table->ac) < 0) {
+                memcpy(best, total, table->size);
+                *meet = u;
+            }
+        }
+    }
+}
+
+void _iam_graph_meet(iam_graph_s const * const graph, graph_workspace_s * const forward, graph_workspace_s const * const backward, size_t const meet, bool const cumulative) {
+    if (IAM_SPECIAL == meet) {
+        return;
+    }
+
+    table_s * table = &forward->table;
+    char * sum = forward->scratch + (forward->length * table->size);
+
+    // backward search's previous indexes lead from meeting vertex to end, so they're reversed into forward table
+    for (size_t v = meet, u = backward->table.previous[meet]; IAM_SPECIAL != u; v = u, u = backward->table.previous[u]) {
+        char const * edge = _iam_graph_edge(graph, v, u);
+        char * u_cost = table->costs + (u * table->size);
+
+        reach_graph_workspace(forward, u);
+        table->previous[u] = v;
+        if (cumulative) {
+            memcpy(sum, table->zero, table->size);
+            memmove(u_cost, table->sum(table->juggle(sum, edge, table->aj), table->costs + (v * table->size), table->as), table->size);
+        } else {
+            memcpy(u_cost, table->zero, table->size);
+            table->juggle(u_cost, edge, table->aj);
+        }
+    }
 }
@@ -0,0 +1,1074 @@
+#include <graph/icsr_graph.h>
+#include <misc/idisjoint_set.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Resize function for graph's vertices.
+/// @param graph Graph to resize.
+/// @param size New vertex capacity to resize into.
+void _icsr_graph_resize(icsr_graph_s * const graph, size_t const size);
+
+/// @brief Resize function for graph's edges.
+/// @param graph Graph to resize.
+/// @param size New edge capacity to resize into.
+void _icsr_graph_resize_edges(icsr_graph_s * const graph, size_t const size);
+
+/// @brief Frees compacted rows, making edges part of edge buffer again.
+/// @param graph Graph to uncompact.
+void _icsr_graph_uncompact(icsr_graph_s * const graph);
+
+/// @brief Finds index of edge between two vertices in compacted rows and edge buffer.
+/// @param graph Graph to search.
+/// @param index_one First vertex index of edge.
+/// @param index_two Second vertex index of edge.
+/// @return Edge index, or ICSR_SPECIAL if edge doesn't exist.
+size_t _icsr_graph_find(icsr_graph_s const * const graph, size_t const index_one, size_t const index_two);
+
+/// @brief Resets workspace and marks start vertex as reached with zero cost.
+/// @param graph Graph to search.
+/// @param workspace Workspace to search with.
+/// @param start Starting vertex index.
+void _icsr_graph_start(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start);
+
+/// @brief Joins sets of edge's vertices and adds edge's cost to joined root's cost.
+/// @param table Table with costs.
+/// @param set Disjoint set of vertices.
+/// @param edge Edge to join, its weight points to its juggled cost.
+/// @return 'true' if vertices were in different sets, 'false' otherwise.
+bool _icsr_graph_join(table_s * const table, idisjoint_set_s * const set, icsr_edge_s const * const edge);
+
+/// @brief Sorts edges by their juggled costs using table's compare function.
+/// @param table Table with compare function.
+/// @param edges Array of edges whose weights point to their juggled costs.
+/// @param length Number of edges.
+void _icsr_graph_sort(table_s const * const table, icsr_edge_s * const edges, size_t const length);
+
+icsr_graph_s create_icsr_graph(size_t const vertex_size, size_t const weight_size) {
+    error(vertex_size && "Parameter can't be zero.");
+    error(weight_size && "Parameter can't be zero.");
+
+    return (icsr_graph_s) {
+        .vertex_size = vertex_size, .weight_size = weight_size,
+        .allocator = &standard, .growth = CERPEC_GROWTH(ICSR_GRAPH_CHUNK),
+    };
+}
+
+icsr_graph_s make_icsr_graph(size_t const vertex_size, size_t const weight_size, memory_s const * const allocator) {
+    error(vertex_size && "Parameter can't be zero.");
+    error(weight_size && "Parameter can't be zero.");
+    error(allocator && "Parameter can't be NULL.");
+
+    return (icsr_graph_s) {
+        .vertex_size = vertex_size, .weight_size = weight_size,
+        .allocator = allocator, .growth = CERPEC_GROWTH(ICSR_GRAPH_CHUNK),
+    };
+}
+
+void destroy_icsr_graph(icsr_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw) {
+    error(graph && "Parameter can't be NULL.");
+    error(destroy_vertex && "Parameter can't be NULL.");
+    error(destroy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        destroy_vertex(graph->vertices + (i * graph->vertex_size), adv);
+    }
+
+    for (size_t i = 0; i < graph->edge_length; ++i) {
+        destroy_weight(graph->weights + (i * graph->weight_size), adw);
+    }
+
+    graph->allocator->free(graph->vertices, graph->allocator->arg);
+    graph->allocator->free(graph->degrees, graph->allocator->arg);
+    graph->allocator->free(graph->weights, graph->allocator->arg);
+    graph->allocator->free(graph->ends, graph->allocator->arg);
+    graph->allocator->free(graph->offsets, graph->allocator->arg);
+    graph->allocator->free(graph->adjacency, graph->allocator->arg);
+
+    memset(graph, 0, sizeof(icsr_graph_s));
+}
+
+void clear_icsr_graph(icsr_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw) {
+    error(graph && "Parameter can't be NULL.");
+    error(destroy_vertex && "Parameter can't be NULL.");
+    error(destroy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        destroy_vertex(graph->vertices + (i * graph->vertex_size), adv);
+    }
+
+    for (size_t i = 0; i < graph->edge_length; ++i) {
+        destroy_weight(graph->weights + (i * graph->weight_size), adw);
+    }
+
+    graph->allocator->free(graph->vertices, graph->allocator->arg);
+    graph->allocator->free(graph->degrees, graph->allocator->arg);
+    graph->allocator->free(graph->weights, graph->allocator->arg);
+    graph->allocator->free(graph->ends, graph->allocator->arg);
+    _icsr_graph_uncompact(graph);
+
+    graph->capacity = graph->vertex_length = graph->edge_capacity = graph->edge_length = 0;
+    graph->vertices = graph->weights = NULL;
+    graph->degrees = graph->ends = NULL;
+}
+
+icsr_graph_s copy_icsr_graph(icsr_graph_s const * const graph, copy_fn const copy_vertex, void * const acv, copy_fn const copy_weight, void * const acw) {
+    error(graph && "Parameter can't be NULL.");
+    error(copy_vertex && "Parameter can't be NULL.");
+    error(copy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    // compacted rows are only allocated if graph was compacted
+    size_t const offset_length = graph->offsets ? graph->row_length + 1 : 0;
+    size_t const slot_length = graph->adjacency ? 4 * graph->compact_length : 0;
+
+    icsr_graph_s const replica = {
+        .vertex_size = graph->vertex_size, .weight_size = graph->weight_size,
+        .vertex_length = graph->vertex_length, .edge_length = graph->edge_length,
+        .capacity = graph->capacity, .edge_capacity = graph->edge_capacity,
+        .row_length = graph->row_length, .compact_length = graph->compact_length,
+        .allocator = graph->allocator, .growth = graph->growth,
+
+        .vertices = graph->allocator->alloc(graph->capacity * graph->vertex_size, graph->allocator->arg),
+        .degrees = graph->allocator->alloc(graph->capacity * sizeof(size_t), graph->allocator->arg),
+        .weights = graph->allocator->alloc(graph->edge_capacity * graph->weight_size, graph->allocator->arg),
+        .ends = graph->allocator->alloc(2 * graph->edge_capacity * sizeof(size_t), graph->allocator->arg),
+        .offsets = offset_length ? graph->allocator->alloc(offset_length * sizeof(size_t), graph->allocator->arg) : NULL,
+        .adjacency = slot_length ? graph->allocator->alloc(slot_length * sizeof(size_t), graph->allocator->arg) : NULL,
+    };
+    error((!replica.capacity || (replica.vertices && replica.degrees)) && "Memory allocation failed.");
+    error((!replica.edge_capacity || (replica.weights && replica.ends)) && "Memory allocation failed.");
+    error((!offset_length || replica.offsets) && "Memory allocation failed.");
+    error((!slot_length || replica.adjacency) && "Memory allocation failed.");
+
+    // function copy each vertex and edge weight
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        copy_vertex(replica.vertices + (i * replica.vertex_size), graph->vertices + (i * graph->vertex_size), acv);
+    }
+
+    for (size_t i = 0; i < graph->edge_length; ++i) {
+        copy_weight(replica.weights + (i * replica.weight_size), graph->weights + (i * graph->weight_size), acw);
+    }
+
+    // memory copy indexes
+    if (graph->vertex_length) {
+        memcpy(replica.degrees, graph->degrees, graph->vertex_length * sizeof(size_t));
+    }
+    if (graph->edge_length) {
+        memcpy(replica.ends, graph->ends, 2 * graph->edge_length * sizeof(size_t));
+    }
+    if (offset_length) {
+        memcpy(replica.offsets, graph->offsets, offset_length * sizeof(size_t));
+    }
+    if (slot_length) {
+        memcpy(replica.adjacency, graph->adjacency, slot_length * sizeof(size_t));
+    }
+
+    return replica;
+}
+
+bool is_empty_icsr_graph(icsr_graph_s const * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return !(graph->vertex_length);
+}
+
+bool is_compact_icsr_graph(icsr_graph_s const * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return graph->row_length == graph->vertex_length && graph->compact_length == graph->edge_length;
+}
+
+void growth_icsr_graph(icsr_graph_s * const graph, growth_s const growth) {
+    error(graph && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph->growth = growth;
+}
+
+void reserve_icsr_graph(icsr_graph_s * const graph, size_t const capacity, size_t const edge_capacity) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (capacity > graph->capacity) {
+        _icsr_graph_resize(graph, capacity);
+    }
+
+    if (edge_capacity > graph->edge_capacity) {
+        _icsr_graph_resize_edges(graph, edge_capacity);
+    }
+}
+
+void shrink_to_fit_icsr_graph(icsr_graph_s * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (graph->vertex_length != graph->capacity) {
+        _icsr_graph_resize(graph, graph->vertex_length);
+    }
+
+    if (graph->edge_length != graph->edge_capacity) {
+        _icsr_graph_resize_edges(graph, graph->edge_length);
+    }
+}
+
+void compact_icsr_graph(icsr_graph_s * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (is_compact_icsr_graph(graph)) {
+        return;
+    }
+
+    size_t const slot_length = 2 * graph->edge_length; // each edge is a slot in both its vertices' rows
+
+    graph->offsets = graph->allocator->realloc(graph->offsets, (graph->vertex_length + 1) * sizeof(size_t), graph->allocator->arg);
+    error(graph->offsets && "Memory allocation failed.");
+    graph->adjacency = graph->allocator->realloc(graph->adjacency, 2 * slot_length * sizeof(size_t), graph->allocator->arg);
+    error((!slot_length || graph->adjacency) && "Memory allocation failed.");
+
+    size_t * scratch = graph->allocator->alloc(2 * slot_length * sizeof(size_t), graph->allocator->arg);
+    error((!slot_length || scratch) && "Memory allocation failed.");
+    size_t * next = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
+    error((!graph->vertex_length || next) && "Memory allocation failed.");
+
+    // row offsets are prefix sums of vertex degrees
+    graph->offsets[0] = 0;
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        graph->offsets[v + 1] = graph->offsets[v] + graph->degrees[v];
+        next[v] = graph->offsets[v];
+    }
+    valid(slot_length == graph->offsets[graph->vertex_length] && "Degrees don't match edge count.");
+
+    // first pass buckets each edge into both its vertices' rows in insertion order
+    for (size_t e = 0; e < graph->edge_length; ++e) {
+        size_t const one = graph->ends[2 * e], two = graph->ends[2 * e + 1];
+
+        size_t const i = next[one]++, j = next[two]++;
+        scratch[2 * i] = two; scratch[2 * i + 1] = e;
+        scratch[2 * j] = one; scratch[2 * j + 1] = e;
+    }
+
+    // second pass walks rows in ascending vertex order, so each neighbor's row is filled in ascending order too
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        next[v] = graph->offsets[v];
+    }
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        for (size_t s = graph->offsets[v]; s < graph->offsets[v + 1]; ++s) {
+            size_t const u = scratch[2 * s];
+
+            // sorted rows place parallel edges next to each other
+            error((next[u] == graph->offsets[u] || v != graph->adjacency[2 * (next[u] - 1)]) && "Graph can't contain parallel edges.");
+
+            size_t const i = next[u]++;
+            graph->adjacency[2 * i] = v;
+            graph->adjacency[2 * i + 1] = scratch[2 * s + 1];
+        }
+    }
+
+    graph->allocator->free(scratch, graph->allocator->arg);
+    graph->allocator->free(next, graph->allocator->arg);
+
+    graph->row_length = graph->vertex_length;
+    graph->compact_length = graph->edge_length;
+}
+
+size_t insert_vertex_icsr_graph(icsr_graph_s * const graph, void const * const vertex) {
+    error(graph && "Parameter can't be NULL.");
+    error(vertex && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (graph->vertex_length == graph->capacity) {
+        _icsr_graph_resize(graph, expand_growth(&(graph->growth), graph->vertex_length));
+    }
+
+    graph->degrees[graph->vertex_length] = 0;
+    memcpy(graph->vertices + (graph->vertex_length * graph->vertex_size), vertex, graph->vertex_size);
+
+    return graph->vertex_length++;
+}
+
+size_t remove_vertex_icsr_graph(icsr_graph_s * const graph, size_t const index, void * const buffer, set_fn const destroy_weight, void * const adw) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+    error(buffer && "Parameter can't be NULL.");
+    error(destroy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    // edge indexes change, so compacted rows become invalid
+    _icsr_graph_uncompact(graph);
+
+    // destroy removed vertex' edges backwards, since each is replaced with last and already checked edge
+    for (size_t e = graph->edge_length; e--;) {
+        size_t const one = graph->ends[2 * e], two = graph->ends[2 * e + 1];
+        if (index != one && index != two) {
+            continue;
+        }
+
+        destroy_weight(graph->weights + (e * graph->weight_size), adw);
+        graph->degrees[index == one ? two : one]--;
+
+        graph->edge_length--;
+        memmove(graph->weights + (e * graph->weight_size), graph->weights + (graph->edge_length * graph->weight_size), graph->weight_size);
+        graph->ends[2 * e] = graph->ends[2 * graph->edge_length];
+        graph->ends[2 * e + 1] = graph->ends[2 * graph->edge_length + 1];
+    }
+
+    // save removed index into buffer and move last vertex into removed's position
+    graph->vertex_length--;
+    void const * last = graph->vertices + (graph->vertex_length * graph->vertex_size);
+    void * removed = graph->vertices + (index * graph->vertex_size);
+    memcpy(buffer, removed, graph->vertex_size);
+    graph->degrees[index] = graph->degrees[graph->vertex_length]; // move last vertex' degree to removed index
+    memmove(removed, last, graph->vertex_size); // memmove since removed could be last
+
+    // last vertex' edges now end in removed index
+    for (size_t i = 0; i < 2 * graph->edge_length; ++i) {
+        if (graph->vertex_length == graph->ends[i]) {
+            graph->ends[i] = index;
+        }
+    }
+
+    // shrink graph if elements fit into smaller memory chunk
+    size_t const capacity = shrink_growth(&(graph->growth), graph->vertex_length, graph->capacity);
+    if (capacity != graph->capacity) {
+        _icsr_graph_resize(graph, capacity);
+    }
+
+    size_t const edge_capacity = shrink_growth(&(graph->growth), graph->edge_length, graph->edge_capacity);
+    if (edge_capacity != graph->edge_capacity) {
+        _icsr_graph_resize_edges(graph, edge_capacity);
+    }
+
+    // if last index was removed return an invalid index, else return the last vertex' index before it was moved
+    return graph->vertex_length;
+}
+
+void get_vertex_icsr_graph(icsr_graph_s const * const graph, size_t const index, void * const buffer) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+    error(buffer && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    memcpy(buffer, graph->vertices + (index * graph->vertex_size), graph->vertex_size);
+}
+
+void insert_weight_icsr_graph(icsr_graph_s * const graph, size_t const index_one, size_t const index_two, void const * const weight) {
+    error(graph && "Parameter can't be NULL.");
+    error(index_one < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_two < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_one != index_two && "Parameters can't be equal.");
+    error(weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    error(ICSR_SPECIAL == _icsr_graph_find(graph, index_one, index_two) && "Edge already exists.");
+
+    if (graph->edge_length == graph->edge_capacity) {
+        _icsr_graph_resize_edges(graph, expand_growth(&(graph->growth), graph->edge_length));
+    }
+
+    // append edge to buffer after compacted edges, it becomes part of rows on next compaction
+    memcpy(graph->weights + (graph->edge_length * graph->weight_size), weight, graph->weight_size);
+    graph->ends[2 * graph->edge_length] = index_one;
+    graph->ends[2 * graph->edge_length + 1] = index_two;
+    graph->edge_length++;
+
+    graph->degrees[index_one]++;
+    graph->degrees[index_two]++;
+}
+
+void remove_weight_icsr_graph(icsr_graph_s * const graph, size_t const index_one, size_t const index_two, void * const buffer) {
+    error(graph && "Parameter can't be NULL.");
+    error(index_one < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_two < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_one != index_two && "Parameters can't be equal.");
+    error(buffer && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const e = _icsr_graph_find(graph, index_one, index_two);
+    error(ICSR_SPECIAL != e && "Can't remove non-existing edge.");
+
+    // edge indexes change, so compacted rows become invalid
+    _icsr_graph_uncompact(graph);
+
+    // copy removed weight into buffer and replace it with last edge
+    memcpy(buffer, graph->weights + (e * graph->weight_size), graph->weight_size);
+    graph->edge_length--;
+    memmove(graph->weights + (e * graph->weight_size), graph->weights + (graph->edge_length * graph->weight_size), graph->weight_size);
+    graph->ends[2 * e] = graph->ends[2 * graph->edge_length];
+    graph->ends[2 * e + 1] = graph->ends[2 * graph->edge_length + 1];
+
+    graph->degrees[index_one]--;
+    graph->degrees[index_two]--;
+
+    size_t const edge_capacity = shrink_growth(&(graph->growth), graph->edge_length, graph->edge_capacity);
+    if (edge_capacity != graph->edge_capacity) {
+        _icsr_graph_resize_edges(graph, edge_capacity);
+    }
+}
+
+bool contains_weight_icsr_graph(icsr_graph_s const * const graph, size_t const index_one, size_t const index_two) {
+    error(graph && "Parameter can't be NULL.");
+    error(index_one < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_two < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_one != index_two && "Parameters can't be equal.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return ICSR_SPECIAL != _icsr_graph_find(graph, index_one, index_two);
+}
+
+void get_weight_icsr_graph(icsr_graph_s const * const graph, size_t const index_one, size_t const index_two, void * const buffer) {
+    error(graph && "Parameter can't be NULL.");
+    error(index_one < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_two < graph->vertex_length && "Parameter can't exceed length.");
+    error(index_one != index_two && "Parameters can't be equal.");
+    error(buffer && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const e = _icsr_graph_find(graph, index_one, index_two);
+    error(ICSR_SPECIAL != e && "Can't get non-existing edge.");
+
+    memcpy(buffer, graph->weights + (e * graph->weight_size), graph->weight_size);
+}
+
+size_t degree_icsr_graph(icsr_graph_s const * const graph, size_t const index) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return graph->degrees[index];
+}
+
+void bfs_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    bfs_workspace_icsr_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void bfs_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error((end < graph->vertex_length || end == ICSR_SPECIAL) && "Parameter can't exceed length.");
+    error(is_compact_icsr_graph(graph) && "Graph must be compacted.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _icsr_graph_start(graph, workspace, start);
+
+    size_t * queue = workspace->array;
+    size_t head = 0, tail = 0;
+    queue[tail++] = start;
+
+    while (head < tail && end != queue[head]) {
+        size_t const v = queue[head++];
+
+        for (size_t s = graph->offsets[v]; s < graph->offsets[v + 1]; ++s) {
+            size_t const u = graph->adjacency[2 * s];
+            if (!reach_graph_workspace(workspace, u)) { continue; }
+
+            queue[tail++] = u;
+
+            void * u_cost = table->costs + (u * table->size);
+            table->previous[u] = v;
+            memcpy(u_cost, table->zero, table->size);
+            table->juggle(u_cost, graph->weights + (graph->adjacency[2 * s + 1] * graph->weight_size), table->aj);
+        }
+    }
+}
+
+void dfs_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    dfs_workspace_icsr_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void dfs_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error((end < graph->vertex_length || end == ICSR_SPECIAL) && "Parameter can't exceed length.");
+    error(is_compact_icsr_graph(graph) && "Graph must be compacted.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _icsr_graph_start(graph, workspace, start);
+
+    size_t * stack = workspace->array;
+    size_t length = 0;
+    stack[length++] = start;
+
+    while (length && end != stack[length - 1]) {
+        size_t const v = stack[--length];
+
+        for (size_t s = graph->offsets[v]; s < graph->offsets[v + 1]; ++s) {
+            size_t const u = graph->adjacency[2 * s];
+            if (!reach_graph_workspace(workspace, u)) { continue; }
+
+            stack[length++] = u;
+
+            void * u_cost = table->costs + (u * table->size);
+            table->previous[u] = v;
+            memcpy(u_cost, table->zero, table->size);
+            table->juggle(u_cost, graph->weights + (graph->adjacency[2 * s + 1] * graph->weight_size), table->aj);
+        }
+    }
+}
+
+void dijkstra_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    dijkstra_workspace_icsr_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void dijkstra_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error((end < graph->vertex_length || end == ICSR_SPECIAL) && "Parameter can't exceed length.");
+    error(is_compact_icsr_graph(graph) && "Graph must be compacted.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _icsr_graph_start(graph, workspace, start);
+
+    char * sum = workspace->scratch + (workspace->length * table->size);
+
+    // heap is keyed by vertex costs, so lowering a cost only needs to move vertex up
+    push_graph_workspace(workspace, table->costs, start);
+
+    while (workspace->heap_length) {
+        size_t const v = pop_graph_workspace(workspace, table->costs);
+        if (end == v) { break; }
+
+        workspace->visited[v] = workspace->epoch;
+        void const * v_cost = table->costs + (v * table->size);
+
+        for (size_t s = graph->offsets[v]; s < graph->offsets[v + 1]; ++s) {
+            size_t const u = graph->adjacency[2 * s];
+            if (workspace->epoch == workspace->visited[u]) { continue; }
+
+            void const * weight = graph->weights + (graph->adjacency[2 * s + 1] * graph->weight_size);
+            memcpy(sum, table->zero, table->size);
+            memmove(sum, table->sum(table->juggle(sum, weight, table->aj), v_cost, table->as), table->size);
+
+            void * u_cost = table->costs + (u * table->size);
+            if (table->compare(sum, u_cost, table->ac) < 0) {
+                reach_graph_workspace(workspace, u);
+                table->previous[u] = v;
+                memcpy(u_cost, sum, table->size);
+                push_graph_workspace(workspace, table->costs, u);
+            }
+        }
+    }
+}
+
+void a_star_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start, size_t const end, operate_fn const heuristic, void * const ah) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    a_star_workspace_icsr_graph(graph, &workspace, start, end, heuristic, ah);
+    release_graph_workspace(&workspace, table);
+}
+
+void a_star_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end, operate_fn const heuristic, void * const ah) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error(end < graph->vertex_length && "Parameter can't exceed length.");
+    error(heuristic && "Parameter can't be NULL.");
+    error(is_compact_icsr_graph(graph) && "Graph must be compacted.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _icsr_graph_start(graph, workspace, start);
+
+    // F(n) estimates of each vertex followed by buffers for sum and H(n), only reached vertices' estimates are read
+    char * estimates = workspace->scratch;
+    char * sum = estimates + (workspace->length * table->size);
+    char * h_cost = sum + table->size;
+
+    void const * target = graph->vertices + (end * graph->vertex_size);
+
+    // start's F(n) is its H(n), since its G(n) is zero
+    heuristic(h_cost, graph->vertices + (start * graph->vertex_size), target, ah);
+    memcpy(estimates + (start * table->size), h_cost, table->size);
+
+    // heap is keyed by F(n) estimates instead of G(n) costs
+    push_graph_workspace(workspace, estimates, start);
+
+    while (workspace->heap_length) {
+        size_t const v = pop_graph_workspace(workspace, estimates);
+        if (end == v) { break; }
+
+        workspace->visited[v] = workspace->epoch;
+        void const * v_cost = table->costs + (v * table->size);
+
+        for (size_t s = graph->offsets[v]; s < graph->offsets[v + 1]; ++s) {
+            size_t const u = graph->adjacency[2 * s];
+            if (workspace->epoch == workspace->visited[u]) { continue; }
+
+            void const * weight = graph->weights + (graph->adjacency[2 * s + 1] * graph->weight_size);
+            memcpy(sum, table->zero, table->size);
+            memmove(sum, table->sum(table->juggle(sum, weight, table->aj), v_cost, table->as), table->size);
+
+            void * u_cost = table->costs + (u * table->size);
+            if (table->compare(sum, u_cost, table->ac) >= 0) { continue; }
+
+            reach_graph_workspace(workspace, u);
+            table->previous[u] = v;
+            memcpy(u_cost, sum, table->size);
+
+            // F(n) is G(n) plus H(n) unless H(n) is infinite (used to prevent potential overflow while summing)
+            void * f_cost = estimates + (u * table->size);
+            heuristic(h_cost, graph->vertices + (u * graph->vertex_size), target, ah);
+            bool const can_sum = table->compare(h_cost, table->infinite, table->ac);
+            memmove(f_cost, can_sum ? table->sum(sum, h_cost, table->as) : table->infinite, table->size);
+
+            push_graph_workspace(workspace, estimates, u);
+        }
+    }
+}
+
+void prim_icsr_graph(icsr_graph_s const * const graph, table_s * const table, size_t const start) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    prim_workspace_icsr_graph(graph, &workspace, start);
+    release_graph_workspace(&workspace, table);
+}
+
+void prim_workspace_icsr_graph(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error(is_compact_icsr_graph(graph) && "Graph must be compacted.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _icsr_graph_start(graph, workspace, start);
+
+    char * weight_cost = workspace->scratch + (workspace->length * table->size);
+
+    // heap is keyed by cost of cheapest edge connecting vertex to tree
+    push_graph_workspace(workspace, table->costs, start);
+
+    while (workspace->heap_length) {
+        size_t const v = pop_graph_workspace(workspace, table->costs);
+        workspace->visited[v] = workspace->epoch;
+
+        for (size_t s = graph->offsets[v]; s < graph->offsets[v + 1]; ++s) {
+            size_t const u = graph->adjacency[2 * s];
+            if (workspace->epoch == workspace->visited[u]) { continue; }
+
+            void const * weight = graph->weights + (graph->adjacency[2 * s + 1] * graph->weight_size);
+            memcpy(weight_cost, table->zero, table->size);
+            memmove(weight_cost, table->juggle(weight_cost, weight, table->aj), table->size);
+
+            void * u_cost = table->costs + (u * table->size);
+            if (table->compare(weight_cost, u_cost, table->ac) < 0) {
+                reach_graph_workspace(workspace, u);
+                table->previous[u] = v;
+                memcpy(u_cost, weight_cost, table->size);
+                push_graph_workspace(workspace, table->costs, u);
+            }
+        }
+    }
+}
+
+void kruskal_icsr_graph(icsr_graph_s const * const graph, table_s * const table) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table->graph = graph;
+    table->costs = graph->allocator->alloc(graph->vertex_length * table->size, graph->allocator->arg);
+    error((!graph->vertex_length || table->costs) && "Memory allocation failed.");
+    table->previous = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
+    error((!graph->vertex_length || table->previous) && "Memory allocation failed.");
+
+    // make each vertex its own set with zero cost
+    idisjoint_set_s set = make_idisjoint_set(graph->allocator);
+    reserve_idisjoint_set(&set, graph->vertex_length);
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        memcpy(table->costs + (i * table->size), table->zero, table->size);
+        insert_idisjoint_set(&set);
+    }
+
+    // graph has no weight compare function, so edges are juggled into costs once and sorted by table's compare
+    icsr_edge_s * edges = graph->allocator->alloc(graph->edge_length * sizeof(icsr_edge_s), graph->allocator->arg);
+    error((!graph->edge_length || edges) && "Memory allocation failed.");
+    char * costs = graph->allocator->alloc(graph->edge_length * table->size, graph->allocator->arg);
+    error((!graph->edge_length || costs) && "Memory allocation failed.");
+
+    // edge list is kept regardless of compaction, so Kruskal doesn't need rows
+    for (size_t e = 0; e < graph->edge_length; ++e) {
+        char * const cost = costs + (e * table->size);
+        memcpy(cost, table->zero, table->size);
+        table->juggle(cost, graph->weights + (e * graph->weight_size), table->aj);
+
+        edges[e] = (icsr_edge_s) { .weight = cost, .vertices = { graph->ends[2 * e], graph->ends[2 * e + 1] }, };
+    }
+    _icsr_graph_sort(table, edges, graph->edge_length);
+
+    // Kruskal's algorithm with sorted edges, stops once every vertex is in a single set
+    for (size_t i = 0; i < graph->edge_length && set.count > 1; ++i) {
+        _icsr_graph_join(table, &set, edges + i);
+    }
+
+    // previous index points straight at root
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        table->previous[i] = find_idisjoint_set(&set, i);
+    }
+
+    destroy_idisjoint_set(&set);
+
+    graph->allocator->free(costs, graph->allocator->arg);
+    graph->allocator->free(edges, graph->allocator->arg);
+}
+
+void destroy_icsr_table(table_s * const table) {
+    error(table && "Parameter can't be NULL.");
+
+    icsr_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        table->destroy(table->costs + (i * table->size), table->ad);
+    }
+
+    graph->allocator->free(table->costs, graph->allocator->arg);
+    graph->allocator->free(table->previous, graph->allocator->arg);
+
+    memset(table, 0, sizeof(table_s));
+}
+
+void each_vertex_icsr_graph(icsr_graph_s const * const graph, manage_fn const manage, void * const am) {
+    error(graph && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const vertex_size = graph->vertex_size;
+    for (char * v = graph->vertices; v < graph->vertices + (graph->vertex_length * vertex_size); v += vertex_size) {
+        if (!manage(v, am)) { return; } // if handler terminates (returns false) end loop
+    }
+}
+
+void each_edge_icsr_graph(icsr_graph_s const * const graph, manage_fn const manage, void * const am) {
+    error(graph && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t e = 0; e < graph->edge_length; ++e) {
+        icsr_edge_s edge = {
+            .weight = graph->weights + (e * graph->weight_size), .vertices = { graph->ends[2 * e], graph->ends[2 * e + 1] },
+        };
+
+        if (!manage(&edge, am)) { return; } // if handler terminates (returns false) end loop
+    }
+}
+
+void each_neighbor_icsr_graph(icsr_graph_s const * const graph, size_t const index, manage_fn const manage, void * const am) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+    error(manage && "Parameter can't be NULL.");
+    error(is_compact_icsr_graph(graph) && "Graph must be compacted.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t s = graph->offsets[index]; s < graph->offsets[index + 1]; ++s) {
+        char * vertex = graph->vertices + (graph->adjacency[2 * s] * graph->vertex_size);
+        if (!manage(vertex, am)) { return; } // if handler terminates (returns false) end loop
+    }
+}
+
+void each_cost_icsr_graph(table_s const * const table, manage_fn const manage, void * const am) {
+    error(table && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    icsr_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    // for each cost in table
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        if (!manage(table->costs + (table->size * i), am)) { break; }
+    }
+}
+
+bool each_path_icsr_graph(table_s const * const table, size_t const end, manage_fn const manage, void * const am) {
+    error(table && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    icsr_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    error(end < graph->vertex_length && "Parameter can't exceed length.");
+
+    // push end vertex index to stack and traverse table until vertex doesn't have a previous parent
+    size_t * stack = graph->allocator->alloc(sizeof(size_t) * graph->vertex_length, graph->allocator->arg);
+    error(stack && "Memory allocation failed.");
+
+    size_t length = 0;
+    stack[length++] = end;
+    for (size_t i = table->previous[end]; ICSR_SPECIAL != i; i = table->previous[i]) {
+        stack[length++] = i;
+    }
+    size_t const top = stack[length - 1]; // save top to check if path exists (top has cost 0)
+
+    // traverse path from start to end index
+    while (length--) {
+        char * vertex = graph->vertices + (stack[length] * graph->vertex_size);
+        if (!manage(vertex, am)) { break; }
+    }
+
+    graph->allocator->free(stack, graph->allocator->arg);
+
+    // return true if last index cost is zero (path exists)
+    return !table->compare(table->costs + (top * table->size), table->zero, table->ac);
+}
+
+void _icsr_graph_resize(icsr_graph_s * const graph, size_t const size) {
+    graph->capacity = size;
+
+    graph->vertices = graph->allocator->realloc(graph->vertices, size * graph->vertex_size, graph->allocator->arg);
+    error((!size || graph->vertices) && "Memory allocation failed.");
+    graph->degrees = graph->allocator->realloc(graph->degrees, size * sizeof(size_t), graph->allocator->arg);
+    error((!size || graph->degrees) && "Memory allocation failed.");
+}
+
+void _icsr_graph_resize_edges(icsr_graph_s * const graph, size_t const size) {
+    graph->edge_capacity = size;
+
+    graph->weights = graph->allocator->realloc(graph->weights, size * graph->weight_size, graph->allocator->arg);
+    error((!size || graph->weights) && "Memory allocation failed.");
+    graph->ends = graph->allocator->realloc(graph->ends, 2 * size * sizeof(size_t), graph->allocator->arg);
+    error((!size || graph->ends) && "Memory allocation failed.");
+}
+
+void _icsr_graph_uncompact(icsr_graph_s * const graph) {
+    graph->allocator->free(graph->offsets, graph->allocator->arg);
+    graph->allocator->free(graph->adjacency, graph->allocator->arg);
+
+    graph->offsets = graph->adjacency = NULL;
+    graph->row_length = graph->compact_length = 0;
+}
+
+size_t _icsr_graph_find(icsr_graph_s const * const graph, size_t const index_one, size_t const index_two) {
+    // compacted rows are sorted, so search stops at first bigger neighbor
+    if (index_one < graph->row_length) {
+        for (size_t s = graph->offsets[index_one]; s < graph->offsets[index_one + 1] && graph->adjacency[2 * s] <= index_two; ++s) {
+            if (index_two == graph->adjacency[2 * s]) {
+                return graph->adjacency[2 * s + 1];
+            }
+        }
+    }
+
+    // edges inserted after compaction can only be found in buffer
+    for (size_t e = graph->compact_length; e < graph->edge_length; ++e) {
+        size_t const one = graph->ends[2 * e], two = graph->ends[2 * e + 1];
+        if ((index_one == one && index_two == two) || (index_one == two && index_two == one)) {
+            return e;
+        }
+    }
+
+    return ICSR_SPECIAL;
+}
+
+void _icsr_graph_start(icsr_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start) {
+    reset_graph_workspace(workspace);
+    workspace->table.graph = graph;
+
+    reach_graph_workspace(workspace, start);
+    memcpy(workspace->table.costs + (workspace->table.size * start), workspace->table.zero, workspace->table.size);
+}
+
+bool _icsr_graph_join(table_s * const table, idisjoint_set_s * const set, icsr_edge_s const * const edge) {
+    size_t const one = find_idisjoint_set(set, edge->vertices[0]), two = find_idisjoint_set(set, edge->vertices[1]);
+    if (!union_idisjoint_set(set, one, two)) {
+        return false;
+    }
+
+    // joined root takes other root's cost and edge's cost, while other root goes back to zero
+    size_t const root = find_idisjoint_set(set, one), other = root == one ? two : one;
+    char * const root_cost = table->costs + (root * table->size), * const other_cost = table->costs + (other * table->size);
+
+    table->sum(root_cost, other_cost, table->as);
+    table->sum(root_cost, edge->weight, table->as);
+    memcpy(other_cost, table->zero, table->size);
+
+    return true;
+}
+
+void _icsr_graph_sort(table_s const * const table, icsr_edge_s * const edges, size_t const length) {
+    size_t left = 0, right = length;
+
+    // quicksort loops over bigger partition and recurses into smaller one, so stack is at most logarithmic
+    while (right - left > CERPEC_BATCH) {
+        // median of three pivot is moved to middle
+        size_t const middle = left + (right - left) / 2;
+        if (table->compare(edges[middle].weight, edges[left].weight, table->ac) < 0) {
+            icsr_edge_s const temporary = edges[middle]; edges[middle] = edges[left]; edges[left] = temporary;
+        }
+        if (table->compare(edges[right - 1].weight, edges[middle].weight, table->ac) < 0) {
+            icsr_edge_s const temporary = edges[middle]; edges[middle] = edges[right - 1]; edges[right - 1] = temporary;
+            if (table->compare(edges[middle].weight, edges[left].weight, table->ac) < 0) {
+                icsr_edge_s const swap = edges[middle]; edges[middle] = edges[left]; edges[left] = swap;
+            }
+        }
+
+        char const * const pivot = edges[middle].weight;
+        size_t i = left, j = right - 1;
+        while (true) {
+            while (table->compare(edges[i].weight, pivot, table->ac) < 0) { i++; }
+            while (table->compare(edges[j].weight, pivot, table->ac) > 0) { j--; }
+            if (i >= j) {
+                break;
+            }
+
+            icsr_edge_s const temporary = edges[i]; edges[i] = edges[j]; edges[j] = temporary;
+            i++; j--;
+        }
+
+        // partitions are [left, j] and [j + 1, right)
+        if (j + 1 - left < right - (j + 1)) {
+            _icsr_graph_sort(table, edges + left, j + 1 - left);
+            left = j + 1;
+        } else {
+            _icsr_graph_sort(table, edges + j + 1, right - (j + 1));
+            right = j + 1;
+        }
+    }
+
+    // insertion sort for small partition
+    for (size_t i = left + 1; i < right; ++i) {
+        icsr_edge_s const edge = edges[i];
+
+        size_t j = i;
+        for (; j > left && table->compare(edge.weight, edges[j - 1].weight, table->ac) < 0; --j) {
+            edges[j] = edges[j - 1];
+        }
+        edges[j] = edge;
+    }
+}
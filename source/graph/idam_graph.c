@@ -0,0 +1,810 @@
+#include <graph/idam_graph.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Number of edge presence bits in a single bitset word.
+#define IDAM_GRAPH_WORD 64
+
+/// @brief Frame of iterative depth first search with vertex and column to continue scanning its row from.
+struct idam_graph_frame {
+    size_t vertex, from;
+};
+
+/// @brief Resize function for graph, moves every row since number of columns changes with capacity.
+/// @param graph Graph to resize.
+/// @param size New vertex capacity to resize into.
+void _idam_graph_resize(idam_graph_s * const graph, size_t const size);
+
+/// @brief Calculates number of bitset words in a row of graph with vertex capacity.
+/// @param capacity Vertex capacity or length.
+/// @return Number of words.
+size_t _idam_graph_words(size_t const capacity);
+
+/// @brief Counts trailing zero bits of non-zero word, i.e. index of its lowest set bit.
+/// @param word Non-zero bitset word.
+/// @return Index of lowest set bit.
+size_t _idam_graph_trailing(uint64_t const word);
+
+/// @brief Finds next vertex an edge from vertex goes to, starting at column.
+/// @param graph Graph to search.
+/// @param vertex Source vertex index.
+/// @param from First column to check.
+/// @return Destination vertex index, or IDAM_SPECIAL if no edges are left in row.
+size_t _idam_graph_next(idam_graph_s const * const graph, size_t const vertex, size_t const from);
+
+/// @brief Resets workspace and marks start vertex as reached with zero cost.
+/// @param graph Graph to search.
+/// @param workspace Workspace to search with.
+/// @param start Starting vertex index.
+void _idam_graph_start(idam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start);
+
+idam_graph_s create_idam_graph(size_t const vertex_size, size_t const weight_size) {
+    error(vertex_size && "Parameter can't be zero.");
+    error(weight_size && "Parameter can't be zero.");
+
+    return (idam_graph_s) {
+        .vertex_size = vertex_size, .weight_size = weight_size,
+        .allocator = &standard, .growth = CERPEC_GROWTH(IDAM_GRAPH_CHUNK),
+    };
+}
+
+idam_graph_s make_idam_graph(size_t const vertex_size, size_t const weight_size, memory_s const * const allocator) {
+    error(vertex_size && "Parameter can't be zero.");
+    error(weight_size && "Parameter can't be zero.");
+    error(allocator && "Parameter can't be NULL.");
+
+    return (idam_graph_s) {
+        .vertex_size = vertex_size, .weight_size = weight_size,
+        .allocator = allocator, .growth = CERPEC_GROWTH(IDAM_GRAPH_CHUNK),
+    };
+}
+
+void destroy_idam_graph(idam_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw) {
+    error(graph && "Parameter can't be NULL.");
+    error(destroy_vertex && "Parameter can't be NULL.");
+    error(destroy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    clear_idam_graph(graph, destroy_vertex, adv, destroy_weight, adw);
+
+    memset(graph, 0, sizeof(idam_graph_s));
+}
+
+void clear_idam_graph(idam_graph_s * const graph, set_fn const destroy_vertex, void * const adv, set_fn const destroy_weight, void * const adw) {
+    error(graph && "Parameter can't be NULL.");
+    error(destroy_vertex && "Parameter can't be NULL.");
+    error(destroy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        destroy_vertex(graph->vertices + (v * graph->vertex_size), adv);
+
+        for (size_t u = _idam_graph_next(graph, v, 0); IDAM_SPECIAL != u; u = _idam_graph_next(graph, v, u + 1)) {
+            destroy_weight(graph->weights + (((v * graph->capacity) + u) * graph->weight_size), adw);
+        }
+    }
+
+    graph->allocator->free(graph->vertices, graph->allocator->arg);
+    graph->allocator->free(graph->weights, graph->allocator->arg);
+    graph->allocator->free(graph->bits, graph->allocator->arg);
+    graph->allocator->free(graph->in_degrees, graph->allocator->arg);
+    graph->allocator->free(graph->out_degrees, graph->allocator->arg);
+
+    graph->capacity = graph->vertex_length = graph->edge_length = 0;
+    graph->vertices = graph->weights = NULL;
+    graph->bits = NULL;
+    graph->in_degrees = graph->out_degrees = NULL;
+}
+
+idam_graph_s copy_idam_graph(idam_graph_s const * const graph, copy_fn const copy_vertex, void * const acv, copy_fn const copy_weight, void * const acw) {
+    error(graph && "Parameter can't be NULL.");
+    error(copy_vertex && "Parameter can't be NULL.");
+    error(copy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const words = graph->capacity * _idam_graph_words(graph->capacity);
+    idam_graph_s const replica = {
+        .vertex_size = graph->vertex_size, .weight_size = graph->weight_size,
+        .vertex_length = graph->vertex_length, .edge_length = graph->edge_length, .capacity = graph->capacity,
+        .allocator = graph->allocator, .growth = graph->growth,
+
+        .vertices = graph->allocator->alloc(graph->capacity * graph->vertex_size, graph->allocator->arg),
+        .weights = graph->allocator->alloc(graph->capacity * graph->capacity * graph->weight_size, graph->allocator->arg),
+        .bits = graph->allocator->alloc(words * sizeof(uint64_t), graph->allocator->arg),
+        .in_degrees = graph->allocator->alloc(graph->capacity * sizeof(size_t), graph->allocator->arg),
+        .out_degrees = graph->allocator->alloc(graph->capacity * sizeof(size_t), graph->allocator->arg),
+    };
+    error((!replica.capacity || (replica.vertices && replica.weights && replica.bits)) && "Memory allocation failed.");
+    error((!replica.capacity || (replica.in_degrees && replica.out_degrees)) && "Memory allocation failed.");
+
+    // memory copy presence bits and degrees, since they have no elements to copy
+    if (graph->capacity) {
+        memcpy(replica.bits, graph->bits, words * sizeof(uint64_t));
+        memcpy(replica.in_degrees, graph->in_degrees, graph->capacity * sizeof(size_t));
+        memcpy(replica.out_degrees, graph->out_degrees, graph->capacity * sizeof(size_t));
+    }
+
+    // function copy each vertex and each existing edge weight
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        copy_vertex(replica.vertices + (v * replica.vertex_size), graph->vertices + (v * graph->vertex_size), acv);
+
+        for (size_t u = _idam_graph_next(graph, v, 0); IDAM_SPECIAL != u; u = _idam_graph_next(graph, v, u + 1)) {
+            size_t const e = (v * graph->capacity) + u;
+            copy_weight(replica.weights + (e * replica.weight_size), graph->weights + (e * graph->weight_size), acw);
+        }
+    }
+
+    return replica;
+}
+
+bool is_empty_idam_graph(idam_graph_s const * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return !(graph->vertex_length);
+}
+
+void growth_idam_graph(idam_graph_s * const graph, growth_s const growth) {
+    error(graph && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph->growth = growth;
+}
+
+void reserve_idam_graph(idam_graph_s * const graph, size_t const capacity) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (capacity > graph->capacity) {
+        _idam_graph_resize(graph, capacity);
+    }
+}
+
+void shrink_to_fit_idam_graph(idam_graph_s * const graph) {
+    error(graph && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (graph->vertex_length != graph->capacity) {
+        _idam_graph_resize(graph, graph->vertex_length);
+    }
+}
+
+size_t insert_vertex_idam_graph(idam_graph_s * const graph, void const * const vertex) {
+    error(graph && "Parameter can't be NULL.");
+    error(vertex && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    if (graph->vertex_length == graph->capacity) {
+        _idam_graph_resize(graph, expand_growth(&(graph->growth), graph->vertex_length));
+    }
+
+    // rows and columns past length are kept without edges, so new vertex starts isolated
+    graph->in_degrees[graph->vertex_length] = graph->out_degrees[graph->vertex_length] = 0;
+    memcpy(graph->vertices + (graph->vertex_length * graph->vertex_size), vertex, graph->vertex_size);
+
+    return graph->vertex_length++;
+}
+
+size_t remove_vertex_idam_graph(idam_graph_s * const graph, size_t const index, void * const buffer, set_fn const destroy_weight, void * const adw) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+    error(buffer && "Parameter can't be NULL.");
+    error(destroy_weight && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const words = _idam_graph_words(graph->capacity);
+    size_t const last = graph->vertex_length - 1;
+    uint64_t const index_bit = (uint64_t)(1) << (index % IDAM_GRAPH_WORD);
+    uint64_t const last_bit = (uint64_t)(1) << (last % IDAM_GRAPH_WORD);
+
+    // destroy edges leaving removed vertex
+    for (size_t u = _idam_graph_next(graph, index, 0); IDAM_SPECIAL != u; u = _idam_graph_next(graph, index, u + 1)) {
+        destroy_weight(graph->weights + (((index * graph->capacity) + u) * graph->weight_size), adw);
+        graph->in_degrees[u]--;
+        graph->edge_length--;
+    }
+    memset(graph->bits + (index * words), 0, words * sizeof(uint64_t));
+
+    // destroy edges entering removed vertex
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        uint64_t * word = graph->bits + (v * words) + (index / IDAM_GRAPH_WORD);
+        if (!(*word & index_bit)) { continue; }
+
+        destroy_weight(graph->weights + (((v * graph->capacity) + index) * graph->weight_size), adw);
+        graph->out_degrees[v]--;
+        graph->edge_length--;
+        *word &= ~index_bit;
+    }
+
+    // move last vertex' row and column into removed vertex' ones
+    if (index != last) {
+        memcpy(graph->weights + (index * graph->capacity * graph->weight_size),
+            graph->weights + (last * graph->capacity * graph->weight_size), graph->vertex_length * graph->weight_size);
+        memcpy(graph->bits + (index * words), graph->bits + (last * words), words * sizeof(uint64_t));
+        memset(graph->bits + (last * words), 0, words * sizeof(uint64_t));
+
+        for (size_t v = 0; v < last; ++v) {
+            uint64_t * last_word = graph->bits + (v * words) + (last / IDAM_GRAPH_WORD);
+            if (!(*last_word & last_bit)) { continue; }
+
+            memcpy(graph->weights + (((v * graph->capacity) + index) * graph->weight_size),
+                graph->weights + (((v * graph->capacity) + last) * graph->weight_size), graph->weight_size);
+            graph->bits[(v * words) + (index / IDAM_GRAPH_WORD)] |= index_bit;
+            *last_word &= ~last_bit;
+        }
+
+        graph->in_degrees[index] = graph->in_degrees[last];
+        graph->out_degrees[index] = graph->out_degrees[last];
+    }
+
+    // save removed vertex into buffer and move last vertex into removed's position
+    graph->vertex_length--;
+    void * removed = graph->vertices + (index * graph->vertex_size);
+    memcpy(buffer, removed, graph->vertex_size);
+    memmove(removed, graph->vertices + (last * graph->vertex_size), graph->vertex_size);
+
+    // shrink graph if elements fit into smaller memory chunk
+    size_t const capacity = shrink_growth(&(graph->growth), graph->vertex_length, graph->capacity);
+    if (capacity != graph->capacity) {
+        _idam_graph_resize(graph, capacity);
+    }
+
+    // if last index was removed return an invalid index, else return the last vertex' index before it was moved
+    return graph->vertex_length;
+}
+
+void get_vertex_idam_graph(idam_graph_s const * const graph, size_t const index, void * const buffer) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+    error(buffer && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    memcpy(buffer, graph->vertices + (index * graph->vertex_size), graph->vertex_size);
+}
+
+void insert_weight_idam_graph(idam_graph_s * const graph, size_t const source, size_t const destination, void const * const weight) {
+    error(graph && "Parameter can't be NULL.");
+    error(source < graph->vertex_length && "Parameter can't exceed length.");
+    error(destination < graph->vertex_length && "Parameter can't exceed length.");
+    error(source != destination && "Parameters can't be equal.");
+    error(weight && "Parameter can't be NULL.");
+    error(!contains_weight_idam_graph(graph, source, destination) && "Edge already exists.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const words = _idam_graph_words(graph->capacity);
+    graph->bits[(source * words) + (destination / IDAM_GRAPH_WORD)] |= (uint64_t)(1) << (destination % IDAM_GRAPH_WORD);
+    memcpy(graph->weights + (((source * graph->capacity) + destination) * graph->weight_size), weight, graph->weight_size);
+
+    graph->out_degrees[source]++;
+    graph->in_degrees[destination]++;
+    graph->edge_length++;
+}
+
+void remove_weight_idam_graph(idam_graph_s * const graph, size_t const source, size_t const destination, void * const buffer) {
+    error(graph && "Parameter can't be NULL.");
+    error(source < graph->vertex_length && "Parameter can't exceed length.");
+    error(destination < graph->vertex_length && "Parameter can't exceed length.");
+    error(source != destination && "Parameters can't be equal.");
+    error(buffer && "Parameter can't be NULL.");
+    error(contains_weight_idam_graph(graph, source, destination) && "Can't remove none.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const words = _idam_graph_words(graph->capacity);
+    graph->bits[(source * words) + (destination / IDAM_GRAPH_WORD)] &= ~((uint64_t)(1) << (destination % IDAM_GRAPH_WORD));
+    memcpy(buffer, graph->weights + (((source * graph->capacity) + destination) * graph->weight_size), graph->weight_size);
+
+    graph->out_degrees[source]--;
+    graph->in_degrees[destination]--;
+    graph->edge_length--;
+}
+
+bool contains_weight_idam_graph(idam_graph_s const * const graph, size_t const source, size_t const destination) {
+    error(graph && "Parameter can't be NULL.");
+    error(source < graph->vertex_length && "Parameter can't exceed length.");
+    error(destination < graph->vertex_length && "Parameter can't exceed length.");
+    error(source != destination && "Parameters can't be equal.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const words = _idam_graph_words(graph->capacity);
+    return (graph->bits[(source * words) + (destination / IDAM_GRAPH_WORD)] >> (destination % IDAM_GRAPH_WORD)) & 1;
+}
+
+void get_weight_idam_graph(idam_graph_s const * const graph, size_t const source, size_t const destination, void * const buffer) {
+    error(graph && "Parameter can't be NULL.");
+    error(source < graph->vertex_length && "Parameter can't exceed length.");
+    error(destination < graph->vertex_length && "Parameter can't exceed length.");
+    error(source != destination && "Parameters can't be equal.");
+    error(buffer && "Parameter can't be NULL.");
+    error(contains_weight_idam_graph(graph, source, destination) && "Edge doesn't exist.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    memcpy(buffer, graph->weights + (((source * graph->capacity) + destination) * graph->weight_size), graph->weight_size);
+}
+
+size_t in_degree_idam_graph(idam_graph_s const * const graph, size_t const index) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return graph->in_degrees[index];
+}
+
+size_t out_degree_idam_graph(idam_graph_s const * const graph, size_t const index) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    return graph->out_degrees[index];
+}
+
+bool topological_sort_idam_graph(idam_graph_s const * const graph, size_t * const order) {
+    error(graph && "Parameter can't be NULL.");
+    error(order && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t * degrees = graph->allocator->alloc(graph->vertex_length * sizeof(size_t), graph->allocator->arg);
+    error((!graph->vertex_length || degrees) && "Memory allocation failed.");
+
+    // order doubles as queue of vertices whose incoming edges all come from already sorted vertices
+    size_t head = 0, tail = 0;
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        degrees[v] = graph->in_degrees[v];
+        if (!degrees[v]) {
+            order[tail++] = v;
+        }
+    }
+
+    size_t const words = _idam_graph_words(graph->capacity), row_words = _idam_graph_words(graph->vertex_length);
+    while (head < tail) {
+        size_t const v = order[head++];
+
+        uint64_t const * row = graph->bits + (v * words);
+        for (size_t w = 0; w < row_words; ++w) {
+            for (uint64_t word = row[w]; word; word &= word - 1) {
+                size_t const u = (w * IDAM_GRAPH_WORD) + _idam_graph_trailing(word);
+                if (!--degrees[u]) {
+                    order[tail++] = u;
+                }
+            }
+        }
+    }
+
+    graph->allocator->free(degrees, graph->allocator->arg);
+
+    // vertices on or behind a cycle never lose all incoming edges
+    return tail == graph->vertex_length;
+}
+
+size_t strongly_connected_idam_graph(idam_graph_s const * const graph, size_t * const components) {
+    error(graph && "Parameter can't be NULL.");
+    error(components && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    // allocate discovery indexes followed by low links and Tarjan's stack, to later free at once
+    size_t * discovery = graph->allocator->alloc(3 * graph->vertex_length * sizeof(size_t), graph->allocator->arg);
+    error((!graph->vertex_length || discovery) && "Memory allocation failed.");
+    size_t * low = discovery + graph->vertex_length, * stack = low + graph->vertex_length;
+
+    // explicit call stack replaces recursion, so deep graphs can't overflow the program's stack
+    struct idam_graph_frame * frames = graph->allocator->alloc(graph->vertex_length * sizeof(struct idam_graph_frame), graph->allocator->arg);
+    error((!graph->vertex_length || frames) && "Memory allocation failed.");
+
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        discovery[v] = components[v] = IDAM_SPECIAL;
+    }
+
+    size_t counter = 0, count = 0, length = 0;
+    for (size_t s = 0; s < graph->vertex_length; ++s) {
+        if (IDAM_SPECIAL != discovery[s]) { continue; }
+
+        size_t depth = 0;
+        frames[depth++] = (struct idam_graph_frame) { .vertex = s, .from = 0, };
+        discovery[s] = low[s] = counter++;
+        stack[length++] = s;
+
+        while (depth) {
+            struct idam_graph_frame * frame = frames + (depth - 1);
+            size_t const v = frame->vertex;
+            size_t const u = _idam_graph_next(graph, v, frame->from);
+
+            if (IDAM_SPECIAL != u) {
+                frame->from = u + 1;
+
+                if (IDAM_SPECIAL == discovery[u]) {
+                    frames[depth++] = (struct idam_graph_frame) { .vertex = u, .from = 0, };
+                    discovery[u] = low[u] = counter++;
+                    stack[length++] = u;
+                } else if (IDAM_SPECIAL == components[u] && discovery[u] < low[v]) {
+                    // discovered vertex without component is still on Tarjan's stack
+                    low[v] = discovery[u];
+                }
+
+                continue;
+            }
+
+            // row is exhausted, so vertex with unchanged low link is root of a component
+            depth--;
+            if (low[v] == discovery[v]) {
+                size_t w = IDAM_SPECIAL;
+                do {
+                    w = stack[--length];
+                    components[w] = count;
+                } while (w != v);
+                count++;
+            }
+
+            if (depth && low[v] < low[frames[depth - 1].vertex]) {
+                low[frames[depth - 1].vertex] = low[v];
+            }
+        }
+    }
+
+    graph->allocator->free(discovery, graph->allocator->arg);
+    graph->allocator->free(frames, graph->allocator->arg);
+
+    return count;
+}
+
+void bfs_idam_graph(idam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    bfs_workspace_idam_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void bfs_workspace_idam_graph(idam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error((end < graph->vertex_length || end == IDAM_SPECIAL) && "Parameter can't exceed length.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _idam_graph_start(graph, workspace, start);
+
+    size_t * queue = workspace->array;
+    size_t head = 0, tail = 0;
+    queue[tail++] = start;
+
+    size_t const words = _idam_graph_words(graph->capacity), row_words = _idam_graph_words(graph->vertex_length);
+    while (head < tail && end != queue[head]) {
+        size_t const v = queue[head++];
+
+        // zero words skip 64 absent edges at once, set bits are visited lowest first
+        uint64_t const * row = graph->bits + (v * words);
+        for (size_t w = 0; w < row_words; ++w) {
+            for (uint64_t word = row[w]; word; word &= word - 1) {
+                size_t const u = (w * IDAM_GRAPH_WORD) + _idam_graph_trailing(word);
+                if (!reach_graph_workspace(workspace, u)) { continue; }
+
+                queue[tail++] = u;
+
+                void * u_cost = table->costs + (u * table->size);
+                table->previous[u] = v;
+                memcpy(u_cost, table->zero, table->size);
+                table->juggle(u_cost, graph->weights + (((v * graph->capacity) + u) * graph->weight_size), table->aj);
+            }
+        }
+    }
+}
+
+void dijkstra_idam_graph(idam_graph_s const * const graph, table_s * const table, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    graph_workspace_s workspace = make_graph_workspace(graph->vertex_length, table, graph->allocator);
+    dijkstra_workspace_idam_graph(graph, &workspace, start, end);
+    release_graph_workspace(&workspace, table);
+}
+
+void dijkstra_workspace_idam_graph(idam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start, size_t const end) {
+    error(graph && "Parameter can't be NULL.");
+    error(workspace && "Parameter can't be NULL.");
+    error(start < graph->vertex_length && "Parameter can't exceed length.");
+    error((end < graph->vertex_length || end == IDAM_SPECIAL) && "Parameter can't exceed length.");
+    error(graph->vertex_length <= workspace->length && "Workspace can't be smaller than graph.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    table_s * table = &workspace->table;
+    _idam_graph_start(graph, workspace, start);
+
+    char * sum = workspace->scratch + (workspace->length * table->size);
+
+    // heap is keyed by vertex costs, so lowering a cost only needs to move vertex up
+    push_graph_workspace(workspace, table->costs, start);
+
+    size_t const words = _idam_graph_words(graph->capacity), row_words = _idam_graph_words(graph->vertex_length);
+    while (workspace->heap_length) {
+        size_t const v = pop_graph_workspace(workspace, table->costs);
+        if (end == v) { break; }
+
+        workspace->visited[v] = workspace->epoch;
+        void const * v_cost = table->costs + (v * table->size);
+
+        uint64_t const * row = graph->bits + (v * words);
+        for (size_t w = 0; w < row_words; ++w) {
+            for (uint64_t word = row[w]; word; word &= word - 1) {
+                size_t const u = (w * IDAM_GRAPH_WORD) + _idam_graph_trailing(word);
+                if (workspace->epoch == workspace->visited[u]) { continue; }
+
+                void const * weight = graph->weights + (((v * graph->capacity) + u) * graph->weight_size);
+                memcpy(sum, table->zero, table->size);
+                memmove(sum, table->sum(table->juggle(sum, weight, table->aj), v_cost, table->as), table->size);
+
+                void * u_cost = table->costs + (u * table->size);
+                if (table->compare(sum, u_cost, table->ac) < 0) {
+                    reach_graph_workspace(workspace, u);
+                    table->previous[u] = v;
+                    memcpy(u_cost, sum, table->size);
+                    push_graph_workspace(workspace, table->costs, u);
+                }
+            }
+        }
+    }
+}
+
+void destroy_idam_table(table_s * const table) {
+    error(table && "Parameter can't be NULL.");
+
+    idam_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        table->destroy(table->costs + (i * table->size), table->ad);
+    }
+
+    graph->allocator->free(table->costs, graph->allocator->arg);
+    graph->allocator->free(table->previous, graph->allocator->arg);
+
+    memset(table, 0, sizeof(table_s));
+}
+
+void each_vertex_idam_graph(idam_graph_s const * const graph, manage_fn const manage, void * const am) {
+    error(graph && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    size_t const vertex_size = graph->vertex_size;
+    for (char * v = graph->vertices; v < graph->vertices + (graph->vertex_length * vertex_size); v += vertex_size) {
+        if (!manage(v, am)) { return; } // if handler terminates (returns false) end loop
+    }
+}
+
+void each_edge_idam_graph(idam_graph_s const * const graph, manage_fn const manage, void * const am) {
+    error(graph && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        for (size_t u = _idam_graph_next(graph, v, 0); IDAM_SPECIAL != u; u = _idam_graph_next(graph, v, u + 1)) {
+            idam_edge_s edge = {
+                .weight = graph->weights + (((v * graph->capacity) + u) * graph->weight_size), .vertices = { v, u },
+            };
+
+            if (!manage(&edge, am)) { return; } // if handler terminates (returns false) end loop
+        }
+    }
+}
+
+void each_neighbor_idam_graph(idam_graph_s const * const graph, size_t const index, manage_fn const manage, void * const am) {
+    error(graph && "Parameter can't be NULL.");
+    error(index < graph->vertex_length && "Parameter can't exceed length.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    for (size_t u = _idam_graph_next(graph, index, 0); IDAM_SPECIAL != u; u = _idam_graph_next(graph, index, u + 1)) {
+        if (!manage(graph->vertices + (u * graph->vertex_size), am)) { return; } // if handler terminates (returns false) end loop
+    }
+}
+
+void each_cost_idam_graph(table_s const * const table, manage_fn const manage, void * const am) {
+    error(table && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    idam_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    // for each cost in table
+    for (size_t i = 0; i < graph->vertex_length; ++i) {
+        if (!manage(table->costs + (table->size * i), am)) { break; }
+    }
+}
+
+bool each_path_idam_graph(table_s const * const table, size_t const end, manage_fn const manage, void * const am) {
+    error(table && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    idam_graph_s const * graph = table->graph;
+
+    valid(graph && "Table graph can't be NULL.");
+    valid(graph->weight_size && "Weight size can't be zero.");
+    valid(graph->vertex_size && "Vertex size can't be zero.");
+    valid(graph->allocator && "Allocator can't be NULL.");
+
+    error(end < graph->vertex_length && "Parameter can't exceed length.");
+
+    // push end vertex index to stack and traverse table until vertex doesn't have a previous parent
+    size_t * stack = graph->allocator->alloc(sizeof(size_t) * graph->vertex_length, graph->allocator->arg);
+    error(stack && "Memory allocation failed.");
+
+    size_t length = 0;
+    stack[length++] = end;
+    for (size_t i = table->previous[end]; IDAM_SPECIAL != i; i = table->previous[i]) {
+        stack[length++] = i;
+    }
+    size_t const top = stack[length - 1]; // save top to check if path exists (top has cost 0)
+
+    // traverse path from start to end index
+    while (length--) {
+        char * vertex = graph->vertices + (stack[length] * graph->vertex_size);
+        if (!manage(vertex, am)) { break; }
+    }
+
+    graph->allocator->free(stack, graph->allocator->arg);
+
+    // return true if last index cost is zero (path exists)
+    return !table->compare(table->costs + (top * table->size), table->zero, table->ac);
+}
+
+void _idam_graph_resize(idam_graph_s * const graph, size_t const size) {
+    size_t const words = _idam_graph_words(size), old_words = _idam_graph_words(graph->capacity);
+
+    char * weights = graph->allocator->alloc(size * size * graph->weight_size, graph->allocator->arg);
+    error((!size || weights) && "Memory allocation failed.");
+    uint64_t * bits = graph->allocator->alloc(size * words * sizeof(uint64_t), graph->allocator->arg);
+    error((!size || bits) && "Memory allocation failed.");
+
+    // every row's columns and words start at a new offset, bits past length stay cleared
+    if (size) {
+        memset(bits, 0, size * words * sizeof(uint64_t));
+    }
+    size_t const row_words = _idam_graph_words(graph->vertex_length);
+    for (size_t v = 0; v < graph->vertex_length; ++v) {
+        memcpy(weights + (v * size * graph->weight_size), graph->weights + (v * graph->capacity * graph->weight_size),
+            graph->vertex_length * graph->weight_size);
+        memcpy(bits + (v * words), graph->bits + (v * old_words), row_words * sizeof(uint64_t));
+    }
+
+    graph->allocator->free(graph->weights, graph->allocator->arg);
+    graph->allocator->free(graph->bits, graph->allocator->arg);
+    graph->weights = weights;
+    graph->bits = bits;
+    graph->capacity = size;
+
+    graph->vertices = graph->allocator->realloc(graph->vertices, size * graph->vertex_size, graph->allocator->arg);
+    error((!size || graph->vertices) && "Memory allocation failed.");
+    graph->in_degrees = graph->allocator->realloc(graph->in_degrees, size * sizeof(size_t), graph->allocator->arg);
+    error((!size || graph->in_degrees) && "Memory allocation failed.");
+    graph->out_degrees = graph->allocator->realloc(graph->out_degrees, size * sizeof(size_t), graph->allocator->arg);
+    error((!size || graph->out_degrees) && "Memory allocation failed.");
+}
+
+size_t _idam_graph_words(size_t const capacity) {
+    return (capacity + IDAM_GRAPH_WORD - 1) / IDAM_GRAPH_WORD;
+}
+
+size_t _idam_graph_trailing(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(__builtin_ctzll(word));
+#else
+    size_t count = 0;
+    for (uint64_t w = word; !(w & 1); w >>= 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+size_t _idam_graph_next(idam_graph_s const * const graph, size_t const vertex, size_t const from) {
+    if (from >= graph->vertex_length) {
+        return IDAM_SPECIAL;
+    }
+
+    uint64_t const * row = graph->bits + (vertex * _idam_graph_words(graph->capacity));
+    size_t const row_words = _idam_graph_words(graph->vertex_length);
+
+    // first word drops bits before column, every other word is checked whole
+    size_t w = from / IDAM_GRAPH_WORD;
+    uint64_t word = row[w] & (~(uint64_t)(0) << (from % IDAM_GRAPH_WORD));
+    while (!word && ++w < row_words) {
+        word = row[w];
+    }
+
+    return word ? (w * IDAM_GRAPH_WORD) + _idam_graph_trailing(word) : IDAM_SPECIAL;
+}
+
+void _idam_graph_start(idam_graph_s const * const graph, graph_workspace_s * const workspace, size_t const start) {
+    reset_graph_workspace(workspace);
+    workspace->table.graph = graph;
+
+    reach_graph_workspace(workspace, start);
+    memcpy(workspace->table.costs + (workspace->table.size * start), workspace->table.zero, workspace->table.size);
+}
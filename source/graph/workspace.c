@@ -0,0 +1,200 @@
+#include <graph/workspace.h>
+
+#include <string.h>
+
+/// @brief Checks if vertex 'a' comes before vertex 'b' in workspace's heap.
+/// @param workspace Workspace structure.
+/// @param keys Keys of vertices heap is ordered by.
+/// @param a First vertex index.
+/// @param b Second vertex index.
+/// @return 'true' if 'a' comes first, 'false' otherwise.
+bool _graph_workspace_less(graph_workspace_s const * const workspace, char const * const keys, size_t const a, size_t const b);
+
+graph_workspace_s create_graph_workspace(size_t const length, table_s const * const table) {
+    return make_graph_workspace(length, table, &standard);
+}
+
+graph_workspace_s make_graph_workspace(size_t const length, table_s const * const table, memory_s const * const allocator) {
+    error(table && "Parameter can't be NULL.");
+    error(allocator && "Parameter can't be NULL.");
+
+    valid(table->size && "Cost size can't be zero.");
+    valid(table->zero && "Zero cost can't be NULL.");
+    valid(table->infinite && "Infinite cost can't be NULL.");
+
+    graph_workspace_s workspace = {
+        .table = *table, .length = length, .allocator = allocator,
+    };
+
+    workspace.table.graph = NULL;
+    workspace.table.costs = allocator->alloc(length * table->size, allocator->arg);
+    error((!length || workspace.table.costs) && "Memory allocation failed.");
+    workspace.table.previous = allocator->alloc(length * sizeof(size_t), allocator->arg);
+    error((!length || workspace.table.previous) && "Memory allocation failed.");
+
+    workspace.reached = allocator->alloc(length * sizeof(size_t), allocator->arg);
+    error((!length || workspace.reached) && "Memory allocation failed.");
+    workspace.visited = allocator->alloc(length * sizeof(size_t), allocator->arg);
+    error((!length || workspace.visited) && "Memory allocation failed.");
+    workspace.touched = allocator->alloc(length * sizeof(size_t), allocator->arg);
+    error((!length || workspace.touched) && "Memory allocation failed.");
+    workspace.array = allocator->alloc(length * sizeof(size_t), allocator->arg);
+    error((!length || workspace.array) && "Memory allocation failed.");
+    workspace.position = allocator->alloc(length * sizeof(size_t), allocator->arg);
+    error((!length || workspace.position) && "Memory allocation failed.");
+    workspace.scratch = allocator->alloc((length + 2) * table->size, allocator->arg);
+    error(workspace.scratch && "Memory allocation failed.");
+
+    // full initialization happens only once, every search after it resets what it reached
+    for (size_t i = 0; i < length; ++i) {
+        memcpy(workspace.table.costs + (i * table->size), table->infinite, table->size);
+        workspace.table.previous[i] = WORKSPACE_SPECIAL;
+        workspace.reached[i] = workspace.visited[i] = 0;
+    }
+
+    return workspace;
+}
+
+void destroy_graph_workspace(graph_workspace_s * const workspace) {
+    error(workspace && "Parameter can't be NULL.");
+
+    valid(workspace->allocator && "Allocator can't be NULL.");
+    valid(workspace->table.destroy && "Destroy function can't be NULL.");
+
+    for (size_t i = 0; i < workspace->length; ++i) {
+        workspace->table.destroy(workspace->table.costs + (i * workspace->table.size), workspace->table.ad);
+    }
+
+    workspace->allocator->free(workspace->table.costs, workspace->allocator->arg);
+    workspace->allocator->free(workspace->table.previous, workspace->allocator->arg);
+
+    // rest is freed the same way as a released workspace
+    workspace->table.costs = NULL;
+    workspace->table.previous = NULL;
+    release_graph_workspace(workspace, &workspace->table);
+}
+
+void release_graph_workspace(graph_workspace_s * const workspace, table_s * const table) {
+    error(workspace && "Parameter can't be NULL.");
+    error(table && "Parameter can't be NULL.");
+
+    valid(workspace->allocator && "Allocator can't be NULL.");
+
+    table->costs = workspace->table.costs;
+    table->previous = workspace->table.previous;
+    table->graph = workspace->table.graph;
+
+    workspace->allocator->free(workspace->reached, workspace->allocator->arg);
+    workspace->allocator->free(workspace->visited, workspace->allocator->arg);
+    workspace->allocator->free(workspace->touched, workspace->allocator->arg);
+    workspace->allocator->free(workspace->array, workspace->allocator->arg);
+    workspace->allocator->free(workspace->position, workspace->allocator->arg);
+    workspace->allocator->free(workspace->scratch, workspace->allocator->arg);
+
+    memset(workspace, 0, sizeof(graph_workspace_s));
+}
+
+void reset_graph_workspace(graph_workspace_s * const workspace) {
+    error(workspace && "Parameter can't be NULL.");
+
+    valid(workspace->touched_length <= workspace->length && "Touched length can't exceed length.");
+
+    table_s const * table = &workspace->table;
+    for (size_t i = 0; i < workspace->touched_length; ++i) {
+        size_t const vertex = workspace->touched[i];
+        char * cost = table->costs + (vertex * table->size);
+
+        table->destroy(cost, table->ad);
+        memcpy(cost, table->infinite, table->size);
+        table->previous[vertex] = WORKSPACE_SPECIAL;
+    }
+    workspace->touched_length = workspace->heap_length = 0;
+
+    // new epoch makes every mark stale at once, only a wrapped around epoch clears marks
+    if (!++workspace->epoch) {
+        memset(workspace->reached, 0, workspace->length * sizeof(size_t));
+        memset(workspace->visited, 0, workspace->length * sizeof(size_t));
+        workspace->epoch = 1;
+    }
+}
+
+bool reach_graph_workspace(graph_workspace_s * const workspace, size_t const vertex) {
+    error(workspace && "Parameter can't be NULL.");
+    error(vertex < workspace->length && "Parameter can't exceed length.");
+
+    if (workspace->epoch == workspace->reached[vertex]) {
+        return false;
+    }
+
+    workspace->reached[vertex] = workspace->epoch;
+    workspace->position[vertex] = WORKSPACE_SPECIAL;
+    workspace->touched[workspace->touched_length++] = vertex;
+
+    return true;
+}
+
+void push_graph_workspace(graph_workspace_s * const workspace, char const * const keys, size_t const vertex) {
+    error(workspace && "Parameter can't be NULL.");
+    error(keys && "Parameter can't be NULL.");
+    error(vertex < workspace->length && "Parameter can't exceed length.");
+    error(workspace->epoch == workspace->reached[vertex] && "Vertex must be reached.");
+
+    // vertex not yet in heap is placed at its end, then it moves up like a decreased key would
+    size_t index = workspace->position[vertex];
+    if (WORKSPACE_SPECIAL == index) {
+        index = workspace->heap_length++;
+    }
+
+    while (index && _graph_workspace_less(workspace, keys, vertex, workspace->array[(index - 1) / 2])) {
+        size_t const parent = (index - 1) / 2;
+
+        workspace->array[index] = workspace->array[parent];
+        workspace->position[workspace->array[index]] = index;
+        index = parent;
+    }
+
+    workspace->array[index] = vertex;
+    workspace->position[vertex] = index;
+}
+
+size_t pop_graph_workspace(graph_workspace_s * const workspace, char const * const keys) {
+    error(workspace && "Parameter can't be NULL.");
+    error(keys && "Parameter can't be NULL.");
+    error(workspace->heap_length && "Can't pop from empty heap.");
+
+    size_t const top = workspace->array[0];
+    workspace->position[top] = WORKSPACE_SPECIAL;
+
+    size_t const last = workspace->array[--workspace->heap_length];
+    if (!workspace->heap_length) {
+        return top;
+    }
+
+    // move last vertex down from root until both children come after it
+    size_t index = 0;
+    for (size_t child = 1; child < workspace->heap_length; child = (2 * index) + 1) {
+        if (child + 1 < workspace->heap_length && _graph_workspace_less(workspace, keys, workspace->array[child + 1], workspace->array[child])) {
+            child++;
+        }
+
+        if (!_graph_workspace_less(workspace, keys, workspace->array[child], last)) {
+            break;
+        }
+
+        workspace->array[index] = workspace->array[child];
+        workspace->position[workspace->array[index]] = index;
+        index = child;
+    }
+
+    workspace->array[index] = last;
+    workspace->position[last] = index;
+
+    return top;
+}
+
+bool _graph_workspace_less(graph_workspace_s const * const workspace, char const * const keys, size_t const a, size_t const b) {
+    table_s const * table = &workspace->table;
+
+    int const comparison = table->compare(keys + (a * table->size), keys + (b * table->size), table->ac);
+    return comparison < 0 || (!comparison && a < b);
+}
@@ -19,14 +19,14 @@ size_t _icircular_list_ceil_size(size_t const size);
 icircular_list_s create_icircular_list(size_t const size) {
     error(size && "Paremeter can't be zero.");
 
-    return (icircular_list_s) { .empty = NIL, .size = size, .allocator = &standard };
+    return (icircular_list_s) { .empty = NIL, .size = size, .growth = CERPEC_GROWTH(ICIRCULAR_LIST_CHUNK), .allocator = &standard };
 }
 
 icircular_list_s make_icircular_list(size_t const size, memory_s const * const allocator) {
     error(size && "Paremeter can't be zero.");
     error(allocator && "Paremeter can't be NULL.");
 
-    return (icircular_list_s) { .empty = NIL, .size = size, .allocator = allocator };
+    return (icircular_list_s) { .empty = NIL, .size = size, .growth = CERPEC_GROWTH(ICIRCULAR_LIST_CHUNK), .allocator = allocator };
 }
 
 void destroy_icircular_list(icircular_list_s * const list, set_fn const destroy, void * const ad) {
@@ -86,7 +86,7 @@ icircular_list_s copy_icircular_list(icircular_list_s const * const list, copy_f
 
     // create a replica/copy structure
     icircular_list_s replica = {
-        .empty = NIL, .size = list->size, .capacity = list->capacity, .allocator = list->allocator,
+        .empty = NIL, .size = list->size, .capacity = list->capacity, .allocator = list->allocator, .growth = list->growth,
         .elements = list->allocator->alloc(list->capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(list->capacity * sizeof(size_t), list->allocator->arg),
     };
@@ -115,6 +115,46 @@ bool is_empty_icircular_list(icircular_list_s const * const list) {
     return !(list->length);
 }
 
+void growth_icircular_list(icircular_list_s * const list, growth_s const growth) {
+    error(list && "Paremeter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+    valid(list->tail != NIL && "Tail can't be NIL.");
+
+    list->growth = growth;
+}
+
+void reserve_icircular_list(icircular_list_s * const list, size_t const capacity) {
+    error(list && "Paremeter can't be NULL.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+    valid(list->tail != NIL && "Tail can't be NIL.");
+
+    if (capacity > list->capacity) {
+        _icircular_list_resize(list, capacity);
+    }
+}
+
+void shrink_to_fit_icircular_list(icircular_list_s * const list) {
+    error(list && "Paremeter can't be NULL.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+    valid(list->tail != NIL && "Tail can't be NIL.");
+
+    if (list->length != list->capacity) {
+        _icircular_list_resize(list, list->length);
+    }
+}
+
 void insert_at_icircular_list(icircular_list_s * const list, void const * const element, size_t const index) {
     error(list && "Paremeter can't be NULL.");
     error(element && "Paremeter can't be NULL.");
@@ -128,8 +168,7 @@ void insert_at_icircular_list(icircular_list_s * const list, void const * const
 
     // if length has reached capacity increase capacity linearly and call resize function to expand nodes
     if (list->length == list->capacity) {
-        size_t const capacity = list->length ? list->length * CERPEC_FACTOR : ICIRCULAR_LIST_CHUNK;
-        _icircular_list_resize(list, capacity);
+        _icircular_list_resize(list, expand_growth(&(list->growth), list->length));
     }
 
     // get the empty node index either from underlying stack or next empty index in array (i.e. length)
@@ -224,8 +263,9 @@ void remove_first_icircular_list(icircular_list_s * const list, void const * con
         }
 
         // if length has reached smaller capacity decrease capacity and resize the list
-        if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > ICIRCULAR_LIST_CHUNK || !list->length)) {
-            _icircular_list_resize(list, list->length);
+        size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+        if (capacity != list->capacity) {
+            _icircular_list_resize(list, capacity);
         }
 
         return; // leave function with found element
@@ -275,8 +315,9 @@ void remove_at_icircular_list(icircular_list_s * const list, size_t const index,
     }
 
     // if length has reached smaller capacity decrease capacity and resize the list
-    if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > ICIRCULAR_LIST_CHUNK || !list->length)) {
-        _icircular_list_resize(list, list->length);
+    size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+    if (capacity != list->capacity) {
+        _icircular_list_resize(list, capacity);
     }
 }
 
@@ -339,7 +380,7 @@ void splice_icircular_list(icircular_list_s * const destination, icircular_list_
 
     size_t const sum = destination->length + source->length;
     size_t const max = destination->capacity > source->capacity ? destination->capacity : source->capacity;
-    size_t const capacity = sum > max ? CERPEC_FACTOR * max : max;
+    size_t const capacity = sum > max ? destination->growth.factor * max : max;
     _icircular_list_resize(destination, capacity);
 
     size_t dest_prev = destination->tail;
@@ -427,7 +468,7 @@ icircular_list_s slice_icircular_list(icircular_list_s * const list, size_t cons
         .capacity = split_capacity, .empty = NIL, .size = list->size,
         .elements = list->allocator->alloc(split_capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
-        .allocator = list->allocator,
+        .allocator = list->allocator, .growth = list->growth,
     };
     error((!split_capacity || split.elements) && "Memory allocation failed.");
     error((!split_capacity || split.next) && "Memory allocation failed.");
@@ -459,7 +500,7 @@ icircular_list_s slice_icircular_list(icircular_list_s * const list, size_t cons
         .capacity = replica_capacity, .empty = NIL, .size = list->size,
         .elements = list->allocator->alloc(replica_capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(replica_capacity * sizeof(size_t), list->allocator->arg),
-        .allocator = list->allocator,
+        .allocator = list->allocator, .growth = list->growth,
     };
     error((!replica_capacity || replica.elements) && "Memory allocation failed.");
     error((!replica_capacity || replica.next) && "Memory allocation failed.");
@@ -504,7 +545,7 @@ icircular_list_s split_icircular_list(icircular_list_s * const list, size_t cons
         .capacity = split_capacity, .empty = NIL, .size = list->size,
         .elements = list->allocator->alloc(split_capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
-        .allocator = list->allocator,
+        .allocator = list->allocator, .growth = list->growth,
     };
     error((!split_capacity || split.elements) && "Memory allocation failed.");
     error((!split_capacity || split.next) && "Memory allocation failed.");
@@ -534,7 +575,7 @@ icircular_list_s split_icircular_list(icircular_list_s * const list, size_t cons
         .capacity = replica_capacity, .empty = NIL, .size = list->size,
         .elements = list->allocator->alloc(replica_capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(replica_capacity * sizeof(size_t), list->allocator->arg),
-        .allocator = list->allocator,
+        .allocator = list->allocator, .growth = list->growth,
     };
     error((!replica_capacity || replica.elements) && "Memory allocation failed.");
     error((!replica_capacity || replica.next) && "Memory allocation failed.");
@@ -567,8 +608,8 @@ icircular_list_s extract_icircular_list(icircular_list_s * const list, filter_fn
     valid(list->tail != NIL && "Tail can't be NIL.");
 
     // create temporary lists to save filtered elements
-    icircular_list_s negative = { .empty = NIL, .size = list->size, .allocator = list->allocator, };
-    icircular_list_s positive = { .empty = NIL, .size = list->size, .allocator = list->allocator, };
+    icircular_list_s negative = { .empty = NIL, .size = list->size, .allocator = list->allocator, .growth = list->growth, };
+    icircular_list_s positive = { .empty = NIL, .size = list->size, .allocator = list->allocator, .growth = list->growth, };
 
     // iterate over each element in list while calling filter function
     size_t * neg = &(negative.tail), * pos = &(positive.tail);
@@ -581,8 +622,7 @@ icircular_list_s extract_icircular_list(icircular_list_s * const list, filter_fn
             (*pos) = pos_idx;
 
             if (positive.length == positive.capacity) { // expand capacity if needed
-                size_t const capacity = positive.length ? positive.length * CERPEC_FACTOR : ICIRCULAR_LIST_CHUNK;
-                _icircular_list_resize(&positive, capacity);
+                _icircular_list_resize(&positive, expand_growth(&(positive.growth), positive.length));
             }
 
             positive.next[pos_idx] = 0; // make list circular
@@ -596,8 +636,7 @@ icircular_list_s extract_icircular_list(icircular_list_s * const list, filter_fn
             (*neg) = neg_idx;
 
             if (negative.length == negative.capacity) { // expand capacity if needed
-                size_t const capacity = negative.length ? negative.length * CERPEC_FACTOR : ICIRCULAR_LIST_CHUNK;
-                _icircular_list_resize(&negative, capacity);
+                _icircular_list_resize(&negative, expand_growth(&(negative.growth), negative.length));
             }
 
             negative.next[neg_idx] = 0; // make list circular
@@ -674,10 +713,10 @@ void apply_icircular_list(icircular_list_s const * const list, process_fn const
 }
 
 void _icircular_list_resize(icircular_list_s * const list, size_t const size) {
-    list->capacity = size;
-
     // if list expands or hole stack is empty then just expand/shrink the list and return
-    if (list->capacity != list->length || NIL == list->empty) {
+    bool const compact = size < list->capacity && NIL != list->empty;
+    list->capacity = size;
+    if (!compact) {
         list->elements = list->allocator->realloc(list->elements, list->capacity * list->size, list->allocator->arg);
         error((!list->capacity || list->elements) && "Memory allocation failed.");
 
@@ -685,7 +724,7 @@ void _icircular_list_resize(icircular_list_s * const list, size_t const size) {
         error((!list->capacity || list->next) && "Memory allocation failed.");
 
         return;
-    } // else copy elements into new array in order, and clear hole stack
+    } // else shrinking could cut off nodes behind holes, so copy elements into new array in order and clear hole stack
 
     // allocate new array to save alements linearly without holes
     char * elements = list->allocator->alloc(list->capacity * list->size, list->allocator->arg);
@@ -22,14 +22,14 @@ void _idouble_list_fill_hole(idouble_list_s * const list, size_t const hole);
 idouble_list_s create_idouble_list(size_t const size) {
     error(size && "Paremeter can't be zero.");
 
-    return (idouble_list_s) { .size = size, .allocator = &standard, };
+    return (idouble_list_s) { .size = size, .growth = CERPEC_GROWTH(IDOUBLE_LIST_CHUNK), .allocator = &standard, };
 }
 
 idouble_list_s make_idouble_list(size_t const size, memory_s const * const allocator) {
     error(size && "Paremeter can't be zero.");
     error(allocator && "Paremeter can't be NULL.");
 
-    return (idouble_list_s) { .size = size, .allocator = allocator, };
+    return (idouble_list_s) { .size = size, .growth = CERPEC_GROWTH(IDOUBLE_LIST_CHUNK), .allocator = allocator, };
 }
 
 void destroy_idouble_list(idouble_list_s * const list, set_fn const destroy, void * const ad) {
@@ -93,7 +93,7 @@ idouble_list_s copy_idouble_list(idouble_list_s const * const list, copy_fn cons
         .node[IDL_NEXT] = list->allocator->alloc(list->capacity * sizeof(size_t), list->allocator->arg),
         .node[IDL_PREV] = list->allocator->alloc(list->capacity * sizeof(size_t), list->allocator->arg),
         .elements = list->allocator->alloc(list->capacity * list->size, list->allocator->arg),
-        .allocator = list->allocator,
+        .allocator = list->allocator, .growth = list->growth,
     };
     error((!replica.capacity || replica.elements) && "Memory allocation failed.");
     error((!replica.capacity || replica.node[IDL_NEXT]) && "Memory allocation failed.");
@@ -119,6 +119,43 @@ bool is_empty_idouble_list(idouble_list_s const * const list) {
     return !(list->length);
 }
 
+void growth_idouble_list(idouble_list_s * const list, growth_s const growth) {
+    error(list && "Paremeter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+
+    list->growth = growth;
+}
+
+void reserve_idouble_list(idouble_list_s * const list, size_t const capacity) {
+    error(list && "Paremeter can't be NULL.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+
+    if (capacity > list->capacity) {
+        _idouble_list_resize(list, capacity);
+    }
+}
+
+void shrink_to_fit_idouble_list(idouble_list_s * const list) {
+    error(list && "Paremeter can't be NULL.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+
+    if (list->length != list->capacity) {
+        _idouble_list_resize(list, list->length);
+    }
+}
+
 void insert_at_idouble_list(idouble_list_s * const list, void const * const element, size_t const index) {
     error(list && "Paremeter can't be NULL.");
     error(element && "Paremeter can't be NULL.");
@@ -131,8 +168,7 @@ void insert_at_idouble_list(idouble_list_s * const list, void const * const elem
 
     // if list is full resize (expand) it
     if (list->length == list->capacity) {
-        size_t const capacity = list->length ? list->length * CERPEC_FACTOR : IDOUBLE_LIST_CHUNK;
-        _idouble_list_resize(list, capacity);
+        _idouble_list_resize(list, expand_growth(&(list->growth), list->length));
     }
 
     // determine closest direction to index and go there
@@ -217,8 +253,9 @@ void remove_first_idouble_list(idouble_list_s * const list, void const * const e
         _idouble_list_fill_hole(list, current);
 
         // if smaller capacity exists then resize (shrink) list
-        if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > IDOUBLE_LIST_CHUNK || !list->length)) {
-            _idouble_list_resize(list, list->length);
+        size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+        if (capacity != list->capacity) {
+            _idouble_list_resize(list, capacity);
         }
 
         return;
@@ -264,8 +301,9 @@ void remove_last_idouble_list(idouble_list_s * const list, void const * const el
         _idouble_list_fill_hole(list, current);
 
         // if smaller capacity exists then resize (shrink) list
-        if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > IDOUBLE_LIST_CHUNK || !list->length)) {
-            _idouble_list_resize(list, list->length);
+        size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+        if (capacity != list->capacity) {
+            _idouble_list_resize(list, capacity);
         }
 
         return;
@@ -306,8 +344,9 @@ void remove_at_idouble_list(idouble_list_s * const list, size_t const index, voi
     _idouble_list_fill_hole(list, current);
 
     // if smaller capacity exists then resize (shrink) list
-    if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > IDOUBLE_LIST_CHUNK || !list->length)) {
-        _idouble_list_resize(list, list->length);
+    size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+    if (capacity != list->capacity) {
+        _idouble_list_resize(list, capacity);
     }
 }
 
@@ -375,7 +414,7 @@ void splice_idouble_list(idouble_list_s * const destination, idouble_list_s * co
     // calculate new capacity of destination list and resize it
     size_t const sum = destination->length + source->length;
     size_t const max = destination->capacity > source->capacity ? destination->capacity : source->capacity;
-    size_t const capacity = sum > max ? CERPEC_FACTOR * max : max;
+    size_t const capacity = sum > max ? destination->growth.factor * max : max;
     _idouble_list_resize(destination, capacity);
 
     // determine closest direction to index and go there
@@ -449,7 +488,7 @@ idouble_list_s slice_idouble_list(idouble_list_s * const list, size_t const inde
         .node[IDL_NEXT] = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
         .node[IDL_PREV] = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
 
-        .size = list->size, .capacity = split_capacity, .allocator = list->allocator,
+        .size = list->size, .capacity = split_capacity, .allocator = list->allocator, .growth = list->growth,
     };
     error((!split.capacity || split.elements) && "Memory allocation failed.");
     error((!split.capacity || split.node[IDL_NEXT]) && "Memory allocation failed.");
@@ -512,7 +551,7 @@ idouble_list_s split_idouble_list(idouble_list_s * const list, size_t const inde
         .node[IDL_NEXT] = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
         .node[IDL_PREV] = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
 
-        .size = list->size, .capacity = split_capacity, .allocator = list->allocator,
+        .size = list->size, .capacity = split_capacity, .allocator = list->allocator, .growth = list->growth,
     };
     error((!split.capacity || split.elements) && "Memory allocation failed.");
     error((!split.capacity || split.node[IDL_NEXT]) && "Memory allocation failed.");
@@ -560,7 +599,7 @@ idouble_list_s extract_idouble_list(idouble_list_s * const list, filter_fn const
     valid(list->allocator && "Allocator can't be NULL.");
 
     // only create positive to save true filtered values
-    idouble_list_s positive = { .size = list->size, .allocator = list->allocator, };
+    idouble_list_s positive = { .size = list->size, .allocator = list->allocator, .growth = list->growth, };
 
     size_t * pos = &(positive.head);
     size_t const length = list->length; // list length may change
@@ -574,8 +613,7 @@ idouble_list_s extract_idouble_list(idouble_list_s * const list, filter_fn const
 
         (*pos) = positive.length; // set head and next nodes to next index
         if (positive.length == positive.capacity) { // expand capacity if needed
-            size_t const capacity = positive.length ? positive.length * CERPEC_FACTOR : IDOUBLE_LIST_CHUNK;
-            _idouble_list_resize(&positive, capacity);
+            _idouble_list_resize(&positive, expand_growth(&(positive.growth), positive.length));
         }
         positive.node[IDL_PREV][positive.length] = positive.length - 1; // set previous node indexes to one minus current
         positive.node[IDL_PREV][0] = positive.length; // set first node's prev to positive length
@@ -19,14 +19,14 @@ size_t _istraight_list_ceil_size(size_t const size);
 istraight_list_s create_istraight_list(size_t const size) {
     error(size && "Paremeter can't be zero.");
 
-    return (istraight_list_s) { .head = NIL, .empty = NIL, .size = size, .allocator = &standard, };
+    return (istraight_list_s) { .head = NIL, .empty = NIL, .size = size, .growth = CERPEC_GROWTH(ISTRAIGHT_LIST_CHUNK), .allocator = &standard, };
 }
 
 istraight_list_s make_istraight_list(size_t const size, memory_s const * const allocator) {
     error(size && "Paremeter can't be zero.");
     error(allocator && "Paremeter can't be NULL.");
 
-    return (istraight_list_s) { .head = NIL, .empty = NIL, .size = size, .allocator = allocator, };
+    return (istraight_list_s) { .head = NIL, .empty = NIL, .size = size, .growth = CERPEC_GROWTH(ISTRAIGHT_LIST_CHUNK), .allocator = allocator, };
 }
 
 void destroy_istraight_list(istraight_list_s * const list, set_fn const destroy, void * const ad) {
@@ -80,7 +80,7 @@ istraight_list_s copy_istraight_list(istraight_list_s const * const list, copy_f
     // create copy/replica list
     istraight_list_s replica = {
         .capacity = list->capacity, .empty = NIL, .head = NIL, .length = list->length, .size = list->size,
-        .allocator = list->allocator,
+        .allocator = list->allocator, .growth = list->growth,
         .elements = list->allocator->alloc(list->capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(list->capacity * sizeof(size_t), list->allocator->arg),
     };
@@ -108,6 +108,43 @@ bool is_empty_istraight_list(istraight_list_s const * const list) {
     return !(list->length);
 }
 
+void growth_istraight_list(istraight_list_s * const list, growth_s const growth) {
+    error(list && "Paremeter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+
+    list->growth = growth;
+}
+
+void reserve_istraight_list(istraight_list_s * const list, size_t const capacity) {
+    error(list && "Paremeter can't be NULL.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+
+    if (capacity > list->capacity) {
+        _istraight_list_resize(list, capacity);
+    }
+}
+
+void shrink_to_fit_istraight_list(istraight_list_s * const list) {
+    error(list && "Paremeter can't be NULL.");
+
+    valid(list->size && "Size can't be zero.");
+    valid(list->length <= list->capacity && "Length exceeds capacity.");
+    valid(list->allocator && "Allocator can't be NULL.");
+
+    if (list->length != list->capacity) {
+        _istraight_list_resize(list, list->length);
+    }
+}
+
 void insert_at_istraight_list(istraight_list_s * const list, void const * const element, size_t const index) {
     error(list && "Paremeter can't be NULL.");
     error(element && "Paremeter can't be NULL.");
@@ -121,8 +158,7 @@ void insert_at_istraight_list(istraight_list_s * const list, void const * const
 
     // if list can't fit elements expand it
     if (list->length == list->capacity) {
-        size_t const capacity = list->length ? list->length * CERPEC_FACTOR : ISTRAIGHT_LIST_CHUNK;
-        _istraight_list_resize(list, capacity);
+        _istraight_list_resize(list, expand_growth(&(list->growth), list->length));
     }
 
     // go to node reference at index
@@ -203,8 +239,9 @@ void remove_first_istraight_list(istraight_list_s * const list, void const * con
         }
 
         // shrink list to save space if smaller capacity is available
-        if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > ISTRAIGHT_LIST_CHUNK || !list->length)) {
-            _istraight_list_resize(list, list->length);
+        size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+        if (capacity != list->capacity) {
+            _istraight_list_resize(list, capacity);
         }
 
         return; // leave function with found element
@@ -247,8 +284,9 @@ void remove_at_istraight_list(istraight_list_s * const list, size_t const index,
     }
 
     // shrink list to save space if smaller capacity is available
-    if (list->length <= list->capacity / CERPEC_FACTOR && (list->length > ISTRAIGHT_LIST_CHUNK || !list->length)) {
-        _istraight_list_resize(list, list->capacity - ISTRAIGHT_LIST_CHUNK);
+    size_t const capacity = shrink_growth(&(list->growth), list->length, list->capacity);
+    if (capacity != list->capacity) {
+        _istraight_list_resize(list, capacity);
     }
 }
 
@@ -285,7 +323,7 @@ void splice_istraight_list(istraight_list_s * const destination, istraight_list_
     // calculate new destination length
     size_t const sum = destination->length + source->length;
     size_t const max = destination->capacity > source->capacity ? destination->capacity : source->capacity;
-    size_t const capacity = sum > max ? CERPEC_FACTOR * max : max;
+    size_t const capacity = sum > max ? destination->growth.factor * max : max;
     _istraight_list_resize(destination, capacity);
 
     // go to destination node reference at index
@@ -351,7 +389,7 @@ istraight_list_s slice_istraight_list(istraight_list_s * const list, size_t cons
     // create split list structure
     size_t const split_capacity = _istraight_list_ceil_size(length);
     istraight_list_s split = {
-        .capacity = split_capacity, .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator,
+        .capacity = split_capacity, .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator, .growth = list->growth,
         .elements = list->allocator->alloc(split_capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(split_capacity * sizeof(size_t), list->allocator->arg),
     };
@@ -371,7 +409,7 @@ istraight_list_s slice_istraight_list(istraight_list_s * const list, size_t cons
     size_t const replica_length = list->length - length;
     size_t const replica_capacity = _istraight_list_ceil_size(replica_length);
     istraight_list_s replica = {
-        .capacity = replica_capacity, .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator,
+        .capacity = replica_capacity, .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator, .growth = list->growth,
         .elements = list->allocator->alloc(replica_capacity * list->size, list->allocator->arg),
         .next = list->allocator->alloc(replica_capacity * sizeof(size_t), list->allocator->arg),
     };
@@ -406,8 +444,8 @@ istraight_list_s extract_istraight_list(istraight_list_s * const list, filter_fn
     valid(list->allocator && "Allocator can't be NULL.");
 
     // create lists that contain true and false filtered elements
-    istraight_list_s negative = { .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator, };
-    istraight_list_s positive = { .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator, };
+    istraight_list_s negative = { .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator, .growth = list->growth, };
+    istraight_list_s positive = { .empty = NIL, .head = NIL, .size = list->size, .allocator = list->allocator, .growth = list->growth, };
 
     // for each element in list check if filter returns true for current element and pushes it propper list
     size_t * neg = &(negative.head), * pos = &(positive.head);
@@ -417,8 +455,7 @@ istraight_list_s extract_istraight_list(istraight_list_s * const list, filter_fn
         if (filter(element, af)) { // if filter value is positive push it into positive
             (*pos) = pos_idx;
             if (positive.length == positive.capacity) {
-                size_t const capacity = positive.length ? positive.length * CERPEC_FACTOR : ISTRAIGHT_LIST_CHUNK;
-                _istraight_list_resize(&positive, capacity);
+                _istraight_list_resize(&positive, expand_growth(&(positive.growth), positive.length));
             }
             positive.next[pos_idx] = NIL;
 
@@ -430,8 +467,7 @@ istraight_list_s extract_istraight_list(istraight_list_s * const list, filter_fn
         } else { // else push it into negative
             (*neg) = neg_idx;
             if (negative.length == negative.capacity) {
-                size_t const capacity = negative.length ? negative.length * CERPEC_FACTOR : ISTRAIGHT_LIST_CHUNK;
-                _istraight_list_resize(&negative, capacity);
+                _istraight_list_resize(&negative, expand_growth(&(negative.growth), negative.length));
             }
             negative.next[neg_idx] = NIL;
 
@@ -492,10 +528,10 @@ void apply_istraight_list(istraight_list_s const * const list, process_fn const
 }
 
 void _istraight_list_resize(istraight_list_s * const list, size_t const size) {
-    list->capacity = size;
-
     // if list expands or hole stack is empty then just expand/shrink the list and return
-    if (list->capacity != list->length || NIL == list->empty) {
+    bool const compact = size < list->capacity && NIL != list->empty;
+    list->capacity = size;
+    if (!compact) {
         list->elements = list->allocator->realloc(list->elements, list->capacity * list->size, list->allocator->arg);
         list->next = list->allocator->realloc(list->next, list->capacity * sizeof(size_t), list->allocator->arg);
 
@@ -503,7 +539,7 @@ void _istraight_list_resize(istraight_list_s * const list, size_t const size) {
         error((!list->capacity || list->next) && "Memory allocation failed.");
 
         return;
-    } // else copy elements into new array in order, and clear hole stack
+    } // else shrinking could cut off nodes behind holes, so copy elements into new array in order and clear hole stack
 
     char * elements = list->allocator->alloc(list->capacity * list->size, list->allocator->arg);
     error((!list->capacity || elements) && "Memory allocation failed.");
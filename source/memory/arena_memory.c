@@ -0,0 +1,166 @@
+#include <memory/arena_memory.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Rounds size up to arena alignment.
+#define ARENA_MEMORY_ROUND(size) (((size) + (ARENA_MEMORY_ALIGN - 1)) & ~(size_t)(ARENA_MEMORY_ALIGN - 1))
+
+/// @brief Arena block header, its allocations follow right after it.
+struct arena_memory_block {
+    struct arena_memory_block * next;
+    size_t capacity, offset;
+};
+
+/// @brief Arena state kept in allocator's argument.
+struct arena_memory {
+    struct arena_memory_block * head, * current;
+    char * last; // most recent allocation that may be extended in place
+    size_t capacity;
+};
+
+#define ARENA_MEMORY_HEADER ARENA_MEMORY_ROUND(sizeof(struct arena_memory_block))
+#define ARENA_MEMORY_PREFIX ARENA_MEMORY_ROUND(sizeof(size_t))
+
+/// @brief Allocates memory by bumping offset of current arena block.
+/// @param size Size of memory to allocate.
+/// @param arg Arena state.
+/// @return Pointer to allocated memory, or NULL if size is zero.
+void * _arena_memory_alloc(size_t const size, void * arg);
+
+/// @brief Reallocates memory in place if it is last allocation and fits, else allocates and copies it.
+/// @param pointer Memory to reallocate.
+/// @param size New size of memory.
+/// @param arg Arena state.
+/// @return Pointer to reallocated memory, or NULL if size is zero.
+void * _arena_memory_realloc(void * pointer, size_t const size, void * arg);
+
+/// @brief Does nothing since arena memory is only released on reset or destroy.
+/// @param pointer Memory to free.
+/// @param arg Arena state.
+void _arena_memory_free(void * pointer, void * arg);
+
+/// @brief Creates new arena block.
+/// @param capacity Size of block's allocatable memory.
+/// @return Arena block.
+struct arena_memory_block * _arena_memory_block(size_t const capacity);
+
+memory_s make_arena_memory(size_t const capacity) {
+    error(capacity && "Parameter can't be zero.");
+
+    struct arena_memory * arena = malloc(sizeof(struct arena_memory));
+    error(arena && "Memory allocation failed.");
+
+    arena->capacity = ARENA_MEMORY_ROUND(capacity);
+    arena->head = arena->current = _arena_memory_block(arena->capacity);
+    arena->last = NULL;
+
+    return compose_memory(_arena_memory_alloc, _arena_memory_realloc, _arena_memory_free, arena);
+}
+
+void destroy_arena_memory(memory_s * const arena) {
+    error(arena && "Parameter can't be NULL.");
+    error(arena->alloc == _arena_memory_alloc && "Allocator isn't an arena.");
+
+    struct arena_memory * state = arena->arg;
+    valid(state && "Arena state can't be NULL.");
+
+    for (struct arena_memory_block * block = state->head, * next = NULL; block; block = next) {
+        next = block->next;
+        free(block);
+    }
+    free(state);
+
+    // map everything to zero/false
+    memset(arena, 0, sizeof(memory_s));
+}
+
+void reset_arena_memory(memory_s const * const arena) {
+    error(arena && "Parameter can't be NULL.");
+    error(arena->alloc == _arena_memory_alloc && "Allocator isn't an arena.");
+
+    struct arena_memory * state = arena->arg;
+    valid(state && "Arena state can't be NULL.");
+
+    // rewind every block so allocations start from the first one again
+    for (struct arena_memory_block * block = state->head; block; block = block->next) {
+        block->offset = 0;
+    }
+    state->current = state->head;
+    state->last = NULL;
+}
+
+void * _arena_memory_alloc(size_t const size, void * arg) {
+    struct arena_memory * state = arg;
+    if (!size) { return NULL; }
+
+    size_t const need = ARENA_MEMORY_PREFIX + ARENA_MEMORY_ROUND(size);
+
+    // move to next block (reused after reset or newly created) until allocation fits
+    struct arena_memory_block * block = state->current;
+    while (block->offset + need > block->capacity) {
+        if (!block->next) {
+            block->next = _arena_memory_block(need > state->capacity ? need : state->capacity);
+        }
+        block = block->next;
+    }
+    state->current = block;
+
+    char * pointer = (char*)(block) + ARENA_MEMORY_HEADER + block->offset + ARENA_MEMORY_PREFIX;
+    memcpy(pointer - ARENA_MEMORY_PREFIX, &size, sizeof(size_t));
+    block->offset += need;
+
+    return state->last = pointer;
+}
+
+void * _arena_memory_realloc(void * pointer, size_t const size, void * arg) {
+    struct arena_memory * state = arg;
+    if (!pointer) { return _arena_memory_alloc(size, arg); }
+
+    char * memory = pointer;
+    size_t old = 0;
+    memcpy(&old, memory - ARENA_MEMORY_PREFIX, sizeof(size_t));
+
+    if (memory == state->last) { // last allocation can grow or shrink by moving current block's offset
+        struct arena_memory_block * block = state->current;
+        size_t const start = (size_t)(memory - ((char*)(block) + ARENA_MEMORY_HEADER));
+
+        if (!size) { // release last allocation since it's at the end of block
+            block->offset = start - ARENA_MEMORY_PREFIX;
+            state->last = NULL;
+            return NULL;
+        }
+
+        if (start + ARENA_MEMORY_ROUND(size) <= block->capacity) {
+            block->offset = start + ARENA_MEMORY_ROUND(size);
+            memcpy(memory - ARENA_MEMORY_PREFIX, &size, sizeof(size_t));
+            return memory;
+        }
+    } else if (!size) {
+        return NULL;
+    } else if (size <= old) { // shrinking memory always fits where it already is
+        memcpy(memory - ARENA_MEMORY_PREFIX, &size, sizeof(size_t));
+        return memory;
+    }
+
+    char * replica = _arena_memory_alloc(size, arg);
+    memcpy(replica, memory, old < size ? old : size);
+
+    return replica;
+}
+
+void _arena_memory_free(void * pointer, void * arg) {
+    (void)(pointer);
+    (void)(arg);
+}
+
+struct arena_memory_block * _arena_memory_block(size_t const capacity) {
+    struct arena_memory_block * block = malloc(ARENA_MEMORY_HEADER + capacity);
+    error(block && "Memory allocation failed.");
+
+    block->next = NULL;
+    block->capacity = capacity;
+    block->offset = 0;
+
+    return block;
+}
@@ -0,0 +1,165 @@
+#include <memory/pool_memory.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Rounds size up to pool alignment.
+#define POOL_MEMORY_ROUND(size) (((size) + (POOL_MEMORY_ALIGN - 1)) & ~(size_t)(POOL_MEMORY_ALIGN - 1))
+
+/// @brief Size of header before each block that saves block's rounded size.
+#define POOL_MEMORY_PREFIX POOL_MEMORY_ROUND(sizeof(size_t))
+
+/// @brief Freed block in free list, overlaps block's memory.
+struct pool_memory_block {
+    struct pool_memory_block * next;
+};
+
+/// @brief Free list of blocks with same rounded size.
+struct pool_memory_list {
+    struct pool_memory_block * head;
+    size_t size;
+};
+
+/// @brief Pool state kept in allocator's argument.
+struct pool_memory {
+    struct pool_memory_list * lists;
+    size_t length, capacity;
+};
+
+/// @brief Allocates memory by popping block from its size's free list, or from system if list is empty.
+/// @param size Size of memory to allocate.
+/// @param arg Pool state.
+/// @return Pointer to allocated memory, or NULL if size is zero.
+void * _pool_memory_alloc(size_t const size, void * arg);
+
+/// @brief Reallocates memory, keeps it if rounded size doesn't change.
+/// @param pointer Memory to reallocate.
+/// @param size New size of memory.
+/// @param arg Pool state.
+/// @return Pointer to reallocated memory, or NULL if size is zero.
+void * _pool_memory_realloc(void * pointer, size_t const size, void * arg);
+
+/// @brief Pushes memory block into its size's free list.
+/// @param pointer Memory to free.
+/// @param arg Pool state.
+void _pool_memory_free(void * pointer, void * arg);
+
+/// @brief Gets free list of rounded size, creating it if it doesn't exist.
+/// @param pool Pool state.
+/// @param size Rounded size of list.
+/// @return Free list.
+struct pool_memory_list * _pool_memory_list(struct pool_memory * const pool, size_t const size);
+
+memory_s make_pool_memory(void) {
+    struct pool_memory * pool = malloc(sizeof(struct pool_memory));
+    error(pool && "Memory allocation failed.");
+
+    pool->lists = NULL;
+    pool->length = pool->capacity = 0;
+
+    return compose_memory(_pool_memory_alloc, _pool_memory_realloc, _pool_memory_free, pool);
+}
+
+void destroy_pool_memory(memory_s * const pool) {
+    error(pool && "Parameter can't be NULL.");
+    error(pool->alloc == _pool_memory_alloc && "Allocator isn't a pool.");
+
+    trim_pool_memory(pool);
+
+    struct pool_memory * state = pool->arg;
+    free(state->lists);
+    free(state);
+
+    // map everything to zero/false
+    memset(pool, 0, sizeof(memory_s));
+}
+
+void trim_pool_memory(memory_s const * const pool) {
+    error(pool && "Parameter can't be NULL.");
+    error(pool->alloc == _pool_memory_alloc && "Allocator isn't a pool.");
+
+    struct pool_memory * state = pool->arg;
+    valid(state && "Pool state can't be NULL.");
+
+    for (size_t i = 0; i < state->length; ++i) {
+        for (struct pool_memory_block * block = state->lists[i].head, * next = NULL; block; block = next) {
+            next = block->next;
+            free((char*)(block) - POOL_MEMORY_PREFIX);
+        }
+        state->lists[i].head = NULL;
+    }
+}
+
+void * _pool_memory_alloc(size_t const size, void * arg) {
+    if (!size) { return NULL; }
+
+    size_t const rounded = POOL_MEMORY_ROUND(size);
+    struct pool_memory_list * list = _pool_memory_list(arg, rounded);
+
+    if (list->head) { // reuse previously freed block of same size
+        struct pool_memory_block * block = list->head;
+        list->head = block->next;
+
+        return block;
+    }
+
+    char * memory = malloc(POOL_MEMORY_PREFIX + rounded);
+    if (!memory) { return NULL; }
+
+    memcpy(memory, &rounded, sizeof(size_t));
+
+    return memory + POOL_MEMORY_PREFIX;
+}
+
+void * _pool_memory_realloc(void * pointer, size_t const size, void * arg) {
+    if (!pointer) { return _pool_memory_alloc(size, arg); }
+    if (!size) {
+        _pool_memory_free(pointer, arg);
+        return NULL;
+    }
+
+    size_t old = 0;
+    memcpy(&old, (char*)(pointer) - POOL_MEMORY_PREFIX, sizeof(size_t));
+    if (old == POOL_MEMORY_ROUND(size)) { return pointer; }
+
+    void * replica = _pool_memory_alloc(size, arg);
+    if (!replica) { return NULL; }
+
+    memcpy(replica, pointer, old < size ? old : size);
+    _pool_memory_free(pointer, arg);
+
+    return replica;
+}
+
+void _pool_memory_free(void * pointer, void * arg) {
+    if (!pointer) { return; }
+
+    size_t size = 0;
+    memcpy(&size, (char*)(pointer) - POOL_MEMORY_PREFIX, sizeof(size_t));
+
+    struct pool_memory_list * list = _pool_memory_list(arg, size);
+    struct pool_memory_block * block = pointer;
+
+    block->next = list->head;
+    list->head = block;
+}
+
+struct pool_memory_list * _pool_memory_list(struct pool_memory * const pool, size_t const size) {
+    // structures reuse only a few distinct sizes, so a linear search over lists is enough
+    for (size_t i = 0; i < pool->length; ++i) {
+        if (size == pool->lists[i].size) {
+            return pool->lists + i;
+        }
+    }
+
+    if (pool->length == pool->capacity) {
+        pool->capacity = pool->capacity ? pool->capacity * CERPEC_FACTOR : CERPEC_CHUNK;
+
+        pool->lists = realloc(pool->lists, pool->capacity * sizeof(struct pool_memory_list));
+        error(pool->lists && "Memory allocation failed.");
+    }
+
+    pool->lists[pool->length] = (struct pool_memory_list) { .head = NULL, .size = size, };
+
+    return pool->lists + (pool->length++);
+}
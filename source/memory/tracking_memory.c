@@ -0,0 +1,188 @@
+#include <memory/tracking_memory.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief Rounds size up to tracking alignment.
+#define TRACKING_MEMORY_ROUND(size) (((size) + (TRACKING_MEMORY_ALIGN - 1)) & ~(size_t)(TRACKING_MEMORY_ALIGN - 1))
+
+/// @brief Size of header before each allocation that saves its requested size.
+#define TRACKING_MEMORY_PREFIX TRACKING_MEMORY_ROUND(sizeof(size_t))
+
+/// @brief Tracking state kept in allocator's argument.
+struct tracking_memory {
+    memory_s const * inner;
+    tracking_memory_stats_s stats;
+};
+
+/// @brief Allocates memory with inner allocator and records its size.
+/// @param size Size of memory to allocate.
+/// @param arg Tracking state.
+/// @return Pointer to allocated memory, or NULL if size is zero.
+void * _tracking_memory_alloc(size_t const size, void * arg);
+
+/// @brief Reallocates memory with inner allocator and records size change and copy volume.
+/// @param pointer Memory to reallocate.
+/// @param size New size of memory.
+/// @param arg Tracking state.
+/// @return Pointer to reallocated memory, or NULL if size is zero.
+void * _tracking_memory_realloc(void * pointer, size_t const size, void * arg);
+
+/// @brief Frees memory with inner allocator and records freed size.
+/// @param pointer Memory to free.
+/// @param arg Tracking state.
+void _tracking_memory_free(void * pointer, void * arg);
+
+/// @brief Frees memory with inner allocator and subtracts its size from live bytes.
+/// @param state Tracking state.
+/// @param pointer Memory to release.
+void _tracking_memory_release(struct tracking_memory * const state, void * const pointer);
+
+/// @brief Adds requested size to live bytes, peak and histogram.
+/// @param state Tracking state.
+/// @param size Requested size.
+void _tracking_memory_record(struct tracking_memory * const state, size_t const size);
+
+memory_s make_tracking_memory(memory_s const * const inner) {
+    error(inner && "Parameter can't be NULL.");
+
+    struct tracking_memory * state = malloc(sizeof(struct tracking_memory));
+    error(state && "Memory allocation failed.");
+
+    memset(state, 0, sizeof(struct tracking_memory));
+    state->inner = inner;
+
+    return compose_memory(_tracking_memory_alloc, _tracking_memory_realloc, _tracking_memory_free, state);
+}
+
+void destroy_tracking_memory(memory_s * const tracking) {
+    error(tracking && "Parameter can't be NULL.");
+    error(tracking->alloc == _tracking_memory_alloc && "Allocator isn't tracking.");
+
+    free(tracking->arg);
+
+    // map everything to zero/false
+    memset(tracking, 0, sizeof(memory_s));
+}
+
+tracking_memory_stats_s stats_tracking_memory(memory_s const * const tracking) {
+    error(tracking && "Parameter can't be NULL.");
+    error(tracking->alloc == _tracking_memory_alloc && "Allocator isn't tracking.");
+
+    struct tracking_memory const * state = tracking->arg;
+    valid(state && "Tracking state can't be NULL.");
+
+    return state->stats;
+}
+
+void reset_tracking_memory(memory_s const * const tracking) {
+    error(tracking && "Parameter can't be NULL.");
+    error(tracking->alloc == _tracking_memory_alloc && "Allocator isn't tracking.");
+
+    struct tracking_memory * state = tracking->arg;
+    valid(state && "Tracking state can't be NULL.");
+
+    size_t const live = state->stats.live;
+    memset(&(state->stats), 0, sizeof(tracking_memory_stats_s));
+    state->stats.live = state->stats.peak = live;
+}
+
+void dump_tracking_memory(memory_s const * const tracking, FILE * const stream) {
+    error(tracking && "Parameter can't be NULL.");
+    error(stream && "Parameter can't be NULL.");
+    error(tracking->alloc == _tracking_memory_alloc && "Allocator isn't tracking.");
+
+    struct tracking_memory const * state = tracking->arg;
+    valid(state && "Tracking state can't be NULL.");
+
+    tracking_memory_stats_s const * stats = &(state->stats);
+    fprintf(stream, "{\"live\":%zu,\"peak\":%zu,\"allocs\":%zu,\"reallocs\":%zu,\"frees\":%zu,\"copied\":%zu,\"histogram\":[",
+        stats->live, stats->peak, stats->allocs, stats->reallocs, stats->frees, stats->copied);
+
+    char const * separator = "";
+    for (size_t i = 0; i < TRACKING_MEMORY_BUCKETS; ++i) {
+        if (!stats->histogram[i]) { continue; }
+
+        fprintf(stream, "%s[%zu,%zu]", separator, (size_t)(1) << i, stats->histogram[i]);
+        separator = ",";
+    }
+
+    fprintf(stream, "]}\n");
+}
+
+void * _tracking_memory_alloc(size_t const size, void * arg) {
+    struct tracking_memory * state = arg;
+    state->stats.allocs++;
+
+    if (!size) { return NULL; }
+
+    char * memory = state->inner->alloc(TRACKING_MEMORY_PREFIX + size, state->inner->arg);
+    if (!memory) { return NULL; }
+
+    memcpy(memory, &size, sizeof(size_t));
+    _tracking_memory_record(state, size);
+
+    return memory + TRACKING_MEMORY_PREFIX;
+}
+
+void * _tracking_memory_realloc(void * pointer, size_t const size, void * arg) {
+    struct tracking_memory * state = arg;
+    state->stats.reallocs++;
+
+    if (!size) {
+        _tracking_memory_release(state, pointer); // realloc to zero acts as free, but isn't counted as free call
+        return NULL;
+    }
+
+    size_t old = 0;
+    char * base = NULL;
+    if (pointer) {
+        base = (char*)(pointer) - TRACKING_MEMORY_PREFIX;
+        memcpy(&old, base, sizeof(size_t));
+    }
+
+    char * memory = state->inner->realloc(base, TRACKING_MEMORY_PREFIX + size, state->inner->arg);
+    if (!memory) { return NULL; }
+
+    if (base && memory != base) { // inner allocator moved memory, so old contents got copied
+        state->stats.copied += old < size ? old : size;
+    }
+
+    memcpy(memory, &size, sizeof(size_t));
+    state->stats.live -= old;
+    _tracking_memory_record(state, size);
+
+    return memory + TRACKING_MEMORY_PREFIX;
+}
+
+void _tracking_memory_free(void * pointer, void * arg) {
+    struct tracking_memory * state = arg;
+    state->stats.frees++;
+
+    _tracking_memory_release(state, pointer);
+}
+
+void _tracking_memory_release(struct tracking_memory * const state, void * const pointer) {
+    if (!pointer) { return; }
+
+    char * base = (char*)(pointer) - TRACKING_MEMORY_PREFIX;
+
+    size_t size = 0;
+    memcpy(&size, base, sizeof(size_t));
+    state->stats.live -= size;
+
+    state->inner->free(base, state->inner->arg);
+}
+
+void _tracking_memory_record(struct tracking_memory * const state, size_t const size) {
+    state->stats.live += size;
+    if (state->stats.live > state->stats.peak) {
+        state->stats.peak = state->stats.live;
+    }
+
+    size_t bucket = 0;
+    for (size_t s = size; s > 1; s >>= 1) { // floor of base two logarithm
+        bucket++;
+    }
+    state->stats.histogram[bucket]++;
+}
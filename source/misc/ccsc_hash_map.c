@@ -0,0 +1,377 @@
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#       undef _POSIX_C_SOURCE
+#       define _POSIX_C_SOURCE 200112L // imports pthread_rwlock_t in strict C99
+#   endif
+#   include <pthread.h>
+#endif
+
+#include <misc/ccsc_hash_map.h>
+
+#include <stdlib.h> // imports exit()
+#include <string.h>
+#include <stdint.h>
+
+#define CCSC_HASH_MAP_LINE 64
+
+/// @brief Shard of concurrent map, padded so neighbouring shards' locks don't share a cache line.
+struct concurrent_separate_chaining_hash_map_shard {
+#if defined(_WIN32)
+    SRWLOCK lock;
+#else
+    pthread_rwlock_t lock;
+#endif
+    isc_hash_map_s map;
+    char padding[CCSC_HASH_MAP_LINE];
+};
+
+/// @brief Gets shard that contains or should contain key based on high bits of its mixed hash.
+/// @param map Structure to get shard from.
+/// @param key Key to hash.
+/// @return Shard of key.
+struct concurrent_separate_chaining_hash_map_shard * _ccsc_hash_map_shard(ccsc_hash_map_s const * const map, void const * const key);
+
+/// @brief Initializes shard lock.
+/// @param shard Shard to initialize.
+void _ccsc_hash_map_init(struct concurrent_separate_chaining_hash_map_shard * const shard);
+
+/// @brief Frees shard lock.
+/// @param shard Shard to free.
+void _ccsc_hash_map_free(struct concurrent_separate_chaining_hash_map_shard * const shard);
+
+/// @brief Locks shard for shared reading.
+/// @param shard Shard to lock.
+void _ccsc_hash_map_read_lock(struct concurrent_separate_chaining_hash_map_shard * const shard);
+
+/// @brief Unlocks shard locked for shared reading.
+/// @param shard Shard to unlock.
+void _ccsc_hash_map_read_unlock(struct concurrent_separate_chaining_hash_map_shard * const shard);
+
+/// @brief Locks shard for exclusive writing.
+/// @param shard Shard to lock.
+void _ccsc_hash_map_write_lock(struct concurrent_separate_chaining_hash_map_shard * const shard);
+
+/// @brief Unlocks shard locked for exclusive writing.
+/// @param shard Shard to unlock.
+void _ccsc_hash_map_write_unlock(struct concurrent_separate_chaining_hash_map_shard * const shard);
+
+ccsc_hash_map_s create_ccsc_hash_map(size_t const key_size, size_t const value_size, hash_fn const hash_key, void * const ahk, compare_fn const compare_key, void * const ack) {
+    error(hash_key && "Parameter can't be NULL.");
+    error(compare_key && "Parameter can't be NULL.");
+    error(key_size && "Parameter can't be zero.");
+    error(value_size && "Parameter can't be zero.");
+
+    return make_ccsc_hash_map(key_size, value_size, CCSC_HASH_MAP_SHARDS, hash_key, ahk, compare_key, ack, &standard);
+}
+
+ccsc_hash_map_s make_ccsc_hash_map(size_t const key_size, size_t const value_size, size_t const count, hash_fn const hash_key, void * const ahk, compare_fn const compare_key, void * const ack, memory_s const * const allocator) {
+    error(hash_key && "Parameter can't be NULL.");
+    error(compare_key && "Parameter can't be NULL.");
+    error(key_size && "Parameter can't be zero.");
+    error(value_size && "Parameter can't be zero.");
+    error(count && "Parameter can't be zero.");
+    error(!(count & (count - 1)) && "Shard count must be a power of 2.");
+    error(allocator && "Parameter can't be NULL.");
+
+    ccsc_hash_map_s const map = {
+        .key_size = key_size, .value_size = value_size, .hash_key = hash_key, .ahk = ahk, .count = count,
+        .shards = allocator->alloc(count * sizeof(struct concurrent_separate_chaining_hash_map_shard), allocator->arg),
+        .allocator = allocator,
+    };
+    error(map.shards && "Memory allocation failed.");
+
+    for (size_t i = 0; i < map.count; ++i) {
+        map.shards[i].map = make_isc_hash_map(key_size, value_size, hash_key, ahk, compare_key, ack, allocator);
+        _ccsc_hash_map_init(map.shards + i);
+    }
+
+    return map;
+}
+
+void destroy_ccsc_hash_map(ccsc_hash_map_s * const map, set_fn const destroy_key, void * const adk, set_fn const destroy_value, void * const adv) {
+    error(map && "Parameter can't be NULL.");
+    error(destroy_key && "Parameter can't be NULL.");
+    error(destroy_value && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < map->count; ++i) {
+        destroy_isc_hash_map(&(map->shards[i].map), destroy_key, adk, destroy_value, adv);
+        _ccsc_hash_map_free(map->shards + i);
+    }
+
+    map->allocator->free(map->shards, map->allocator->arg);
+
+    // map everything to zero/false
+    memset(map, 0, sizeof(ccsc_hash_map_s));
+}
+
+void clear_ccsc_hash_map(ccsc_hash_map_s * const map, set_fn const destroy_key, void * const adk, set_fn const destroy_value, void * const adv) {
+    error(map && "Parameter can't be NULL.");
+    error(destroy_key && "Parameter can't be NULL.");
+    error(destroy_value && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    for (size_t i = 0; i < map->count; ++i) {
+        _ccsc_hash_map_write_lock(map->shards + i);
+        clear_isc_hash_map(&(map->shards[i].map), destroy_key, adk, destroy_value, adv);
+        _ccsc_hash_map_write_unlock(map->shards + i);
+    }
+}
+
+ccsc_hash_map_s copy_ccsc_hash_map(ccsc_hash_map_s const * const map, copy_fn const copy_key, void * const ack, copy_fn const copy_value, void * const acv) {
+    error(map && "Parameter can't be NULL.");
+    error(copy_key && "Parameter can't be NULL.");
+    error(copy_value && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    ccsc_hash_map_s const replica = {
+        .key_size = map->key_size, .value_size = map->value_size, .hash_key = map->hash_key, .ahk = map->ahk,
+        .count = map->count, .allocator = map->allocator,
+        .shards = map->allocator->alloc(map->count * sizeof(struct concurrent_separate_chaining_hash_map_shard), map->allocator->arg),
+    };
+    error(replica.shards && "Memory allocation failed.");
+
+    for (size_t i = 0; i < map->count; ++i) {
+        _ccsc_hash_map_read_lock(map->shards + i);
+        replica.shards[i].map = copy_isc_hash_map(&(map->shards[i].map), copy_key, ack, copy_value, acv);
+        _ccsc_hash_map_read_unlock(map->shards + i);
+
+        _ccsc_hash_map_init(replica.shards + i);
+    }
+
+    return replica;
+}
+
+bool is_empty_ccsc_hash_map(ccsc_hash_map_s const * const map) {
+    error(map && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    bool empty = true;
+    for (size_t i = 0; i < map->count && empty; ++i) {
+        _ccsc_hash_map_read_lock(map->shards + i);
+        empty = is_empty_isc_hash_map(&(map->shards[i].map));
+        _ccsc_hash_map_read_unlock(map->shards + i);
+    }
+
+    return empty;
+}
+
+void insert_ccsc_hash_map(ccsc_hash_map_s * const map, void const * const key, void const * const value) {
+    error(map && "Parameter can't be NULL.");
+    error(key && "Parameter can't be NULL.");
+    error(value && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    struct concurrent_separate_chaining_hash_map_shard * const shard = _ccsc_hash_map_shard(map, key);
+
+    _ccsc_hash_map_write_lock(shard);
+    insert_isc_hash_map(&(shard->map), key, value);
+    _ccsc_hash_map_write_unlock(shard);
+}
+
+void remove_ccsc_hash_map(ccsc_hash_map_s * const map, void const * const key, void * const key_buffer, void * const value_buffer) {
+    error(map && "Parameter can't be NULL.");
+    error(key && "Parameter can't be NULL.");
+    error(key_buffer && "Parameter can't be NULL.");
+    error(value_buffer && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    struct concurrent_separate_chaining_hash_map_shard * const shard = _ccsc_hash_map_shard(map, key);
+
+    _ccsc_hash_map_write_lock(shard);
+    remove_isc_hash_map(&(shard->map), key, key_buffer, value_buffer);
+    _ccsc_hash_map_write_unlock(shard);
+}
+
+bool contains_key_ccsc_hash_map(ccsc_hash_map_s const * const map, void const * const key) {
+    error(map && "Parameter can't be NULL.");
+    error(key && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    struct concurrent_separate_chaining_hash_map_shard * const shard = _ccsc_hash_map_shard(map, key);
+
+    _ccsc_hash_map_read_lock(shard);
+    bool const contains = contains_key_isc_hash_map(&(shard->map), key);
+    _ccsc_hash_map_read_unlock(shard);
+
+    return contains;
+}
+
+void get_value_ccsc_hash_map(ccsc_hash_map_s const * const map, void const * const key, void * const value_buffer) {
+    error(map && "Parameter can't be NULL.");
+    error(key && "Parameter can't be NULL.");
+    error(value_buffer && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    struct concurrent_separate_chaining_hash_map_shard * const shard = _ccsc_hash_map_shard(map, key);
+
+    _ccsc_hash_map_read_lock(shard);
+    get_value_isc_hash_map(&(shard->map), key, value_buffer);
+    _ccsc_hash_map_read_unlock(shard);
+}
+
+void set_ccsc_hash_map(ccsc_hash_map_s * const map, void const * const key, void const * const value, void * const value_buffer) {
+    error(map && "Parameter can't be NULL.");
+    error(key && "Parameter can't be NULL.");
+    error(value && "Parameter can't be NULL.");
+    error(value_buffer && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    struct concurrent_separate_chaining_hash_map_shard * const shard = _ccsc_hash_map_shard(map, key);
+
+    _ccsc_hash_map_write_lock(shard);
+    set_isc_hash_map(&(shard->map), key, value, value_buffer);
+    _ccsc_hash_map_write_unlock(shard);
+}
+
+void each_key_ccsc_hash_map(ccsc_hash_map_s const * const map, manage_fn const manage, void * const am) {
+    error(map && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    bool proceed = true;
+    for (size_t i = 0; i < map->count && proceed; ++i) {
+        isc_hash_map_s const * const shard = &(map->shards[i].map);
+
+        _ccsc_hash_map_read_lock(map->shards + i);
+        for (size_t k = 0; k < shard->length && proceed; ++k) {
+            proceed = manage(shard->keys + (k * shard->key_size), am);
+        }
+        _ccsc_hash_map_read_unlock(map->shards + i);
+    }
+}
+
+void each_value_ccsc_hash_map(ccsc_hash_map_s const * const map, manage_fn const manage, void * const am) {
+    error(map && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->shards && "Shards array can't be NULL.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    bool proceed = true;
+    for (size_t i = 0; i < map->count && proceed; ++i) {
+        isc_hash_map_s const * const shard = &(map->shards[i].map);
+
+        _ccsc_hash_map_read_lock(map->shards + i);
+        for (size_t v = 0; v < shard->length && proceed; ++v) {
+            proceed = manage(shard->values + (v * shard->value_size), am);
+        }
+        _ccsc_hash_map_read_unlock(map->shards + i);
+    }
+}
+
+struct concurrent_separate_chaining_hash_map_shard * _ccsc_hash_map_shard(ccsc_hash_map_s const * const map, void const * const key) {
+    // mix hash so that weak hashes (like identity) also spread their high bits, shard maps keep using low ones
+    uint64_t mix = (uint64_t)(map->hash_key(key, map->ahk));
+    mix ^= mix >> 33;
+    mix *= (uint64_t)(0xff51afd7ed558ccd);
+    mix ^= mix >> 33;
+
+    return map->shards + ((size_t)(mix >> 32) & (map->count - 1));
+}
+
+void _ccsc_hash_map_init(struct concurrent_separate_chaining_hash_map_shard * const shard) {
+#if defined(_WIN32)
+    InitializeSRWLock(&(shard->lock));
+#else
+    int const result = pthread_rwlock_init(&(shard->lock), NULL);
+    error(!result && "Lock initialization failed.");
+    (void)(result);
+#endif
+}
+
+void _ccsc_hash_map_free(struct concurrent_separate_chaining_hash_map_shard * const shard) {
+#if defined(_WIN32)
+    (void)(shard); // slim reader-writer locks don't need to be freed
+#else
+    pthread_rwlock_destroy(&(shard->lock));
+#endif
+}
+
+void _ccsc_hash_map_read_lock(struct concurrent_separate_chaining_hash_map_shard * const shard) {
+#if defined(_WIN32)
+    AcquireSRWLockShared(&(shard->lock));
+#else
+    pthread_rwlock_rdlock(&(shard->lock));
+#endif
+}
+
+void _ccsc_hash_map_read_unlock(struct concurrent_separate_chaining_hash_map_shard * const shard) {
+#if defined(_WIN32)
+    ReleaseSRWLockShared(&(shard->lock));
+#else
+    pthread_rwlock_unlock(&(shard->lock));
+#endif
+}
+
+void _ccsc_hash_map_write_lock(struct concurrent_separate_chaining_hash_map_shard * const shard) {
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&(shard->lock));
+#else
+    pthread_rwlock_wrlock(&(shard->lock));
+#endif
+}
+
+void _ccsc_hash_map_write_unlock(struct concurrent_separate_chaining_hash_map_shard * const shard) {
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&(shard->lock));
+#else
+    pthread_rwlock_unlock(&(shard->lock));
+#endif
+}
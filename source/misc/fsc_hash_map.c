@@ -2,6 +2,7 @@
 
 #include <stdlib.h> // imports exit()
 #include <string.h>
+#include <stdint.h>
 
 #define NIL (size_t)(-1)
 
@@ -10,6 +11,16 @@
 /// @param hole Index of hole in arrays.
 void _fsc_hash_map_fill_hole(fsc_hash_map_s const * const map, size_t const hole);
 
+/// @brief Reduces hash value into bucket index based on structure's indexing mode.
+/// @param map Structure to index.
+/// @param hash Hash value to reduce.
+/// @return Bucket index.
+size_t _fsc_hash_map_index(fsc_hash_map_s const * const map, size_t const hash);
+
+/// @brief Rebuilds bucket lists by pushing each element's hash into its bucket.
+/// @param map Structure to rehash.
+void _fsc_hash_map_rehash(fsc_hash_map_s const * const map);
+
 fsc_hash_map_s create_fsc_hash_map(size_t const key_size, size_t const value_size, size_t const max, hash_fn const hash_key, void * const ahk, compare_fn const compare_key, void * const ack) {
     error(hash_key && "Parameter can't be NULL.");
     error(compare_key && "Parameter can't be NULL.");
@@ -147,6 +158,7 @@ fsc_hash_map_s copy_fsc_hash_map(fsc_hash_map_s const * const map, copy_fn const
     fsc_hash_map_s const replica = {
         .max = map->max, .hash_key = map->hash_key, .length = map->length,
         .key_size = map->key_size, .value_size = map->value_size, .ack = map->ack, .ahk = map->ahk,
+        .indexing = map->indexing, .mask = map->mask,
 
         .keys = map->allocator->alloc(map->max * map->key_size, map->allocator->arg),
         .values = map->allocator->alloc(map->max * map->value_size, map->allocator->arg),
@@ -203,6 +215,31 @@ bool is_full_fsc_hash_map(fsc_hash_map_s const * const map) {
     return (map->length == map->max); // if 0 return 'true'
 }
 
+void reindex_fsc_hash_map(fsc_hash_map_s * const map, index_e const indexing) {
+    error(map && "Parameter can't be NULL.");
+    error((MODULO_INDEX == indexing || MASK_INDEX == indexing) && "Invalid indexing mode.");
+
+    valid(map->hash_key && "Parameter can't be NULL.");
+    valid(map->key_size && "Parameter can't be zero.");
+    valid(map->value_size && "Parameter can't be zero.");
+    valid(map->length <= map->max && "Lenght can't be larger than maximum.");
+    valid(map->allocator && "Paremeter can't be NULL.");
+
+    map->indexing = indexing;
+
+    // only the largest power of two buckets that fit into head array are used when masking
+    map->mask = 0;
+    if (MASK_INDEX == indexing) {
+        size_t buckets = 1;
+        while (buckets <= map->max / 2) {
+            buckets <<= 1;
+        }
+        map->mask = buckets - 1;
+    }
+
+    _fsc_hash_map_rehash(map);
+}
+
 void insert_fsc_hash_map(fsc_hash_map_s * const map, void const * const key, void const * const value) {
     error(map && "Parameter can't be NULL.");
     error(key && "Parameter can't be NULL.");
@@ -220,7 +257,7 @@ void insert_fsc_hash_map(fsc_hash_map_s * const map, void const * const key, voi
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->max;
+    size_t const index = _fsc_hash_map_index(map, hash);
 
 #ifndef NERROR
     // check if element is in map or not
@@ -276,7 +313,7 @@ void remove_fsc_hash_map(fsc_hash_map_s * const map, void const * const key, voi
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->max;
+    size_t const index = _fsc_hash_map_index(map, hash);
 
     for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
         char const * current_key = map->keys + (n * map->key_size);
@@ -311,7 +348,7 @@ bool contains_key_fsc_hash_map(fsc_hash_map_s const * const map, void const * co
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->max;
+    size_t const index = _fsc_hash_map_index(map, hash);
 
     // for each node at index check if element is contained and return true or false
     for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
@@ -343,7 +380,7 @@ void get_value_fsc_hash_map(fsc_hash_map_s const * const map, void const * const
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->max;
+    size_t const index = _fsc_hash_map_index(map, hash);
 
     // for each node at index check if element is contained
     for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
@@ -358,6 +395,59 @@ void get_value_fsc_hash_map(fsc_hash_map_s const * const map, void const * const
     exit(EXIT_FAILURE); // terminate on error
 }
 
+void get_values_fsc_hash_map(fsc_hash_map_s const * const map, void const * const keys, size_t const count, void * const values_buffer) {
+    error(map && "Parameter can't be NULL.");
+    error((!count || keys) && "Parameter can't be NULL.");
+    error((!count || values_buffer) && "Parameter can't be NULL.");
+    error(keys != values_buffer && "Parameters can't be the same.");
+    error((!count || map->length) && "Structure is empty.");
+
+    valid(map->hash_key && "Parameter can't be NULL.");
+    valid(map->key_size && "Parameter can't be zero.");
+    valid(map->value_size && "Parameter can't be zero.");
+    valid(map->length <= map->max && "Lenght can't be larger than maximum.");
+    valid(map->allocator && "Paremeter can't be NULL.");
+
+    char const * const key_array = keys;
+    char * const value_array = values_buffer;
+
+    size_t hashes[CERPEC_BATCH], indexes[CERPEC_BATCH];
+    for (size_t b = 0; b < count; b += CERPEC_BATCH) {
+        size_t const batch = count - b < CERPEC_BATCH ? count - b : CERPEC_BATCH;
+
+        // hash batch of keys first and prefetch their heads so misses overlap
+        for (size_t i = 0; i < batch; ++i) {
+            hashes[i] = map->hash_key(key_array + ((b + i) * map->key_size), map->ahk);
+            indexes[i] = _fsc_hash_map_index(map, hashes[i]);
+            prefetch(map->head + indexes[i]);
+        }
+
+        // prefetch first node of each list since its hash and key are compared first
+        for (size_t i = 0; i < batch; ++i) {
+            size_t const n = map->head[indexes[i]];
+            if (NIL != n) {
+                prefetch(map->hashes + n);
+                prefetch(map->keys + (n * map->key_size));
+            }
+        }
+
+        // resolve lists with hopefully cached heads and nodes
+        for (size_t i = 0; i < batch; ++i) {
+            char const * const key = key_array + ((b + i) * map->key_size);
+
+            size_t n = map->head[indexes[i]];
+            while (NIL != n && (hashes[i] != map->hashes[n] || map->compare_key(key, map->keys + (n * map->key_size), map->ack))) {
+                n = map->next[n];
+            }
+
+            error(NIL != n && "Structure does not contain key.");
+            if (NIL == n) { exit(EXIT_FAILURE); } // terminate on error
+
+            memcpy(value_array + ((b + i) * map->value_size), map->values + (n * map->value_size), map->value_size);
+        }
+    }
+}
+
 void set_fsc_hash_map(fsc_hash_map_s * const map, void const * const key, void const * const value, void * const value_buffer) {
     error(map && "Parameter can't be NULL.");
     error(key && "Parameter can't be NULL.");
@@ -381,7 +471,7 @@ void set_fsc_hash_map(fsc_hash_map_s * const map, void const * const key, void c
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->max;
+    size_t const index = _fsc_hash_map_index(map, hash);
 
     // for each node at index check if element is contained
     for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
@@ -456,14 +546,49 @@ void each_value_fsc_hash_map(fsc_hash_map_s const * const map, manage_fn const m
     }
 }
 
+size_t _fsc_hash_map_index(fsc_hash_map_s const * const map, size_t const hash) {
+    if (MODULO_INDEX == map->indexing) {
+        return hash % map->max;
+    }
+
+    // mix hash so that weak hashes (like identity) don't only depend on their low bits, then mask
+    uint64_t mix = (uint64_t)(hash);
+    mix ^= mix >> 32;
+    mix *= (uint64_t)(0xd6e8feb86659fd93);
+    mix ^= mix >> 32;
+
+    return (size_t)(mix) & map->mask;
+}
+
+void _fsc_hash_map_rehash(fsc_hash_map_s const * const map) {
+    for (size_t i = 0; i < map->max; ++i) {
+        map->head[i] = NIL;
+    }
+
+    // reset lists by pushing hashes to their valid list
+    for (size_t i = 0; i < map->length; ++i) {
+        size_t const index = _fsc_hash_map_index(map, map->hashes[i]);
+
+        size_t const head = map->head[index];
+        if (NIL != head) {
+            map->prev[head] = i;
+        }
+
+        // node index redirection
+        map->prev[i] = NIL;
+        map->next[i] = head;
+        map->head[index] = i;
+    }
+}
+
 void _fsc_hash_map_fill_hole(fsc_hash_map_s const * const map, size_t const hole) {
     if (NIL == map->prev[map->length]) {
-        size_t const index = map->hashes[map->length] % map->max;
+        size_t const index = _fsc_hash_map_index(map, map->hashes[map->length]);
         map->head[index] = hole;
     }
 
     if (NIL == map->prev[hole]) {
-        size_t const index = map->hashes[hole] % map->max;
+        size_t const index = _fsc_hash_map_index(map, map->hashes[hole]);
         map->head[index] = map->next[hole];
     }
 
@@ -29,7 +29,7 @@ ibinary_heap_s create_ibinary_heap(size_t const size, compare_fn const compare,
     assert(size && "Parameter can't be zero.");
 
     return (ibinary_heap_s) {
-        .size = size, .compare = compare, .allocator = &standard, .ac = ac,
+        .size = size, .compare = compare, .allocator = &standard, .ac = ac, .growth = CERPEC_GROWTH(IBINARY_HEAP_CHUNK),
     };
 }
 
@@ -39,7 +39,7 @@ ibinary_heap_s make_ibinary_heap(size_t const size, compare_fn const compare, vo
     assert(allocator && "Parameter can't be NULL.");
 
     return (ibinary_heap_s) {
-        .size = size, .compare = compare, .allocator = allocator, .ac = ac,
+        .size = size, .compare = compare, .allocator = allocator, .ac = ac, .growth = CERPEC_GROWTH(IBINARY_HEAP_CHUNK),
     };
 }
 
@@ -92,7 +92,7 @@ ibinary_heap_s copy_ibinary_heap(ibinary_heap_s const * const heap, copy_fn cons
     ibinary_heap_s const replica = {
         .capacity = heap->capacity, .compare = heap->compare, .size = heap->size, .length = heap->length,
         .elements = heap->allocator->alloc(heap->capacity * heap->size, heap->allocator->arg),
-        .allocator = heap->allocator, .ac = heap->ac,
+        .allocator = heap->allocator, .ac = heap->ac, .growth = heap->growth,
     };
     assert((!replica.capacity || replica.elements) && "Memory allocation failed.");
 
@@ -113,6 +113,40 @@ bool is_empty_ibinary_heap(ibinary_heap_s const * const heap) {
     return !(heap->length);
 }
 
+void growth_ibinary_heap(ibinary_heap_s * const heap, growth_s const growth) {
+    assert(heap && "Parameter can't be NULL.");
+    assert(growth.factor > 1 && "Factor must be greater than one.");
+    assert(growth.chunk && "Chunk can't be zero.");
+    assert((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+    assert(heap->compare && "Parameter can't be NULL.");
+    assert(heap->size && "Parameter can't be zero.");
+    assert(heap->allocator && "Paremeter can't be NULL.");
+
+    heap->growth = growth;
+}
+
+void reserve_ibinary_heap(ibinary_heap_s * const heap, size_t const capacity) {
+    assert(heap && "Parameter can't be NULL.");
+    assert(heap->compare && "Parameter can't be NULL.");
+    assert(heap->size && "Parameter can't be zero.");
+    assert(heap->allocator && "Paremeter can't be NULL.");
+
+    if (capacity > heap->capacity) {
+        _ibinary_heap_resize(heap, capacity);
+    }
+}
+
+void shrink_to_fit_ibinary_heap(ibinary_heap_s * const heap) {
+    assert(heap && "Parameter can't be NULL.");
+    assert(heap->compare && "Parameter can't be NULL.");
+    assert(heap->size && "Parameter can't be zero.");
+    assert(heap->allocator && "Paremeter can't be NULL.");
+
+    if (heap->length != heap->capacity) {
+        _ibinary_heap_resize(heap, heap->length);
+    }
+}
+
 void push_ibinary_heap(ibinary_heap_s * const heap, void const * const element) {
     assert(heap && "Parameter can't be NULL.");
     assert(element && "Parameter can't be NULL.");
@@ -122,8 +156,7 @@ void push_ibinary_heap(ibinary_heap_s * const heap, void const * const element)
     assert(heap->allocator && "Paremeter can't be NULL.");
 
     if (heap->length == heap->capacity) {
-        size_t const capacity = heap->length ? heap->length * CERPEC_FACTOR : IBINARY_HEAP_CHUNK;
-        _ibinary_heap_resize(heap, capacity);
+        _ibinary_heap_resize(heap, expand_growth(&(heap->growth), heap->length));
     }
 
     // append element to the end of the structure
@@ -151,8 +184,9 @@ void pop_ibinary_heap(ibinary_heap_s * const heap, void * const buffer) {
 
     _ibinary_heapify_down(heap, 0);
 
-    if (heap->length <= heap->capacity / CERPEC_FACTOR && (heap->length > IBINARY_HEAP_CHUNK || !heap->length)) {
-        _ibinary_heap_resize(heap, heap->length);
+    size_t const capacity = shrink_growth(&(heap->growth), heap->length, heap->capacity);
+    if (capacity != heap->capacity) {
+        _ibinary_heap_resize(heap, capacity);
     }
 }
 
@@ -208,7 +242,7 @@ void meld_ibinary_heap(ibinary_heap_s * const destination, ibinary_heap_s * cons
     // calculate new destination length
     size_t const sum = destination->length + source->length;
     size_t const max = destination->capacity > source->capacity ? destination->capacity : source->capacity;
-    size_t const capacity = sum > max ? CERPEC_FACTOR * max : max;
+    size_t const capacity = sum > max ? destination->growth.factor * max : max;
     _ibinary_heap_resize(destination, capacity);
 
     // copy source elements into destination array
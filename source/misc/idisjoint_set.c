@@ -0,0 +1,226 @@
+#include <misc/idisjoint_set.h>
+
+#include <string.h>
+
+/// @brief Resizes structure to new size.
+/// @param set Structure to resize.
+/// @param size New size to be used.
+void _idisjoint_set_resize(idisjoint_set_s * const set, size_t const size);
+
+idisjoint_set_s create_idisjoint_set(void) {
+    return (idisjoint_set_s) { .allocator = &standard, .growth = CERPEC_GROWTH(IDISJOINT_SET_CHUNK), };
+}
+
+idisjoint_set_s make_idisjoint_set(memory_s const * const allocator) {
+    error(allocator && "Parameter can't be NULL.");
+
+    return (idisjoint_set_s) { .allocator = allocator, .growth = CERPEC_GROWTH(IDISJOINT_SET_CHUNK), };
+}
+
+void destroy_idisjoint_set(idisjoint_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    set->allocator->free(set->parents, set->allocator->arg);
+    set->allocator->free(set->sizes, set->allocator->arg);
+
+    // make structure invalid
+    memset(set, 0, sizeof(idisjoint_set_s));
+}
+
+void clear_idisjoint_set(idisjoint_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    set->allocator->free(set->parents, set->allocator->arg);
+    set->allocator->free(set->sizes, set->allocator->arg);
+
+    // only clear structure
+    set->length = set->capacity = set->count = 0;
+    set->parents = set->sizes = NULL;
+}
+
+idisjoint_set_s copy_idisjoint_set(idisjoint_set_s const * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    idisjoint_set_s const replica = {
+        .length = set->length, .capacity = set->capacity, .count = set->count,
+        .growth = set->growth, .allocator = set->allocator,
+        .parents = set->allocator->alloc(set->capacity * sizeof(size_t), set->allocator->arg),
+        .sizes = set->allocator->alloc(set->capacity * sizeof(size_t), set->allocator->arg),
+    };
+    error((!replica.capacity || (replica.parents && replica.sizes)) && "Memory allocation failed.");
+
+    if (set->length) {
+        memcpy(replica.parents, set->parents, set->length * sizeof(size_t));
+        memcpy(replica.sizes, set->sizes, set->length * sizeof(size_t));
+    }
+
+    return replica;
+}
+
+bool is_empty_idisjoint_set(idisjoint_set_s const * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    return !(set->length);
+}
+
+void growth_idisjoint_set(idisjoint_set_s * const set, growth_s const growth) {
+    error(set && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    set->growth = growth;
+}
+
+void reserve_idisjoint_set(idisjoint_set_s * const set, size_t const capacity) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    if (capacity > set->capacity) {
+        _idisjoint_set_resize(set, capacity);
+    }
+}
+
+void shrink_to_fit_idisjoint_set(idisjoint_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    if (set->length != set->capacity) {
+        _idisjoint_set_resize(set, set->length);
+    }
+}
+
+size_t insert_idisjoint_set(idisjoint_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    if (set->length == set->capacity) {
+        _idisjoint_set_resize(set, expand_growth(&(set->growth), set->length));
+    }
+
+    // new element is root of its own single element set
+    set->parents[set->length] = set->length;
+    set->sizes[set->length] = 1;
+    set->count++;
+
+    return set->length++;
+}
+
+size_t find_idisjoint_set(idisjoint_set_s * const set, size_t const element) {
+    error(set && "Parameter can't be NULL.");
+    error(element < set->length && "Parameter can't exceed length.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    // path halving, each visited element skips to its grandparent in a single pass without recursion
+    size_t current = element;
+    while (current != set->parents[current]) {
+        set->parents[current] = set->parents[set->parents[current]];
+        current = set->parents[current];
+    }
+
+    return current;
+}
+
+bool union_idisjoint_set(idisjoint_set_s * const set, size_t const one, size_t const two) {
+    error(set && "Parameter can't be NULL.");
+    error(one < set->length && "Parameter can't exceed length.");
+    error(two < set->length && "Parameter can't exceed length.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    size_t big = find_idisjoint_set(set, one), small = find_idisjoint_set(set, two);
+    if (big == small) {
+        return false;
+    }
+
+    // union by size, smaller set goes under bigger one so trees stay logarithmically shallow
+    if (set->sizes[big] < set->sizes[small]) {
+        size_t const swap = big;
+        big = small;
+        small = swap;
+    }
+
+    set->parents[small] = big;
+    set->sizes[big] += set->sizes[small];
+    set->count--;
+
+    return true;
+}
+
+bool is_joint_idisjoint_set(idisjoint_set_s * const set, size_t const one, size_t const two) {
+    error(set && "Parameter can't be NULL.");
+    error(one < set->length && "Parameter can't exceed length.");
+    error(two < set->length && "Parameter can't exceed length.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    return find_idisjoint_set(set, one) == find_idisjoint_set(set, two);
+}
+
+size_t size_idisjoint_set(idisjoint_set_s * const set, size_t const element) {
+    error(set && "Parameter can't be NULL.");
+    error(element < set->length && "Parameter can't exceed length.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    return set->sizes[find_idisjoint_set(set, element)];
+}
+
+void find_many_idisjoint_set(idisjoint_set_s * const set, size_t const * const elements, size_t const length, size_t * const roots) {
+    error(set && "Parameter can't be NULL.");
+    error((!length || elements) && "Parameter can't be NULL.");
+    error((!length || roots) && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    // parents of later elements are prefetched while earlier ones are walked
+    for (size_t i = 0; i < length; ++i) {
+        if (i + CERPEC_BATCH < length) {
+            prefetch(set->parents + elements[i + CERPEC_BATCH]);
+        }
+
+        roots[i] = find_idisjoint_set(set, elements[i]);
+    }
+}
+
+size_t union_many_idisjoint_set(idisjoint_set_s * const set, size_t const * const pairs, size_t const length) {
+    error(set && "Parameter can't be NULL.");
+    error((!length || pairs) && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    size_t united = 0;
+    for (size_t i = 0; i < length; ++i) {
+        if (i + CERPEC_BATCH < length) {
+            prefetch(set->parents + pairs[2 * (i + CERPEC_BATCH)]);
+            prefetch(set->parents + pairs[2 * (i + CERPEC_BATCH) + 1]);
+        }
+
+        united += union_idisjoint_set(set, pairs[2 * i], pairs[2 * i + 1]);
+    }
+
+    return united;
+}
+
+void _idisjoint_set_resize(idisjoint_set_s * const set, size_t const size) {
+    set->capacity = size;
+
+    set->parents = set->allocator->realloc(set->parents, size * sizeof(size_t), set->allocator->arg);
+    error((!size || set->parents) && "Memory allocation failed.");
+    set->sizes = set->allocator->realloc(set->sizes, size * sizeof(size_t), set->allocator->arg);
+    error((!size || set->sizes) && "Memory allocation failed.");
+}
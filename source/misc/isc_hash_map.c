@@ -2,6 +2,7 @@
 
 #include <stdlib.h> // imports exit()
 #include <string.h>
+#include <stdint.h>
 
 #define NIL (size_t)(-1)
 
@@ -10,6 +11,35 @@
 /// @param size New size.
 void _isc_hash_table_resize(isc_hash_map_s * const table, size_t const size);
 
+/// @brief Resizes structure at once or starts incremental rehash if structure has it enabled.
+/// @param map Structure to resize.
+/// @param size New size.
+void _isc_hash_map_resize(isc_hash_map_s * const map, size_t const size);
+
+/// @brief Moves nodes from old bucket heads into current ones.
+/// @param map Structure to migrate.
+/// @param count Maximum number of old buckets to migrate.
+void _isc_hash_map_migrate(isc_hash_map_s * const map, size_t const count);
+
+/// @brief Gets bucket head that contains or should contain hash, old or current one.
+/// @param map Structure to get bucket from.
+/// @param hash Hash value of bucket.
+/// @return Pointer to bucket head.
+size_t * _isc_hash_map_bucket(isc_hash_map_s const * const map, size_t const hash);
+
+/// @brief Reduces hash value into bucket index based on structure's indexing mode.
+/// @param map Structure to index.
+/// @param hash Hash value to reduce.
+/// @param capacity Number of buckets to reduce into.
+/// @return Bucket index.
+size_t _isc_hash_map_index(isc_hash_map_s const * const map, size_t const hash, size_t const capacity);
+
+/// @brief Rounds capacity to one valid for structure's indexing mode.
+/// @param map Structure to round capacity for.
+/// @param size Minimum capacity.
+/// @return Valid capacity.
+size_t _isc_hash_map_round(isc_hash_map_s const * const map, size_t const size);
+
 /// @brief Fills hole/empty node index with last array-based node and fixes/redirects siblings.
 /// @param map Strcuture to fill.
 /// @param hole Index of hole node.
@@ -23,7 +53,7 @@ isc_hash_map_s create_isc_hash_map(size_t const key_size, size_t const value_siz
 
     return (isc_hash_map_s) {
         .key_size = key_size, .value_size = value_size, .hash_key = hash_key, .ahk = ahk,
-        .compare_key = compare_key, .allocator = &standard, .ack = ack,
+        .compare_key = compare_key, .allocator = &standard, .ack = ack, .growth = CERPEC_GROWTH(ISC_HASH_MAP_CHUNK),
     };
 }
 
@@ -36,7 +66,7 @@ isc_hash_map_s make_isc_hash_map(size_t const key_size, size_t const value_size,
 
     return (isc_hash_map_s) {
         .key_size = key_size, .value_size = value_size, .hash_key = hash_key, .ahk = ahk,
-        .compare_key = compare_key, .allocator = allocator, .ack = ack,
+        .compare_key = compare_key, .allocator = allocator, .ack = ack, .growth = CERPEC_GROWTH(ISC_HASH_MAP_CHUNK),
     };
 }
 
@@ -59,6 +89,7 @@ void destroy_isc_hash_map(isc_hash_map_s * const map, set_fn const destroy_key,
 
     // free arrays
     map->allocator->free(map->head, map->allocator->arg);
+    map->allocator->free(map->old_head, map->allocator->arg);
     map->allocator->free(map->next, map->allocator->arg);
     map->allocator->free(map->prev, map->allocator->arg);
     map->allocator->free(map->hashes, map->allocator->arg);
@@ -80,12 +111,10 @@ void clear_isc_hash_map(isc_hash_map_s * const map, set_fn const destroy_key, vo
     valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
     valid(map->allocator && "Allocator can't be NULL.");
 
-    // for each element since they are all layered continuosly in array
-    for (size_t i = 0; i < map->capacity; ++i) {
-        for (size_t n = map->head[i]; NIL != n; n = map->next[n]) {
-            destroy_key(map->keys + (n * map->key_size), adk);
-            destroy_value(map->values + (n * map->value_size), adv);
-        }
+    // for each element since they are all layered continuosly in array (nodes may be in old or current buckets)
+    for (size_t i = 0; i < map->length; ++i) {
+        destroy_key(map->keys + (i * map->key_size), adk);
+        destroy_value(map->values + (i * map->value_size), adv);
     }
 
     // free arrays
@@ -93,12 +122,13 @@ void clear_isc_hash_map(isc_hash_map_s * const map, set_fn const destroy_key, vo
     map->allocator->free(map->values, map->allocator->arg);
     map->allocator->free(map->hashes, map->allocator->arg);
     map->allocator->free(map->head, map->allocator->arg);
+    map->allocator->free(map->old_head, map->allocator->arg);
     map->allocator->free(map->next, map->allocator->arg);
     map->allocator->free(map->prev, map->allocator->arg);
 
     // only clear map (keep the map usable)
-    map->capacity = map->length = 0;
-    map->head = map->next = map->prev = map->hashes = NULL;
+    map->capacity = map->length = map->old_capacity = map->migrated = 0;
+    map->head = map->next = map->prev = map->hashes = map->old_head = NULL;
     map->keys = map->values = NULL;
 }
 
@@ -117,6 +147,8 @@ isc_hash_map_s copy_isc_hash_map(isc_hash_map_s const * const map, copy_fn const
     isc_hash_map_s const replica = {
         .capacity = map->capacity, .hash_key = map->hash_key, .length = map->length, .ack = map->ack, .ahk = map->ahk,
         .key_size = map->key_size, .value_size = map->value_size, .compare_key = map->compare_key,
+        .indexing = map->indexing, .incremental = map->incremental, .growth = map->growth,
+        .old_capacity = map->old_capacity, .migrated = map->migrated,
 
         .keys = map->allocator->alloc(map->capacity * map->key_size, map->allocator->arg),
         .values = map->allocator->alloc(map->capacity * map->value_size, map->allocator->arg),
@@ -125,6 +157,7 @@ isc_hash_map_s copy_isc_hash_map(isc_hash_map_s const * const map, copy_fn const
         .head = map->allocator->alloc(map->capacity * sizeof(size_t), map->allocator->arg),
         .next = map->allocator->alloc(map->capacity * sizeof(size_t), map->allocator->arg),
         .prev = map->allocator->alloc(map->capacity * sizeof(size_t), map->allocator->arg),
+        .old_head = map->old_head ? map->allocator->alloc(map->old_capacity * sizeof(size_t), map->allocator->arg) : NULL,
 
         .allocator = map->allocator,
     };
@@ -134,8 +167,12 @@ isc_hash_map_s copy_isc_hash_map(isc_hash_map_s const * const map, copy_fn const
     error((!replica.capacity || replica.head) && "Memory allocation failed.");
     error((!replica.capacity || replica.next) && "Memory allocation failed.");
     error((!replica.capacity || replica.prev) && "Memory allocation failed.");
+    error((!map->old_head || replica.old_head) && "Memory allocation failed.");
 
     memcpy(replica.head, map->head, map->capacity * sizeof(size_t)); // capacity since heads can't be move
+    if (map->old_head) { // copy old buckets too if structure is still being rehashed
+        memcpy(replica.old_head, map->old_head, map->old_capacity * sizeof(size_t));
+    }
 
     memcpy(replica.next, map->next, map->length * sizeof(size_t));
     memcpy(replica.prev, map->prev, map->length * sizeof(size_t));
@@ -161,6 +198,111 @@ bool is_empty_isc_hash_map(isc_hash_map_s const * const map) {
     return !(map->length); // if 0 return 'true'
 }
 
+void growth_isc_hash_map(isc_hash_map_s * const map, growth_s const growth) {
+    error(map && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    map->growth = growth;
+}
+
+void reserve_isc_hash_map(isc_hash_map_s * const map, size_t const capacity) {
+    error(map && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    // account for load factor so that inserting capacity elements won't trigger an expansion
+    size_t const size = capacity ? _isc_hash_map_round(map, (size_t)((double)(capacity) / ISC_HASH_MAP_LOAD) + 1) : 0;
+    if (size > map->capacity) {
+        _isc_hash_map_resize(map, size);
+    }
+}
+
+void shrink_to_fit_isc_hash_map(isc_hash_map_s * const map) {
+    error(map && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    size_t const capacity = _isc_hash_map_round(map, map->length);
+    if (capacity != map->capacity) {
+        _isc_hash_map_resize(map, capacity);
+    }
+}
+
+void reindex_isc_hash_map(isc_hash_map_s * const map, index_e const indexing) {
+    error(map && "Parameter can't be NULL.");
+    error((MODULO_INDEX == indexing || MASK_INDEX == indexing) && "Invalid indexing mode.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    map->indexing = indexing;
+
+    // rehash lists since bucket indexes (and possibly capacity) change with new mode
+    if (map->capacity) {
+        _isc_hash_table_resize(map, _isc_hash_map_round(map, map->capacity));
+    }
+}
+
+void incremental_isc_hash_map(isc_hash_map_s * const map, bool const incremental) {
+    error(map && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    map->incremental = incremental;
+
+    if (!incremental) { // finish pending rehash since operations won't migrate buckets anymore
+        _isc_hash_map_migrate(map, map->old_capacity);
+    }
+}
+
+size_t pending_rehash_isc_hash_map(isc_hash_map_s const * const map) {
+    error(map && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->migrated <= map->old_capacity && "Migrated buckets can't exceed old capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    return map->old_capacity - map->migrated;
+}
+
+void finish_rehash_isc_hash_map(isc_hash_map_s * const map) {
+    error(map && "Parameter can't be NULL.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    _isc_hash_map_migrate(map, map->old_capacity);
+}
+
 void insert_isc_hash_map(isc_hash_map_s * const map, void const * const key, void const * const value) {
     error(map && "Parameter can't be NULL.");
     error(key && "Parameter can't be NULL.");
@@ -175,20 +317,22 @@ void insert_isc_hash_map(isc_hash_map_s * const map, void const * const key, voi
     valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
     valid(map->allocator && "Allocator can't be NULL.");
 
+    _isc_hash_map_migrate(map, ISC_HASH_MAP_STEP);
+
     // resize (expand) if load factor was exceeded
     double const load = (double)(map->length) / (double)(map->capacity);
     if (!map->capacity || load >= ISC_HASH_MAP_LOAD) {
-        size_t const capacity = map->length ? map->length * CERPEC_FACTOR : ISC_HASH_MAP_CHUNK;
-        _isc_hash_table_resize(map, capacity);
+        size_t const capacity = expand_growth(&(map->growth), map->length);
+        _isc_hash_map_resize(map, _isc_hash_map_round(map, capacity));
     }
 
-    // calculate hash values and index in array
+    // calculate hash values and bucket in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->capacity;
+    size_t * const bucket = _isc_hash_map_bucket(map, hash);
 
 #ifndef NERROR
     // check if element is in map or not
-    for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
+    for (size_t n = (*bucket); NIL != n; n = map->next[n]) {
         void const * const current_key = map->keys + (n * map->key_size);
         error((hash != map->hashes[n] || map->compare_key(key, current_key, map->ack)) && "Key must be unique.");
     }
@@ -197,7 +341,7 @@ void insert_isc_hash_map(isc_hash_map_s * const map, void const * const key, voi
     size_t const current = map->length; // index of currently inserted element
 
     // if head has an element then redirect its prev to current
-    size_t const head = map->head[index];
+    size_t const head = (*bucket);
     if (NIL != head) {
         map->prev[head] = current;
     }
@@ -205,7 +349,7 @@ void insert_isc_hash_map(isc_hash_map_s * const map, void const * const key, voi
     // node index redirection
     map->prev[current] = NIL;
     map->next[current] = head;
-    map->head[index] = current;
+    (*bucket) = current;
 
     // copy element into elements array
     map->hashes[current] = hash;
@@ -238,11 +382,12 @@ void remove_isc_hash_map(isc_hash_map_s * const map, void const * const key, voi
     valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
     valid(map->allocator && "Allocator can't be NULL.");
 
+    _isc_hash_map_migrate(map, ISC_HASH_MAP_STEP);
+
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->capacity;
 
-    for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
+    for (size_t n = (*_isc_hash_map_bucket(map, hash)); NIL != n; n = map->next[n]) {
         const char * current_key = map->keys + (n * map->key_size);
         if (hash != map->hashes[n] || map->compare_key(key, current_key, map->ack)) { // if not equal contionue
             continue;
@@ -256,8 +401,9 @@ void remove_isc_hash_map(isc_hash_map_s * const map, void const * const key, voi
         _isc_hash_map_fill_hole(map, n);
 
         // resize (expand) if map can contain a smaller capacity of elements
-        if (map->length <= map->capacity / CERPEC_FACTOR && (map->length > ISC_HASH_MAP_CHUNK || !map->length)) {
-            _isc_hash_table_resize(map, map->length);
+        size_t const capacity = _isc_hash_map_round(map, shrink_growth(&(map->growth), map->length, map->capacity));
+        if (capacity != map->capacity) {
+            _isc_hash_map_resize(map, capacity);
         }
 
         return; // return to avoid errorion and termination at the end of function if element wasn't found
@@ -283,10 +429,9 @@ bool contains_key_isc_hash_map(isc_hash_map_s const * const map, void const * co
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->capacity;
 
     // for each node at index check if element is contained and return true or false
-    for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
+    for (size_t n = (*_isc_hash_map_bucket(map, hash)); NIL != n; n = map->next[n]) {
         void const * const current_key = map->keys + (n * map->key_size);
         if (hash == map->hashes[n] && !map->compare_key(key, current_key, map->ack)) {
             return true;
@@ -314,10 +459,9 @@ void get_value_isc_hash_map(isc_hash_map_s const * const map, void const * const
 
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
-    size_t const index = hash % map->capacity;
 
     // for each node at index check if element is contained
-    for (size_t n = map->head[index]; NIL != n; n = map->next[n]) {
+    for (size_t n = (*_isc_hash_map_bucket(map, hash)); NIL != n; n = map->next[n]) {
         char const * current_key = map->keys + (n * map->key_size);
         if (hash == map->hashes[n] && !map->compare_key(key, current_key, map->ack)) {
             memcpy(value_buffer, map->values + (n * map->value_size), map->value_size); // copy retrieved element into buffer
@@ -329,6 +473,59 @@ void get_value_isc_hash_map(isc_hash_map_s const * const map, void const * const
     exit(EXIT_FAILURE); // terminate on error
 }
 
+void get_values_isc_hash_map(isc_hash_map_s const * const map, void const * const keys, size_t const count, void * const values_buffer) {
+    error(map && "Parameter can't be NULL.");
+    error((!count || keys) && "Parameter can't be NULL.");
+    error((!count || values_buffer) && "Parameter can't be NULL.");
+    error(keys != values_buffer && "Parameters can't be the same.");
+    error((!count || map->length) && "Structure is empty.");
+
+    valid(map->hash_key && "Hash function can't be NULL.");
+    valid(map->key_size && "Key size can't be zero.");
+    valid(map->value_size && "Value size can't be zero.");
+    valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
+    valid(map->allocator && "Allocator can't be NULL.");
+
+    char const * const key_array = keys;
+    char * const value_array = values_buffer;
+
+    size_t hashes[CERPEC_BATCH], * buckets[CERPEC_BATCH];
+    for (size_t b = 0; b < count; b += CERPEC_BATCH) {
+        size_t const batch = count - b < CERPEC_BATCH ? count - b : CERPEC_BATCH;
+
+        // hash batch of keys first and prefetch their heads so misses overlap
+        for (size_t i = 0; i < batch; ++i) {
+            hashes[i] = map->hash_key(key_array + ((b + i) * map->key_size), map->ahk);
+            buckets[i] = _isc_hash_map_bucket(map, hashes[i]);
+            prefetch(buckets[i]);
+        }
+
+        // prefetch first node of each list since its hash and key are compared first
+        for (size_t i = 0; i < batch; ++i) {
+            size_t const n = (*buckets[i]);
+            if (NIL != n) {
+                prefetch(map->hashes + n);
+                prefetch(map->keys + (n * map->key_size));
+            }
+        }
+
+        // resolve lists with hopefully cached heads and nodes
+        for (size_t i = 0; i < batch; ++i) {
+            char const * const key = key_array + ((b + i) * map->key_size);
+
+            size_t n = (*buckets[i]);
+            while (NIL != n && (hashes[i] != map->hashes[n] || map->compare_key(key, map->keys + (n * map->key_size), map->ack))) {
+                n = map->next[n];
+            }
+
+            error(NIL != n && "Structure does not contain key.");
+            if (NIL == n) { exit(EXIT_FAILURE); } // terminate on error
+
+            memcpy(value_array + ((b + i) * map->value_size), map->values + (n * map->value_size), map->value_size);
+        }
+    }
+}
+
 void set_isc_hash_map(isc_hash_map_s * const map, void const * const key, void const * const value, void * const value_buffer) {
     error(map && "Parameter can't be NULL.");
     error(key && "Parameter can't be NULL.");
@@ -350,13 +547,15 @@ void set_isc_hash_map(isc_hash_map_s * const map, void const * const key, void c
     valid(map->length <= map->capacity && "Lenght can't be larger than capacity.");
     valid(map->allocator && "Allocator can't be NULL.");
 
+    _isc_hash_map_migrate(map, ISC_HASH_MAP_STEP);
+
     // calculate hash values and index in array
     size_t const hash = map->hash_key(key, map->ahk);
 
     if (!map->capacity) { goto INSERT; }
 
     // for each node at index check if element is contained
-    for (size_t n = map->head[hash % map->capacity]; NIL != n; n = map->next[n]) {
+    for (size_t n = (*_isc_hash_map_bucket(map, hash)); NIL != n; n = map->next[n]) {
         char const * current_key = map->keys + (n * map->key_size);
 
         if (hash == map->hashes[n] && !map->compare_key(key, current_key, map->ack)) {
@@ -371,16 +570,16 @@ INSERT:
     // resize (expand) if map can't contain new element
     double const load = (double)(map->length) / (double)(map->capacity);
     if (!map->capacity || load >= ISC_HASH_MAP_LOAD) {
-        size_t const capacity = map->length ? map->length * CERPEC_FACTOR : ISC_HASH_MAP_CHUNK;
-        _isc_hash_table_resize(map, capacity);
+        size_t const capacity = expand_growth(&(map->growth), map->length);
+        _isc_hash_map_resize(map, _isc_hash_map_round(map, capacity));
     }
 
-    size_t const index = hash % map->capacity;
+    size_t * const bucket = _isc_hash_map_bucket(map, hash);
 
     size_t const current = map->length; // index of currently inserted element
 
     // if head has an element then redirect its prev to current
-    size_t const head = map->head[index];
+    size_t const head = (*bucket);
     if (NIL != head) {
         map->prev[head] = current;
     }
@@ -388,7 +587,7 @@ INSERT:
     // node index redirection
     map->prev[current] = NIL;
     map->next[current] = head;
-    map->head[index] = current;
+    (*bucket) = current;
 
     // copy element into elements array
     map->hashes[current] = hash;
@@ -458,11 +657,16 @@ void _isc_hash_table_resize(isc_hash_map_s * const table, size_t const size) {
     table->hashes = table->allocator->realloc(table->hashes, size * sizeof(size_t), table->allocator->arg);
     error((!table->capacity || table->hashes) && "Memory allocation failed.");
 
+    // drop old buckets of incremental rehash, since every node gets relinked anyway
+    table->allocator->free(table->old_head, table->allocator->arg);
+    table->old_head = NULL;
+    table->old_capacity = table->migrated = 0;
+
     for (size_t i = 0; i < table->capacity; ++i) { table->head[i] = NIL; }
 
     // reset lists by pushing hashes to their valid list
     for (size_t i = 0; i < table->length; ++i) {
-        size_t const index = table->hashes[i] % table->capacity;
+        size_t const index = _isc_hash_map_index(table, table->hashes[i], table->capacity);
 
         size_t const head = table->head[index];
         if (NIL != head) {
@@ -476,32 +680,128 @@ void _isc_hash_table_resize(isc_hash_map_s * const table, size_t const size) {
     }
 }
 
-void _isc_hash_map_fill_hole(isc_hash_map_s const * const map, size_t const hole) {
-    if (NIL == map->prev[map->length]) {
-        size_t const index = map->hashes[map->length] % map->capacity;
-        map->head[index] = hole;
+void _isc_hash_map_resize(isc_hash_map_s * const map, size_t const size) {
+    // empty or freed structures have nothing to migrate, so they get resized at once
+    if (!map->incremental || !map->capacity || !size) {
+        _isc_hash_table_resize(map, size);
+        return;
+    }
+
+    // only two bucket arrays can coexist, so previous rehash must be finished first
+    _isc_hash_map_migrate(map, map->old_capacity);
+
+    map->next = map->allocator->realloc(map->next, size * sizeof(size_t), map->allocator->arg);
+    error(map->next && "Memory allocation failed.");
+
+    map->prev = map->allocator->realloc(map->prev, size * sizeof(size_t), map->allocator->arg);
+    error(map->prev && "Memory allocation failed.");
+
+    map->keys = map->allocator->realloc(map->keys, size * map->key_size, map->allocator->arg);
+    error(map->keys && "Memory allocation failed.");
+
+    map->values = map->allocator->realloc(map->values, size * map->value_size, map->allocator->arg);
+    error(map->values && "Memory allocation failed.");
+
+    map->hashes = map->allocator->realloc(map->hashes, size * sizeof(size_t), map->allocator->arg);
+    error(map->hashes && "Memory allocation failed.");
+
+    // keep current buckets as old ones and start with new empty buckets
+    map->old_head = map->head;
+    map->old_capacity = map->capacity;
+    map->migrated = 0;
+
+    map->head = map->allocator->alloc(size * sizeof(size_t), map->allocator->arg);
+    error(map->head && "Memory allocation failed.");
+
+    map->capacity = size;
+    for (size_t i = 0; i < map->capacity; ++i) { map->head[i] = NIL; }
+}
+
+void _isc_hash_map_migrate(isc_hash_map_s * const map, size_t const count) {
+    if (!map->old_head) { return; }
+
+    size_t const end = map->old_capacity - map->migrated > count ? map->migrated + count : map->old_capacity;
+    for (; map->migrated < end; map->migrated++) {
+        // push each node in old bucket to its valid current list
+        for (size_t n = map->old_head[map->migrated], next = NIL; NIL != n; n = next) {
+            next = map->next[n];
+
+            size_t const index = _isc_hash_map_index(map, map->hashes[n], map->capacity);
+
+            size_t const head = map->head[index];
+            if (NIL != head) {
+                map->prev[head] = n;
+            }
+
+            // node index redirection
+            map->prev[n] = NIL;
+            map->next[n] = head;
+            map->head[index] = n;
+        }
+    }
+
+    if (map->migrated == map->old_capacity) { // free old buckets since all were migrated
+        map->allocator->free(map->old_head, map->allocator->arg);
+        map->old_head = NULL;
+        map->old_capacity = map->migrated = 0;
+    }
+}
+
+size_t * _isc_hash_map_bucket(isc_hash_map_s const * const map, size_t const hash) {
+    if (map->old_head) { // if old bucket wasn't yet migrated then hash's list is still there
+        size_t const index = _isc_hash_map_index(map, hash, map->old_capacity);
+        if (index >= map->migrated) {
+            return map->old_head + index;
+        }
+    }
+
+    return map->head + _isc_hash_map_index(map, hash, map->capacity);
+}
+
+size_t _isc_hash_map_index(isc_hash_map_s const * const map, size_t const hash, size_t const capacity) {
+    if (MODULO_INDEX == map->indexing) {
+        return hash % capacity;
+    }
+
+    // mix hash so that weak hashes (like identity) don't only depend on their low bits, then mask
+    uint64_t mix = (uint64_t)(hash);
+    mix ^= mix >> 32;
+    mix *= (uint64_t)(0xd6e8feb86659fd93);
+    mix ^= mix >> 32;
+
+    return (size_t)(mix) & (capacity - 1);
+}
+
+size_t _isc_hash_map_round(isc_hash_map_s const * const map, size_t const size) {
+    if (MODULO_INDEX == map->indexing || !size) {
+        return size;
     }
 
-    if (NIL == map->prev[hole]) {
-        size_t const index = map->hashes[hole] % map->capacity;
-        map->head[index] = map->next[hole];
+    size_t capacity = 1;
+    while (capacity < size) {
+        capacity <<= 1;
     }
 
+    return capacity;
+}
+
+void _isc_hash_map_fill_hole(isc_hash_map_s const * const map, size_t const hole) {
     // cut current removed node's siblings from itself
     if (NIL != map->prev[hole]) { map->next[map->prev[hole]] = map->next[hole]; }
+    else { (*_isc_hash_map_bucket(map, map->hashes[hole])) = map->next[hole]; }
     if (NIL != map->next[hole]) { map->prev[map->next[hole]] = map->prev[hole]; }
 
-    // cut current removed node from its siblings
-    map->next[hole] = map->prev[hole] = hole;
+    if (hole == map->length) { return; } // removed node was the last one, so there is no hole to fill
+
+    // redirect array's last node's siblings (or head) to hole
+    if (NIL != map->prev[map->length]) { map->next[map->prev[map->length]] = hole; }
+    else { (*_isc_hash_map_bucket(map, map->hashes[map->length])) = hole; }
+    if (NIL != map->next[map->length]) { map->prev[map->next[map->length]] = hole; }
 
     // replace element at current index with popped last element like in a stack
-    memmove(map->keys + (hole * map->key_size), map->keys + (map->length * map->key_size), map->key_size);
-    memmove(map->values + (hole * map->value_size), map->values + (map->length * map->value_size), map->value_size);
+    memcpy(map->keys + (hole * map->key_size), map->keys + (map->length * map->key_size), map->key_size);
+    memcpy(map->values + (hole * map->value_size), map->values + (map->length * map->value_size), map->value_size);
     map->hashes[hole] = map->hashes[map->length];
     map->next[hole] = map->next[map->length];
     map->prev[hole] = map->prev[map->length];
-
-    // redirect array's last swapped node's siblings to hole
-    if (NIL != map->next[map->length]) { map->prev[map->next[map->length]] = hole; }
-    if (NIL != map->prev[map->length]) { map->next[map->prev[map->length]] = hole; }
 }
@@ -2,6 +2,16 @@
 
 #include <string.h>
 
+/// @brief Gets spare node if there is one, else allocates a new node.
+/// @param deque Structure to get node for.
+/// @return Deque node.
+struct infinite_deque_node * _ideque_node(ideque_s * const deque);
+
+/// @brief Keeps drained node as spare if cache isn't full, else frees it.
+/// @param deque Structure to release node from.
+/// @param node Drained node to release.
+void _ideque_release(ideque_s * const deque, struct infinite_deque_node * const node);
+
 ideque_s create_ideque(size_t const size) {
     error(size && "Parameter can't be zero.");
 
@@ -38,6 +48,12 @@ void destroy_ideque(ideque_s * const deque, set_fn const destroy, void * const a
         deque->allocator->free(temp, deque->allocator->arg); // free temporary current node
     }
 
+    // free spare nodes kept for reuse
+    for (struct infinite_deque_node * spare = deque->spare, * next = NULL; spare; spare = next) {
+        next = spare->next;
+        deque->allocator->free(spare, deque->allocator->arg);
+    }
+
     // set everything to zero
     memset(deque, 0, sizeof(ideque_s));
 }
@@ -62,7 +78,7 @@ void clear_ideque(ideque_s * const deque, set_fn const destroy, void * const ad)
         struct infinite_deque_node * temp = current; // save current node as temporary to free later
         current = current->next; // go to next node
 
-        deque->allocator->free(temp, deque->allocator->arg); // free temporary current node
+        _ideque_release(deque, temp); // release temporary current node
     }
 
     deque->current = deque->length = 0;
@@ -79,6 +95,7 @@ ideque_s copy_ideque(ideque_s const * const deque, copy_fn const copy, void * co
 
     ideque_s replica = {
         .current = deque->current, .size = deque->size, .length = deque->length, .allocator = deque->allocator,
+        .cache = deque->cache,
     };
 
     struct infinite_deque_node const * current_deque = deque->head; // save head index as current node
@@ -122,6 +139,26 @@ bool is_empty_ideque(ideque_s const * const deque) {
     return (deque->length == 0);
 }
 
+void cache_ideque(ideque_s * const deque, size_t const cache) {
+    error(deque && "Parameter is NULL.");
+
+    valid(deque->size && "Size can't be zero.");
+    valid(deque->allocator && "Allocator can't be NULL.");
+    valid(deque->current < IDEQUE_CHUNK && "Current exceeds chunk.");
+    valid(deque->spares <= deque->cache && "Spares can't exceed cache.");
+
+    deque->cache = cache;
+
+    // free spare nodes that don't fit into smaller cache
+    while (deque->spares > deque->cache) {
+        struct infinite_deque_node * spare = deque->spare;
+        deque->spare = spare->next;
+        deque->spares--;
+
+        deque->allocator->free(spare, deque->allocator->arg);
+    }
+}
+
 void enqueue_front_ideque(ideque_s * const deque, void const * const element) {
     error(deque && "Parameter is NULL.");
     error(element && "Parameter is NULL.");
@@ -134,10 +171,7 @@ void enqueue_front_ideque(ideque_s * const deque, void const * const element) {
     if (!(deque->current)) { // if deque's previous current 'underflows' in node array due to inserting element to front
         deque->current = IDEQUE_CHUNK; // make current into list array chunk size to prevent future underflow
 
-        // allocate node for replica
-        struct infinite_deque_node * node = deque->allocator->alloc(sizeof(struct infinite_deque_node) +
-            (IDEQUE_CHUNK * deque->size), deque->allocator->arg);
-        error(node && "Memory allocation failed.");
+        struct infinite_deque_node * node = _ideque_node(deque);
 
         if (deque->head) { // if head exists
             node->next = deque->head; // node's next is head
@@ -165,9 +199,7 @@ void enqueue_back_ideque(ideque_s * const deque, void const * const element) {
 
     size_t const next_index = ((deque->current + deque->length) % IDEQUE_CHUNK);
     if (!next_index) { // if next index to insert into is zero
-        struct infinite_deque_node * node = deque->allocator->alloc(sizeof(struct infinite_deque_node) +
-            (IDEQUE_CHUNK * deque->size), deque->allocator->arg);
-        error(node && "Memory allocation failed.");
+        struct infinite_deque_node * node = _ideque_node(deque);
 
         if (deque->head) { // if head exists
             node->next = deque->head; // node's next is head
@@ -239,7 +271,7 @@ void dequeue_front_ideque(ideque_s * const deque, void * const buffer) {
         deque->head = deque->length ? deque->head->next : NULL;
         deque->current = 0; // reset current index to zero/beginning
 
-        deque->allocator->free(head, deque->allocator->arg); // free temporary head node
+        _ideque_release(deque, head); // release temporary head node
     }
 }
 
@@ -260,7 +292,7 @@ void dequeue_back_ideque(ideque_s * const deque, void * const buffer) {
     memcpy(buffer, deque->head->prev->elements + (back_index * deque->size), deque->size);
 
     if (!deque->length) {
-        deque->allocator->free(deque->head, deque->allocator->arg); // free head node
+        _ideque_release(deque, deque->head); // release head node
 
         deque->current = 0; // reset current index to 0 if deque is empty
         deque->head = NULL;
@@ -270,7 +302,7 @@ void dequeue_back_ideque(ideque_s * const deque, void * const buffer) {
         deque->head->prev = tail->prev; // head's tail pointer equals tail's previous
         tail->prev->next = deque->head; // tail previous' next equals head
 
-        deque->allocator->free(tail, deque->allocator->arg); // free temporary tail node
+        _ideque_release(deque, tail); // release temporary tail node
     }
 }
 
@@ -376,3 +408,31 @@ void apply_ideque(ideque_s const * const deque, process_fn const process, void *
 
     deque->allocator->free(elements_array, deque->allocator->arg);
 }
+
+struct infinite_deque_node * _ideque_node(ideque_s * const deque) {
+    if (deque->spare) { // reuse spare node instead of allocating it
+        struct infinite_deque_node * node = deque->spare;
+        deque->spare = node->next;
+        deque->spares--;
+
+        return node;
+    }
+
+    struct infinite_deque_node * node = deque->allocator->alloc(sizeof(struct infinite_deque_node) +
+        (IDEQUE_CHUNK * deque->size), deque->allocator->arg);
+    error(node && "Memory allocation failed.");
+
+    return node;
+}
+
+void _ideque_release(ideque_s * const deque, struct infinite_deque_node * const node) {
+    if (deque->spares < deque->cache) { // keep node as spare if cache has space
+        node->next = deque->spare;
+        deque->spare = node;
+        deque->spares++;
+
+        return;
+    }
+
+    deque->allocator->free(node, deque->allocator->arg);
+}
@@ -2,6 +2,16 @@
 
 #include <string.h>
 
+/// @brief Gets spare node if there is one, else allocates a new node.
+/// @param queue Structure to get node for.
+/// @return Queue node.
+struct infinite_queue_node * _iqueue_node(iqueue_s * const queue);
+
+/// @brief Keeps drained node as spare if cache isn't full, else frees it.
+/// @param queue Structure to release node from.
+/// @param node Drained node to release.
+void _iqueue_release(iqueue_s * const queue, struct infinite_queue_node * const node);
+
 iqueue_s create_iqueue(size_t const size) {
     error(size && "Parameter can't be zero.");
 
@@ -41,6 +51,12 @@ void destroy_iqueue(iqueue_s * const queue, set_fn const destroy, void * const a
         queue->allocator->free(temp, queue->allocator->arg);
     }
 
+    // free spare nodes kept for reuse
+    for (struct infinite_queue_node * spare = queue->spare, * next = NULL; spare; spare = next) {
+        next = spare->next;
+        queue->allocator->free(spare, queue->allocator->arg);
+    }
+
     // set everything to zero
     memset(queue, 0, sizeof(iqueue_s));
 }
@@ -67,8 +83,8 @@ void clear_iqueue(iqueue_s * const queue, set_fn const destroy, void * const ad)
         struct infinite_queue_node * temp = previous->next;
         previous->next = previous->next->next;
 
-        // free destroyed node
-        queue->allocator->free(temp, queue->allocator->arg);
+        // release destroyed node
+        _iqueue_release(queue, temp);
     }
 
     queue->current = queue->length = 0;
@@ -86,6 +102,7 @@ iqueue_s copy_iqueue(iqueue_s const * const queue, copy_fn const copy, void * co
     // create properly initialized replica
     iqueue_s replica = {
         .size = queue->size, .length = queue->length, .current = queue->current, .allocator = queue->allocator,
+        .cache = queue->cache,
     };
 
     // set original queue's and replica's current nodes for iteration
@@ -141,6 +158,26 @@ void peek_iqueue(iqueue_s const * const queue, void * const buffer) {
     memcpy(buffer, queue->tail->next->elements + (queue->current * queue->size), queue->size);
 }
 
+void cache_iqueue(iqueue_s * const queue, size_t const cache) {
+    error(queue && "Parameter can't be NULL.");
+
+    valid(queue->size && "Size can't be zero.");
+    valid(queue->allocator && "Allocator can't be NULL.");
+    valid(queue->current < IQUEUE_CHUNK && "Current exceeds chunk.");
+    valid(queue->spares <= queue->cache && "Spares can't exceed cache.");
+
+    queue->cache = cache;
+
+    // free spare nodes that don't fit into smaller cache
+    while (queue->spares > queue->cache) {
+        struct infinite_queue_node * spare = queue->spare;
+        queue->spare = spare->next;
+        queue->spares--;
+
+        queue->allocator->free(spare, queue->allocator->arg);
+    }
+}
+
 void enqueue_iqueue(iqueue_s * const queue, void const * const element) {
     error(queue && "Parameter can't be NULL.");
     error(element && "Parameter can't be NULL.");
@@ -154,8 +191,7 @@ void enqueue_iqueue(iqueue_s * const queue, void const * const element) {
     // index where the next element will be enqueued
     size_t const next_index = (queue->current + queue->length) % IQUEUE_CHUNK;
     if (!next_index) { // if head list array is full (is divisible) adds new list element to head
-        struct infinite_queue_node * node = queue->allocator->alloc(sizeof(struct infinite_queue_node) + (IQUEUE_CHUNK * queue->size), queue->allocator->arg);
-        error(node && "Memory allocation failed");
+        struct infinite_queue_node * node = _iqueue_node(queue);
 
         if (queue->tail == NULL) {
             node->next = node; // create initial circle
@@ -186,7 +222,7 @@ void dequeue_iqueue(iqueue_s * const queue, void * const buffer) {
     queue->current = (queue->current + 1) % IQUEUE_CHUNK; // set current to next index in node array
 
     if (!queue->length) { // if queue is empty after extracting element thne free memory and reset everything to zero
-        queue->allocator->free(queue->tail, queue->allocator->arg); // free empty tail/head node
+        _iqueue_release(queue, queue->tail); // release empty tail/head node
 
         queue->current = 0; // if queue is empty make current index 0 to not break enqueue_iqueue operation
         queue->tail = NULL; // set tail to NULL
@@ -194,7 +230,7 @@ void dequeue_iqueue(iqueue_s * const queue, void * const buffer) {
         struct infinite_queue_node * head = queue->tail->next; // get empty head node
         queue->tail->next = queue->tail->next->next; // set new head node to its next node
 
-        queue->allocator->free(head, queue->allocator->arg); // free previous head node
+        _iqueue_release(queue, head); // release previous head node
     }
 }
 
@@ -263,3 +299,30 @@ void apply_iqueue(iqueue_s const * const queue, process_fn const process, void *
 
     queue->allocator->free(elements_array, queue->allocator->arg);
 }
+
+struct infinite_queue_node * _iqueue_node(iqueue_s * const queue) {
+    if (queue->spare) { // reuse spare node instead of allocating it
+        struct infinite_queue_node * node = queue->spare;
+        queue->spare = node->next;
+        queue->spares--;
+
+        return node;
+    }
+
+    struct infinite_queue_node * node = queue->allocator->alloc(sizeof(struct infinite_queue_node) + (IQUEUE_CHUNK * queue->size), queue->allocator->arg);
+    error(node && "Memory allocation failed");
+
+    return node;
+}
+
+void _iqueue_release(iqueue_s * const queue, struct infinite_queue_node * const node) {
+    if (queue->spares < queue->cache) { // keep node as spare if cache has space
+        node->next = queue->spare;
+        queue->spare = node;
+        queue->spares++;
+
+        return;
+    }
+
+    queue->allocator->free(node, queue->allocator->arg);
+}
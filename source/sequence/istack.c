@@ -10,14 +10,14 @@ void _istack_resize(istack_s * const stack, size_t const size);
 istack_s create_istack(size_t const size) {
     error(size && "Paremeter can't be zero.");
 
-    return (istack_s) { .size = size, .allocator = &standard };
+    return (istack_s) { .size = size, .growth = CERPEC_GROWTH(ISTACK_CHUNK), .allocator = &standard };
 }
 
 istack_s make_istack(size_t const size, memory_s const * const allocator) {
     error(size && "Paremeter can't be zero.");
     error(allocator && "Paremeter can't be NULL.");
 
-    return (istack_s) { .size = size, .allocator = allocator };
+    return (istack_s) { .size = size, .growth = CERPEC_GROWTH(ISTACK_CHUNK), .allocator = allocator };
 }
 
 void destroy_istack(istack_s * const stack, set_fn const destroy, void * const ad) {
@@ -67,6 +67,7 @@ istack_s copy_istack(istack_s const * const stack, copy_fn const copy, void * co
     // create replica to initialize and return
     istack_s const replica = {
         .capacity = stack->capacity, .length = stack->length, .size = stack->size, .allocator = stack->allocator,
+        .growth = stack->growth,
         .elements = stack->allocator->alloc(stack->capacity * stack->size, stack->allocator->arg),
     };
     error((!replica.capacity || replica.elements) && "Memory allocation failed.");
@@ -90,6 +91,43 @@ bool is_empty_istack(istack_s const * const stack) {
     return !(stack->length);
 }
 
+void growth_istack(istack_s * const stack, growth_s const growth) {
+    error(stack && "Paremeter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(stack->size && "Size can't be zero.");
+    valid(stack->length <= stack->capacity && "Length exceeds capacity.");
+    valid(stack->allocator && "Allocator can't be NULL.");
+
+    stack->growth = growth;
+}
+
+void reserve_istack(istack_s * const stack, size_t const capacity) {
+    error(stack && "Paremeter can't be NULL.");
+
+    valid(stack->size && "Size can't be zero.");
+    valid(stack->length <= stack->capacity && "Length exceeds capacity.");
+    valid(stack->allocator && "Allocator can't be NULL.");
+
+    if (capacity > stack->capacity) {
+        _istack_resize(stack, capacity);
+    }
+}
+
+void shrink_to_fit_istack(istack_s * const stack) {
+    error(stack && "Paremeter can't be NULL.");
+
+    valid(stack->size && "Size can't be zero.");
+    valid(stack->length <= stack->capacity && "Length exceeds capacity.");
+    valid(stack->allocator && "Allocator can't be NULL.");
+
+    if (stack->length != stack->capacity) {
+        _istack_resize(stack, stack->length);
+    }
+}
+
 void push_istack(istack_s * const stack, void const * const element) {
     error(stack && "Paremeter can't be NULL.");
     error(element && "Paremeter can't be NULL.");
@@ -100,8 +138,7 @@ void push_istack(istack_s * const stack, void const * const element) {
     valid(stack->allocator && "Allocator can't be NULL.");
 
     if (stack->length == stack->capacity) { // if length is equal to capacity the array must expand linearly
-        size_t const capacity = stack->length ? stack->length * CERPEC_FACTOR : ISTACK_CHUNK;
-        _istack_resize(stack, capacity);
+        _istack_resize(stack, expand_growth(&(stack->growth), stack->length));
     }
 
     // push element knowing the elements array can fit it
@@ -124,8 +161,9 @@ void pop_istack(istack_s * const stack, void * const buffer) {
     stack->length--;
     memcpy(buffer, stack->elements + (stack->length * stack->size), stack->size);
 
-    if (stack->length <= stack->capacity / CERPEC_FACTOR && (stack->length > ISTACK_CHUNK || !stack->length)) {
-        _istack_resize(stack, stack->length);
+    size_t const capacity = shrink_growth(&(stack->growth), stack->length, stack->capacity);
+    if (capacity != stack->capacity) {
+        _istack_resize(stack, capacity);
     }
 }
 
@@ -0,0 +1,300 @@
+#include <set/bitwise.h>
+
+// gcc and clang on x86 can compile AVX2 functions without global flags and check processor support at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#   define BITWISE_AVX2
+#   include <immintrin.h>
+#endif
+
+/// @brief Calculates the number of set (one) bits in word.
+/// @param word Word to count set bits.
+/// @return Number of set bits.
+size_t _bitwise_popcount(uint64_t const word);
+
+/// @brief Combines two word arrays with portable word loop.
+/// @param result Array to save combined words into.
+/// @param one First operand array.
+/// @param two Second operand array.
+/// @param words Number of words in every array.
+/// @param operation Operation to combine words with.
+/// @return Number of set bits in result array.
+size_t _bitwise_operate(uint64_t * const result, uint64_t const * const one, uint64_t const * const two, size_t const words, bitwise_e const operation);
+
+#ifdef BITWISE_AVX2
+
+/// @brief Checks if processor supports AVX2 instructions.
+/// @return 'true' if supported, 'false' otherwise.
+bool _bitwise_has_avx2(void);
+
+/// @brief Counts set bits in each byte of vector using nibble lookup table and sums them into four 64-bit lanes.
+/// @param vector Vector to count.
+/// @return Vector of four partial counts.
+__attribute__((target("avx2"))) __m256i _bitwise_count_avx2(__m256i const vector);
+
+/// @brief Combines two word arrays four words at a time with AVX2 instructions.
+/// @param result Array to save combined words into.
+/// @param one First operand array.
+/// @param two Second operand array.
+/// @param words Number of words in every array.
+/// @param operation Operation to combine words with.
+/// @return Number of set bits in result array.
+__attribute__((target("avx2"))) size_t _bitwise_operate_avx2(uint64_t * const result, uint64_t const * const one, uint64_t const * const two, size_t const words, bitwise_e const operation);
+
+/// @brief Counts set bits in word array four words at a time with AVX2 instructions.
+/// @param array Array of words to count.
+/// @param words Number of words in array.
+/// @return Number of set bits.
+__attribute__((target("avx2"))) size_t _bitwise_total_avx2(uint64_t const * const array, size_t const words);
+
+/// @brief Checks subset four words at a time with AVX2 instructions.
+/// @param superset Superset array to check with.
+/// @param subset Subset array to check from.
+/// @param words Number of words in both arrays.
+/// @return 'true' if subset, 'false' otherwise.
+__attribute__((target("avx2"))) bool _bitwise_is_subset_avx2(uint64_t const * const superset, uint64_t const * const subset, size_t const words);
+
+/// @brief Checks disjointness four words at a time with AVX2 instructions.
+/// @param one First array to check.
+/// @param two Second array to check.
+/// @param words Number of words in both arrays.
+/// @return 'true' if disjoint, 'false' otherwise.
+__attribute__((target("avx2"))) bool _bitwise_is_disjoint_avx2(uint64_t const * const one, uint64_t const * const two, size_t const words);
+
+#endif
+
+size_t operate_bitwise(uint64_t * const result, uint64_t const * const one, uint64_t const * const two, size_t const words, bitwise_e const operation) {
+    error((!words || result) && "Parameter can't be NULL.");
+    error((!words || one) && "Parameter can't be NULL.");
+    error((!words || two) && "Parameter can't be NULL.");
+
+#ifdef BITWISE_AVX2
+    if (_bitwise_has_avx2()) {
+        return _bitwise_operate_avx2(result, one, two, words, operation);
+    }
+#endif
+
+    return _bitwise_operate(result, one, two, words, operation);
+}
+
+size_t count_bitwise(uint64_t const * const array, size_t const words) {
+    error((!words || array) && "Parameter can't be NULL.");
+
+#ifdef BITWISE_AVX2
+    if (_bitwise_has_avx2()) {
+        return _bitwise_total_avx2(array, words);
+    }
+#endif
+
+    size_t count = 0;
+    for (size_t i = 0; i < words; ++i) {
+        count += _bitwise_popcount(array[i]);
+    }
+
+    return count;
+}
+
+bool is_subset_bitwise(uint64_t const * const superset, uint64_t const * const subset, size_t const words) {
+    error((!words || superset) && "Parameter can't be NULL.");
+    error((!words || subset) && "Parameter can't be NULL.");
+
+#ifdef BITWISE_AVX2
+    if (_bitwise_has_avx2()) {
+        return _bitwise_is_subset_avx2(superset, subset, words);
+    }
+#endif
+
+    // subset can't have a bit that isn't set in superset
+    for (size_t i = 0; i < words; ++i) {
+        if (subset[i] & ~(superset[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool is_disjoint_bitwise(uint64_t const * const one, uint64_t const * const two, size_t const words) {
+    error((!words || one) && "Parameter can't be NULL.");
+    error((!words || two) && "Parameter can't be NULL.");
+
+#ifdef BITWISE_AVX2
+    if (_bitwise_has_avx2()) {
+        return _bitwise_is_disjoint_avx2(one, two, words);
+    }
+#endif
+
+    for (size_t i = 0; i < words; ++i) {
+        if (one[i] & two[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t _bitwise_popcount(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__) // if either gcc or clang is used, '__builtin_popcount*' is supported
+    return (size_t)__builtin_popcountll(word);
+#else // else use parallel bit count that sums bits in pairs, nibbles and then bytes
+    uint64_t w = word - ((word >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return (size_t)((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+size_t _bitwise_operate(uint64_t * const result, uint64_t const * const one, uint64_t const * const two, size_t const words, bitwise_e const operation) {
+    size_t count = 0;
+
+    // separate loops per operation so the compiler can vectorize each one
+    switch (operation) {
+        case OR_BITWISE: {
+            for (size_t i = 0; i < words; ++i) {
+                result[i] = one[i] | two[i];
+                count += _bitwise_popcount(result[i]);
+            }
+            break;
+        }
+        case AND_BITWISE: {
+            for (size_t i = 0; i < words; ++i) {
+                result[i] = one[i] & two[i];
+                count += _bitwise_popcount(result[i]);
+            }
+            break;
+        }
+        case ANDNOT_BITWISE: {
+            for (size_t i = 0; i < words; ++i) {
+                result[i] = one[i] & ~(two[i]);
+                count += _bitwise_popcount(result[i]);
+            }
+            break;
+        }
+        case XOR_BITWISE: {
+            for (size_t i = 0; i < words; ++i) {
+                result[i] = one[i] ^ two[i];
+                count += _bitwise_popcount(result[i]);
+            }
+            break;
+        }
+        default: {
+            error(false && "Unknown bitwise operation.");
+        }
+    }
+
+    return count;
+}
+
+#ifdef BITWISE_AVX2
+
+bool _bitwise_has_avx2(void) {
+    return __builtin_cpu_supports("avx2");
+}
+
+__m256i _bitwise_count_avx2(__m256i const vector) {
+    // number of set bits for each of sixteen nibble values, repeated for both 128-bit lanes
+    __m256i const table = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+    );
+    __m256i const nibble = _mm256_set1_epi8(0x0F);
+
+    // look up low and high nibble counts of each byte, then sum bytes of each 64-bit lane
+    __m256i const low = _mm256_shuffle_epi8(table, _mm256_and_si256(vector, nibble));
+    __m256i const high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(vector, 4), nibble));
+
+    return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256());
+}
+
+size_t _bitwise_operate_avx2(uint64_t * const result, uint64_t const * const one, uint64_t const * const two, size_t const words, bitwise_e const operation) {
+    size_t const vectors = words / 4; // four 64-bit words per 256-bit vector
+    __m256i total = _mm256_setzero_si256();
+
+    for (size_t i = 0; i < vectors; ++i) {
+        __m256i const a = _mm256_loadu_si256((__m256i const *)(one + (4 * i)));
+        __m256i const b = _mm256_loadu_si256((__m256i const *)(two + (4 * i)));
+
+        __m256i combined;
+        switch (operation) {
+            case OR_BITWISE:     { combined = _mm256_or_si256(a, b);     break; }
+            case AND_BITWISE:    { combined = _mm256_and_si256(a, b);    break; }
+            case ANDNOT_BITWISE: { combined = _mm256_andnot_si256(b, a); break; }
+            case XOR_BITWISE:    { combined = _mm256_xor_si256(a, b);    break; }
+            default:             { error(false && "Unknown bitwise operation."); combined = a; }
+        }
+
+        _mm256_storeu_si256((__m256i *)(result + (4 * i)), combined);
+        total = _mm256_add_epi64(total, _bitwise_count_avx2(combined));
+    }
+
+    // sum four lane counts and leave remaining words to portable loop
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    size_t const count = (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+    size_t const done = 4 * vectors;
+    return count + _bitwise_operate(result + done, one + done, two + done, words - done, operation);
+}
+
+size_t _bitwise_total_avx2(uint64_t const * const array, size_t const words) {
+    size_t const vectors = words / 4;
+    __m256i total = _mm256_setzero_si256();
+
+    for (size_t i = 0; i < vectors; ++i) {
+        total = _mm256_add_epi64(total, _bitwise_count_avx2(_mm256_loadu_si256((__m256i const *)(array + (4 * i)))));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    size_t count = (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+    for (size_t i = 4 * vectors; i < words; ++i) {
+        count += _bitwise_popcount(array[i]);
+    }
+
+    return count;
+}
+
+bool _bitwise_is_subset_avx2(uint64_t const * const superset, uint64_t const * const subset, size_t const words) {
+    size_t const vectors = words / 4;
+    for (size_t i = 0; i < vectors; ++i) {
+        __m256i const super = _mm256_loadu_si256((__m256i const *)(superset + (4 * i)));
+        __m256i const sub = _mm256_loadu_si256((__m256i const *)(subset + (4 * i)));
+
+        // 'testc' is set only if every bit of subset is also set in superset
+        if (!_mm256_testc_si256(super, sub)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 4 * vectors; i < words; ++i) {
+        if (subset[i] & ~(superset[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool _bitwise_is_disjoint_avx2(uint64_t const * const one, uint64_t const * const two, size_t const words) {
+    size_t const vectors = words / 4;
+    for (size_t i = 0; i < vectors; ++i) {
+        __m256i const a = _mm256_loadu_si256((__m256i const *)(one + (4 * i)));
+        __m256i const b = _mm256_loadu_si256((__m256i const *)(two + (4 * i)));
+
+        // 'testz' is set only if ANDed vectors are all zero
+        if (!_mm256_testz_si256(a, b)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 4 * vectors; i < words; ++i) {
+        if (one[i] & two[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif
@@ -3,20 +3,25 @@
 #include <string.h>
 #include <limits.h>
 
-#define BIT_COUNT (sizeof(unsigned) * CHAR_BIT)
+#define BIT_COUNT BITWISE_WORD
 
-/// @brief Calculates the number of set (one) bits in unsigned integer.
-/// @param bits Unsigned integer to count set bits.
-/// @return Number of set bits.
-int _fbitwise_set_popcount(unsigned const bits);
+/// @brief Calculates number of words needed to store maximum bits.
+/// @param max Maximum length of structure.
+/// @return Number of words.
+size_t _fbitwise_set_words(size_t const max);
+
+/// @brief Combines two structures word by word into a new structure with first structure's maximum.
+/// @param one First structure to combine, its words beyond second structure's maximum are copied.
+/// @param two Second structure to combine.
+/// @param operation Operation to combine words with.
+/// @return New structure.
+fbitwise_set_s _fbitwise_set_operate(fbitwise_set_s const * const one, fbitwise_set_s const * const two, bitwise_e const operation);
 
 fbitwise_set_s create_fbitwise_set(size_t const max) {
     error(max && "Parameter can't be zero.");
 
-    // ceil to closest multiple of CHAR_BIT (usually 8)
-    size_t const mod = max % CHAR_BIT;
-    size_t const ceil = mod ? max - mod + CHAR_BIT : max;
-    size_t const size = ceil / CHAR_BIT;
+    // ceil to closest multiple of word bits
+    size_t const size = _fbitwise_set_words(max) * sizeof(uint64_t);
 
     // create structure with allocated memory based on bits
     fbitwise_set_s const set = {
@@ -34,10 +39,8 @@ fbitwise_set_s make_fbitwise_set(size_t const max, memory_s const * const alloca
     error(max && "Parameter can't be zero.");
     error(allocator && "Parameter can't be NULL.");
 
-    // ceil to closest multiple of BIT_COUNT (usually 4 * 8 = 32)
-    size_t const mod = max % BIT_COUNT;
-    size_t const ceil = mod ? max - mod + BIT_COUNT : max;
-    size_t const size = ceil / CHAR_BIT;
+    // ceil to closest multiple of word bits
+    size_t const size = _fbitwise_set_words(max) * sizeof(uint64_t);
 
     // create structure with allocated memory based on bits
     fbitwise_set_s const set = {
@@ -73,11 +76,7 @@ void clear_fbitwise_set(fbitwise_set_s * const set) {
     valid(set->bits && "Bits array can't be NULL.");
     valid(set->allocator && "Allocator can't be NULL.");
 
-    // ceil to closest multiple of BIT_COUNT (usually 4 * 8 = 32)
-    size_t const mod = set->max % BIT_COUNT;
-    size_t const ceil = mod ? set->max - mod + BIT_COUNT : set->max;
-
-    memset(set->bits, 0, ceil / CHAR_BIT);
+    memset(set->bits, 0, _fbitwise_set_words(set->max) * sizeof(uint64_t));
     set->length = 0;
 }
 
@@ -89,10 +88,8 @@ fbitwise_set_s copy_fbitwise_set(fbitwise_set_s const * const set) {
     valid(set->bits && "Bits array can't be NULL.");
     valid(set->allocator && "Allocator can't be NULL.");
 
-    // ceil to closest multiple of BIT_COUNT (usually 4 * 8 = 32)
-    size_t const mod = set->max % BIT_COUNT;
-    size_t const ceil = mod ? set->max - mod + BIT_COUNT : set->max;
-    size_t const size = ceil / CHAR_BIT;
+    // ceil to closest multiple of word bits
+    size_t const size = _fbitwise_set_words(set->max) * sizeof(uint64_t);
 
     // create replica structure
     fbitwise_set_s const replica = {
@@ -140,7 +137,7 @@ void insert_fbitwise_set(fbitwise_set_s * const set, size_t const index) {
     // calculate bits array index and bit at parameter index
     size_t const idx = index / BIT_COUNT;
     unsigned const relative = (unsigned)(index % BIT_COUNT);
-    unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+    uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
     // error that bit index is unique (set doesn't contain index)
     error(!(set->bits[idx] & bit) && "Structure already contains element.");
@@ -161,7 +158,7 @@ void remove_fbitwise_set(fbitwise_set_s * const set, size_t const index) {
     // calculate bits array index and bit at parameter index
     size_t const idx = index / BIT_COUNT;
     unsigned const relative = (unsigned)(index % BIT_COUNT);
-    unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+    uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
     error((set->bits[idx] & bit) && "Strucutre already contains element.");
 
@@ -181,7 +178,7 @@ bool contains_fbitwise_set(fbitwise_set_s const * const set, size_t const index)
     // calculate bits array index and bit at parameter index
     size_t const idx = index / BIT_COUNT;
     unsigned const relative = (unsigned)(index % BIT_COUNT);
-    unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+    uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
     return (index < set->max) && (bool)(set->bits[idx] & bit); // return ANDed bit as a boolean
 }
@@ -204,17 +201,7 @@ fbitwise_set_s union_fbitwise_set(fbitwise_set_s const * const set_one, fbitwise
     fbitwise_set_s const * const minimum = set_one->max < set_two->max ? set_one : set_two;
     fbitwise_set_s const * const maximum = set_one->max >= set_two->max ? set_one : set_two;
 
-    // make union as a copy of biggest set and set its length to zero for later popcount
-    fbitwise_set_s set_union = copy_fbitwise_set(maximum);
-    set_union.length = 0;
-
-    // for each bits in minimum set copy minimum's (OR) into union and calculate new union length
-    for (size_t i = 0; i < minimum->max / BIT_COUNT; ++i) {
-        set_union.bits[i] |= minimum->bits[i];
-        set_union.length += (size_t)_fbitwise_set_popcount(set_union.bits[i]);
-    }
-
-    return set_union;
+    return _fbitwise_set_operate(maximum, minimum, OR_BITWISE);
 }
 
 fbitwise_set_s intersect_fbitwise_set(fbitwise_set_s const * const set_one, fbitwise_set_s const * const set_two) {
@@ -234,14 +221,7 @@ fbitwise_set_s intersect_fbitwise_set(fbitwise_set_s const * const set_one, fbit
     fbitwise_set_s const * const minimum = set_one->max < set_two->max ? set_one : set_two;
     fbitwise_set_s const * const maximum = set_one->max >= set_two->max ? set_one : set_two;
 
-    fbitwise_set_s set_intersect = copy_fbitwise_set(minimum);
-    set_intersect.length = 0;
-    for (size_t i = 0; i < minimum->max / BIT_COUNT; ++i) {
-        set_intersect.bits[i] &= maximum->bits[i];
-        set_intersect.length += (size_t)_fbitwise_set_popcount(set_intersect.bits[i]);
-    }
-
-    return set_intersect;
+    return _fbitwise_set_operate(minimum, maximum, AND_BITWISE);
 }
 
 fbitwise_set_s subtract_fbitwise_set(fbitwise_set_s const * const minuend, fbitwise_set_s const * const subtrahend) {
@@ -258,17 +238,7 @@ fbitwise_set_s subtract_fbitwise_set(fbitwise_set_s const * const minuend, fbitw
     valid(subtrahend->bits && "Bits array can't be NULL.");
     valid(subtrahend->allocator && "Allocator can't be NULL.");
 
-    // get smallest set based on capacity to minimize operations and invalid array access
-    fbitwise_set_s const * const minimum = minuend->max < subtrahend->max ? minuend : subtrahend;
-
-    fbitwise_set_s set_subtract = copy_fbitwise_set(minuend);
-    set_subtract.length = 0;
-    for (size_t i = 0; i < minimum->max / BIT_COUNT; ++i) {
-        set_subtract.bits[i] &= ~(subtrahend->bits[i]);
-        set_subtract.length += (size_t)_fbitwise_set_popcount(set_subtract.bits[i]);
-    }
-
-    return set_subtract;
+    return _fbitwise_set_operate(minuend, subtrahend, ANDNOT_BITWISE);
 }
 
 fbitwise_set_s exclude_fbitwise_set(fbitwise_set_s const * const set_one, fbitwise_set_s const * const set_two) {
@@ -288,14 +258,7 @@ fbitwise_set_s exclude_fbitwise_set(fbitwise_set_s const * const set_one, fbitwi
     fbitwise_set_s const * const minimum = set_one->max < set_two->max ? set_one : set_two;
     fbitwise_set_s const * const maximum = set_one->max >= set_two->max ? set_one : set_two;
 
-    fbitwise_set_s set_exclude = copy_fbitwise_set(maximum);
-    set_exclude.length = 0;
-    for (size_t i = 0; i < minimum->max / BIT_COUNT; ++i) {
-        set_exclude.bits[i] ^= minimum->bits[i];
-        set_exclude.length += (size_t)_fbitwise_set_popcount(set_exclude.bits[i]);
-    }
-
-    return set_exclude;
+    return _fbitwise_set_operate(maximum, minimum, XOR_BITWISE);
 }
 
 bool is_subset_fbitwise_set(fbitwise_set_s const * const superset, fbitwise_set_s const * const subset) {
@@ -312,22 +275,20 @@ bool is_subset_fbitwise_set(fbitwise_set_s const * const superset, fbitwise_set_
     valid(subset->bits && "Bits array can't be NULL.");
     valid(subset->allocator && "Allocator can't be NULL.");
 
-    // if ANDed sub- and super-set doesn't equals sub's bits then it isn't a subset
-    size_t i = 0;
-    for (; i < subset->max / BIT_COUNT && i < superset->max / BIT_COUNT; ++i) {
-        if ((subset->bits[i] & superset->bits[i]) != subset->bits[i]) {
-            return false;
-        }
+    // subset can't have more elements than superset
+    if (subset->length > superset->length) {
+        return false;
     }
 
-    // if subset has bits set beyond superset then it also isn't a subset
-    for (; i < subset->max / BIT_COUNT; ++i) {
+    // if subset has bits set beyond superset then it isn't a subset
+    size_t const words = _fbitwise_set_words(subset->max < superset->max ? subset->max : superset->max);
+    for (size_t i = words; i < _fbitwise_set_words(subset->max); ++i) {
         if (subset->bits[i]) {
             return false;
         }
     }
 
-    return true;
+    return is_subset_bitwise(superset->bits, subset->bits, words);
 }
 
 bool is_proper_subset_fbitwise_set(fbitwise_set_s const * const superset, fbitwise_set_s const * const subset) {
@@ -344,22 +305,7 @@ bool is_proper_subset_fbitwise_set(fbitwise_set_s const * const superset, fbitwi
     valid(subset->bits && "Bits array can't be NULL.");
     valid(subset->allocator && "Allocator can't be NULL.");
 
-    // if ANDed sub- and super-set doesn't equals sub's bits then it isn't a subset
-    size_t i = 0;
-    for (; i < subset->max / BIT_COUNT && i < superset->max / BIT_COUNT; ++i) {
-        if ((subset->bits[i] & superset->bits[i]) != subset->bits[i]) {
-            return false;
-        }
-    }
-
-    // if subset has bits set beyond superset then it also isn't a subset
-    for (; i < subset->max / BIT_COUNT; ++i) {
-        if (subset->bits[i]) {
-            return false;
-        }
-    }
-
-    return (subset->length != superset->length);
+    return (subset->length != superset->length) && is_subset_fbitwise_set(superset, subset);
 }
 
 bool is_disjoint_fbitwise_set(fbitwise_set_s const * const set_one, fbitwise_set_s const * const set_two) {
@@ -376,13 +322,9 @@ bool is_disjoint_fbitwise_set(fbitwise_set_s const * const set_one, fbitwise_set
     valid(set_two->bits && "Bits array can't be NULL.");
     valid(set_two->allocator && "Allocator can't be NULL.");
 
-    for (size_t i = 0; i < set_two->max / BIT_COUNT && i < set_one->max / BIT_COUNT; ++i) {
-        if (set_two->bits[i] & set_one->bits[i]) {
-            return false;
-        }
-    }
+    size_t const words = _fbitwise_set_words(set_one->max < set_two->max ? set_one->max : set_two->max);
 
-    return true;
+    return is_disjoint_bitwise(set_one->bits, set_two->bits, words);
 }
 
 void each_index_fbitwise_set(fbitwise_set_s const * const set, manage_fn const manage, void * const am) {
@@ -400,7 +342,7 @@ void each_index_fbitwise_set(fbitwise_set_s const * const set, manage_fn const m
         // calculate bits' array index and bit to check
         size_t const idx = i / BIT_COUNT;
         unsigned const relative = ((unsigned)(i) % BIT_COUNT);
-        unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+        uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
         // if bit isn't set continue, and if handle function returns false break the loop and quit main function
         if ((set->bits[idx] & bit) && !manage(&temp, am)) {
@@ -409,17 +351,27 @@ void each_index_fbitwise_set(fbitwise_set_s const * const set, manage_fn const m
     }
 }
 
-int _fbitwise_set_popcount(unsigned const bits) {
-#if defined(__GNUC__) || defined(__clang__) // if either gcc or clang is used, '__builtin_popcount*' is supported
-    return __builtin_popcount(bits);
-#else // else use custom popcount implementation
-    int count = 0;
+size_t _fbitwise_set_words(size_t const max) {
+    return (max + BIT_COUNT - 1) / BIT_COUNT;
+}
+
+fbitwise_set_s _fbitwise_set_operate(fbitwise_set_s const * const one, fbitwise_set_s const * const two, bitwise_e const operation) {
+    size_t const size = _fbitwise_set_words(one->max);
+    fbitwise_set_s result = {
+        .max = one->max, .allocator = one->allocator,
+        .bits = one->allocator->alloc(size * sizeof(uint64_t), one->allocator->arg),
+    };
+    error(result.bits && "Memory allocation failed.");
+
+    // combine shared words and count their bits in the same pass, bits past maximum are always zero
+    size_t const words = _fbitwise_set_words(one->max < two->max ? one->max : two->max);
+    result.length = operate_bitwise(result.bits, one->bits, two->bits, words, operation);
 
-    // while bits is not 0 increment count and remove its rightmost bit
-    for (unsigned b = bits; b; b ^= b & (~b + 1)) {
-        count++;
+    // words beyond second structure are zero in it, so OR, ANDNOT and XOR leave first structure's words as they are
+    if (size - words) {
+        memcpy(result.bits + words, one->bits + words, (size - words) * sizeof(uint64_t));
+        result.length += count_bitwise(one->bits + words, size - words);
     }
 
-    return count;
-#endif
+    return result;
 }
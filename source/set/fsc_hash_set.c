@@ -2,6 +2,7 @@
 
 #include <stdlib.h> // imports exit()
 #include <string.h>
+#include <stdint.h>
 
 #define NIL (size_t)(-1)
 
@@ -42,6 +43,16 @@ void _insert_wrapper_fsc_hash_set(fsc_hash_set_s const * const set, size_t const
 /// @return 'true' if element is contained, 'false' otherwise.
 bool _contains_wrapper_fsc_hash_set(fsc_hash_set_s const * const set, void const * const element, size_t const hash, size_t const index);
 
+/// @brief Reduces hash value into bucket index based on structure's indexing mode.
+/// @param set Structure to index.
+/// @param hash Hash value to reduce.
+/// @return Bucket index.
+size_t _fsc_hash_set_index(fsc_hash_set_s const * const set, size_t const hash);
+
+/// @brief Rebuilds bucket lists by pushing each element's hash into its bucket.
+/// @param set Structure to rehash.
+void _fsc_hash_set_rehash(fsc_hash_set_s const * const set);
+
 fsc_hash_set_s create_fsc_hash_set(size_t const size, size_t const max, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac) {
     error(hash && "Parameter can't be NULL.");
     error(size && "Parameter can't be zero.");
@@ -177,6 +188,33 @@ bool is_full_fsc_hash_set(fsc_hash_set_s const * const set) {
     return (set->length == set->max);
 }
 
+void reindex_fsc_hash_set(fsc_hash_set_s * const set, index_e const indexing) {
+    error(set && "Parameter can't be NULL.");
+    error((MODULO_INDEX == indexing || MASK_INDEX == indexing) && "Invalid indexing mode.");
+
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->size && "Size can't be zero.");
+    valid(set->length <= set->max && "Lenght can't be larger than maximum.");
+    valid(set->elements && "Elements array can't be NULL.");
+    valid(set->head && "Heads array can't be NULL.");
+    valid(set->next && "Nexts array can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    set->indexing = indexing;
+
+    // only the largest power of two buckets that fit into head array are used when masking
+    set->mask = 0;
+    if (MASK_INDEX == indexing) {
+        size_t buckets = 1;
+        while (buckets <= set->max / 2) {
+            buckets <<= 1;
+        }
+        set->mask = buckets - 1;
+    }
+
+    _fsc_hash_set_rehash(set);
+}
+
 void insert_fsc_hash_set(fsc_hash_set_s * const set, void const * const element) {
     error(set && "Parameter can't be NULL.");
     error(element && "Parameter can't be NULL.");
@@ -191,7 +229,7 @@ void insert_fsc_hash_set(fsc_hash_set_s * const set, void const * const element)
 
     // calculate hash value and index in array
     size_t const hash = set->hash(element, set->ah);
-    size_t const index = hash % set->max;
+    size_t const index = _fsc_hash_set_index(set, hash);
 
 #ifndef NERROR
     // check if element is in set or not
@@ -221,7 +259,7 @@ void remove_fsc_hash_set(fsc_hash_set_s * const set, void const * const element,
 
     // calculate hash values and index in array
     size_t const hash = set->hash(element, set->ah);
-    size_t const index = hash % set->max;
+    size_t const index = _fsc_hash_set_index(set, hash);
 
     for (size_t n = set->head[index]; NIL != n; n = set->next[n]) {
         char const * current = set->elements + (n * set->size);
@@ -256,11 +294,52 @@ bool contains_fsc_hash_set(fsc_hash_set_s const * const set, void const * const
 
     // calculate hash value and index in array
     size_t const hash = set->hash(element, set->ah);
-    size_t const index = hash % set->max;
+    size_t const index = _fsc_hash_set_index(set, hash);
 
     return _contains_wrapper_fsc_hash_set(set, element, hash, index);
 }
 
+void contains_many_fsc_hash_set(fsc_hash_set_s const * const set, void const * const elements, size_t const count, bool * const results) {
+    error(set && "Parameter can't be NULL.");
+    error((!count || elements) && "Parameter can't be NULL.");
+    error((!count || results) && "Parameter can't be NULL.");
+
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->size && "Size can't be zero.");
+    valid(set->length <= set->max && "Lenght can't be larger than maximum.");
+    valid(set->elements && "Elements array can't be NULL.");
+    valid(set->head && "Heads array can't be NULL.");
+    valid(set->next && "Nexts array can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    char const * const keys = elements;
+    size_t hashes[CERPEC_BATCH], indexes[CERPEC_BATCH];
+    for (size_t b = 0; b < count; b += CERPEC_BATCH) {
+        size_t const batch = count - b < CERPEC_BATCH ? count - b : CERPEC_BATCH;
+
+        // hash batch of elements first and prefetch their heads so misses overlap
+        for (size_t i = 0; i < batch; ++i) {
+            hashes[i] = set->hash(keys + ((b + i) * set->size), set->ah);
+            indexes[i] = _fsc_hash_set_index(set, hashes[i]);
+            prefetch(set->head + indexes[i]);
+        }
+
+        // prefetch first node of each list since its hash and element are compared first
+        for (size_t i = 0; i < batch; ++i) {
+            size_t const n = set->head[indexes[i]];
+            if (NIL != n) {
+                prefetch(set->hashes + n);
+                prefetch(set->elements + (n * set->size));
+            }
+        }
+
+        // resolve lists with hopefully cached heads and nodes
+        for (size_t i = 0; i < batch; ++i) {
+            results[b + i] = _contains_wrapper_fsc_hash_set(set, keys + ((b + i) * set->size), hashes[i], indexes[i]);
+        }
+    }
+}
+
 fsc_hash_set_s union_fsc_hash_set(fsc_hash_set_s const * const set_one, fsc_hash_set_s const * const set_two, copy_fn const copy, void * const ac) {
     error(set_one && "Parameter can't be NULL.");
     error(set_two && "Parameter can't be NULL.");
@@ -294,7 +373,7 @@ fsc_hash_set_s union_fsc_hash_set(fsc_hash_set_s const * const set_one, fsc_hash
         char const * const element = minimum->elements + (m * minimum->size);
 
         size_t const min_hash = minimum->hashes[m];
-        size_t const union_idx = min_hash % set_union.max;
+        size_t const union_idx = _fsc_hash_set_index(&set_union, min_hash);
 
 
         // if element is not in the set push it to set union
@@ -341,16 +420,17 @@ fsc_hash_set_s intersect_fsc_hash_set(fsc_hash_set_s const * const set_one, fsc_
     size_t const smallest_max = set_one->max < set_two->max ? set_one->max : set_two->max;
 
     fsc_hash_set_s set_intersect = _make_wrapper_fsc_hash_set(set_one->size, smallest_max, set_one->hash, set_one->ah, set_one->compare, set_one->ac, set_one->allocator);
+    reindex_fsc_hash_set(&set_intersect, set_one->indexing);
     for (size_t min = 0; min < minimum->length; ++min) {
         char const * const element = minimum->elements + (min * minimum->size);
 
         size_t const min_hash = minimum->hashes[min];
-        size_t const max_idx = min_hash % maximum->max;
+        size_t const max_idx = _fsc_hash_set_index(maximum, min_hash);
 
         // if element is in set push it into intersect
         bool const contains = _contains_wrapper_fsc_hash_set(maximum, element, min_hash, max_idx);
         if (contains) {
-            size_t const intersect_index = min_hash % set_intersect.max;
+            size_t const intersect_index = _fsc_hash_set_index(&set_intersect, min_hash);
             _insert_wrapper_fsc_hash_set(&set_intersect, min_hash, intersect_index);
 
             copy(set_intersect.elements + (set_intersect.length * set_intersect.size), element, ac);
@@ -385,17 +465,18 @@ fsc_hash_set_s subtract_fsc_hash_set(fsc_hash_set_s const * const minuend, fsc_h
     valid(subtrahend->allocator && "Allocator can't be NULL.");
 
     fsc_hash_set_s set_subtract = _make_wrapper_fsc_hash_set(minuend->size, minuend->max, minuend->hash, minuend->ah, minuend->compare, minuend->ac, minuend->allocator);
+    reindex_fsc_hash_set(&set_subtract, minuend->indexing);
     for (size_t min = 0; min < minuend->length; ++min) {
         // get element and set its found flag to false
         char const * const element = minuend->elements + (min * minuend->size);
 
         size_t const hash = minuend->hashes[min];
-        size_t const subtrahend_idx = hash % subtrahend->max;
+        size_t const subtrahend_idx = _fsc_hash_set_index(subtrahend, hash);
 
         // if minuend element is not in subtrahend set push it to new set
         bool const contains = _contains_wrapper_fsc_hash_set(subtrahend, element, hash, subtrahend_idx);
         if (!contains) {
-            size_t const subtract_index = hash % set_subtract.max;
+            size_t const subtract_index = _fsc_hash_set_index(&set_subtract, hash);
             _insert_wrapper_fsc_hash_set(&set_subtract, hash, subtract_index);
 
             copy(set_subtract.elements + (set_subtract.length * set_subtract.size), element, ac);
@@ -432,19 +513,20 @@ fsc_hash_set_s exclude_fsc_hash_set(fsc_hash_set_s const * const set_one, fsc_ha
     fsc_hash_set_s const * const biggest = set_one->max >= set_two->max ? set_one : set_two;
 
     fsc_hash_set_s set_exclude = _make_wrapper_fsc_hash_set(biggest->size, biggest->max, biggest->hash, biggest->ah, biggest->compare, biggest->ac, biggest->allocator);
+    reindex_fsc_hash_set(&set_exclude, biggest->indexing);
 
     for (size_t one = 0; one < set_one->length; ++one) {
         // get element and set its found flag to false
         char const * const element = set_one->elements + (one * set_one->size);
 
         size_t const hash = set_one->hashes[one];
-        size_t const two_idx = hash % set_two->max;
+        size_t const two_idx = _fsc_hash_set_index(set_two, hash);
 
         bool const contains = _contains_wrapper_fsc_hash_set(set_two, element, hash, two_idx);
         if (!contains) {
             error(set_exclude.length <= set_exclude.max && "Length can't exceeds maximum.");
 
-            size_t const exclude_index = hash % set_exclude.max;
+            size_t const exclude_index = _fsc_hash_set_index(&set_exclude, hash);
             _insert_wrapper_fsc_hash_set(&set_exclude, hash, exclude_index);
 
             copy(set_exclude.elements + (set_exclude.length * set_exclude.size), element, ac);
@@ -457,13 +539,13 @@ fsc_hash_set_s exclude_fsc_hash_set(fsc_hash_set_s const * const set_one, fsc_ha
         char const * const element = set_two->elements + (two * set_two->size);
 
         size_t const hash = set_two->hashes[two];
-        size_t const one_idx = hash % set_one->max;
+        size_t const one_idx = _fsc_hash_set_index(set_one, hash);
 
         bool const contains = _contains_wrapper_fsc_hash_set(set_one, element, hash, one_idx);
         if (!contains) {
             error(set_exclude.length <= set_exclude.max && "Length can't exceeds maximum.");
 
-            size_t const exclude_index = hash % set_exclude.max;
+            size_t const exclude_index = _fsc_hash_set_index(&set_exclude, hash);
             _insert_wrapper_fsc_hash_set(&set_exclude, hash, exclude_index);
 
             copy(set_exclude.elements + (set_exclude.length * set_exclude.size), element, ac);
@@ -501,7 +583,7 @@ bool is_subset_fsc_hash_set(fsc_hash_set_s const * const superset, fsc_hash_set_
         char const * const element = subset->elements + (sub * subset->size);
 
         size_t const sub_hash = subset->hashes[sub];
-        size_t const super_idx = sub_hash % superset->max;
+        size_t const super_idx = _fsc_hash_set_index(superset, sub_hash);
 
         bool const contains = _contains_wrapper_fsc_hash_set(superset, element, sub_hash, super_idx);
         if (!contains) { return false; }
@@ -537,7 +619,7 @@ bool is_proper_subset_fsc_hash_set(fsc_hash_set_s const * const superset, fsc_ha
         char const * const element = subset->elements + (sub * subset->size);
 
         size_t const sub_hash = subset->hashes[sub];
-        size_t const super_idx = sub_hash % superset->max;
+        size_t const super_idx = _fsc_hash_set_index(superset, sub_hash);
 
         bool const contains = _contains_wrapper_fsc_hash_set(superset, element, sub_hash, super_idx);
         if (!contains) { return false; }
@@ -576,7 +658,7 @@ bool is_disjoint_fsc_hash_set(fsc_hash_set_s const * const set_one, fsc_hash_set
         char const * const element = minimum->elements + (min * minimum->size);
 
         size_t const min_hash = minimum->hash(element, minimum->ah);
-        size_t const max_idx = min_hash % maximum->max;
+        size_t const max_idx = _fsc_hash_set_index(maximum, min_hash);
 
         bool const contains = _contains_wrapper_fsc_hash_set(maximum, element, min_hash, max_idx);
         if (contains) { return false; }
@@ -604,12 +686,12 @@ void each_fsc_hash_set(fsc_hash_set_s const * const set, manage_fn const manage,
 
 void _fsc_hash_set_fill_hole(fsc_hash_set_s const * const set, size_t const hole) {
     if (NIL == set->prev[set->length]) {
-        size_t const index = set->hashes[set->length] % set->max;
+        size_t const index = _fsc_hash_set_index(set, set->hashes[set->length]);
         set->head[index] = hole;
     }
 
     if (NIL == set->prev[hole]) {
-        size_t const index = set->hashes[hole] % set->max;
+        size_t const index = _fsc_hash_set_index(set, set->hashes[hole]);
         set->head[index] = set->next[hole];
     }
 
@@ -631,6 +713,41 @@ void _fsc_hash_set_fill_hole(fsc_hash_set_s const * const set, size_t const hole
     if (NIL != set->prev[set->length]) { set->next[set->prev[set->length]] = hole; }
 }
 
+size_t _fsc_hash_set_index(fsc_hash_set_s const * const set, size_t const hash) {
+    if (MODULO_INDEX == set->indexing) {
+        return hash % set->max;
+    }
+
+    // mix hash so that weak hashes (like identity) don't only depend on their low bits, then mask
+    uint64_t mix = (uint64_t)(hash);
+    mix ^= mix >> 32;
+    mix *= (uint64_t)(0xd6e8feb86659fd93);
+    mix ^= mix >> 32;
+
+    return (size_t)(mix) & set->mask;
+}
+
+void _fsc_hash_set_rehash(fsc_hash_set_s const * const set) {
+    for (size_t i = 0; i < set->max; ++i) {
+        set->head[i] = NIL;
+    }
+
+    // reset lists by pushing hashes to their valid list
+    for (size_t i = 0; i < set->length; ++i) {
+        size_t const index = _fsc_hash_set_index(set, set->hashes[i]);
+
+        size_t const head = set->head[index];
+        if (NIL != head) {
+            set->prev[head] = i;
+        }
+
+        // node index redirection
+        set->prev[i] = NIL;
+        set->next[i] = head;
+        set->head[index] = i;
+    }
+}
+
 fsc_hash_set_s _make_wrapper_fsc_hash_set(size_t const size, size_t const max, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator) {
     fsc_hash_set_s const set = {
         .size = size, .hash = hash, .ah = ah, .allocator = allocator, .max = max, .compare = compare, .ac = ac,
@@ -660,6 +777,7 @@ fsc_hash_set_s _copy_wrapper_fsc_hash_set(fsc_hash_set_s const * const set, copy
     fsc_hash_set_s const replica = {
         .max = set->max, .hash = set->hash, .length = set->length, .size = set->size,
         .allocator = set->allocator, .compare = set->compare, .ah = set->ah, .ac = set->ac,
+        .indexing = set->indexing, .mask = set->mask,
 
         .elements = set->allocator->alloc(set->max * set->size, set->allocator->arg),
         .hashes = set->allocator->alloc(set->max * sizeof(size_t), set->allocator->arg),
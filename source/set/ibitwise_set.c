@@ -4,18 +4,72 @@
 #include <string.h>
 #include <limits.h>
 
-#define BIT_COUNT (sizeof(unsigned) * CHAR_BIT)
+#define BIT_COUNT BITWISE_WORD
 
-/// @brief Calculates the number of set (one) bits in unsigned integer.
-/// @param bits Unsigned integer to count set bits.
-/// @return Number of set bits.
-int _ibitwise_set_popcount(unsigned const bits);
+// number of words that many structure operations combine from every structure before moving on, small enough to stay cached
+#define BLOCK_WORDS 64
+
+// number of words counted by each rank index entry, a rank query counts at most this many words
+#define RANK_WORDS 8
 
 /// @brief Resizes (reallocates) structure parameter arrays based on changed capacity.
 /// @param set Structure to resize.
 /// @param size New size.
 void _ibitwise_set_resize(ibitwise_set_s * const set, size_t const size);
 
+/// @brief Calculates smallest chunk multiple capacity that still contains every set bit.
+/// @param set Structure to calculate capacity for.
+/// @return Trimmed bit-based capacity.
+size_t _ibitwise_set_fit(ibitwise_set_s const * const set);
+
+/// @brief Shrinks structure to its words below capacity and then to last chunk containing an element.
+/// @param set Structure to shrink.
+/// @param capacity Bit-based capacity to drop words at or beyond, can't be larger than structure's.
+void _ibitwise_set_trim(ibitwise_set_s * const set, size_t const capacity);
+
+/// @brief Combines two structures word by word into a new structure with first structure's capacity.
+/// @param one First structure to combine, its words beyond second structure's capacity are copied.
+/// @param two Second structure to combine.
+/// @param operation Operation to combine words with.
+/// @return New untrimmed structure.
+ibitwise_set_s _ibitwise_set_operate(ibitwise_set_s const * const one, ibitwise_set_s const * const two, bitwise_e const operation);
+
+/// @brief Builds rank index with number of indexes before each block of 'RANK_WORDS' words.
+/// @param set Structure to build index for.
+void _ibitwise_set_index(ibitwise_set_s * const set);
+
+/// @brief Sets or clears masked bits of word.
+/// @param word Word to change.
+/// @param mask Bits to change.
+/// @param value 'true' to set bits, 'false' to clear them.
+/// @return Number of bits that changed.
+size_t _ibitwise_set_apply(uint64_t * const word, uint64_t const mask, bool const value);
+
+/// @brief Sets or clears every bit in [start, end) range, masking only first and last word.
+/// @param bits Bits array that contains range.
+/// @param start First bit of non-empty range.
+/// @param end Bit after last bit of range.
+/// @param value 'true' to set bits, 'false' to clear them.
+/// @return Number of bits that changed.
+size_t _ibitwise_set_fill(uint64_t * const bits, size_t const start, size_t const end, bool const value);
+
+/// @brief Finds first bit at or after start that is either set or cleared.
+/// @param set Structure to search.
+/// @param start Bit to start searching from.
+/// @param value 'true' to find set bit, 'false' to find cleared bit.
+/// @return Found bit, or structure's capacity if there isn't one.
+size_t _ibitwise_set_seek(ibitwise_set_s const * const set, size_t const start, bool const value);
+
+/// @brief Counts leading zero bits of non-zero word, i.e. relative index of its first element.
+/// @param word Non-zero word.
+/// @return Number of leading zero bits.
+size_t _ibitwise_set_leading(uint64_t const word);
+
+/// @brief Counts trailing zero bits of non-zero word, i.e. distance of its last element from word's end.
+/// @param word Non-zero word.
+/// @return Number of trailing zero bits.
+size_t _ibitwise_set_trailing(uint64_t const word);
+
 ibitwise_set_s create_ibitwise_set(void) {
     return (ibitwise_set_s) { .allocator = &standard, };
 }
@@ -33,6 +87,7 @@ void destroy_ibitwise_set(ibitwise_set_s * const set) {
 
     // free bits array since it only stores indexes
     set->allocator->free(set->bits, set->allocator->arg);
+    set->allocator->free(set->ranks, set->allocator->arg);
 
     memset(set, 0, sizeof(ibitwise_set_s));
 }
@@ -44,9 +99,12 @@ void clear_ibitwise_set(ibitwise_set_s * const set) {
 
     // free bits array since it only stores indexes
     set->allocator->free(set->bits, set->allocator->arg);
+    set->allocator->free(set->ranks, set->allocator->arg);
 
     set->capacity = set->length = 0;
     set->bits = NULL;
+    set->ranks = NULL;
+    set->indexed = false;
 }
 
 ibitwise_set_s copy_ibitwise_set(ibitwise_set_s const * const set) {
@@ -75,13 +133,37 @@ bool is_empty_ibitwise_set(ibitwise_set_s const * const set) {
     return !(set->length);
 }
 
+void reserve_ibitwise_set(ibitwise_set_s * const set, size_t const capacity) {
+    assert(set && "Parameter can't be NULL.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // round capacity up to next chunk multiple
+    size_t const mod = capacity % IBITWISE_SET_CHUNK;
+    size_t const size = mod ? (capacity - mod) + IBITWISE_SET_CHUNK : capacity;
+    if (size > set->capacity) {
+        _ibitwise_set_resize(set, size);
+    }
+}
+
+void shrink_to_fit_ibitwise_set(ibitwise_set_s * const set) {
+    assert(set && "Parameter can't be NULL.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    size_t const capacity = _ibitwise_set_fit(set);
+    if (set->capacity != capacity) {
+        _ibitwise_set_resize(set, capacity);
+    }
+}
+
 void insert_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
     assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
 
     // calculate bits array index and bit at parameter index
     size_t const idx = index / BIT_COUNT;
     unsigned const relative = (unsigned)(index % BIT_COUNT);
-    unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+    uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
     // expand set if index is beyond capacity
     if (index >= set->capacity) {
@@ -96,6 +178,7 @@ void insert_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
     // set bit in bits array by ORing
     set->bits[idx] |= bit;
     set->length++;
+    set->indexed = false;
 }
 
 void remove_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
@@ -106,26 +189,18 @@ void remove_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
     // calculate bits array index and bit at parameter index
     size_t const idx = index / BIT_COUNT;
     unsigned const relative = (unsigned)(index % BIT_COUNT);
-    unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+    uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
     assert((set->bits[idx] & bit) && "Strucutre already contains element.");
 
     // remove bit in bits array by XORing
     set->bits[idx] ^= bit;
     set->length--;
+    set->indexed = false;
 
     // if new set has no leftmost chunk bits set then shrink bits array until it has
-    size_t capacity = set->capacity;
-    for (size_t i = set->capacity / IBITWISE_SET_CHUNK; i; --i) {
-        for (size_t j = 0; j < IBITWISE_SET_CHUNK / BIT_COUNT; ++j) {
-            if (set->bits[(set->capacity / BIT_COUNT) - j - 1]) {
-                goto EXIT_LOOP;
-            }
-        }
-        capacity -= IBITWISE_SET_CHUNK;
-    }
+    size_t const capacity = _ibitwise_set_fit(set);
 
-EXIT_LOOP:
     // if capacity has shrunk then shrink new set as well
     if (set->capacity != capacity) {
         _ibitwise_set_resize(set, capacity);
@@ -140,11 +215,67 @@ bool contains_ibitwise_set(ibitwise_set_s const * const set, size_t const index)
     // calculate bits array index and bit at parameter index
     size_t const idx = index / BIT_COUNT;
     unsigned const relative = (unsigned)(index % BIT_COUNT);
-    unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+    uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
     return (index < set->capacity) && (bool)(set->bits[idx] & bit); // return ANDed bit as a boolean
 }
 
+void insert_range_ibitwise_set(ibitwise_set_s * const set, size_t const start, size_t const end) {
+    assert(set && "Parameter can't be NULL.");
+    assert(start <= end && "Range start can't be after its end.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (start == end) {
+        return;
+    }
+
+    // expand set if range's last index is beyond capacity
+    if (end > set->capacity) {
+        size_t const mod = (end - 1) % IBITWISE_SET_CHUNK;
+        _ibitwise_set_resize(set, (end - 1 - mod) + IBITWISE_SET_CHUNK);
+    }
+
+    set->length += _ibitwise_set_fill(set->bits, start, end, true);
+    set->indexed = false;
+}
+
+void remove_range_ibitwise_set(ibitwise_set_s * const set, size_t const start, size_t const end) {
+    assert(set && "Parameter can't be NULL.");
+    assert(start <= end && "Range start can't be after its end.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // indexes beyond capacity aren't contained, so range is cut at capacity
+    size_t const last = end < set->capacity ? end : set->capacity;
+    if (start >= last) {
+        return;
+    }
+
+    set->length -= _ibitwise_set_fill(set->bits, start, last, false);
+    set->indexed = false;
+
+    _ibitwise_set_trim(set, set->capacity);
+}
+
+bool contains_range_ibitwise_set(ibitwise_set_s const * const set, size_t const start, size_t const end) {
+    assert(set && "Parameter can't be NULL.");
+    assert(start <= end && "Range start can't be after its end.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (start == end) {
+        return true;
+    }
+
+    if (end > set->capacity || end - start > set->length) {
+        return false;
+    }
+
+    // range is contained if first cleared bit at or after its start is beyond it
+    return _ibitwise_set_seek(set, start, false) >= end;
+}
+
 ibitwise_set_s union_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set_s const * const set_two) {
     assert(set_one && "Parameter can't be NULL.");
     assert(set_two && "Parameter can't be NULL.");
@@ -155,17 +286,8 @@ ibitwise_set_s union_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise
     ibitwise_set_s const * const minimum = set_one->capacity < set_two->capacity ? set_one : set_two;
     ibitwise_set_s const * const maximum = set_one->capacity >= set_two->capacity ? set_one : set_two;
 
-    // make union as a copy of biggest set and set its length to zero for later popcount
-    ibitwise_set_s set_union = copy_ibitwise_set(maximum);
-    set_union.length = 0;
-
-    // for each bits in minimum set copy minimum's (OR) into union and calculate new union length
-    for (size_t i = 0; i < minimum->capacity / BIT_COUNT; ++i) {
-        set_union.bits[i] |= minimum->bits[i];
-        set_union.length += (size_t)_ibitwise_set_popcount(set_union.bits[i]);
-    }
-
-    return set_union;
+    // union can't clear a bit, so unlike other operations it never needs trimming
+    return _ibitwise_set_operate(maximum, minimum, OR_BITWISE);
 }
 
 ibitwise_set_s intersect_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set_s const * const set_two) {
@@ -177,29 +299,10 @@ ibitwise_set_s intersect_ibitwise_set(ibitwise_set_s const * const set_one, ibit
     ibitwise_set_s const * const minimum = set_one->capacity < set_two->capacity ? set_one : set_two;
     ibitwise_set_s const * const maximum = set_one->capacity >= set_two->capacity ? set_one : set_two;
 
-    ibitwise_set_s set_intersect = copy_ibitwise_set(minimum);
-    set_intersect.length = 0;
-    for (size_t i = 0; i < minimum->capacity / BIT_COUNT; ++i) {
-        set_intersect.bits[i] &= maximum->bits[i];
-        set_intersect.length += (size_t)_ibitwise_set_popcount(set_intersect.bits[i]);
-    }
+    ibitwise_set_s set_intersect = _ibitwise_set_operate(minimum, maximum, AND_BITWISE);
 
     // if new set has no leftmost chunk bits set then shrink bits array until it has
-    size_t capacity = set_intersect.capacity;
-    for (size_t i = set_intersect.capacity / IBITWISE_SET_CHUNK; i; --i) {
-        for (size_t j = 0; j < IBITWISE_SET_CHUNK / BIT_COUNT; ++j) {
-            if (set_intersect.bits[(set_intersect.capacity / BIT_COUNT) - j - 1]) {
-                goto EXIT_LOOP;
-            }
-        }
-        capacity -= IBITWISE_SET_CHUNK;
-    }
-
-EXIT_LOOP:
-    // if capacity has shrunk then shrink new set as well
-    if (set_intersect.capacity != capacity) {
-        _ibitwise_set_resize(&set_intersect, capacity);
-    }
+    _ibitwise_set_trim(&set_intersect, set_intersect.capacity);
 
     return set_intersect;
 }
@@ -210,32 +313,10 @@ ibitwise_set_s subtract_ibitwise_set(ibitwise_set_s const * const minuend, ibitw
     assert(minuend->length <= minuend->capacity && "Lenght can't be larger than capacity.");
     assert(subtrahend->length <= subtrahend->capacity && "Lenght can't be larger than capacity.");
 
-    // get smallest set based on capacity to minimize operations and invalid array access
-    ibitwise_set_s const * const minimum = minuend->capacity < subtrahend->capacity ? minuend : subtrahend;
-
-    ibitwise_set_s set_subtract = copy_ibitwise_set(minuend);
-    set_subtract.length = 0;
-    for (size_t i = 0; i < minimum->capacity / BIT_COUNT; ++i) {
-        set_subtract.bits[i] &= ~(subtrahend->bits[i]);
-        set_subtract.length += (size_t)_ibitwise_set_popcount(set_subtract.bits[i]);
-    }
+    ibitwise_set_s set_subtract = _ibitwise_set_operate(minuend, subtrahend, ANDNOT_BITWISE);
 
     // if new set has no leftmost chunk bits set then shrink bits array until it has
-    size_t capacity = set_subtract.capacity;
-    for (size_t i = set_subtract.capacity / IBITWISE_SET_CHUNK; i; --i) {
-        for (size_t j = 0; j < IBITWISE_SET_CHUNK / BIT_COUNT; ++j) {
-            if (set_subtract.bits[(set_subtract.capacity / BIT_COUNT) - j - 1]) {
-                goto EXIT_LOOP;
-            }
-        }
-        capacity -= IBITWISE_SET_CHUNK;
-    }
-
-EXIT_LOOP:
-    // if capacity has shrunk then shrink new set as well
-    if (set_subtract.capacity != capacity) {
-        _ibitwise_set_resize(&set_subtract, capacity);
-    }
+    _ibitwise_set_trim(&set_subtract, set_subtract.capacity);
 
     return set_subtract;
 }
@@ -249,31 +330,152 @@ ibitwise_set_s exclude_ibitwise_set(ibitwise_set_s const * const set_one, ibitwi
     ibitwise_set_s const * const minimum = set_one->capacity < set_two->capacity ? set_one : set_two;
     ibitwise_set_s const * const maximum = set_one->capacity >= set_two->capacity ? set_one : set_two;
 
-    ibitwise_set_s set_exclude = copy_ibitwise_set(maximum);
-    set_exclude.length = 0;
-    for (size_t i = 0; i < minimum->capacity / BIT_COUNT; ++i) {
-        set_exclude.bits[i] ^= minimum->bits[i];
-        set_exclude.length += (size_t)_ibitwise_set_popcount(set_exclude.bits[i]);
-    }
+    ibitwise_set_s set_exclude = _ibitwise_set_operate(maximum, minimum, XOR_BITWISE);
 
     // if new set has no leftmost chunk bits set then shrink bits array until it has
-    size_t capacity = set_exclude.capacity;
-    for (size_t i = set_exclude.capacity / IBITWISE_SET_CHUNK; i; --i) {
-        for (size_t j = 0; j < IBITWISE_SET_CHUNK / BIT_COUNT; ++j) {
-            if (set_exclude.bits[(set_exclude.capacity / BIT_COUNT) - j - 1]) {
-                goto EXIT_LOOP;
+    _ibitwise_set_trim(&set_exclude, set_exclude.capacity);
+
+    return set_exclude;
+}
+
+void union_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source) {
+    assert(destination && "Parameter can't be NULL.");
+    assert(source && "Parameter can't be NULL.");
+    assert(destination->length <= destination->capacity && "Lenght can't be larger than capacity.");
+    assert(source->length <= source->capacity && "Lenght can't be larger than capacity.");
+
+    // expand destination so every source word has a place to go
+    if (source->capacity > destination->capacity) {
+        _ibitwise_set_resize(destination, source->capacity);
+    }
+
+    size_t const words = source->capacity / BIT_COUNT, size = destination->capacity / BIT_COUNT;
+    destination->length = operate_bitwise(destination->bits, destination->bits, source->bits, words, OR_BITWISE);
+    destination->indexed = false;
+    destination->length += count_bitwise(destination->bits + words, size - words);
+}
+
+void intersect_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source) {
+    assert(destination && "Parameter can't be NULL.");
+    assert(source && "Parameter can't be NULL.");
+    assert(destination->length <= destination->capacity && "Lenght can't be larger than capacity.");
+    assert(source->length <= source->capacity && "Lenght can't be larger than capacity.");
+
+    size_t const capacity = destination->capacity < source->capacity ? destination->capacity : source->capacity;
+    destination->length = operate_bitwise(destination->bits, destination->bits, source->bits, capacity / BIT_COUNT, AND_BITWISE);
+    destination->indexed = false;
+
+    // destination's words beyond source intersect with nothing, so they're dropped
+    _ibitwise_set_trim(destination, capacity);
+}
+
+void subtract_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source) {
+    assert(destination && "Parameter can't be NULL.");
+    assert(source && "Parameter can't be NULL.");
+    assert(destination->length <= destination->capacity && "Lenght can't be larger than capacity.");
+    assert(source->length <= source->capacity && "Lenght can't be larger than capacity.");
+
+    size_t const words = (destination->capacity < source->capacity ? destination->capacity : source->capacity) / BIT_COUNT;
+    size_t const size = destination->capacity / BIT_COUNT;
+    destination->length = operate_bitwise(destination->bits, destination->bits, source->bits, words, ANDNOT_BITWISE);
+    destination->indexed = false;
+    destination->length += count_bitwise(destination->bits + words, size - words);
+
+    _ibitwise_set_trim(destination, destination->capacity);
+}
+
+void exclude_into_ibitwise_set(ibitwise_set_s * const destination, ibitwise_set_s const * const source) {
+    assert(destination && "Parameter can't be NULL.");
+    assert(source && "Parameter can't be NULL.");
+    assert(destination->length <= destination->capacity && "Lenght can't be larger than capacity.");
+    assert(source->length <= source->capacity && "Lenght can't be larger than capacity.");
+
+    if (source->capacity > destination->capacity) {
+        _ibitwise_set_resize(destination, source->capacity);
+    }
+
+    size_t const words = source->capacity / BIT_COUNT, size = destination->capacity / BIT_COUNT;
+    destination->length = operate_bitwise(destination->bits, destination->bits, source->bits, words, XOR_BITWISE);
+    destination->indexed = false;
+    destination->length += count_bitwise(destination->bits + words, size - words);
+
+    _ibitwise_set_trim(destination, destination->capacity);
+}
+
+ibitwise_set_s union_all_ibitwise_set(ibitwise_set_s const * const sets, size_t const length) {
+    assert(sets && "Parameter can't be NULL.");
+    assert(length && "Parameter can't be zero.");
+
+    size_t capacity = 0;
+    for (size_t i = 0; i < length; ++i) {
+        assert(sets[i].length <= sets[i].capacity && "Lenght can't be larger than capacity.");
+
+        capacity = sets[i].capacity > capacity ? sets[i].capacity : capacity;
+    }
+
+    ibitwise_set_s set_union = {
+        .capacity = capacity, .allocator = sets[0].allocator,
+        .bits = sets[0].allocator->alloc(capacity / CHAR_BIT, sets[0].allocator->arg),
+    };
+    assert((!set_union.capacity || set_union.bits) && "Memory allocation failed.");
+
+    // every structure is ORed into a block while it's cached, instead of streaming whole result once per structure
+    size_t const size = capacity / BIT_COUNT;
+    for (size_t start = 0; start < size; start += BLOCK_WORDS) {
+        size_t const end = start + BLOCK_WORDS < size ? start + BLOCK_WORDS : size;
+
+        memset(set_union.bits + start, 0, (end - start) * sizeof(uint64_t));
+        for (size_t i = 0; i < length; ++i) {
+            size_t const words = sets[i].capacity / BIT_COUNT;
+            if (words > start) {
+                size_t const stop = words < end ? words : end;
+                operate_bitwise(set_union.bits + start, set_union.bits + start, sets[i].bits + start, stop - start, OR_BITWISE);
             }
         }
-        capacity -= IBITWISE_SET_CHUNK;
+
+        set_union.length += count_bitwise(set_union.bits + start, end - start);
     }
 
-EXIT_LOOP:
-    // if capacity has shrunk then shrink new set as well
-    if (set_exclude.capacity != capacity) {
-        _ibitwise_set_resize(&set_exclude, capacity);
+    return set_union;
+}
+
+ibitwise_set_s intersect_all_ibitwise_set(ibitwise_set_s const * const sets, size_t const length) {
+    assert(sets && "Parameter can't be NULL.");
+    assert(length && "Parameter can't be zero.");
+
+    size_t capacity = sets[0].capacity;
+    for (size_t i = 0; i < length; ++i) {
+        assert(sets[i].length <= sets[i].capacity && "Lenght can't be larger than capacity.");
+
+        capacity = sets[i].capacity < capacity ? sets[i].capacity : capacity;
     }
 
-    return set_exclude;
+    ibitwise_set_s set_intersect = {
+        .capacity = capacity, .allocator = sets[0].allocator,
+        .bits = sets[0].allocator->alloc(capacity / CHAR_BIT, sets[0].allocator->arg),
+    };
+    assert((!set_intersect.capacity || set_intersect.bits) && "Memory allocation failed.");
+
+    // single structure is intersected with itself, which only copies it
+    size_t const second = length > 1 ? 1 : 0;
+
+    size_t const size = capacity / BIT_COUNT;
+    for (size_t start = 0; start < size; start += BLOCK_WORDS) {
+        size_t const words = start + BLOCK_WORDS < size ? BLOCK_WORDS : size - start;
+        uint64_t * const block = set_intersect.bits + start;
+
+        // once a block is empty ANDing it with remaining structures can't set a bit, so they're skipped
+        size_t count = operate_bitwise(block, sets[0].bits + start, sets[second].bits + start, words, AND_BITWISE);
+        for (size_t i = 2; i < length && count; ++i) {
+            count = operate_bitwise(block, block, sets[i].bits + start, words, AND_BITWISE);
+        }
+
+        set_intersect.length += count;
+    }
+
+    _ibitwise_set_trim(&set_intersect, set_intersect.capacity);
+
+    return set_intersect;
 }
 
 bool is_subset_ibitwise_set(ibitwise_set_s const * const superset, ibitwise_set_s const * const subset) {
@@ -282,22 +484,20 @@ bool is_subset_ibitwise_set(ibitwise_set_s const * const superset, ibitwise_set_
     assert(superset->length <= superset->capacity && "Lenght can't be larger than capacity.");
     assert(subset->length <= subset->capacity && "Lenght can't be larger than capacity.");
 
-    // if ANDed sub- and super-set doesn't equals sub's bits then it isn't a subset
-    size_t i = 0;
-    for (; i < subset->capacity / BIT_COUNT && i < superset->capacity / BIT_COUNT; ++i) {
-        if ((subset->bits[i] & superset->bits[i]) != subset->bits[i]) {
-            return false;
-        }
+    // subset can't have more elements than superset
+    if (subset->length > superset->length) {
+        return false;
     }
 
-    // if subset has bits set beyond superset then it also isn't a subset
-    for (; i < subset->capacity / BIT_COUNT; ++i) {
+    // if subset has bits set beyond superset then it isn't a subset
+    size_t const words = (subset->capacity < superset->capacity ? subset->capacity : superset->capacity) / BIT_COUNT;
+    for (size_t i = words; i < subset->capacity / BIT_COUNT; ++i) {
         if (subset->bits[i]) {
             return false;
         }
     }
 
-    return true;
+    return is_subset_bitwise(superset->bits, subset->bits, words);
 }
 
 bool is_proper_subset_ibitwise_set(ibitwise_set_s const * const superset, ibitwise_set_s const * const subset) {
@@ -306,22 +506,7 @@ bool is_proper_subset_ibitwise_set(ibitwise_set_s const * const superset, ibitwi
     assert(superset->length <= superset->capacity && "Lenght can't be larger than capacity.");
     assert(subset->length <= subset->capacity && "Lenght can't be larger than capacity.");
 
-    // if ANDed sub- and super-set doesn't equals sub's bits then it isn't a subset
-    size_t i = 0;
-    for (; i < subset->capacity / BIT_COUNT && i < superset->capacity / BIT_COUNT; ++i) {
-        if ((subset->bits[i] & superset->bits[i]) != subset->bits[i]) {
-            return false;
-        }
-    }
-
-    // if subset has bits set beyond superset then it also isn't a subset
-    for (; i < subset->capacity / BIT_COUNT; ++i) {
-        if (subset->bits[i]) {
-            return false;
-        }
-    }
-
-    return (subset->length != superset->length);
+    return (subset->length != superset->length) && is_subset_ibitwise_set(superset, subset);
 }
 
 bool is_disjoint_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set_s const * const set_two) {
@@ -331,13 +516,116 @@ bool is_disjoint_ibitwise_set(ibitwise_set_s const * const set_one, ibitwise_set
     assert(set_one->length <= set_one->capacity && "Lenght can't be larger than capacity.");
     assert(set_two->length <= set_two->capacity && "Lenght can't be larger than capacity.");
 
-    for (size_t i = 0; i < set_two->capacity / BIT_COUNT && i < set_one->capacity / BIT_COUNT; ++i) {
-        if (set_two->bits[i] & set_one->bits[i]) {
-            return false;
+    size_t const words = (set_one->capacity < set_two->capacity ? set_one->capacity : set_two->capacity) / BIT_COUNT;
+
+    return is_disjoint_bitwise(set_one->bits, set_two->bits, words);
+}
+
+size_t rank_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
+    assert(set && "Parameter can't be NULL.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (index >= set->capacity) {
+        return set->length;
+    }
+
+    if (!set->indexed) {
+        _ibitwise_set_index(set);
+    }
+
+    // add index's block rank, counts of words before index's word in block and bits before index in its word
+    size_t const idx = index / BIT_COUNT;
+    unsigned const relative = (unsigned)(index % BIT_COUNT);
+    size_t const block = idx / RANK_WORDS;
+    uint64_t const before = set->bits[idx] & ~(~(uint64_t)(0) >> relative);
+
+    return set->ranks[block] + count_bitwise(set->bits + (block * RANK_WORDS), idx % RANK_WORDS) + count_bitwise(&before, 1);
+}
+
+size_t select_ibitwise_set(ibitwise_set_s * const set, size_t const rank) {
+    assert(set && "Parameter can't be NULL.");
+    assert(rank < set->length && "Rank must be smaller than length.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (!set->indexed) {
+        _ibitwise_set_index(set);
+    }
+
+    // find last block with rank at most parameter's, so element is in it and not in any block after
+    size_t const words = set->capacity / BIT_COUNT;
+    size_t low = 0, high = ((words + RANK_WORDS - 1) / RANK_WORDS) - 1;
+    while (low < high) {
+        size_t const middle = low + ((high - low + 1) / 2);
+        if (set->ranks[middle] <= rank) {
+            low = middle;
+        } else {
+            high = middle - 1;
         }
     }
 
-    return true;
+    // skip words in block until the one containing element, then remove its elements before it
+    size_t remaining = rank - set->ranks[low];
+    size_t idx = low * RANK_WORDS;
+    for (size_t count = count_bitwise(set->bits + idx, 1); remaining >= count; count = count_bitwise(set->bits + idx, 1)) {
+        remaining -= count;
+        idx++;
+    }
+
+    uint64_t word = set->bits[idx];
+    for (; remaining; --remaining) {
+        word &= ~((uint64_t)(1) << (BIT_COUNT - 1 - _ibitwise_set_leading(word)));
+    }
+
+    return (idx * BIT_COUNT) + _ibitwise_set_leading(word);
+}
+
+size_t next_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
+    assert(set && "Parameter can't be NULL.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (index >= set->capacity) {
+        return IBITWISE_SPECIAL;
+    }
+
+    // check rest of index's word first, including index itself, since nearby elements are the common case
+    size_t const idx = index / BIT_COUNT;
+    unsigned const relative = (unsigned)(index % BIT_COUNT);
+    uint64_t const after = set->bits[idx] & (~(uint64_t)(0) >> relative);
+    if (after) {
+        return (idx * BIT_COUNT) + _ibitwise_set_leading(after);
+    }
+
+    // else next element is the first one ranked after every element up to index's word end
+    size_t const rank = rank_ibitwise_set(set, (idx + 1) * BIT_COUNT);
+
+    return rank < set->length ? select_ibitwise_set(set, rank) : IBITWISE_SPECIAL;
+}
+
+size_t prev_ibitwise_set(ibitwise_set_s * const set, size_t const index) {
+    assert(set && "Parameter can't be NULL.");
+
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (!set->length) {
+        return IBITWISE_SPECIAL;
+    }
+
+    // indexes beyond capacity start searching from last bit
+    size_t const last = index < set->capacity ? index : set->capacity - 1;
+    size_t const idx = last / BIT_COUNT;
+    unsigned const relative = (unsigned)(last % BIT_COUNT);
+    uint64_t const before = set->bits[idx] & (~(uint64_t)(0) << (BIT_COUNT - 1 - relative));
+    if (before) {
+        return (idx * BIT_COUNT) + (BIT_COUNT - 1 - _ibitwise_set_trailing(before));
+    }
+
+    // else previous element is the last one ranked before index's word start
+    size_t const rank = rank_ibitwise_set(set, idx * BIT_COUNT);
+
+    return rank ? select_ibitwise_set(set, rank - 1) : IBITWISE_SPECIAL;
 }
 
 void each_index_ibitwise_set(ibitwise_set_s const * const set, manage_fn const manage, void * const am) {
@@ -352,7 +640,7 @@ void each_index_ibitwise_set(ibitwise_set_s const * const set, manage_fn const m
         // calculate bits' array index and bit to check
         size_t const idx = i / BIT_COUNT;
         unsigned const relative = ((unsigned)(i) % BIT_COUNT);
-        unsigned const bit = 1U << (BIT_COUNT - relative - 1);
+        uint64_t const bit = (uint64_t)1 << (BIT_COUNT - relative - 1);
 
         // if bit isn't set continue, and if handle function returns false break the loop and quit main function
         if ((set->bits[idx] & bit) && !manage(&temp, am)) {
@@ -361,19 +649,21 @@ void each_index_ibitwise_set(ibitwise_set_s const * const set, manage_fn const m
     }
 }
 
-int _ibitwise_set_popcount(unsigned const bits) {
-#if defined(__GNUC__) || defined(__clang__) // if either gcc or clang is used, '__builtin_popcount*' is supported
-    return __builtin_popcount(bits);
-#else // else use custom popcount implementation
-    int count = 0;
+void each_run_ibitwise_set(ibitwise_set_s const * const set, manage_fn const manage, void * const am) {
+    assert(set && "Parameter can't be NULL.");
+    assert(manage && "Parameter can't be NULL.");
 
-    // while bits is not 0 increment count and remove its rightmost bit
-    for (unsigned b = bits; b; b ^= b & (~b + 1)) {
-        count++;
-    }
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
 
-    return count;
-#endif
+    // each run ends at first cleared bit after its start and next one starts at first set bit after that
+    for (size_t start = _ibitwise_set_seek(set, 0, true); start < set->capacity;) {
+        size_t run[2] = { start, _ibitwise_set_seek(set, start, false), };
+        if (!manage(run, am)) {
+            break;
+        }
+
+        start = _ibitwise_set_seek(set, run[1], true);
+    }
 }
 
 void _ibitwise_set_resize(ibitwise_set_s * const set, size_t const size) {
@@ -383,5 +673,142 @@ void _ibitwise_set_resize(ibitwise_set_s * const set, size_t const size) {
     }
 
     set->capacity = size;
+    set->indexed = false;
     assert((!set->capacity || set->bits) && "Memory allocation failed.");
 }
+
+size_t _ibitwise_set_fit(ibitwise_set_s const * const set) {
+    // remove leftmost chunks until one with a set bit is found
+    for (size_t capacity = set->capacity; capacity; capacity -= IBITWISE_SET_CHUNK) {
+        for (size_t i = (capacity - IBITWISE_SET_CHUNK) / BIT_COUNT; i < capacity / BIT_COUNT; ++i) {
+            if (set->bits[i]) {
+                return capacity;
+            }
+        }
+    }
+
+    return 0;
+}
+
+ibitwise_set_s _ibitwise_set_operate(ibitwise_set_s const * const one, ibitwise_set_s const * const two, bitwise_e const operation) {
+    ibitwise_set_s result = {
+        .capacity = one->capacity, .allocator = one->allocator,
+        .bits = one->allocator->alloc(one->capacity / CHAR_BIT, one->allocator->arg),
+    };
+    assert((!result.capacity || result.bits) && "Memory allocation failed.");
+
+    // combine shared words and count their bits in the same pass
+    size_t const words = (one->capacity < two->capacity ? one->capacity : two->capacity) / BIT_COUNT;
+    result.length = operate_bitwise(result.bits, one->bits, two->bits, words, operation);
+
+    // words beyond second structure are zero in it, so OR, ANDNOT and XOR leave first structure's words as they are
+    size_t const rest = (one->capacity / BIT_COUNT) - words;
+    if (rest) {
+        memcpy(result.bits + words, one->bits + words, rest * sizeof(uint64_t));
+        result.length += count_bitwise(one->bits + words, rest);
+    }
+
+    return result;
+}
+
+void _ibitwise_set_trim(ibitwise_set_s * const set, size_t const capacity) {
+    size_t const allocated = set->capacity;
+
+    // fit only checks words below capacity, so words beyond it are dropped with empty chunks in a single reallocation
+    set->capacity = capacity;
+    size_t const fit = _ibitwise_set_fit(set);
+    if (allocated != fit) {
+        _ibitwise_set_resize(set, fit);
+    }
+}
+
+void _ibitwise_set_index(ibitwise_set_s * const set) {
+    size_t const words = set->capacity / BIT_COUNT;
+    size_t const blocks = (words + RANK_WORDS - 1) / RANK_WORDS;
+
+    // last entry holds total count, so every block has its end rank as well
+    set->ranks = set->allocator->realloc(set->ranks, (blocks + 1) * sizeof(size_t), set->allocator->arg);
+    assert(set->ranks && "Memory allocation failed.");
+
+    size_t rank = 0;
+    for (size_t i = 0; i < blocks; ++i) {
+        set->ranks[i] = rank;
+
+        size_t const start = i * RANK_WORDS;
+        rank += count_bitwise(set->bits + start, (words - start) < RANK_WORDS ? (words - start) : RANK_WORDS);
+    }
+    set->ranks[blocks] = rank;
+
+    set->indexed = true;
+}
+
+size_t _ibitwise_set_apply(uint64_t * const word, uint64_t const mask, bool const value) {
+    uint64_t const changed = value ? (mask & ~(*word)) : (mask & (*word));
+    (*word) ^= changed;
+
+    return count_bitwise(&changed, 1);
+}
+
+size_t _ibitwise_set_fill(uint64_t * const bits, size_t const start, size_t const end, bool const value) {
+    size_t const first = start / BIT_COUNT, last = (end - 1) / BIT_COUNT;
+
+    // bits are ordered from most significant one, so head keeps bits from start and tail bits up to end
+    uint64_t const head = ~(uint64_t)(0) >> (start % BIT_COUNT);
+    uint64_t const tail = ~(uint64_t)(0) << (BIT_COUNT - 1 - ((end - 1) % BIT_COUNT));
+    if (first == last) {
+        return _ibitwise_set_apply(bits + first, head & tail, value);
+    }
+
+    size_t changed = _ibitwise_set_apply(bits + first, head, value) + _ibitwise_set_apply(bits + last, tail, value);
+
+    // inner words become full or empty, so only their current set bits must be counted
+    size_t const inner = last - first - 1;
+    size_t const count = count_bitwise(bits + first + 1, inner);
+    changed += value ? (inner * BIT_COUNT) - count : count;
+    memset(bits + first + 1, value ? 0xFF : 0x00, inner * sizeof(uint64_t));
+
+    return changed;
+}
+
+size_t _ibitwise_set_seek(ibitwise_set_s const * const set, size_t const start, bool const value) {
+    size_t idx = start / BIT_COUNT;
+    size_t const words = set->capacity / BIT_COUNT;
+    if (idx >= words) {
+        return set->capacity;
+    }
+
+    // searching for cleared bit is the same as searching for set bit in inverted word, bits before start are ignored
+    uint64_t word = (value ? set->bits[idx] : ~(set->bits[idx])) & (~(uint64_t)(0) >> (start % BIT_COUNT));
+    while (!word) {
+        if (++idx == words) {
+            return set->capacity;
+        }
+        word = value ? set->bits[idx] : ~(set->bits[idx]);
+    }
+
+    return (idx * BIT_COUNT) + _ibitwise_set_leading(word);
+}
+
+size_t _ibitwise_set_leading(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(__builtin_clzll(word));
+#else
+    size_t count = 0;
+    for (uint64_t w = word; !(w & ((uint64_t)(1) << (BIT_COUNT - 1))); w <<= 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+size_t _ibitwise_set_trailing(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(__builtin_ctzll(word));
+#else
+    size_t count = 0;
+    for (uint64_t w = word; !(w & 1u); w >>= 1) {
+        count++;
+    }
+    return count;
+#endif
+}
@@ -0,0 +1,865 @@
+#include <set/ioa_hash_set.h>
+
+#include <stdlib.h> // imports exit()
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define IOA_HASH_SET_SSE2
+#   define GROUP 16 // control bytes scanned by a single SSE2 comparison
+#   define SHIFT 0  // match mask has one bit per control byte
+#else
+#   define GROUP 8  // control bytes scanned by a single 64-bit word (SWAR) comparison
+#   define SHIFT 3  // match mask has one high bit per control byte
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+#define NIL (size_t)(-1)
+
+#define EMPTY   (unsigned char)(0x80)
+#define DELETED (unsigned char)(0xFE)
+
+#define LSBS (uint64_t)(0x0101010101010101)
+#define MSBS (uint64_t)(0x8080808080808080)
+
+// minimum capacity must hold at least one whole control group
+#define MINIMUM (IOA_HASH_SET_CHUNK < GROUP ? GROUP : IOA_HASH_SET_CHUNK)
+
+/// @brief Mixes user provided hash so that both its low (index) and high (tag) bits are usable.
+/// @param hash User provided hash value.
+/// @return Avalanched hash value.
+size_t _ioa_hash_set_mix(size_t const hash);
+
+/// @brief Calculates maximum number of occupied (full and deleted) slots before table must grow.
+/// @param capacity Capacity of table.
+/// @return Maximum occupied slots.
+size_t _ioa_hash_set_limit(size_t const capacity);
+
+/// @brief Creates bit mask of control bytes in group that are equal to tag.
+/// @param group Pointer to first control byte in group.
+/// @param tag 7-bit hash tag to match.
+/// @return Bit mask of matches, may contain false positives.
+uint64_t _ioa_hash_set_match(unsigned char const * const group, unsigned char const tag);
+
+/// @brief Creates bit mask of empty control bytes in group.
+/// @param group Pointer to first control byte in group.
+/// @return Bit mask of empty control bytes.
+uint64_t _ioa_hash_set_match_empty(unsigned char const * const group);
+
+/// @brief Creates bit mask of empty or deleted control bytes in group.
+/// @param group Pointer to first control byte in group.
+/// @return Bit mask of free control bytes.
+uint64_t _ioa_hash_set_match_free(unsigned char const * const group);
+
+/// @brief Gets offset of lowest matched control byte in group.
+/// @param mask Non-zero match mask.
+/// @return Offset of control byte in group.
+size_t _ioa_hash_set_lowest(uint64_t const mask);
+
+/// @brief Gets offset of highest matched control byte in group.
+/// @param mask Non-zero match mask.
+/// @return Offset of control byte in group.
+size_t _ioa_hash_set_highest(uint64_t const mask);
+
+/// @brief Sets control byte at index and its mirrored copy past the end of the table.
+/// @param set Structure to set control byte in.
+/// @param index Index of slot.
+/// @param value Control byte value.
+void _ioa_hash_set_control(ioa_hash_set_s const * const set, size_t const index, unsigned char const value);
+
+/// @brief Finds first free (empty or deleted) slot in probe sequence of hash.
+/// @param set Structure to probe.
+/// @param hash Mixed hash value.
+/// @return Index of free slot.
+size_t _ioa_hash_set_free_slot(ioa_hash_set_s const * const set, size_t const hash);
+
+/// @brief Finds slot containing element.
+/// @param set Structure to probe.
+/// @param element Element to find.
+/// @param hash Mixed hash value of element.
+/// @return Index of slot if found, 'NIL' otherwise.
+size_t _ioa_hash_set_find(ioa_hash_set_s const * const set, void const * const element, size_t const hash);
+
+/// @brief Resizes (reallocates) set arrays and reinserts every element, removing deleted slots.
+/// @param set Structure to resize.
+/// @param size New capacity, either zero or power of two.
+void _ioa_hash_set_resize(ioa_hash_set_s * const set, size_t const size);
+
+/// @brief Grows (or purges deleted slots of) structure if it can't contain a new element.
+/// @param set Structure to reserve slot in.
+void _ioa_hash_set_reserve(ioa_hash_set_s * const set);
+
+/// @brief Calculates smallest valid capacity that can contain length elements without growing.
+/// @param length Number of elements to fit.
+/// @return Zero if length is zero, else power of two capacity.
+size_t _ioa_hash_set_fit(size_t const length);
+
+/// @brief Make logic wrapper mainly to repeated assertion for specific structure operations.
+/// @param size Size of single element.
+/// @param hash Hash function to generate hash values from elements.
+/// @param ah Arguments for hash function pointer.
+/// @param compare Compare function to compare elements.
+/// @param ac Arguments for compare function pointer.
+/// @param allocator Custom allocator function.
+/// @return Set structure.
+ioa_hash_set_s _make_wrapper_ioa_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator);
+
+/// @brief Copy logic wrapper mainly to repeated assertion for specific structure operations.
+/// @param set Structure to copy.
+/// @param copy Function pointer to create shallow/deep copy of single element
+/// @param ac Arguments for copy function pointer.
+/// @return Set structure.
+ioa_hash_set_s _copy_wrapper_ioa_hash_set(ioa_hash_set_s const * const set, copy_fn const copy, void * const ac);
+
+/// @brief Insert logic wrapper mainly to remove repeated code snippeds.
+/// @param set Structure to call insert logic on.
+/// @param element Element to insert.
+/// @param hash Mixed hash of element to be inserted.
+/// @param copy Function pointer to create shallow/deep copy of element.
+/// @param ac Arguments for copy function pointer.
+void _insert_wrapper_ioa_hash_set(ioa_hash_set_s * const set, void const * const element, size_t const hash, copy_fn const copy, void * const ac);
+
+/// @brief Copies element into destination via memcpy, used as default insert copy.
+/// @param destination Destination element.
+/// @param source Source element.
+/// @param size Pointer to size of element.
+/// @return Destination element.
+void * _ioa_hash_set_memcpy(void * const destination, void const * const source, void * size);
+
+ioa_hash_set_s create_ioa_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac) {
+    error(hash && "Parameter can't be NULL.");
+    error(compare && "Parameter can't be NULL.");
+    error(size && "Parameter can't be zero.");
+
+    return (ioa_hash_set_s) { .size = size, .hash = hash, .compare = compare, .allocator = &standard, .ah = ah, .ac = ac, };
+}
+
+ioa_hash_set_s make_ioa_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator) {
+    error(hash && "Parameter can't be NULL.");
+    error(compare && "Parameter can't be NULL.");
+    error(size && "Parameter can't be zero.");
+    error(allocator && "Parameter can't be NULL.");
+
+    return _make_wrapper_ioa_hash_set(size, hash, ah, compare, ac, allocator);
+}
+
+void destroy_ioa_hash_set(ioa_hash_set_s * const set, set_fn const destroy, void * const ad) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // for each full slot call destroy function on its element
+    for (size_t i = 0; i < set->capacity; ++i) {
+        if (!(set->control[i] & EMPTY)) {
+            destroy(set->elements + (i * set->size), ad);
+        }
+    }
+
+    // free arrays
+    set->allocator->free(set->elements, set->allocator->arg);
+    set->allocator->free(set->control, set->allocator->arg);
+
+    // set everything to zero/false
+    memset(set, 0, sizeof(ioa_hash_set_s));
+}
+
+void clear_ioa_hash_set(ioa_hash_set_s * const set, set_fn const destroy, void * const ad) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // for each full slot call destroy function on its element
+    for (size_t i = 0; i < set->capacity; ++i) {
+        if (!(set->control[i] & EMPTY)) {
+            destroy(set->elements + (i * set->size), ad);
+        }
+    }
+
+    // free arrays
+    set->allocator->free(set->elements, set->allocator->arg);
+    set->allocator->free(set->control, set->allocator->arg);
+
+    // only clear set (keep the set usable)
+    set->capacity = set->length = set->tombs = 0;
+
+    set->elements = NULL;
+    set->control = NULL;
+}
+
+ioa_hash_set_s copy_ioa_hash_set(ioa_hash_set_s const * const set, copy_fn const copy, void * const ac) {
+    error(set && "Parameter can't be NULL.");
+    error(copy && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    return _copy_wrapper_ioa_hash_set(set, copy, ac);
+}
+
+bool is_empty_ioa_hash_set(ioa_hash_set_s const * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    return !(set->length); // if 0 return 'true'
+}
+
+void reserve_ioa_hash_set(ioa_hash_set_s * const set, size_t const capacity) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    size_t const size = _ioa_hash_set_fit(capacity);
+    if (size > set->capacity) {
+        _ioa_hash_set_resize(set, size);
+    }
+}
+
+void shrink_to_fit_ioa_hash_set(ioa_hash_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    size_t const size = _ioa_hash_set_fit(set->length);
+    if (size != set->capacity) {
+        _ioa_hash_set_resize(set, size);
+    }
+}
+
+void insert_ioa_hash_set(ioa_hash_set_s * const set, void const * const element) {
+    error(set && "Parameter can't be NULL.");
+    error(element && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // calculate hash value
+    size_t const hash = _ioa_hash_set_mix(set->hash(element, set->ah));
+
+    // check if element is in set or not
+    error((!set->capacity || NIL == _ioa_hash_set_find(set, element, hash)) && "Key must be unique.");
+
+    _insert_wrapper_ioa_hash_set(set, element, hash, _ioa_hash_set_memcpy, &(set->size));
+}
+
+void remove_ioa_hash_set(ioa_hash_set_s * const set, void const * const element, void * const buffer) {
+    error(set && "Parameter can't be NULL.");
+    error(element && "Parameter can't be NULL.");
+    error(buffer && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // calculate hash value and slot in array
+    size_t const hash = _ioa_hash_set_mix(set->hash(element, set->ah));
+    size_t const slot = set->capacity ? _ioa_hash_set_find(set, element, hash) : NIL;
+
+    if (NIL == slot) {
+        error(false && "Structure does not contain element.");
+        exit(EXIT_FAILURE); // terminate on error
+    }
+
+    // copy removed element into buffer
+    memcpy(buffer, set->elements + (slot * set->size), set->size);
+    set->length--;
+
+    // if every group window containing slot also contains an empty slot then no probe ever passed through it
+    size_t const mask = set->capacity - 1;
+    uint64_t const empty_after = _ioa_hash_set_match_empty(set->control + slot);
+    uint64_t const empty_before = _ioa_hash_set_match_empty(set->control + ((slot - GROUP) & mask));
+
+    bool const never_full = empty_after && empty_before &&
+        (_ioa_hash_set_lowest(empty_after) + (GROUP - 1 - _ioa_hash_set_highest(empty_before))) < GROUP;
+    if (never_full) {
+        _ioa_hash_set_control(set, slot, EMPTY);
+    } else {
+        _ioa_hash_set_control(set, slot, DELETED);
+        set->tombs++;
+    }
+
+    // resize (shrink) if set can contain a smaller capacity of elements
+    if (!set->length) {
+        _ioa_hash_set_resize(set, 0);
+    } else if (set->length <= set->capacity / (CERPEC_FACTOR * CERPEC_FACTOR) && set->capacity > MINIMUM) {
+        _ioa_hash_set_resize(set, set->capacity / CERPEC_FACTOR);
+    }
+}
+
+bool contains_ioa_hash_set(ioa_hash_set_s const * const set, void const * const element) {
+    error(set && "Parameter can't be NULL.");
+    error(element && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // early return to avoid probing an unallocated table
+    if (!set->capacity) { return false; }
+
+    size_t const hash = _ioa_hash_set_mix(set->hash(element, set->ah));
+
+    return (NIL != _ioa_hash_set_find(set, element, hash));
+}
+
+ioa_hash_set_s union_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two, copy_fn const copy, void * const ac) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+    error(copy && "Parameter can't be NULL.");
+    error(set_one->hash == set_two->hash && "Function pointers must be the same.");
+    error(set_one->size == set_two->size && "Sizes must be the same.");
+
+    valid(set_one->size && "Size can't be zero.");
+    valid(set_one->hash && "Hash function can't be NULL.");
+    valid(set_one->compare && "Compare function can't be NULL.");
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_one->length + set_one->tombs <= set_one->capacity && "Lenght can't be larger than capacity.");
+
+    valid(set_two->size && "Size can't be zero.");
+    valid(set_two->hash && "Hash function can't be NULL.");
+    valid(set_two->compare && "Compare function can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+    valid(set_two->length + set_two->tombs <= set_two->capacity && "Lenght can't be larger than capacity.");
+
+    // get minimum and maximum sets to avoid pointless resizing via only pushing minimum set's elements to maximum's replica
+    ioa_hash_set_s const * const minimum = set_one->length < set_two->length ? set_one : set_two;
+    ioa_hash_set_s const * const maximum = set_one->length >= set_two->length ? set_one : set_two;
+
+    // copy maximum set into set union
+    ioa_hash_set_s set_union = _copy_wrapper_ioa_hash_set(maximum, copy, ac);
+    for (size_t m = 0; m < minimum->capacity; ++m) {
+        if (minimum->control[m] & EMPTY) { continue; }
+
+        char const * const element = minimum->elements + (m * minimum->size);
+        size_t const hash = _ioa_hash_set_mix(minimum->hash(element, minimum->ah));
+
+        // if element is not in the set push it to set union
+        if (!set_union.capacity || NIL == _ioa_hash_set_find(&set_union, element, hash)) {
+            _insert_wrapper_ioa_hash_set(&set_union, element, hash, copy, ac);
+        }
+    }
+
+    return set_union;
+}
+
+ioa_hash_set_s intersect_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two, copy_fn const copy, void * const ac) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+    error(copy && "Parameter can't be NULL.");
+    error(set_one->hash == set_two->hash && "Function pointers must be the same.");
+    error(set_one->size == set_two->size && "Sizes must be the same.");
+
+    valid(set_one->size && "Size can't be zero.");
+    valid(set_one->hash && "Hash function can't be NULL.");
+    valid(set_one->compare && "Compare function can't be NULL.");
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_one->length + set_one->tombs <= set_one->capacity && "Lenght can't be larger than capacity.");
+
+    valid(set_two->size && "Size can't be zero.");
+    valid(set_two->hash && "Hash function can't be NULL.");
+    valid(set_two->compare && "Compare function can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+    valid(set_two->length + set_two->tombs <= set_two->capacity && "Lenght can't be larger than capacity.");
+
+    // get minimum and maximum sets to only probe maximum set with minimum set's elements
+    ioa_hash_set_s const * const minimum = set_one->length < set_two->length ? set_one : set_two;
+    ioa_hash_set_s const * const maximum = set_one->length >= set_two->length ? set_one : set_two;
+
+    ioa_hash_set_s set_intersect = _make_wrapper_ioa_hash_set(set_one->size, set_one->hash, set_one->ah, set_one->compare, set_one->ac, set_one->allocator);
+    if (!maximum->capacity) { return set_intersect; }
+
+    for (size_t m = 0; m < minimum->capacity; ++m) {
+        if (minimum->control[m] & EMPTY) { continue; }
+
+        char const * const element = minimum->elements + (m * minimum->size);
+        size_t const hash = _ioa_hash_set_mix(minimum->hash(element, minimum->ah));
+
+        // if element is in set push it into intersect
+        if (NIL != _ioa_hash_set_find(maximum, element, hash)) {
+            _insert_wrapper_ioa_hash_set(&set_intersect, element, hash, copy, ac);
+        }
+    }
+
+    return set_intersect;
+}
+
+ioa_hash_set_s subtract_ioa_hash_set(ioa_hash_set_s const * const minuend, ioa_hash_set_s const * const subtrahend, copy_fn const copy, void * const ac) {
+    error(minuend && "Parameter can't be NULL.");
+    error(subtrahend && "Parameter can't be NULL.");
+    error(copy && "Parameter can't be NULL.");
+    error(minuend->hash == subtrahend->hash && "Function pointers must be the same.");
+    error(minuend->size == subtrahend->size && "Sizes must be the same.");
+
+    valid(minuend->size && "Size can't be zero.");
+    valid(minuend->hash && "Hash function can't be NULL.");
+    valid(minuend->compare && "Compare function can't be NULL.");
+    valid(minuend->allocator && "Allocator can't be NULL.");
+    valid(minuend->length + minuend->tombs <= minuend->capacity && "Lenght can't be larger than capacity.");
+
+    valid(subtrahend->size && "Size can't be zero.");
+    valid(subtrahend->hash && "Hash function can't be NULL.");
+    valid(subtrahend->compare && "Compare function can't be NULL.");
+    valid(subtrahend->allocator && "Allocator can't be NULL.");
+    valid(subtrahend->length + subtrahend->tombs <= subtrahend->capacity && "Lenght can't be larger than capacity.");
+
+    ioa_hash_set_s set_subtract = _make_wrapper_ioa_hash_set(minuend->size, minuend->hash, minuend->ah, minuend->compare, minuend->ac, minuend->allocator);
+    for (size_t m = 0; m < minuend->capacity; ++m) {
+        if (minuend->control[m] & EMPTY) { continue; }
+
+        char const * const element = minuend->elements + (m * minuend->size);
+        size_t const hash = _ioa_hash_set_mix(minuend->hash(element, minuend->ah));
+
+        // if minuend element is not in subtrahend set push it to new set
+        if (!subtrahend->capacity || NIL == _ioa_hash_set_find(subtrahend, element, hash)) {
+            _insert_wrapper_ioa_hash_set(&set_subtract, element, hash, copy, ac);
+        }
+    }
+
+    return set_subtract;
+}
+
+ioa_hash_set_s exclude_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two, copy_fn const copy, void * const ac) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+    error(copy && "Parameter can't be NULL.");
+    error(set_one->hash == set_two->hash && "Function pointers must be the same.");
+    error(set_one->size == set_two->size && "Sizes must be the same.");
+
+    valid(set_one->size && "Size can't be zero.");
+    valid(set_one->hash && "Hash function can't be NULL.");
+    valid(set_one->compare && "Compare function can't be NULL.");
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_one->length + set_one->tombs <= set_one->capacity && "Lenght can't be larger than capacity.");
+
+    valid(set_two->size && "Size can't be zero.");
+    valid(set_two->hash && "Hash function can't be NULL.");
+    valid(set_two->compare && "Compare function can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+    valid(set_two->length + set_two->tombs <= set_two->capacity && "Lenght can't be larger than capacity.");
+
+    ioa_hash_set_s set_exclude = _make_wrapper_ioa_hash_set(set_one->size, set_one->hash, set_one->ah, set_one->compare, set_one->ac, set_one->allocator);
+
+    for (size_t one = 0; one < set_one->capacity; ++one) {
+        if (set_one->control[one] & EMPTY) { continue; }
+
+        char const * const element = set_one->elements + (one * set_one->size);
+        size_t const hash = _ioa_hash_set_mix(set_one->hash(element, set_one->ah));
+
+        if (!set_two->capacity || NIL == _ioa_hash_set_find(set_two, element, hash)) {
+            _insert_wrapper_ioa_hash_set(&set_exclude, element, hash, copy, ac);
+        }
+    }
+
+    for (size_t two = 0; two < set_two->capacity; ++two) {
+        if (set_two->control[two] & EMPTY) { continue; }
+
+        char const * const element = set_two->elements + (two * set_two->size);
+        size_t const hash = _ioa_hash_set_mix(set_two->hash(element, set_two->ah));
+
+        if (!set_one->capacity || NIL == _ioa_hash_set_find(set_one, element, hash)) {
+            _insert_wrapper_ioa_hash_set(&set_exclude, element, hash, copy, ac);
+        }
+    }
+
+    return set_exclude;
+}
+
+bool is_subset_ioa_hash_set(ioa_hash_set_s const * const superset, ioa_hash_set_s const * const subset) {
+    error(superset && "Parameter can't be NULL.");
+    error(subset && "Parameter can't be NULL.");
+    error(superset->hash == subset->hash && "Function pointers must be the same.");
+    error(superset->size == subset->size && "Sizes must be the same.");
+
+    valid(superset->size && "Size can't be zero.");
+    valid(superset->hash && "Hash function can't be NULL.");
+    valid(superset->compare && "Compare function can't be NULL.");
+    valid(superset->allocator && "Allocator can't be NULL.");
+    valid(superset->length + superset->tombs <= superset->capacity && "Lenght can't be larger than capacity.");
+
+    valid(subset->size && "Size can't be zero.");
+    valid(subset->hash && "Hash function can't be NULL.");
+    valid(subset->compare && "Compare function can't be NULL.");
+    valid(subset->allocator && "Allocator can't be NULL.");
+    valid(subset->length + subset->tombs <= subset->capacity && "Lenght can't be larger than capacity.");
+
+    if (subset->length > superset->length) { return false; }
+
+    for (size_t sub = 0; sub < subset->capacity; ++sub) {
+        if (subset->control[sub] & EMPTY) { continue; }
+
+        char const * const element = subset->elements + (sub * subset->size);
+        size_t const hash = _ioa_hash_set_mix(subset->hash(element, subset->ah));
+
+        if (NIL == _ioa_hash_set_find(superset, element, hash)) { return false; }
+    }
+
+    return true;
+}
+
+bool is_proper_subset_ioa_hash_set(ioa_hash_set_s const * const superset, ioa_hash_set_s const * const subset) {
+    error(superset && "Parameter can't be NULL.");
+    error(subset && "Parameter can't be NULL.");
+    error(superset->hash == subset->hash && "Function pointers must be the same.");
+    error(superset->size == subset->size && "Sizes must be the same.");
+
+    valid(superset->size && "Size can't be zero.");
+    valid(superset->hash && "Hash function can't be NULL.");
+    valid(superset->compare && "Compare function can't be NULL.");
+    valid(superset->allocator && "Allocator can't be NULL.");
+    valid(superset->length + superset->tombs <= superset->capacity && "Lenght can't be larger than capacity.");
+
+    valid(subset->size && "Size can't be zero.");
+    valid(subset->hash && "Hash function can't be NULL.");
+    valid(subset->compare && "Compare function can't be NULL.");
+    valid(subset->allocator && "Allocator can't be NULL.");
+    valid(subset->length + subset->tombs <= subset->capacity && "Lenght can't be larger than capacity.");
+
+    if (subset->length >= superset->length) { return false; }
+
+    for (size_t sub = 0; sub < subset->capacity; ++sub) {
+        if (subset->control[sub] & EMPTY) { continue; }
+
+        char const * const element = subset->elements + (sub * subset->size);
+        size_t const hash = _ioa_hash_set_mix(subset->hash(element, subset->ah));
+
+        if (NIL == _ioa_hash_set_find(superset, element, hash)) { return false; }
+    }
+
+    return true;
+}
+
+bool is_disjoint_ioa_hash_set(ioa_hash_set_s const * const set_one, ioa_hash_set_s const * const set_two) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+    error(set_one->hash == set_two->hash && "Function pointers must be the same.");
+    error(set_one->size == set_two->size && "Sizes must be the same.");
+
+    valid(set_one->size && "Size can't be zero.");
+    valid(set_one->hash && "Hash function can't be NULL.");
+    valid(set_one->compare && "Compare function can't be NULL.");
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_one->length + set_one->tombs <= set_one->capacity && "Lenght can't be larger than capacity.");
+
+    valid(set_two->size && "Size can't be zero.");
+    valid(set_two->hash && "Hash function can't be NULL.");
+    valid(set_two->compare && "Compare function can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+    valid(set_two->length + set_two->tombs <= set_two->capacity && "Lenght can't be larger than capacity.");
+
+    ioa_hash_set_s const * const minimum = set_one->length < set_two->length ? set_one : set_two;
+    ioa_hash_set_s const * const maximum = set_one->length >= set_two->length ? set_one : set_two;
+
+    if (!maximum->capacity) { return true; }
+
+    for (size_t m = 0; m < minimum->capacity; ++m) {
+        if (minimum->control[m] & EMPTY) { continue; }
+
+        char const * const element = minimum->elements + (m * minimum->size);
+        size_t const hash = _ioa_hash_set_mix(minimum->hash(element, minimum->ah));
+
+        if (NIL != _ioa_hash_set_find(maximum, element, hash)) { return false; }
+    }
+
+    return true;
+}
+
+void each_ioa_hash_set(ioa_hash_set_s const * const set, manage_fn const manage, void * const am) {
+    error(set && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length + set->tombs <= set->capacity && "Lenght can't be larger than capacity.");
+
+    for (size_t i = 0; i < set->capacity; ++i) {
+        if (set->control[i] & EMPTY) { continue; }
+
+        if (!manage(set->elements + (i * set->size), am)) { break; }
+    }
+}
+
+size_t _ioa_hash_set_mix(size_t const hash) {
+    // murmur3's 64-bit finalizer, low bits of the result are used on 32-bit platforms
+    uint64_t mix = (uint64_t)(hash);
+    mix ^= mix >> 33;
+    mix *= (uint64_t)(0xff51afd7ed558ccd);
+    mix ^= mix >> 33;
+
+    return (size_t)(mix);
+}
+
+size_t _ioa_hash_set_limit(size_t const capacity) {
+    return capacity - (capacity / 8); // maximum load factor of 7/8
+}
+
+uint64_t _ioa_hash_set_match(unsigned char const * const group, unsigned char const tag) {
+#ifdef IOA_HASH_SET_SSE2
+    __m128i const control = _mm_loadu_si128((__m128i const *)(group));
+    return (uint64_t)(unsigned)(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)(tag)), control)));
+#else
+    uint64_t word = 0;
+    memcpy(&word, group, sizeof(uint64_t));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    word = __builtin_bswap64(word);
+#endif
+
+    // zero bytes of 'word ^ tag' are matches, borrow may only cause false positives above a true match
+    uint64_t const match = word ^ (LSBS * tag);
+    return (match - LSBS) & ~match & MSBS;
+#endif
+}
+
+uint64_t _ioa_hash_set_match_empty(unsigned char const * const group) {
+#ifdef IOA_HASH_SET_SSE2
+    __m128i const control = _mm_loadu_si128((__m128i const *)(group));
+    return (uint64_t)(unsigned)(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)(EMPTY)), control)));
+#else
+    uint64_t word = 0;
+    memcpy(&word, group, sizeof(uint64_t));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    word = __builtin_bswap64(word);
+#endif
+
+    // empty is the only control byte with highest bit set and second lowest bit unset
+    return word & ~(word << 6) & MSBS;
+#endif
+}
+
+uint64_t _ioa_hash_set_match_free(unsigned char const * const group) {
+#ifdef IOA_HASH_SET_SSE2
+    __m128i const control = _mm_loadu_si128((__m128i const *)(group));
+    return (uint64_t)(unsigned)(_mm_movemask_epi8(control));
+#else
+    uint64_t word = 0;
+    memcpy(&word, group, sizeof(uint64_t));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    word = __builtin_bswap64(word);
+#endif
+
+    // full control bytes are 7-bit tags, so highest bit marks empty or deleted bytes
+    return word & MSBS;
+#endif
+}
+
+size_t _ioa_hash_set_lowest(uint64_t const mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(__builtin_ctzll(mask)) >> SHIFT;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index = 0;
+    _BitScanForward64(&index, mask);
+    return (size_t)(index) >> SHIFT;
+#else
+    size_t index = 0;
+    for (uint64_t m = mask; !(m & 1); m >>= 1) { index++; }
+    return index >> SHIFT;
+#endif
+}
+
+size_t _ioa_hash_set_highest(uint64_t const mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(63 - __builtin_clzll(mask)) >> SHIFT;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index = 0;
+    _BitScanReverse64(&index, mask);
+    return (size_t)(index) >> SHIFT;
+#else
+    size_t index = 63;
+    for (uint64_t m = mask; !(m & ((uint64_t)(1) << 63)); m <<= 1) { index--; }
+    return index >> SHIFT;
+#endif
+}
+
+void _ioa_hash_set_control(ioa_hash_set_s const * const set, size_t const index, unsigned char const value) {
+    set->control[index] = value;
+
+    // mirror first group past the end so that any group can be loaded without wrapping
+    if (index < GROUP) {
+        set->control[set->capacity + index] = value;
+    }
+}
+
+size_t _ioa_hash_set_free_slot(ioa_hash_set_s const * const set, size_t const hash) {
+    size_t const mask = set->capacity - 1;
+
+    // triangular probing over groups visits every group since capacity is a power of two
+    size_t position = (hash >> 7) & mask;
+    for (size_t step = GROUP; ; step += GROUP) {
+        uint64_t const free = _ioa_hash_set_match_free(set->control + position);
+        if (free) {
+            return (position + _ioa_hash_set_lowest(free)) & mask;
+        }
+
+        position = (position + step) & mask;
+    }
+}
+
+size_t _ioa_hash_set_find(ioa_hash_set_s const * const set, void const * const element, size_t const hash) {
+    size_t const mask = set->capacity - 1;
+    unsigned char const tag = (unsigned char)(hash & 0x7F);
+
+    size_t position = (hash >> 7) & mask;
+    for (size_t step = GROUP; ; step += GROUP) {
+        unsigned char const * const group = set->control + position;
+
+        // compare only elements whose tag matches
+        for (uint64_t match = _ioa_hash_set_match(group, tag); match; match &= match - 1) {
+            size_t const slot = (position + _ioa_hash_set_lowest(match)) & mask;
+            if (!set->compare(element, set->elements + (slot * set->size), set->ac)) {
+                return slot;
+            }
+        }
+
+        // an empty slot terminates every probe sequence that could contain element
+        if (_ioa_hash_set_match_empty(group)) {
+            return NIL;
+        }
+
+        position = (position + step) & mask;
+    }
+}
+
+void _ioa_hash_set_resize(ioa_hash_set_s * const set, size_t const size) {
+    char * const elements = set->elements;
+    unsigned char * const control = set->control;
+    size_t const capacity = set->capacity;
+
+    // set table to new resized parameters
+    set->capacity = size;
+    set->tombs = 0;
+    set->elements = NULL;
+    set->control = NULL;
+
+    if (size) {
+        set->elements = set->allocator->alloc(size * set->size, set->allocator->arg);
+        error(set->elements && "Memory allocation failed.");
+
+        set->control = set->allocator->alloc(size + GROUP, set->allocator->arg);
+        error(set->control && "Memory allocation failed.");
+
+        memset(set->control, EMPTY, size + GROUP);
+    }
+
+    // reinsert elements into their new slots (deleted slots are dropped)
+    for (size_t i = 0; i < capacity; ++i) {
+        if (control[i] & EMPTY) { continue; }
+
+        char const * const element = elements + (i * set->size);
+        size_t const hash = _ioa_hash_set_mix(set->hash(element, set->ah));
+        size_t const slot = _ioa_hash_set_free_slot(set, hash);
+
+        _ioa_hash_set_control(set, slot, (unsigned char)(hash & 0x7F));
+        memcpy(set->elements + (slot * set->size), element, set->size);
+    }
+
+    set->allocator->free(elements, set->allocator->arg);
+    set->allocator->free(control, set->allocator->arg);
+}
+
+void _ioa_hash_set_reserve(ioa_hash_set_s * const set) {
+    if (!set->capacity) {
+        _ioa_hash_set_resize(set, MINIMUM);
+    } else if (set->length + set->tombs + 1 > _ioa_hash_set_limit(set->capacity)) {
+        // if deleted slots take up most of the load then rehashing in place is enough
+        bool const purge = set->length + 1 <= _ioa_hash_set_limit(set->capacity) / 2;
+        _ioa_hash_set_resize(set, purge ? set->capacity : set->capacity * CERPEC_FACTOR);
+    }
+}
+
+size_t _ioa_hash_set_fit(size_t const length) {
+    if (!length) {
+        return 0;
+    }
+
+    size_t capacity = MINIMUM;
+    while (_ioa_hash_set_limit(capacity) < length) {
+        error(capacity <= SIZE_MAX / CERPEC_FACTOR && "Capacity overflow.");
+        capacity *= CERPEC_FACTOR;
+    }
+
+    return capacity;
+}
+
+ioa_hash_set_s _make_wrapper_ioa_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator) {
+    return (ioa_hash_set_s) { .size = size, .hash = hash, .compare = compare, .allocator = allocator, .ah = ah, .ac = ac, };
+}
+
+ioa_hash_set_s _copy_wrapper_ioa_hash_set(ioa_hash_set_s const * const set, copy_fn const copy, void * const ac) {
+    ioa_hash_set_s replica = _make_wrapper_ioa_hash_set(set->size, set->hash, set->ah, set->compare, set->ac, set->allocator);
+    if (!set->capacity) { return replica; }
+
+    // create replica with the same slot layout, so no element must be rehashed
+    replica.capacity = set->capacity;
+    replica.length = set->length;
+    replica.tombs = set->tombs;
+
+    replica.elements = set->allocator->alloc(set->capacity * set->size, set->allocator->arg);
+    error(replica.elements && "Memory allocation failed.");
+
+    replica.control = set->allocator->alloc(set->capacity + GROUP, set->allocator->arg);
+    error(replica.control && "Memory allocation failed.");
+
+    memcpy(replica.control, set->control, set->capacity + GROUP);
+
+    // for each full slot call copy function
+    for (size_t i = 0; i < set->capacity; ++i) {
+        if (set->control[i] & EMPTY) { continue; }
+
+        copy(replica.elements + (i * replica.size), set->elements + (i * set->size), ac);
+    }
+
+    return replica;
+}
+
+void _insert_wrapper_ioa_hash_set(ioa_hash_set_s * const set, void const * const element, size_t const hash, copy_fn const copy, void * const ac) {
+    // resize (expand) if set can't contain new element
+    _ioa_hash_set_reserve(set);
+
+    size_t const slot = _ioa_hash_set_free_slot(set, hash);
+    if (DELETED == set->control[slot]) {
+        set->tombs--;
+    }
+
+    _ioa_hash_set_control(set, slot, (unsigned char)(hash & 0x7F));
+    copy(set->elements + (slot * set->size), element, ac);
+    set->length++;
+}
+
+void * _ioa_hash_set_memcpy(void * const destination, void const * const source, void * size) {
+    return memcpy(destination, source, *(size_t*)(size));
+}
@@ -60,7 +60,7 @@ irb_set_s create_irb_set(size_t const size, compare_fn const compare, void * con
         .parent = standard.alloc(sizeof(size_t), standard.arg),
         .node[IRB_SET_LEFT] = standard.alloc(sizeof(size_t), standard.arg),
         .node[IRB_SET_RIGHT] = standard.alloc(sizeof(size_t), standard.arg),
-        .allocator = &standard, .ac = ac,
+        .allocator = &standard, .ac = ac, .growth = CERPEC_GROWTH(IRB_SET_CHUNK),
     };
     assert(set.elements && "Memory allocation failed.");
     assert(set.color && "Memory allocation failed.");
@@ -88,7 +88,7 @@ irb_set_s make_irb_set(size_t const size, compare_fn const compare, void * const
         .parent = allocator->alloc(sizeof(size_t), allocator->arg),
         .node[IRB_SET_LEFT] = allocator->alloc(sizeof(size_t), allocator->arg),
         .node[IRB_SET_RIGHT] = allocator->alloc(sizeof(size_t), allocator->arg),
-        .allocator = allocator, .ac = ac,
+        .allocator = allocator, .ac = ac, .growth = CERPEC_GROWTH(IRB_SET_CHUNK),
     };
     assert(set.elements && "Memory allocation failed.");
     assert(set.color && "Memory allocation failed.");
@@ -173,7 +173,7 @@ irb_set_s copy_irb_set(irb_set_s const * const set, copy_fn const copy, void * c
         .parent = set->allocator->alloc((set->capacity + 1) * sizeof(size_t), set->allocator->arg),
         .node[IRB_SET_LEFT] = set->allocator->alloc((set->capacity + 1) * sizeof(size_t), set->allocator->arg),
         .node[IRB_SET_RIGHT] = set->allocator->alloc((set->capacity + 1) * sizeof(size_t), set->allocator->arg),
-        .allocator = set->allocator, .ac = set->ac,
+        .allocator = set->allocator, .ac = set->ac, .growth = set->growth,
 
         .capacity = set->capacity, .root = set->root, .length = set->length, .compare = set->compare, .size = set->size,
     };
@@ -207,6 +207,40 @@ bool is_empty_irb_set(irb_set_s const * const set) {
     return !(set->length);
 }
 
+void growth_irb_set(irb_set_s * const set, growth_s const growth) {
+    assert(set && "Parameter can't be NULL.");
+    assert(growth.factor > 1 && "Factor must be greater than one.");
+    assert(growth.chunk && "Chunk can't be zero.");
+    assert((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+    assert(set->compare && "Parameter can't be NULL.");
+    assert(set->size && "Parameter can't be zero.");
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    set->growth = growth;
+}
+
+void reserve_irb_set(irb_set_s * const set, size_t const capacity) {
+    assert(set && "Parameter can't be NULL.");
+    assert(set->compare && "Parameter can't be NULL.");
+    assert(set->size && "Parameter can't be zero.");
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (capacity > set->capacity) {
+        _irb_set_resize(set, capacity);
+    }
+}
+
+void shrink_to_fit_irb_set(irb_set_s * const set) {
+    assert(set && "Parameter can't be NULL.");
+    assert(set->compare && "Parameter can't be NULL.");
+    assert(set->size && "Parameter can't be zero.");
+    assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (set->length != set->capacity) {
+        _irb_set_resize(set, set->length);
+    }
+}
+
 void insert_irb_set(irb_set_s * const set, void const * const element) {
     assert(set && "Parameter can't be NULL.");
     assert(element && "Parameter can't be NULL.");
@@ -216,8 +250,7 @@ void insert_irb_set(irb_set_s * const set, void const * const element) {
     assert(set->length <= set->capacity && "Lenght can't be larger than capacity.");
 
     if (set->length == set->capacity) {
-        size_t const capacity = set->length ? set->length * CERPEC_FACTOR : IRB_SET_CHUNK;
-        _irb_set_resize(set, capacity);
+        _irb_set_resize(set, expand_growth(&(set->growth), set->length));
     }
 
     size_t previous = NIL; // initially invalid for the head case when set is empty
@@ -318,8 +351,9 @@ void remove_irb_set(irb_set_s * const set, void const * const element, void * co
 
     _irb_set_fill_hole(set, node);
 
-    if (set->length <= set->capacity / CERPEC_FACTOR && (set->length > IRB_SET_CHUNK || !set->length)) {
-        _irb_set_resize(set, set->length);
+    size_t const capacity = shrink_growth(&(set->growth), set->length, set->capacity);
+    if (capacity != set->capacity) {
+        _irb_set_resize(set, capacity);
     }
 }
 
@@ -394,8 +428,7 @@ irb_set_s union_irb_set(irb_set_s const * const set_one, irb_set_s const * const
         } // else add minimum's element to set union
 
         if (set_union.length == set_union.capacity) {
-            size_t const capacity = set_union.length ? set_union.length * CERPEC_FACTOR : IRB_SET_CHUNK;
-            _irb_set_resize(&set_union, capacity);
+            _irb_set_resize(&set_union, expand_growth(&(set_union.growth), set_union.length));
         }
 
         size_t previous = NIL; // initially invalid for the head case when set is empty
@@ -468,8 +501,7 @@ irb_set_s intersect_irb_set(irb_set_s const * const set_one, irb_set_s const * c
         } // else add minimum's element to set union
 
         if (set_intersect.length == set_intersect.capacity) {
-            size_t const capacity = set_intersect.length ? set_intersect.length * CERPEC_FACTOR : IRB_SET_CHUNK;
-            _irb_set_resize(&set_intersect, capacity);
+            _irb_set_resize(&set_intersect, expand_growth(&(set_intersect.growth), set_intersect.length));
         }
 
         size_t previous = NIL; // initially invalid for the head case when set is empty
@@ -538,8 +570,7 @@ irb_set_s subtract_irb_set(irb_set_s const * const minuend, irb_set_s const * co
         } // else add minuend's element to set union
 
         if (set_subtract.length == set_subtract.capacity) {
-            size_t const capacity = set_subtract.length ? set_subtract.length * CERPEC_FACTOR : IRB_SET_CHUNK;
-            _irb_set_resize(&set_subtract, capacity);
+            _irb_set_resize(&set_subtract, expand_growth(&(set_subtract.growth), set_subtract.length));
         }
 
         size_t previous = NIL; // initially invalid for the head case when set is empty
@@ -608,8 +639,7 @@ irb_set_s exclude_irb_set(irb_set_s const * const set_one, irb_set_s const * con
         } // else add minimum's element to set union
 
         if (set_exclude.length == set_exclude.capacity) {
-            size_t const capacity = set_exclude.length ? set_exclude.length * CERPEC_FACTOR : IRB_SET_CHUNK;
-            _irb_set_resize(&set_exclude, capacity);
+            _irb_set_resize(&set_exclude, expand_growth(&(set_exclude.growth), set_exclude.length));
         }
 
         size_t previous = NIL; // initially invalid for the head case when set is empty
@@ -658,8 +688,7 @@ irb_set_s exclude_irb_set(irb_set_s const * const set_one, irb_set_s const * con
         } // else add minimum's element to set union
 
         if (set_exclude.length == set_exclude.capacity) {
-            size_t const capacity = set_exclude.length ? set_exclude.length * CERPEC_FACTOR : IRB_SET_CHUNK;
-            _irb_set_resize(&set_exclude, capacity);
+            _irb_set_resize(&set_exclude, expand_growth(&(set_exclude.growth), set_exclude.length));
         }
 
         size_t previous = NIL; // initially invalid for the head case when set is empty
@@ -816,25 +845,21 @@ void each_irb_set(irb_set_s const * const set, manage_fn const manage, void * co
     bool left_done = false;
     size_t node = set->root;
     while (NIL != node) {
-        size_t const parent = set->parent[node];
-        size_t const left = set->node[IRB_SET_LEFT][node];
-        size_t const right = set->node[IRB_SET_RIGHT][node];
-
-        while (!left_done && NIL != left) {
-            node = left;
+        while (!left_done && NIL != set->node[IRB_SET_LEFT][node]) {
+            node = set->node[IRB_SET_LEFT][node];
         }
 
         if (!manage(set->elements + (node * set->size), am)) { break; }
 
         left_done = true;
-        if (NIL != right) {
+        if (NIL != set->node[IRB_SET_RIGHT][node]) {
             left_done = false;
-            node = right;
-        } else if (NIL != parent) {
-            while (NIL != parent && node == set->node[IRB_SET_RIGHT][parent]) { node = parent; }
-            if (NIL == parent) { break; }
+            node = set->node[IRB_SET_RIGHT][node];
+        } else if (NIL != set->parent[node]) {
+            while (NIL != set->parent[node] && node == set->node[IRB_SET_RIGHT][set->parent[node]]) { node = set->parent[node]; }
+            if (NIL == set->parent[node]) { break; }
 
-            node = parent;
+            node = set->parent[node];
         } else {
             break;
         }
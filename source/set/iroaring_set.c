@@ -0,0 +1,1071 @@
+#include <set/iroaring_set.h>
+
+#include <string.h>
+
+// mask of low index bits kept by containers
+#define LOW_MASK (IROARING_SET_SPAN - 1)
+
+// initial number of array values or run pairs allocated by a container
+#define MINIMUM 4
+
+/// @brief Fills array with container's values while iterating over it.
+struct iroaring_set_fill {
+    uint16_t * values;
+    size_t length;
+};
+
+/// @brief Finds position of first container with key not smaller than key.
+/// @param set Structure to search.
+/// @param key High bits of index.
+/// @return Position of container, or number of containers if every key is smaller.
+size_t _iroaring_set_search(iroaring_set_s const * const set, size_t const key);
+
+/// @brief Resizes (reallocates) structure's containers array.
+/// @param set Structure to resize.
+/// @param size New capacity of containers array.
+void _iroaring_set_resize(iroaring_set_s * const set, size_t const size);
+
+/// @brief Combines two structures container by container into a new structure.
+/// @param one First structure to combine, result uses its allocator and growth.
+/// @param two Second structure to combine.
+/// @param operation Operation to combine indexes with.
+/// @return New structure.
+iroaring_set_s _iroaring_set_operate(iroaring_set_s const * const one, iroaring_set_s const * const two, bitwise_e const operation);
+
+/// @brief Calculates the number of set (one) bits in word.
+/// @param word Word to count set bits.
+/// @return Number of set bits.
+size_t _iroaring_set_popcount(uint64_t const word);
+
+/// @brief Counts trailing zero bits of non-zero word, i.e. index of its lowest set bit.
+/// @param word Non-zero word.
+/// @return Index of lowest set bit.
+size_t _iroaring_set_trailing(uint64_t const word);
+
+/// @brief Finds position of first value not smaller than value in sorted array.
+/// @param values Sorted array of values.
+/// @param length Number of values.
+/// @param value Value to search for.
+/// @return Position of value, or length if every value is smaller.
+size_t _iroaring_set_lower(uint16_t const * const values, size_t const length, size_t const value);
+
+/// @brief Counts runs that start at or before value in sorted array of run pairs.
+/// @param runs Sorted array of start and length minus one pairs.
+/// @param length Number of runs.
+/// @param value Value to search for.
+/// @return Number of runs, so value can only be inside run before returned position.
+size_t _iroaring_set_run(uint16_t const * const runs, size_t const length, size_t const value);
+
+/// @brief Finds first value at or after start whose bit in bitmap is either set or cleared.
+/// @param words Bitmap words.
+/// @param start Value to start searching from.
+/// @param set 'true' to find set bit, 'false' to find cleared bit.
+/// @return Found value, or 'IROARING_SET_SPAN' if there isn't one.
+size_t _iroaring_set_next(uint64_t const * const words, size_t const start, bool const set);
+
+/// @brief Counts runs of consecutive set bits in bitmap.
+/// @param words Bitmap words.
+/// @return Number of runs.
+size_t _iroaring_set_runs(uint64_t const * const words);
+
+/// @brief Checks if container contains value.
+/// @param container Container to check.
+/// @param value Low bits of index.
+/// @return 'true' if contained, 'false' otherwise.
+bool _iroaring_set_has(iroaring_container_s const * const container, size_t const value);
+
+/// @brief Expands array or run container so it fits at least size values or runs.
+/// @param allocator Allocator of container's structure.
+/// @param container Container to expand.
+/// @param size Minimum number of values or runs.
+void _iroaring_set_reserve(memory_s const * const allocator, iroaring_container_s * const container, size_t const size);
+
+/// @brief Inserts value that isn't in container into container.
+/// @param allocator Allocator of container's structure.
+/// @param container Container to insert into.
+/// @param value Low bits of index.
+void _iroaring_set_add(memory_s const * const allocator, iroaring_container_s * const container, size_t const value);
+
+/// @brief Removes value that is in container from container.
+/// @param allocator Allocator of container's structure.
+/// @param container Container to remove from.
+/// @param value Low bits of index.
+void _iroaring_set_delete(memory_s const * const allocator, iroaring_container_s * const container, size_t const value);
+
+/// @brief Converts container's encoding into bitmap or array.
+/// @param allocator Allocator of container's structure.
+/// @param container Container to convert.
+/// @param type Either 'BITMAP_IROARING' or 'ARRAY_IROARING' if container has at most 'IROARING_SET_ARRAY' indexes.
+void _iroaring_set_convert(memory_s const * const allocator, iroaring_container_s * const container, iroaring_e const type);
+
+/// @brief Gets container's bitmap, decoding it into words if container isn't a bitmap.
+/// @param container Container to decode.
+/// @param words Array of 'IROARING_SET_WORDS' words to decode into.
+/// @return Container's own bitmap words, or words array.
+uint64_t const * _iroaring_set_unpack(iroaring_container_s const * const container, uint64_t * const words);
+
+/// @brief Encodes bitmap into a new container with smallest of array, bitmap or run encoding.
+/// @param allocator Allocator to allocate container with.
+/// @param words Bitmap words.
+/// @param cardinality Number of set bits in bitmap.
+/// @param key High bits of container's indexes.
+/// @return New container, without data if cardinality is zero.
+iroaring_container_s _iroaring_set_pack(memory_s const * const allocator, uint64_t const * const words, size_t const cardinality, size_t const key);
+
+/// @brief Creates a new array container from sorted values.
+/// @param allocator Allocator to allocate container with.
+/// @param values Sorted array of values.
+/// @param length Number of values, at most 'IROARING_SET_ARRAY'.
+/// @param key High bits of container's indexes.
+/// @return New container, without data if length is zero.
+iroaring_container_s _iroaring_set_values(memory_s const * const allocator, uint16_t const * const values, size_t const length, size_t const key);
+
+/// @brief Combines two containers with the same key into a new container.
+/// @param allocator Allocator to allocate container with.
+/// @param one First container to combine.
+/// @param two Second container to combine.
+/// @param operation Operation to combine indexes with.
+/// @param scratch Array of three times 'IROARING_SET_WORDS' words to decode and combine containers in.
+/// @return New container, without data if it's empty.
+iroaring_container_s _iroaring_set_combine(memory_s const * const allocator, iroaring_container_s const * const one, iroaring_container_s const * const two, bitwise_e const operation, uint64_t * const scratch);
+
+/// @brief Creates a copy of container with capacity trimmed to its size.
+/// @param allocator Allocator to allocate copy with.
+/// @param container Container to copy.
+/// @return New container.
+iroaring_container_s _iroaring_set_clone(memory_s const * const allocator, iroaring_container_s const * const container);
+
+/// @brief Iterates over each index in container in ascending order.
+/// @param container Container to iterate over.
+/// @param manage Function pointer to handle each index reference using generic arguments.
+/// @param am Generic arguments to use in function pointer.
+/// @return 'false' if iteration was stopped by function pointer, 'true' otherwise.
+bool _iroaring_set_each(iroaring_container_s const * const container, manage_fn const manage, void * const am);
+
+/// @brief Appends index's low bits to fill array.
+/// @param element Index reference.
+/// @param fill Fill structure to append into.
+/// @return Always 'true'.
+bool _iroaring_set_append(void * const element, void * const fill);
+
+/// @brief Checks if index is inside container.
+/// @param element Index reference.
+/// @param container Container to check.
+/// @return 'true' to continue iterating if inside, 'false' otherwise.
+bool _iroaring_set_inside(void * const element, void * const container);
+
+/// @brief Checks if index is outside of container.
+/// @param element Index reference.
+/// @param container Container to check.
+/// @return 'true' to continue iterating if outside, 'false' otherwise.
+bool _iroaring_set_outside(void * const element, void * const container);
+
+iroaring_set_s create_iroaring_set(void) {
+    return (iroaring_set_s) { .allocator = &standard, .growth = CERPEC_GROWTH(IROARING_SET_CHUNK), };
+}
+
+iroaring_set_s make_iroaring_set(memory_s const * const allocator) {
+    error(allocator && "Parameter can't be NULL.");
+
+    return (iroaring_set_s) { .allocator = allocator, .growth = CERPEC_GROWTH(IROARING_SET_CHUNK), };
+}
+
+void destroy_iroaring_set(iroaring_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    clear_iroaring_set(set);
+
+    // make structure invalid
+    memset(set, 0, sizeof(iroaring_set_s));
+}
+
+void clear_iroaring_set(iroaring_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    for (size_t i = 0; i < set->count; ++i) {
+        set->allocator->free(set->containers[i].data, set->allocator->arg);
+    }
+    set->allocator->free(set->containers, set->allocator->arg);
+
+    // only clear structure
+    set->length = set->count = set->capacity = 0;
+    set->containers = NULL;
+}
+
+iroaring_set_s copy_iroaring_set(iroaring_set_s const * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    iroaring_set_s const replica = {
+        .length = set->length, .count = set->count, .capacity = set->count,
+        .growth = set->growth, .allocator = set->allocator,
+        .containers = set->allocator->alloc(set->count * sizeof(iroaring_container_s), set->allocator->arg),
+    };
+    error((!replica.capacity || replica.containers) && "Memory allocation failed.");
+
+    for (size_t i = 0; i < set->count; ++i) {
+        replica.containers[i] = _iroaring_set_clone(set->allocator, set->containers + i);
+    }
+
+    return replica;
+}
+
+bool is_empty_iroaring_set(iroaring_set_s const * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    return !(set->length);
+}
+
+void growth_iroaring_set(iroaring_set_s * const set, growth_s const growth) {
+    error(set && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+
+    set->growth = growth;
+}
+
+void shrink_to_fit_iroaring_set(iroaring_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    if (set->count) {
+        uint64_t * const words = set->allocator->alloc(IROARING_SET_WORDS * sizeof(uint64_t), set->allocator->arg);
+        error(words && "Memory allocation failed.");
+
+        // decoding and encoding again picks smallest encoding and allocates exactly what it needs
+        for (size_t i = 0; i < set->count; ++i) {
+            iroaring_container_s * const container = set->containers + i;
+
+            iroaring_container_s const packed = _iroaring_set_pack(set->allocator, _iroaring_set_unpack(container, words), container->cardinality, container->key);
+            set->allocator->free(container->data, set->allocator->arg);
+            (*container) = packed;
+        }
+
+        set->allocator->free(words, set->allocator->arg);
+    }
+
+    if (set->count != set->capacity) {
+        _iroaring_set_resize(set, set->count);
+    }
+}
+
+void insert_iroaring_set(iroaring_set_s * const set, size_t const index) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    size_t const key = index >> IROARING_SET_BITS, value = index & LOW_MASK;
+
+    // create empty array container if there isn't one for index's key
+    size_t const position = _iroaring_set_search(set, key);
+    if (position == set->count || set->containers[position].key != key) {
+        if (set->count == set->capacity) {
+            _iroaring_set_resize(set, expand_growth(&(set->growth), set->count));
+        }
+
+        memmove(set->containers + position + 1, set->containers + position, (set->count - position) * sizeof(iroaring_container_s));
+        set->containers[position] = (iroaring_container_s) { .key = key, .type = ARRAY_IROARING, };
+        set->count++;
+    }
+
+    iroaring_container_s * const container = set->containers + position;
+    error(!_iroaring_set_has(container, value) && "Structure already contains element.");
+
+    _iroaring_set_add(set->allocator, container, value);
+    set->length++;
+}
+
+void remove_iroaring_set(iroaring_set_s * const set, size_t const index) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    size_t const key = index >> IROARING_SET_BITS, value = index & LOW_MASK;
+
+    size_t const position = _iroaring_set_search(set, key);
+    error(position < set->count && set->containers[position].key == key && "Structure doesn't contain element.");
+
+    iroaring_container_s * const container = set->containers + position;
+    error(_iroaring_set_has(container, value) && "Structure doesn't contain element.");
+
+    _iroaring_set_delete(set->allocator, container, value);
+    set->length--;
+
+    // remove empty container and shrink containers array if needed
+    if (!container->cardinality) {
+        set->allocator->free(container->data, set->allocator->arg);
+        set->count--;
+        memmove(set->containers + position, set->containers + position + 1, (set->count - position) * sizeof(iroaring_container_s));
+
+        size_t const capacity = shrink_growth(&(set->growth), set->count, set->capacity);
+        if (capacity != set->capacity) {
+            _iroaring_set_resize(set, capacity);
+        }
+    }
+}
+
+bool contains_iroaring_set(iroaring_set_s const * const set, size_t const index) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    size_t const key = index >> IROARING_SET_BITS;
+    size_t const position = _iroaring_set_search(set, key);
+
+    return position < set->count && set->containers[position].key == key && _iroaring_set_has(set->containers + position, index & LOW_MASK);
+}
+
+iroaring_set_s union_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+
+    return _iroaring_set_operate(set_one, set_two, OR_BITWISE);
+}
+
+iroaring_set_s intersect_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+
+    return _iroaring_set_operate(set_one, set_two, AND_BITWISE);
+}
+
+iroaring_set_s subtract_iroaring_set(iroaring_set_s const * const minuend, iroaring_set_s const * const subtrahend) {
+    error(minuend && "Parameter can't be NULL.");
+    error(subtrahend && "Parameter can't be NULL.");
+
+    valid(minuend->allocator && "Allocator can't be NULL.");
+    valid(subtrahend->allocator && "Allocator can't be NULL.");
+
+    return _iroaring_set_operate(minuend, subtrahend, ANDNOT_BITWISE);
+}
+
+iroaring_set_s exclude_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+
+    return _iroaring_set_operate(set_one, set_two, XOR_BITWISE);
+}
+
+bool is_subset_iroaring_set(iroaring_set_s const * const superset, iroaring_set_s const * const subset) {
+    error(superset && "Parameter can't be NULL.");
+    error(subset && "Parameter can't be NULL.");
+
+    valid(superset->allocator && "Allocator can't be NULL.");
+    valid(subset->allocator && "Allocator can't be NULL.");
+
+    if (subset->length > superset->length) {
+        return false;
+    }
+
+    // containers are sorted by key, so superset's search continues where previous one stopped
+    size_t position = 0;
+    for (size_t i = 0; i < subset->count; ++i) {
+        iroaring_container_s const * const sub = subset->containers + i;
+        while (position < superset->count && superset->containers[position].key < sub->key) {
+            position++;
+        }
+
+        if (position == superset->count || superset->containers[position].key != sub->key) {
+            return false;
+        }
+
+        iroaring_container_s const * const super = superset->containers + position;
+        if (sub->cardinality > super->cardinality) {
+            return false;
+        }
+
+        if (BITMAP_IROARING == sub->type && BITMAP_IROARING == super->type) {
+            if (!is_subset_bitwise(super->data, sub->data, IROARING_SET_WORDS)) {
+                return false;
+            }
+        } else if (!_iroaring_set_each(sub, _iroaring_set_inside, (void *)super)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool is_proper_subset_iroaring_set(iroaring_set_s const * const superset, iroaring_set_s const * const subset) {
+    error(superset && "Parameter can't be NULL.");
+    error(subset && "Parameter can't be NULL.");
+
+    valid(superset->allocator && "Allocator can't be NULL.");
+    valid(subset->allocator && "Allocator can't be NULL.");
+
+    return (subset->length != superset->length) && is_subset_iroaring_set(superset, subset);
+}
+
+bool is_disjoint_iroaring_set(iroaring_set_s const * const set_one, iroaring_set_s const * const set_two) {
+    error(set_one && "Parameter can't be NULL.");
+    error(set_two && "Parameter can't be NULL.");
+
+    valid(set_one->allocator && "Allocator can't be NULL.");
+    valid(set_two->allocator && "Allocator can't be NULL.");
+
+    // only containers with the same key can share indexes
+    for (size_t i = 0, j = 0; i < set_one->count && j < set_two->count;) {
+        iroaring_container_s const * const one = set_one->containers + i;
+        iroaring_container_s const * const two = set_two->containers + j;
+
+        if (one->key < two->key) {
+            i++;
+        } else if (two->key < one->key) {
+            j++;
+        } else {
+            if (BITMAP_IROARING == one->type && BITMAP_IROARING == two->type) {
+                if (!is_disjoint_bitwise(one->data, two->data, IROARING_SET_WORDS)) {
+                    return false;
+                }
+            } else {
+                // iterate over smaller container and look its indexes up in bigger one
+                iroaring_container_s const * const small = one->cardinality < two->cardinality ? one : two;
+                iroaring_container_s const * const big = one->cardinality < two->cardinality ? two : one;
+                if (!_iroaring_set_each(small, _iroaring_set_outside, (void *)big)) {
+                    return false;
+                }
+            }
+
+            i++;
+            j++;
+        }
+    }
+
+    return true;
+}
+
+void each_index_iroaring_set(iroaring_set_s const * const set, manage_fn const manage, void * const am) {
+    error(set && "Parameter can't be NULL.");
+    error(manage && "Parameter can't be NULL.");
+
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->count <= set->capacity && "Count can't be larger than capacity.");
+
+    for (size_t i = 0; i < set->count && _iroaring_set_each(set->containers + i, manage, am); ++i) {}
+}
+
+size_t _iroaring_set_search(iroaring_set_s const * const set, size_t const key) {
+    // indexes are often inserted in ascending order, so check if key goes after last container first
+    if (!set->count || set->containers[set->count - 1].key < key) {
+        return set->count;
+    }
+
+    size_t low = 0, high = set->count - 1;
+    while (low < high) {
+        size_t const middle = low + ((high - low) / 2);
+        if (set->containers[middle].key < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+void _iroaring_set_resize(iroaring_set_s * const set, size_t const size) {
+    set->capacity = size;
+
+    set->containers = set->allocator->realloc(set->containers, size * sizeof(iroaring_container_s), set->allocator->arg);
+    error((!size || set->containers) && "Memory allocation failed.");
+}
+
+iroaring_set_s _iroaring_set_operate(iroaring_set_s const * const one, iroaring_set_s const * const two, bitwise_e const operation) {
+    valid(one->count <= one->capacity && "Count can't be larger than capacity.");
+    valid(two->count <= two->capacity && "Count can't be larger than capacity.");
+
+    // containers only in first structure are kept unless intersecting, ones only in second if uniting or excluding
+    bool const left = AND_BITWISE != operation;
+    bool const right = OR_BITWISE == operation || XOR_BITWISE == operation;
+
+    memory_s const * const allocator = one->allocator;
+    iroaring_set_s result = {
+        .capacity = one->count + two->count, .growth = one->growth, .allocator = allocator,
+        .containers = allocator->alloc((one->count + two->count) * sizeof(iroaring_container_s), allocator->arg),
+    };
+    error((!result.capacity || result.containers) && "Memory allocation failed.");
+
+    // scratch is only needed when both structures have containers to combine
+    uint64_t * const scratch = one->count && two->count ? allocator->alloc(3 * IROARING_SET_WORDS * sizeof(uint64_t), allocator->arg) : NULL;
+    error((!(one->count && two->count) || scratch) && "Memory allocation failed.");
+
+    size_t i = 0, j = 0;
+    while (i < one->count || j < two->count) {
+        iroaring_container_s container = { 0 };
+
+        if (j == two->count || (i < one->count && one->containers[i].key < two->containers[j].key)) {
+            if (left) {
+                container = _iroaring_set_clone(allocator, one->containers + i);
+            }
+            i++;
+        } else if (i == one->count || two->containers[j].key < one->containers[i].key) {
+            if (right) {
+                container = _iroaring_set_clone(allocator, two->containers + j);
+            }
+            j++;
+        } else {
+            container = _iroaring_set_combine(allocator, one->containers + i, two->containers + j, operation, scratch);
+            i++;
+            j++;
+        }
+
+        if (container.cardinality) {
+            result.length += container.cardinality;
+            result.containers[result.count++] = container;
+        }
+    }
+
+    allocator->free(scratch, allocator->arg);
+
+    if (result.count != result.capacity) {
+        _iroaring_set_resize(&result, result.count);
+    }
+
+    return result;
+}
+
+size_t _iroaring_set_popcount(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__) // if either gcc or clang is used, '__builtin_popcount*' is supported
+    return (size_t)__builtin_popcountll(word);
+#else // else use custom popcount implementation
+    size_t count = 0;
+
+    // while bits is not 0 increment count and remove its rightmost bit
+    for (uint64_t w = word; w; w &= w - 1) {
+        count++;
+    }
+
+    return count;
+#endif
+}
+
+size_t _iroaring_set_trailing(uint64_t const word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)(__builtin_ctzll(word));
+#else
+    size_t count = 0;
+    for (uint64_t w = word; !(w & 1u); w >>= 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+size_t _iroaring_set_lower(uint16_t const * const values, size_t const length, size_t const value) {
+    size_t low = 0, high = length;
+    while (low < high) {
+        size_t const middle = low + ((high - low) / 2);
+        if (values[middle] < value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+size_t _iroaring_set_run(uint16_t const * const runs, size_t const length, size_t const value) {
+    size_t low = 0, high = length;
+    while (low < high) {
+        size_t const middle = low + ((high - low) / 2);
+        if (runs[2 * middle] <= value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+size_t _iroaring_set_next(uint64_t const * const words, size_t const start, bool const set) {
+    size_t index = start / BITWISE_WORD;
+    if (index >= IROARING_SET_WORDS) {
+        return IROARING_SET_SPAN;
+    }
+
+    // searching for cleared bit is the same as searching for set bit in inverted word, bits before start are ignored
+    uint64_t word = (set ? words[index] : ~(words[index])) & (~(uint64_t)(0) << (start % BITWISE_WORD));
+    while (!word) {
+        if (++index == IROARING_SET_WORDS) {
+            return IROARING_SET_SPAN;
+        }
+        word = set ? words[index] : ~(words[index]);
+    }
+
+    return (index * BITWISE_WORD) + _iroaring_set_trailing(word);
+}
+
+size_t _iroaring_set_runs(uint64_t const * const words) {
+    // a run starts at every set bit whose previous bit, which may be last bit of previous word, isn't set
+    size_t runs = 0;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < IROARING_SET_WORDS; ++i) {
+        runs += _iroaring_set_popcount(words[i] & ~((words[i] << 1) | carry));
+        carry = words[i] >> (BITWISE_WORD - 1);
+    }
+
+    return runs;
+}
+
+bool _iroaring_set_has(iroaring_container_s const * const container, size_t const value) {
+    switch (container->type) {
+        case ARRAY_IROARING: {
+            uint16_t const * const values = container->data;
+            size_t const position = _iroaring_set_lower(values, container->size, value);
+
+            return position < container->size && values[position] == value;
+        }
+        case BITMAP_IROARING: {
+            uint64_t const * const words = container->data;
+
+            return (words[value / BITWISE_WORD] >> (value % BITWISE_WORD)) & 1;
+        }
+        case RUN_IROARING: {
+            uint16_t const * const runs = container->data;
+            size_t const position = _iroaring_set_run(runs, container->size, value);
+
+            return position && value <= (size_t)(runs[2 * (position - 1)]) + runs[2 * (position - 1) + 1];
+        }
+        default: {
+            valid(false && "Unknown container type.");
+            return false;
+        }
+    }
+}
+
+void _iroaring_set_reserve(memory_s const * const allocator, iroaring_container_s * const container, size_t const size) {
+    if (size <= container->capacity) {
+        return;
+    }
+
+    size_t capacity = container->capacity ? container->capacity : MINIMUM;
+    while (capacity < size) {
+        capacity *= 2;
+    }
+
+    // run pair takes two values
+    size_t const element = RUN_IROARING == container->type ? 2 * sizeof(uint16_t) : sizeof(uint16_t);
+    container->data = allocator->realloc(container->data, capacity * element, allocator->arg);
+    error(container->data && "Memory allocation failed.");
+
+    container->capacity = capacity;
+}
+
+void _iroaring_set_add(memory_s const * const allocator, iroaring_container_s * const container, size_t const value) {
+    // full array would take more memory than a bitmap once another value is added
+    if (ARRAY_IROARING == container->type && container->size == IROARING_SET_ARRAY) {
+        _iroaring_set_convert(allocator, container, BITMAP_IROARING);
+    }
+
+    switch (container->type) {
+        case ARRAY_IROARING: {
+            _iroaring_set_reserve(allocator, container, container->size + 1);
+
+            uint16_t * const values = container->data;
+            size_t const position = _iroaring_set_lower(values, container->size, value);
+            memmove(values + position + 1, values + position, (container->size - position) * sizeof(uint16_t));
+            values[position] = (uint16_t)(value);
+            container->size++;
+            break;
+        }
+        case BITMAP_IROARING: {
+            uint64_t * const words = container->data;
+            words[value / BITWISE_WORD] |= (uint64_t)(1) << (value % BITWISE_WORD);
+            break;
+        }
+        case RUN_IROARING: {
+            uint16_t * runs = container->data;
+            size_t const position = _iroaring_set_run(runs, container->size, value);
+
+            // value may extend run before it, run after it or both, merging them
+            bool const after = position && (size_t)(runs[2 * (position - 1)]) + runs[2 * (position - 1) + 1] + 1 == value;
+            bool const before = position < container->size && value + 1 == runs[2 * position];
+            if (after && before) {
+                runs[2 * (position - 1) + 1] = (uint16_t)(runs[2 * position] + runs[2 * position + 1] - runs[2 * (position - 1)]);
+                memmove(runs + (2 * position), runs + (2 * (position + 1)), (container->size - position - 1) * 2 * sizeof(uint16_t));
+                container->size--;
+            } else if (after) {
+                runs[2 * (position - 1) + 1]++;
+            } else if (before) {
+                runs[2 * position]--;
+                runs[2 * position + 1]++;
+            } else {
+                _iroaring_set_reserve(allocator, container, container->size + 1);
+                runs = container->data;
+
+                memmove(runs + (2 * (position + 1)), runs + (2 * position), (container->size - position) * 2 * sizeof(uint16_t));
+                runs[2 * position] = (uint16_t)(value);
+                runs[2 * position + 1] = 0;
+                container->size++;
+            }
+            break;
+        }
+        default: {
+            valid(false && "Unknown container type.");
+        }
+    }
+
+    container->cardinality++;
+
+    // too many runs take more memory than a bitmap
+    if (RUN_IROARING == container->type && container->size > IROARING_SET_ARRAY / 2) {
+        _iroaring_set_convert(allocator, container, BITMAP_IROARING);
+    }
+}
+
+void _iroaring_set_delete(memory_s const * const allocator, iroaring_container_s * const container, size_t const value) {
+    switch (container->type) {
+        case ARRAY_IROARING: {
+            uint16_t * const values = container->data;
+            size_t const position = _iroaring_set_lower(values, container->size, value);
+            memmove(values + position, values + position + 1, (container->size - position - 1) * sizeof(uint16_t));
+            container->size--;
+            break;
+        }
+        case BITMAP_IROARING: {
+            uint64_t * const words = container->data;
+            words[value / BITWISE_WORD] &= ~((uint64_t)(1) << (value % BITWISE_WORD));
+            break;
+        }
+        case RUN_IROARING: {
+            uint16_t * runs = container->data;
+            size_t const position = _iroaring_set_run(runs, container->size, value) - 1;
+            size_t const start = runs[2 * position], end = start + runs[2 * position + 1];
+
+            // value either removes single value run, shortens run from either side or splits it in two
+            if (start == end) {
+                memmove(runs + (2 * position), runs + (2 * (position + 1)), (container->size - position - 1) * 2 * sizeof(uint16_t));
+                container->size--;
+            } else if (value == start) {
+                runs[2 * position]++;
+                runs[2 * position + 1]--;
+            } else if (value == end) {
+                runs[2 * position + 1]--;
+            } else {
+                _iroaring_set_reserve(allocator, container, container->size + 1);
+                runs = container->data;
+
+                memmove(runs + (2 * (position + 2)), runs + (2 * (position + 1)), (container->size - position - 1) * 2 * sizeof(uint16_t));
+                runs[2 * position + 1] = (uint16_t)(value - start - 1);
+                runs[2 * (position + 1)] = (uint16_t)(value + 1);
+                runs[2 * (position + 1) + 1] = (uint16_t)(end - value - 1);
+                container->size++;
+            }
+            break;
+        }
+        default: {
+            valid(false && "Unknown container type.");
+        }
+    }
+
+    container->cardinality--;
+
+    // bitmap that fits into an array takes more memory than it
+    if (BITMAP_IROARING == container->type && container->cardinality && container->cardinality <= IROARING_SET_ARRAY) {
+        _iroaring_set_convert(allocator, container, ARRAY_IROARING);
+    } else if (RUN_IROARING == container->type && container->size > IROARING_SET_ARRAY / 2) {
+        _iroaring_set_convert(allocator, container, BITMAP_IROARING);
+    }
+}
+
+void _iroaring_set_convert(memory_s const * const allocator, iroaring_container_s * const container, iroaring_e const type) {
+    valid((BITMAP_IROARING == type || container->cardinality <= IROARING_SET_ARRAY) && "Array can't fit container.");
+
+    iroaring_container_s converted = { .key = container->key, .cardinality = container->cardinality, .type = type, };
+
+    if (BITMAP_IROARING == type) {
+        uint64_t * const words = allocator->alloc(IROARING_SET_WORDS * sizeof(uint64_t), allocator->arg);
+        error(words && "Memory allocation failed.");
+
+        _iroaring_set_unpack(container, words);
+        converted.data = words;
+    } else {
+        struct iroaring_set_fill fill = {
+            .values = allocator->alloc(container->cardinality * sizeof(uint16_t), allocator->arg),
+        };
+        error(fill.values && "Memory allocation failed.");
+
+        _iroaring_set_each(container, _iroaring_set_append, &fill);
+        converted.data = fill.values;
+        converted.size = converted.capacity = fill.length;
+    }
+
+    allocator->free(container->data, allocator->arg);
+    (*container) = converted;
+}
+
+uint64_t const * _iroaring_set_unpack(iroaring_container_s const * const container, uint64_t * const words) {
+    if (BITMAP_IROARING == container->type) {
+        return container->data;
+    }
+
+    memset(words, 0, IROARING_SET_WORDS * sizeof(uint64_t));
+
+    uint16_t const * const values = container->data;
+    if (ARRAY_IROARING == container->type) {
+        for (size_t i = 0; i < container->size; ++i) {
+            words[values[i] / BITWISE_WORD] |= (uint64_t)(1) << (values[i] % BITWISE_WORD);
+        }
+
+        return words;
+    }
+
+    // set each run a word at a time, masking bits outside of it in its first and last word
+    for (size_t i = 0; i < container->size; ++i) {
+        size_t const start = values[2 * i], end = start + values[2 * i + 1];
+        for (size_t value = start; value <= end;) {
+            size_t const index = value / BITWISE_WORD;
+            size_t const last = (end / BITWISE_WORD == index) ? end % BITWISE_WORD : BITWISE_WORD - 1;
+
+            words[index] |= (~(uint64_t)(0) >> (BITWISE_WORD - 1 - last)) & (~(uint64_t)(0) << (value % BITWISE_WORD));
+            value = (index * BITWISE_WORD) + last + 1;
+        }
+    }
+
+    return words;
+}
+
+iroaring_container_s _iroaring_set_pack(memory_s const * const allocator, uint64_t const * const words, size_t const cardinality, size_t const key) {
+    iroaring_container_s container = { .key = key, .cardinality = cardinality, .type = ARRAY_IROARING, };
+    if (!cardinality) {
+        return container;
+    }
+
+    // each run takes two values, while array takes a value per index and bitmap as much as a full array
+    size_t const runs = _iroaring_set_runs(words);
+    size_t const smallest = cardinality < IROARING_SET_ARRAY ? cardinality : IROARING_SET_ARRAY;
+
+    if (2 * runs < smallest) {
+        uint16_t * const pairs = allocator->alloc(runs * 2 * sizeof(uint16_t), allocator->arg);
+        error(pairs && "Memory allocation failed.");
+
+        size_t run = 0;
+        for (size_t start = _iroaring_set_next(words, 0, true); start < IROARING_SET_SPAN; run++) {
+            size_t const end = _iroaring_set_next(words, start, false);
+            pairs[2 * run] = (uint16_t)(start);
+            pairs[2 * run + 1] = (uint16_t)(end - start - 1);
+            start = _iroaring_set_next(words, end, true);
+        }
+
+        container.type = RUN_IROARING;
+        container.data = pairs;
+        container.size = container.capacity = runs;
+    } else if (cardinality <= IROARING_SET_ARRAY) {
+        uint16_t * const values = allocator->alloc(cardinality * sizeof(uint16_t), allocator->arg);
+        error(values && "Memory allocation failed.");
+
+        size_t length = 0;
+        for (size_t i = 0; i < IROARING_SET_WORDS; ++i) {
+            for (uint64_t word = words[i]; word; word &= word - 1) {
+                values[length++] = (uint16_t)((i * BITWISE_WORD) + _iroaring_set_trailing(word));
+            }
+        }
+
+        container.data = values;
+        container.size = container.capacity = cardinality;
+    } else {
+        uint64_t * const bitmap = allocator->alloc(IROARING_SET_WORDS * sizeof(uint64_t), allocator->arg);
+        error(bitmap && "Memory allocation failed.");
+
+        memcpy(bitmap, words, IROARING_SET_WORDS * sizeof(uint64_t));
+
+        container.type = BITMAP_IROARING;
+        container.data = bitmap;
+    }
+
+    return container;
+}
+
+iroaring_container_s _iroaring_set_values(memory_s const * const allocator, uint16_t const * const values, size_t const length, size_t const key) {
+    iroaring_container_s container = { .key = key, .cardinality = length, .size = length, .capacity = length, .type = ARRAY_IROARING, };
+    if (!length) {
+        return container;
+    }
+
+    container.data = allocator->alloc(length * sizeof(uint16_t), allocator->arg);
+    error(container.data && "Memory allocation failed.");
+
+    memcpy(container.data, values, length * sizeof(uint16_t));
+
+    return container;
+}
+
+iroaring_container_s _iroaring_set_combine(memory_s const * const allocator, iroaring_container_s const * const one, iroaring_container_s const * const two, bitwise_e const operation, uint64_t * const scratch) {
+    // values are collected into first two thirds of scratch, enough for union of two full arrays
+    uint16_t * const values = (uint16_t *)(scratch);
+    size_t length = 0;
+
+    if (ARRAY_IROARING == one->type && ARRAY_IROARING == two->type) {
+        uint16_t const * const first = one->data;
+        uint16_t const * const second = two->data;
+
+        // merge sorted arrays, keeping values based on which of them contains it
+        size_t i = 0, j = 0;
+        while (i < one->size || j < two->size) {
+            if (j == two->size || (i < one->size && first[i] < second[j])) {
+                if (AND_BITWISE != operation) {
+                    values[length++] = first[i];
+                }
+                i++;
+            } else if (i == one->size || second[j] < first[i]) {
+                if (OR_BITWISE == operation || XOR_BITWISE == operation) {
+                    values[length++] = second[j];
+                }
+                j++;
+            } else {
+                if (OR_BITWISE == operation || AND_BITWISE == operation) {
+                    values[length++] = first[i];
+                }
+                i++;
+                j++;
+            }
+        }
+
+        if (length <= IROARING_SET_ARRAY) {
+            return _iroaring_set_values(allocator, values, length, one->key);
+        }
+
+        // union of arrays doesn't fit into an array, so it's packed from last third of scratch
+        uint64_t * const words = scratch + (2 * IROARING_SET_WORDS);
+        memset(words, 0, IROARING_SET_WORDS * sizeof(uint64_t));
+        for (size_t k = 0; k < length; ++k) {
+            words[values[k] / BITWISE_WORD] |= (uint64_t)(1) << (values[k] % BITWISE_WORD);
+        }
+
+        return _iroaring_set_pack(allocator, words, length, one->key);
+    }
+
+    // array intersected with or subtracted by any container only needs its values looked up
+    bool const intersect = AND_BITWISE == operation && (ARRAY_IROARING == one->type || ARRAY_IROARING == two->type);
+    bool const subtract = ANDNOT_BITWISE == operation && ARRAY_IROARING == one->type;
+    if (intersect || subtract) {
+        iroaring_container_s const * const array = ARRAY_IROARING == one->type ? one : two;
+        iroaring_container_s const * const other = ARRAY_IROARING == one->type ? two : one;
+        uint16_t const * const probe = array->data;
+
+        for (size_t i = 0; i < array->size; ++i) {
+            if (_iroaring_set_has(other, probe[i]) == intersect) {
+                values[length++] = probe[i];
+            }
+        }
+
+        return _iroaring_set_values(allocator, values, length, one->key);
+    }
+
+    // any other pair is decoded into bitmaps and combined a vector at a time
+    uint64_t const * const first = _iroaring_set_unpack(one, scratch);
+    uint64_t const * const second = _iroaring_set_unpack(two, scratch + IROARING_SET_WORDS);
+    uint64_t * const words = scratch + (2 * IROARING_SET_WORDS);
+    size_t const cardinality = operate_bitwise(words, first, second, IROARING_SET_WORDS, operation);
+
+    return _iroaring_set_pack(allocator, words, cardinality, one->key);
+}
+
+iroaring_container_s _iroaring_set_clone(memory_s const * const allocator, iroaring_container_s const * const container) {
+    iroaring_container_s clone = (*container);
+
+    size_t size = IROARING_SET_WORDS * sizeof(uint64_t);
+    if (BITMAP_IROARING != container->type) {
+        size = (RUN_IROARING == container->type ? 2 : 1) * container->size * sizeof(uint16_t);
+        clone.capacity = container->size;
+    }
+
+    clone.data = allocator->alloc(size, allocator->arg);
+    error(clone.data && "Memory allocation failed.");
+
+    memcpy(clone.data, container->data, size);
+
+    return clone;
+}
+
+bool _iroaring_set_each(iroaring_container_s const * const container, manage_fn const manage, void * const am) {
+    size_t const base = container->key << IROARING_SET_BITS;
+
+    switch (container->type) {
+        case ARRAY_IROARING: {
+            uint16_t const * const values = container->data;
+            for (size_t i = 0; i < container->size; ++i) {
+                size_t index = base + values[i];
+                if (!manage(&index, am)) {
+                    return false;
+                }
+            }
+            break;
+        }
+        case BITMAP_IROARING: {
+            uint64_t const * const words = container->data;
+            for (size_t i = 0; i < IROARING_SET_WORDS; ++i) {
+                for (uint64_t word = words[i]; word; word &= word - 1) {
+                    size_t index = base + (i * BITWISE_WORD) + _iroaring_set_trailing(word);
+                    if (!manage(&index, am)) {
+                        return false;
+                    }
+                }
+            }
+            break;
+        }
+        case RUN_IROARING: {
+            uint16_t const * const runs = container->data;
+            for (size_t i = 0; i < container->size; ++i) {
+                size_t const end = (size_t)(runs[2 * i]) + runs[2 * i + 1];
+                for (size_t value = runs[2 * i]; value <= end; ++value) {
+                    size_t index = base + value;
+                    if (!manage(&index, am)) {
+                        return false;
+                    }
+                }
+            }
+            break;
+        }
+        default: {
+            valid(false && "Unknown container type.");
+        }
+    }
+
+    return true;
+}
+
+bool _iroaring_set_append(void * const element, void * const fill) {
+    struct iroaring_set_fill * const array = fill;
+    array->values[array->length++] = (uint16_t)((*(size_t *)(element)) & LOW_MASK);
+
+    return true;
+}
+
+bool _iroaring_set_inside(void * const element, void * const container) {
+    return _iroaring_set_has(container, (*(size_t *)(element)) & LOW_MASK);
+}
+
+bool _iroaring_set_outside(void * const element, void * const container) {
+    return !_iroaring_set_has(container, (*(size_t *)(element)) & LOW_MASK);
+}
@@ -2,6 +2,7 @@
 
 #include <stdlib.h> // imports exit()
 #include <string.h>
+#include <stdint.h>
 
 #define NIL (size_t)(-1)
 
@@ -15,6 +16,18 @@ void _isc_hash_set_fill_hole(isc_hash_set_s const * const set, size_t const hole
 /// @param size New size.
 void _isc_hash_set_resize(isc_hash_set_s * const set, size_t const size);
 
+/// @brief Reduces hash value into bucket index based on structure's indexing mode.
+/// @param set Structure to index.
+/// @param hash Hash value to reduce.
+/// @return Bucket index.
+size_t _isc_hash_set_index(isc_hash_set_s const * const set, size_t const hash);
+
+/// @brief Rounds capacity to one valid for structure's indexing mode.
+/// @param set Structure to round capacity for.
+/// @param size Minimum capacity.
+/// @return Valid capacity.
+size_t _isc_hash_set_round(isc_hash_set_s const * const set, size_t const size);
+
 /// @brief Make logic wrapper mainly to repeated assertion for specific structure operations.
 /// @param size Size of single element.
 /// @param hash Hash function to generate hash values from elements.
@@ -51,7 +64,7 @@ isc_hash_set_s create_isc_hash_set(size_t const size, hash_fn const hash, void *
     error(compare && "Parameter can't be NULL.");
     error(size && "Parameter can't be zero.");
 
-    return (isc_hash_set_s) { .size = size, .hash = hash, .compare = compare, .allocator = &standard, .ah = ah, .ac = ac, };
+    return (isc_hash_set_s) { .size = size, .hash = hash, .compare = compare, .allocator = &standard, .ah = ah, .ac = ac, .growth = CERPEC_GROWTH(ISC_HASH_SET_CHUNK), };
 }
 
 isc_hash_set_s make_isc_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator) {
@@ -60,7 +73,7 @@ isc_hash_set_s make_isc_hash_set(size_t const size, hash_fn const hash, void * c
     error(size && "Parameter can't be zero.");
     error(allocator && "Parameter can't be NULL.");
 
-    return _make_wrapper_isc_hash_set(size, hash, ah, ac, compare, allocator);
+    return _make_wrapper_isc_hash_set(size, hash, ah, compare, ac, allocator);
 }
 
 void destroy_isc_hash_set(isc_hash_set_s * const set, set_fn const destroy, void * const ad) {
@@ -147,6 +160,68 @@ bool is_empty_isc_hash_set(isc_hash_set_s const * const set) {
     return !(set->length); // if 0 return 'true'
 }
 
+void growth_isc_hash_set(isc_hash_set_s * const set, growth_s const growth) {
+    error(set && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    set->growth = growth;
+}
+
+void reserve_isc_hash_set(isc_hash_set_s * const set, size_t const capacity) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    if (capacity > set->capacity) {
+        _isc_hash_set_resize(set, _isc_hash_set_round(set, capacity));
+    }
+}
+
+void shrink_to_fit_isc_hash_set(isc_hash_set_s * const set) {
+    error(set && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    size_t const capacity = _isc_hash_set_round(set, set->length);
+    if (capacity != set->capacity) {
+        _isc_hash_set_resize(set, capacity);
+    }
+}
+
+void reindex_isc_hash_set(isc_hash_set_s * const set, index_e const indexing) {
+    error(set && "Parameter can't be NULL.");
+    error((MODULO_INDEX == indexing || MASK_INDEX == indexing) && "Invalid indexing mode.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    set->indexing = indexing;
+
+    // rehash lists since bucket indexes (and possibly capacity) change with new mode
+    if (set->capacity) {
+        _isc_hash_set_resize(set, _isc_hash_set_round(set, set->capacity));
+    }
+}
+
 void insert_isc_hash_set(isc_hash_set_s * const set, void const * const element) {
     error(set && "Parameter can't be NULL.");
     error(element && "Parameter can't be NULL.");
@@ -159,13 +234,13 @@ void insert_isc_hash_set(isc_hash_set_s * const set, void const * const element)
 
     // resize (expand) if set can't contain new element
     if (set->length == set->capacity) {
-        size_t const capacity = set->length ? set->length * CERPEC_FACTOR : ISC_HASH_SET_CHUNK;
-        _isc_hash_set_resize(set, capacity);
+        size_t const capacity = expand_growth(&(set->growth), set->length);
+        _isc_hash_set_resize(set, _isc_hash_set_round(set, capacity));
     }
 
     // calculate hash value and index in array
     size_t const hash = set->hash(element, set->ah);
-    size_t const index = hash % set->capacity;
+    size_t const index = _isc_hash_set_index(set, hash);
 
 #ifndef NERROR
     // check if element is in set or not
@@ -193,7 +268,7 @@ void remove_isc_hash_set(isc_hash_set_s * const set, void const * const element,
 
     // calculate hash value and index in array
     size_t const hash = set->hash(element, set->ah);
-    size_t const index = hash % set->capacity;
+    size_t const index = _isc_hash_set_index(set, hash);
 
     // for each node at index check if element is contained
     for (size_t n = set->head[index]; NIL != n; n = set->next[n]) {
@@ -209,8 +284,9 @@ void remove_isc_hash_set(isc_hash_set_s * const set, void const * const element,
         _isc_hash_set_fill_hole(set, n);
 
         // resize (expand) if set can contain a smaller capacity of elements
-        if (set->length <= set->capacity / CERPEC_FACTOR && (set->length > ISC_HASH_SET_CHUNK || !set->length)) {
-            _isc_hash_set_resize(set, set->length);
+        size_t const capacity = _isc_hash_set_round(set, shrink_growth(&(set->growth), set->length, set->capacity));
+        if (capacity != set->capacity) {
+            _isc_hash_set_resize(set, capacity);
         }
 
         return; // return to avoid errorion and termination at the end of function if element wasn't found
@@ -235,11 +311,56 @@ bool contains_isc_hash_set(isc_hash_set_s const * const set, void const * const
 
     // calculate hash value and index in array
     size_t const hash = set->hash(element, set->ah);
-    size_t const index = hash % set->capacity;
+    size_t const index = _isc_hash_set_index(set, hash);
 
     return _contains_wrapper_isc_hash_set(set, element, hash, index);
 }
 
+void contains_many_isc_hash_set(isc_hash_set_s const * const set, void const * const elements, size_t const count, bool * const results) {
+    error(set && "Parameter can't be NULL.");
+    error((!count || elements) && "Parameter can't be NULL.");
+    error((!count || results) && "Parameter can't be NULL.");
+
+    valid(set->size && "Size can't be zero.");
+    valid(set->hash && "Hash function can't be NULL.");
+    valid(set->compare && "Compare function can't be NULL.");
+    valid(set->allocator && "Allocator can't be NULL.");
+    valid(set->length <= set->capacity && "Lenght can't be larger than capacity.");
+
+    // early return to avoid 'x mod 0' by capacity
+    if (!set->capacity) {
+        for (size_t i = 0; i < count; ++i) { results[i] = false; }
+        return;
+    }
+
+    char const * const keys = elements;
+    size_t hashes[CERPEC_BATCH], indexes[CERPEC_BATCH];
+    for (size_t b = 0; b < count; b += CERPEC_BATCH) {
+        size_t const batch = count - b < CERPEC_BATCH ? count - b : CERPEC_BATCH;
+
+        // hash batch of elements first and prefetch their heads so misses overlap
+        for (size_t i = 0; i < batch; ++i) {
+            hashes[i] = set->hash(keys + ((b + i) * set->size), set->ah);
+            indexes[i] = _isc_hash_set_index(set, hashes[i]);
+            prefetch(set->head + indexes[i]);
+        }
+
+        // prefetch first node of each list since its hash and element are compared first
+        for (size_t i = 0; i < batch; ++i) {
+            size_t const n = set->head[indexes[i]];
+            if (NIL != n) {
+                prefetch(set->hashes + n);
+                prefetch(set->elements + (n * set->size));
+            }
+        }
+
+        // resolve lists with hopefully cached heads and nodes
+        for (size_t i = 0; i < batch; ++i) {
+            results[b + i] = _contains_wrapper_isc_hash_set(set, keys + ((b + i) * set->size), hashes[i], indexes[i]);
+        }
+    }
+}
+
 isc_hash_set_s union_isc_hash_set(isc_hash_set_s const * const set_one, isc_hash_set_s const * const set_two, copy_fn const copy, void * const ac) {
     error(set_one && "Parameter can't be NULL.");
     error(set_two && "Parameter can't be NULL.");
@@ -269,19 +390,19 @@ isc_hash_set_s union_isc_hash_set(isc_hash_set_s const * const set_one, isc_hash
         char const * const element = minimum->elements + (m * minimum->size);
 
         size_t const min_hash = minimum->hashes[m];
-        size_t const union_idx = min_hash % set_union.capacity;
+        size_t const union_idx = _isc_hash_set_index(&set_union, min_hash);
 
         // if element is not in the set push it to set union
         bool const contains = _contains_wrapper_isc_hash_set(&set_union, element, min_hash, union_idx);
         if (!contains) {
             // expand union set if necessary
             if (set_union.length == set_union.capacity) {
-                size_t const capacity = set_union.length ? set_union.length * CERPEC_FACTOR : ISC_HASH_SET_CHUNK;
-                _isc_hash_set_resize(&set_union, capacity);
+                size_t const capacity = expand_growth(&(set_union.growth), set_union.length);
+                _isc_hash_set_resize(&set_union, _isc_hash_set_round(&set_union, capacity));
             }
 
             // index may change due to increase in capacity
-            size_t const new_union_idx = min_hash % set_union.capacity;
+            size_t const new_union_idx = _isc_hash_set_index(&set_union, min_hash);
             _insert_wrapper_isc_hash_set(&set_union, min_hash, new_union_idx);
 
             copy(set_union.elements + (set_union.length * set_union.size), element, ac);
@@ -316,22 +437,23 @@ isc_hash_set_s intersect_isc_hash_set(isc_hash_set_s const * const set_one, isc_
     isc_hash_set_s const * const maximum = set_one->length >= set_two->length ? set_one : set_two;
 
     isc_hash_set_s set_intersect = _make_wrapper_isc_hash_set(set_one->size, set_one->hash, set_one->ah, set_one->compare, set_one->ac, set_one->allocator);
+    set_intersect.indexing = set_one->indexing;
     for (size_t min = 0; min < minimum->length; ++min) {
         char const * const element = minimum->elements + (min * minimum->size);
 
         size_t const min_hash = minimum->hashes[min];
-        size_t const max_idx = min_hash % maximum->capacity;
+        size_t const max_idx = _isc_hash_set_index(maximum, min_hash);
 
         // if element is in set push it into intersect
         bool const contains = _contains_wrapper_isc_hash_set(maximum, element, min_hash, max_idx);
         if (contains) {
             // expand intersect set if necessary
             if (set_intersect.length == set_intersect.capacity) {
-                size_t const capacity = set_intersect.length ? set_intersect.length * CERPEC_FACTOR : ISC_HASH_SET_CHUNK;
-                _isc_hash_set_resize(&set_intersect, capacity);
+                size_t const capacity = expand_growth(&(set_intersect.growth), set_intersect.length);
+                _isc_hash_set_resize(&set_intersect, _isc_hash_set_round(&set_intersect, capacity));
             }
 
-            size_t const intersect_index = min_hash % set_intersect.capacity;
+            size_t const intersect_index = _isc_hash_set_index(&set_intersect, min_hash);
             _insert_wrapper_isc_hash_set(&set_intersect, min_hash, intersect_index);
 
             copy(set_intersect.elements + (set_intersect.length * set_intersect.size), element, ac);
@@ -362,23 +484,24 @@ isc_hash_set_s subtract_isc_hash_set(isc_hash_set_s const * const minuend, isc_h
     valid(subtrahend->length <= subtrahend->capacity && "Lenght can't be larger than capacity.");
 
     isc_hash_set_s set_subtract = _make_wrapper_isc_hash_set(minuend->size, minuend->hash, minuend->ah, minuend->compare, minuend->ac, minuend->allocator);
+    set_subtract.indexing = minuend->indexing;
     for (size_t min = 0; min < minuend->length; ++min) {
         // get element and set its found flag to false
         char const * const element = minuend->elements + (min * minuend->size);
 
         size_t const hash = minuend->hashes[min];
-        size_t const subtrahend_idx = hash % subtrahend->capacity;
+        size_t const subtrahend_idx = _isc_hash_set_index(subtrahend, hash);
 
         // if minuend element is not in subtrahend set push it to new set
         bool const contains = _contains_wrapper_isc_hash_set(subtrahend, element, hash, subtrahend_idx);
         if (!contains) {
             // expand subtract set if necessary
             if (set_subtract.length == set_subtract.capacity) {
-                size_t const capacity = set_subtract.length ? set_subtract.length * CERPEC_FACTOR : ISC_HASH_SET_CHUNK;
-                _isc_hash_set_resize(&set_subtract, capacity);
+                size_t const capacity = expand_growth(&(set_subtract.growth), set_subtract.length);
+                _isc_hash_set_resize(&set_subtract, _isc_hash_set_round(&set_subtract, capacity));
             }
 
-            size_t const subtract_index = hash % set_subtract.capacity;
+            size_t const subtract_index = _isc_hash_set_index(&set_subtract, hash);
             _insert_wrapper_isc_hash_set(&set_subtract, hash, subtract_index);
 
             copy(set_subtract.elements + (set_subtract.length * set_subtract.size), element, ac);
@@ -409,23 +532,24 @@ isc_hash_set_s exclude_isc_hash_set(isc_hash_set_s const * const set_one, isc_ha
     valid(set_two->length <= set_two->capacity && "Lenght can't be larger than capacity.");
 
     isc_hash_set_s set_exclude = _make_wrapper_isc_hash_set(set_one->size, set_one->hash, set_one->ah, set_one->compare, set_one->ac, set_one->allocator);
+    set_exclude.indexing = set_one->indexing;
 
     for (size_t one = 0; one < set_one->length; ++one) {
         // get element and set its found flag to false
         char const * const element = set_one->elements + (one * set_one->size);
 
         size_t const hash = set_one->hashes[one];
-        size_t const two_idx = hash % set_two->capacity;
+        size_t const two_idx = _isc_hash_set_index(set_two, hash);
 
         bool const contains = _contains_wrapper_isc_hash_set(set_two, element, hash, two_idx);
         if (!contains) {
             // expand exclude set if necessary
             if (set_exclude.length == set_exclude.capacity) {
-                size_t const capacity = set_exclude.length ? set_exclude.length * CERPEC_FACTOR : ISC_HASH_SET_CHUNK;
-                _isc_hash_set_resize(&set_exclude, capacity);
+                size_t const capacity = expand_growth(&(set_exclude.growth), set_exclude.length);
+                _isc_hash_set_resize(&set_exclude, _isc_hash_set_round(&set_exclude, capacity));
             }
 
-            size_t const exclude_index = hash % set_exclude.capacity;
+            size_t const exclude_index = _isc_hash_set_index(&set_exclude, hash);
             _insert_wrapper_isc_hash_set(&set_exclude, hash, exclude_index);
 
             copy(set_exclude.elements + (set_exclude.length * set_exclude.size), element, ac);
@@ -438,17 +562,17 @@ isc_hash_set_s exclude_isc_hash_set(isc_hash_set_s const * const set_one, isc_ha
         char const * const element = set_two->elements + (two * set_two->size);
 
         size_t const hash = set_two->hashes[two];
-        size_t const one_idx = hash % set_one->capacity;
+        size_t const one_idx = _isc_hash_set_index(set_one, hash);
 
         bool const contains = _contains_wrapper_isc_hash_set(set_one, element, hash, one_idx);
         if (!contains) {
             // expand exclude set if necessary
             if (set_exclude.length == set_exclude.capacity) {
-                size_t const capacity = set_exclude.length ? set_exclude.length * CERPEC_FACTOR : ISC_HASH_SET_CHUNK;
-                _isc_hash_set_resize(&set_exclude, capacity);
+                size_t const capacity = expand_growth(&(set_exclude.growth), set_exclude.length);
+                _isc_hash_set_resize(&set_exclude, _isc_hash_set_round(&set_exclude, capacity));
             }
 
-            size_t const exclude_index = hash % set_exclude.capacity;
+            size_t const exclude_index = _isc_hash_set_index(&set_exclude, hash);
             _insert_wrapper_isc_hash_set(&set_exclude, hash, exclude_index);
 
             copy(set_exclude.elements + (set_exclude.length * set_exclude.size), element, ac);
@@ -482,7 +606,7 @@ bool is_subset_isc_hash_set(isc_hash_set_s const * const superset, isc_hash_set_
         char const * const element = subset->elements + (sub * subset->size);
 
         size_t const sub_hash = subset->hashes[sub];
-        size_t const super_idx = sub_hash % superset->capacity;
+        size_t const super_idx = _isc_hash_set_index(superset, sub_hash);
 
         bool const contains = _contains_wrapper_isc_hash_set(superset, element, sub_hash, super_idx);
         if (!contains) { return false; }
@@ -514,7 +638,7 @@ bool is_proper_subset_isc_hash_set(isc_hash_set_s const * const superset, isc_ha
         char const * const element = subset->elements + (sub * subset->size);
 
         size_t const sub_hash = subset->hashes[sub];
-        size_t const super_idx = sub_hash % superset->capacity;
+        size_t const super_idx = _isc_hash_set_index(superset, sub_hash);
 
         bool const contains = _contains_wrapper_isc_hash_set(superset, element, sub_hash, super_idx);
         if (!contains) { return false; }
@@ -549,7 +673,7 @@ bool is_disjoint_isc_hash_set(isc_hash_set_s const * const set_one, isc_hash_set
         char const * const element = minimum->elements + (min * minimum->size);
 
         size_t const min_hash = minimum->hash(element, minimum->ah);
-        size_t const max_idx = min_hash % maximum->capacity;
+        size_t const max_idx = _isc_hash_set_index(maximum, min_hash);
 
         bool const contains = _contains_wrapper_isc_hash_set(maximum, element, min_hash, max_idx);
         if (contains) { return false; }
@@ -598,7 +722,7 @@ void _isc_hash_set_resize(isc_hash_set_s * const set, size_t const size) {
 
     // reset lists by pushing hashes to their valid list
     for (size_t i = 0; i < set->length; ++i) {
-        size_t const index = set->hashes[i] % set->capacity;
+        size_t const index = _isc_hash_set_index(set, set->hashes[i]);
 
         size_t const head = set->head[index];
         if (NIL != head) {
@@ -612,8 +736,35 @@ void _isc_hash_set_resize(isc_hash_set_s * const set, size_t const size) {
     }
 }
 
+size_t _isc_hash_set_index(isc_hash_set_s const * const set, size_t const hash) {
+    if (MODULO_INDEX == set->indexing) {
+        return hash % set->capacity;
+    }
+
+    // mix hash so that weak hashes (like identity) don't only depend on their low bits, then mask
+    uint64_t mix = (uint64_t)(hash);
+    mix ^= mix >> 32;
+    mix *= (uint64_t)(0xd6e8feb86659fd93);
+    mix ^= mix >> 32;
+
+    return (size_t)(mix) & (set->capacity - 1);
+}
+
+size_t _isc_hash_set_round(isc_hash_set_s const * const set, size_t const size) {
+    if (MODULO_INDEX == set->indexing || !size) {
+        return size;
+    }
+
+    size_t capacity = 1;
+    while (capacity < size) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
 isc_hash_set_s _make_wrapper_isc_hash_set(size_t const size, hash_fn const hash, void * const ah, compare_fn const compare, void * const ac, memory_s const * const allocator) {
-    return (isc_hash_set_s) { .size = size, .hash = hash, .compare = compare, .allocator = allocator, .ah = ah, .ac = ac, };
+    return (isc_hash_set_s) { .size = size, .hash = hash, .compare = compare, .allocator = allocator, .ah = ah, .ac = ac, .growth = CERPEC_GROWTH(ISC_HASH_SET_CHUNK), };
 }
 
 isc_hash_set_s _copy_wrapper_isc_hash_set(isc_hash_set_s const * const set, copy_fn const copy, void * const ac) {
@@ -621,6 +772,7 @@ isc_hash_set_s _copy_wrapper_isc_hash_set(isc_hash_set_s const * const set, copy
     isc_hash_set_s const replica = {
         .capacity = set->capacity, .hash = set->hash, .length = set->length, .size = set->size,
         .allocator = set->allocator, .compare = set->compare, .ah = set->ah, .ac = set->ac,
+        .indexing = set->indexing, .growth = set->growth,
 
         .elements = set->allocator->alloc(set->capacity * set->size, set->allocator->arg),
         .hashes = set->allocator->alloc(set->capacity * sizeof(size_t), set->allocator->arg),
@@ -682,12 +834,12 @@ bool _contains_wrapper_isc_hash_set(isc_hash_set_s const * const set, void const
 
 void _isc_hash_set_fill_hole(isc_hash_set_s const * const set, size_t const hole) {
     if (NIL == set->prev[set->length]) {
-        size_t const index = set->hashes[set->length] % set->capacity;
+        size_t const index = _isc_hash_set_index(set, set->hashes[set->length]);
         set->head[index] = hole;
     }
 
     if (NIL == set->prev[hole]) {
-        size_t const index = set->hashes[hole] % set->capacity;
+        size_t const index = _isc_hash_set_index(set, set->hashes[hole]);
         set->head[index] = set->next[hole];
     }
 
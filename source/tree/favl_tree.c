@@ -1029,7 +1029,7 @@ void post_order_favl_tree(favl_tree_s const * const tree, manage_fn const manage
             if (NIL != peek_right && peek_right != last) {
                 node = peek_right;
             } else {
-                if (!manage(tree->elements + (node * tree->size), am)) {
+                if (!manage(tree->elements + (peek * tree->size), am)) {
                     break;
                 }
 
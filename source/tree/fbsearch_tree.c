@@ -968,7 +968,7 @@ void post_order_fbsearch_tree(fbsearch_tree_s const * const tree, manage_fn cons
             if (NIL != peek_right && peek_right != last) {
                 node = peek_right;
             } else {
-                if (!manage(tree->elements + (node * tree->size), am)) {
+                if (!manage(tree->elements + (peek * tree->size), am)) {
                     break;
                 }
 
@@ -849,25 +849,21 @@ void in_order_frb_tree(frb_tree_s const * const tree, manage_fn const manage, vo
     bool left_done = false;
     size_t node = tree->root;
     while (NIL != node) {
-        size_t const parent = tree->parent[node];
-        size_t const left = tree->node[FRBT_LEFT][node];
-        size_t const right = tree->node[FRBT_RIGHT][node];
-
-        while (!left_done && NIL != left) {
-            node = left;
+        while (!left_done && NIL != tree->node[FRBT_LEFT][node]) {
+            node = tree->node[FRBT_LEFT][node];
         }
 
         if (!manage(tree->elements + (node * tree->size), am)) { break; }
 
         left_done = true;
-        if (NIL != right) {
+        if (NIL != tree->node[FRBT_RIGHT][node]) {
             left_done = false;
-            node = right;
-        } else if (NIL != parent) {
-            while (NIL != parent && node == tree->node[FRBT_RIGHT][parent]) { node = parent; }
-            if (NIL == parent) { break; }
+            node = tree->node[FRBT_RIGHT][node];
+        } else if (NIL != tree->parent[node]) {
+            while (NIL != tree->parent[node] && node == tree->node[FRBT_RIGHT][tree->parent[node]]) { node = tree->parent[node]; }
+            if (NIL == tree->parent[node]) { break; }
 
-            node = parent;
+            node = tree->parent[node];
         } else {
             break;
         }
@@ -951,7 +947,7 @@ void post_order_frb_tree(frb_tree_s const * const tree, manage_fn const manage,
             if (NIL != peek_right && peek_right != last) {
                 node = peek_right;
             } else {
-                if (!manage(tree->elements + (node * tree->size), am)) {
+                if (!manage(tree->elements + (peek * tree->size), am)) {
                     break;
                 }
 
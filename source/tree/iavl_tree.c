@@ -80,7 +80,7 @@ iavl_tree_s create_iavl_tree(size_t const size, compare_fn const compare, void *
     error(compare && "Parameter can't be NULL.");
     error(size && "Parameter can't be zero.");
 
-    return (iavl_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = &standard, .ac = ac, };
+    return (iavl_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = &standard, .ac = ac, .growth = CERPEC_GROWTH(IAVL_TREE_CHUNK), };
 }
 
 iavl_tree_s make_iavl_tree(size_t const size, compare_fn const compare, void * const ac, memory_s const * const allocator) {
@@ -88,7 +88,7 @@ iavl_tree_s make_iavl_tree(size_t const size, compare_fn const compare, void * c
     error(size && "Parameter can't be zero.");
     error(allocator && "Parameter can't be NULL.");
 
-    return (iavl_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = allocator, .ac = ac, };
+    return (iavl_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = allocator, .ac = ac, .growth = CERPEC_GROWTH(IAVL_TREE_CHUNK), };
 }
 
 void destroy_iavl_tree(iavl_tree_s * const tree, set_fn const destroy, void * const ad) {
@@ -154,7 +154,7 @@ iavl_tree_s copy_iavl_tree(iavl_tree_s const * const tree, copy_fn const copy, v
         .node[IAVLT_RIGHT] = tree->allocator->alloc(tree->capacity * sizeof(size_t), tree->allocator->arg),
 
         .capacity = tree->capacity, .root = tree->root, .length = tree->length, .compare = tree->compare,
-        .size = tree->size, .allocator = tree->allocator, .ac = tree->ac,
+        .size = tree->size, .allocator = tree->allocator, .ac = tree->ac, .growth = tree->growth,
     };
     error((!replica.capacity || replica.elements) && "Memory allocation failed.");
     error((!replica.capacity || replica.parent) && "Memory allocation failed.");
@@ -184,6 +184,46 @@ bool is_empty_iavl_tree(iavl_tree_s const * const tree) {
     return !tree->length;
 }
 
+void growth_iavl_tree(iavl_tree_s * const tree, growth_s const growth) {
+    error(tree && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    tree->growth = growth;
+}
+
+void reserve_iavl_tree(iavl_tree_s * const tree, size_t const capacity) {
+    error(tree && "Parameter can't be NULL.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    if (capacity > tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
+    }
+}
+
+void shrink_to_fit_iavl_tree(iavl_tree_s * const tree) {
+    error(tree && "Parameter can't be NULL.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    if (tree->length != tree->capacity) {
+        _iavl_tree_resize(tree, tree->length);
+    }
+}
+
 void insert_iavl_tree(iavl_tree_s * const tree, void const * const element) {
     error(tree && "Parameter can't be NULL.");
     error(element && "Parameter can't be NULL.");
@@ -195,8 +235,7 @@ void insert_iavl_tree(iavl_tree_s * const tree, void const * const element) {
     valid(tree->allocator && "Allocator can't be NULL.");
 
     if (tree->length == tree->capacity) {
-        size_t const capacity = tree->length ? tree->length * CERPEC_FACTOR : IAVL_TREE_CHUNK;
-        _iavl_tree_resize(tree, capacity);
+        _iavl_tree_resize(tree, expand_growth(&(tree->growth), tree->length));
     }
 
     size_t previous = NIL; // initially invalid for the head case when tree is empty
@@ -262,8 +301,9 @@ void remove_iavl_tree(iavl_tree_s * const tree, void const * const element, void
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*node));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -373,8 +413,9 @@ void remove_max_iavl_tree(iavl_tree_s * const tree, void * const buffer) {
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*maximum));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -413,8 +454,9 @@ void remove_min_iavl_tree(iavl_tree_s * const tree, void * const buffer) {
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*minimum));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -534,8 +576,9 @@ void remove_floor_iavl_tree(iavl_tree_s * const tree, void const * const element
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*floor));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -571,8 +614,9 @@ void remove_ceil_iavl_tree(iavl_tree_s * const tree, void const * const element,
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*ceil));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -701,8 +745,9 @@ void remove_successor_iavl_tree(iavl_tree_s * const tree, void const * const ele
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*successor));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -738,8 +783,9 @@ void remove_predecessor_iavl_tree(iavl_tree_s * const tree, void const * const e
     _iavl_tree_fill_hole(tree, hole);
     _iavl_tree_rebalance(tree, (*predecessor));
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IAVL_TREE_CHUNK || !tree->length)) {
-        _iavl_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _iavl_tree_resize(tree, capacity);
     }
 }
 
@@ -892,7 +938,7 @@ void post_order_iavl_tree(iavl_tree_s const * const tree, manage_fn const manage
             if (NIL != peek_right && peek_right != last) {
                 node = peek_right;
             } else {
-                if (!manage(tree->elements + (node * tree->size), am)) {
+                if (!manage(tree->elements + (peek * tree->size), am)) {
                     break;
                 }
 
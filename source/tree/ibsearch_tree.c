@@ -59,14 +59,14 @@ ibsearch_tree_s create_ibsearch_tree(size_t const size, compare_fn const compare
     error(compare && "Parameter can't be NULL.");
     error(size && "Parameter can't be zero.");
 
-    return (ibsearch_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = &standard, .ac = ac, };
+    return (ibsearch_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = &standard, .ac = ac, .growth = CERPEC_GROWTH(IBSEARCH_TREE_CHUNK), };
 }
 
 ibsearch_tree_s make_ibsearch_tree(size_t const size, compare_fn const compare, void * const ac, memory_s const * const allocator) {
     error(compare && "Parameter can't be NULL.");
     error(size && "Parameter can't be zero.");
 
-    return (ibsearch_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = allocator, .ac = ac, };
+    return (ibsearch_tree_s) { .root = NIL, .compare = compare, .size = size, .allocator = allocator, .ac = ac, .growth = CERPEC_GROWTH(IBSEARCH_TREE_CHUNK), };
 }
 
 void destroy_ibsearch_tree(ibsearch_tree_s * const tree, set_fn const destroy, void * const ad) {
@@ -129,7 +129,7 @@ ibsearch_tree_s copy_ibsearch_tree(ibsearch_tree_s const * const tree, copy_fn c
         .node[IBST_RIGHT] = tree->allocator->alloc(tree->capacity * sizeof(size_t), tree->allocator->arg),
 
         .capacity = tree->capacity, .root = tree->root, .length = tree->length, .compare = tree->compare,
-        .size = tree->size, .allocator = tree->allocator, .ac = tree->ac,
+        .size = tree->size, .allocator = tree->allocator, .ac = tree->ac, .growth = tree->growth,
     };
     error((!replica.capacity || replica.elements) && "Memory allocation failed.");
     error((!replica.capacity || replica.parent) && "Memory allocation failed.");
@@ -157,6 +157,46 @@ bool is_empty_ibsearch_tree(ibsearch_tree_s const * const tree) {
     return !tree->length;
 }
 
+void growth_ibsearch_tree(ibsearch_tree_s * const tree, growth_s const growth) {
+    error(tree && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    tree->growth = growth;
+}
+
+void reserve_ibsearch_tree(ibsearch_tree_s * const tree, size_t const capacity) {
+    error(tree && "Parameter can't be NULL.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    if (capacity > tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
+    }
+}
+
+void shrink_to_fit_ibsearch_tree(ibsearch_tree_s * const tree) {
+    error(tree && "Parameter can't be NULL.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    if (tree->length != tree->capacity) {
+        _ibsearch_tree_resize(tree, tree->length);
+    }
+}
+
 void insert_ibsearch_tree(ibsearch_tree_s * const tree, void const * const element) {
     error(tree && "Parameter can't be NULL.");
     error(element && "Parameter can't be NULL.");
@@ -168,8 +208,7 @@ void insert_ibsearch_tree(ibsearch_tree_s * const tree, void const * const eleme
     valid(tree->allocator && "Allocator can't be NULL.");
 
     if (tree->length == tree->capacity) {
-        size_t const capacity = tree->length ? tree->length * CERPEC_FACTOR : IBSEARCH_TREE_CHUNK;
-        _ibsearch_tree_resize(tree, capacity);
+        _ibsearch_tree_resize(tree, expand_growth(&(tree->growth), tree->length));
     }
 
     size_t previous = NIL; // initially invalid for the head case when tree is empty
@@ -232,8 +271,9 @@ void remove_ibsearch_tree(ibsearch_tree_s * const tree, void const * const eleme
     size_t const hole = _ibsearch_tree_remove_fixup(tree, node);
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -342,8 +382,9 @@ void remove_max_ibsearch_tree(ibsearch_tree_s * const tree, void * const buffer)
 
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -381,8 +422,9 @@ void remove_min_ibsearch_tree(ibsearch_tree_s * const tree, void * const buffer)
 
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -501,8 +543,9 @@ void remove_floor_ibsearch_tree(ibsearch_tree_s * const tree, void const * const
     size_t const hole = _ibsearch_tree_remove_fixup(tree, floor);
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -537,8 +580,9 @@ void remove_ceil_ibsearch_tree(ibsearch_tree_s * const tree, void const * const
     size_t const hole = _ibsearch_tree_remove_fixup(tree, ceil);
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -667,8 +711,9 @@ void remove_successor_ibsearch_tree(ibsearch_tree_s * const tree, void const * c
     size_t const hole = _ibsearch_tree_remove_fixup(tree, successor);
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -703,8 +748,9 @@ void remove_predecessor_ibsearch_tree(ibsearch_tree_s * const tree, void const *
     size_t const hole = _ibsearch_tree_remove_fixup(tree, predecessor);
     _ibsearch_tree_fill_hole(tree, hole);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IBSEARCH_TREE_CHUNK || !tree->length)) {
-        _ibsearch_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _ibsearch_tree_resize(tree, capacity);
     }
 }
 
@@ -857,7 +903,7 @@ void post_order_ibsearch_tree(ibsearch_tree_s const * const tree, manage_fn cons
             if (NIL != peek_right && peek_right != last) {
                 node = peek_right;
             } else {
-                if (!manage(tree->elements + (node * tree->size), am)) {
+                if (!manage(tree->elements + (peek * tree->size), am)) {
                     break;
                 }
 
@@ -97,7 +97,7 @@ irb_tree_s create_irb_tree(size_t const size, compare_fn const compare, void * c
         .parent = standard.alloc(sizeof(size_t), standard.arg),
         .node[IRBT_LEFT] = standard.alloc(sizeof(size_t), standard.arg),
         .node[IRBT_RIGHT] = standard.alloc(sizeof(size_t), standard.arg),
-        .allocator = &standard, .ac = ac,
+        .allocator = &standard, .ac = ac, .growth = CERPEC_GROWTH(IRB_TREE_CHUNK),
     };
     error(tree.elements && "Memory allocation failed.");
     error(tree.color && "Memory allocation failed.");
@@ -123,7 +123,7 @@ irb_tree_s make_irb_tree(size_t const size, compare_fn const compare, void * con
         .parent = allocator->alloc(sizeof(size_t), allocator->arg),
         .node[IRBT_LEFT] = allocator->alloc(sizeof(size_t), allocator->arg),
         .node[IRBT_RIGHT] = allocator->alloc(sizeof(size_t), allocator->arg),
-        .allocator = allocator, .ac = ac,
+        .allocator = allocator, .ac = ac, .growth = CERPEC_GROWTH(IRB_TREE_CHUNK),
     };
     error(tree.elements && "Memory allocation failed.");
     error(tree.color && "Memory allocation failed.");
@@ -204,7 +204,7 @@ irb_tree_s copy_irb_tree(irb_tree_s const * const tree, copy_fn const copy, void
         .node[IRBT_LEFT] = tree->allocator->alloc((tree->capacity + 1) * sizeof(size_t), tree->allocator->arg),
         .node[IRBT_RIGHT] = tree->allocator->alloc((tree->capacity + 1) * sizeof(size_t), tree->allocator->arg),
 
-        .allocator = tree->allocator, .ac = tree->ac,
+        .allocator = tree->allocator, .ac = tree->ac, .growth = tree->growth,
         .capacity = tree->capacity, .root = tree->root, .length = tree->length, .compare = tree->compare, .size = tree->size,
     };
 
@@ -237,6 +237,46 @@ bool is_empty_irb_tree(irb_tree_s const * const tree) {
     return !(tree->length);
 }
 
+void growth_irb_tree(irb_tree_s * const tree, growth_s const growth) {
+    error(tree && "Parameter can't be NULL.");
+    error(growth.factor > 1 && "Factor must be greater than one.");
+    error(growth.chunk && "Chunk can't be zero.");
+    error((!growth.shrink || growth.shrink >= growth.factor) && "Shrink must be zero or at least factor.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    tree->growth = growth;
+}
+
+void reserve_irb_tree(irb_tree_s * const tree, size_t const capacity) {
+    error(tree && "Parameter can't be NULL.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    if (capacity > tree->capacity) {
+        _irb_tree_resize(tree, capacity);
+    }
+}
+
+void shrink_to_fit_irb_tree(irb_tree_s * const tree) {
+    error(tree && "Parameter can't be NULL.");
+
+    valid(tree->size && "Size can't be zero.");
+    valid(tree->length <= tree->capacity && "Lenght can't be larger than capacity.");
+    valid(tree->compare && "Compare function can't be NULL.");
+    valid(tree->allocator && "Allocator can't be NULL.");
+
+    if (tree->length != tree->capacity) {
+        _irb_tree_resize(tree, tree->length);
+    }
+}
+
 void insert_irb_tree(irb_tree_s * const tree, void const * const element) {
     error(tree && "Parameter can't be NULL.");
     error(element && "Parameter can't be NULL.");
@@ -248,8 +288,7 @@ void insert_irb_tree(irb_tree_s * const tree, void const * const element) {
     valid(tree->allocator && "Allocator can't be NULL.");
 
     if (tree->length == tree->capacity) {
-        size_t const capacity = tree->length ? tree->length * CERPEC_FACTOR : IRB_TREE_CHUNK;
-        _irb_tree_resize(tree, capacity);
+        _irb_tree_resize(tree, expand_growth(&(tree->growth), tree->length));
     }
 
     size_t previous = NIL; // initially invalid for the head case when tree is empty
@@ -319,8 +358,9 @@ void remove_irb_tree(irb_tree_s * const tree, void const * const element, void *
 
     _irb_tree_fill_hole(tree, node);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -424,8 +464,9 @@ void remove_max_irb_tree(irb_tree_s * const tree, void * const buffer) {
 
     _irb_tree_fill_hole(tree, maximum);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -457,8 +498,9 @@ void remove_min_irb_tree(irb_tree_s * const tree, void * const buffer) {
 
     _irb_tree_fill_hole(tree, minimum);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -550,8 +592,9 @@ void remove_floor_irb_tree(irb_tree_s * const tree, void const * const element,
 
     _irb_tree_fill_hole(tree, floor);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -587,8 +630,9 @@ void remove_ceil_irb_tree(irb_tree_s * const tree, void const * const element, v
 
     _irb_tree_fill_hole(tree, ceil);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -680,8 +724,9 @@ void remove_successor_irb_tree(irb_tree_s * const tree, void const * const eleme
 
     _irb_tree_fill_hole(tree, successor);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -717,8 +762,9 @@ void remove_predecessor_irb_tree(irb_tree_s * const tree, void const * const ele
 
     _irb_tree_fill_hole(tree, predecessor);
 
-    if (tree->length <= tree->capacity / CERPEC_FACTOR && (tree->length > IRB_TREE_CHUNK || !tree->length)) {
-        _irb_tree_resize(tree, tree->length);
+    size_t const capacity = shrink_growth(&(tree->growth), tree->length, tree->capacity);
+    if (capacity != tree->capacity) {
+        _irb_tree_resize(tree, capacity);
     }
 }
 
@@ -776,25 +822,21 @@ void in_order_irb_tree(irb_tree_s const * const tree, manage_fn const manage, vo
     bool left_done = false;
     size_t node = tree->root;
     while (NIL != node) {
-        size_t const parent = tree->parent[node];
-        size_t const left = tree->node[IRBT_LEFT][node];
-        size_t const right = tree->node[IRBT_RIGHT][node];
-
-        while (!left_done && NIL != left) {
-            node = left;
+        while (!left_done && NIL != tree->node[IRBT_LEFT][node]) {
+            node = tree->node[IRBT_LEFT][node];
         }
 
         if (!manage(tree->elements + (node * tree->size), am)) { break; }
 
         left_done = true;
-        if (NIL != right) {
+        if (NIL != tree->node[IRBT_RIGHT][node]) {
             left_done = false;
-            node = right;
-        } else if (NIL != parent) {
-            while (NIL != parent && node == tree->node[IRBT_RIGHT][parent]) { node = parent; }
-            if (NIL == parent) { break; }
+            node = tree->node[IRBT_RIGHT][node];
+        } else if (NIL != tree->parent[node]) {
+            while (NIL != tree->parent[node] && node == tree->node[IRBT_RIGHT][tree->parent[node]]) { node = tree->parent[node]; }
+            if (NIL == tree->parent[node]) { break; }
 
-            node = parent;
+            node = tree->parent[node];
         } else {
             break;
         }
@@ -868,7 +910,7 @@ void post_order_irb_tree(irb_tree_s const * const tree, manage_fn const manage,
             if (NIL != peek_right && peek_right != last) {
                 node = peek_right;
             } else {
-                if (!manage(tree->elements + (node * tree->size), am)) {
+                if (!manage(tree->elements + (peek * tree->size), am)) {
                     break;
                 }
 
@@ -6,6 +6,8 @@ int main(const int argc, char **argv) {
     GREATEST_MAIN_BEGIN();
 
     RUN_SUITE(iam_graph_test);
+    RUN_SUITE(icsr_graph_test);
+    RUN_SUITE(idam_graph_test);
 
     GREATEST_MAIN_END();
 }
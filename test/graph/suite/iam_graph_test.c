@@ -1,4 +1,5 @@
 #include <limits.h>
+#include <float.h>
 
 #include <graph/iam_graph.h>
 #include <graph/table.h>
@@ -14,6 +15,12 @@
 #define SQUARE_GRAPH_SIZE 4
 #define PENTAGON_GRAPH_SIZE 5
 
+/// @brief Heuristic that never overestimates, making A* behave like Dijkstra.
+void _iam_zero_heuristic(void * const result, void const * const a, void const * const b, void * arg) {
+    (void)(a); (void)(b); (void)(arg);
+    *(int *)(result) = 0;
+}
+
 TEST CREATE_01(void) {
     int none = 0;
     iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
@@ -1500,6 +1507,957 @@ TEST DIJKSTRA_03(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    reserve_iam_graph(&graph, 100);
+    size_t const capacity = graph.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+    ASSERT_EQ(capacity, graph.capacity);
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int vertex = -1;
+        remove_vertex_iam_graph(&graph, 0, &vertex, intdst, NULL);
+    }
+
+    shrink_to_fit_iam_graph(&graph);
+    ASSERT_EQ(graph.vertex_length, graph.capacity);
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_04(void) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=5GT5hYzjNoo
+
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int const edges[] = { 4, 8, 8, 11, 7, 4, 2, 9, 14, 10, 2, 1, 6, 7 };
+    insert_weight_iam_graph(&graph, 0, 1, edges +  0);
+    insert_weight_iam_graph(&graph, 0, 7, edges +  1);
+
+    insert_weight_iam_graph(&graph, 1, 2, edges +  2);
+    insert_weight_iam_graph(&graph, 1, 7, edges +  3);
+
+    insert_weight_iam_graph(&graph, 2, 3, edges +  4);
+    insert_weight_iam_graph(&graph, 2, 5, edges +  5);
+    insert_weight_iam_graph(&graph, 2, 8, edges +  6);
+
+    insert_weight_iam_graph(&graph, 3, 4, edges +  7);
+    insert_weight_iam_graph(&graph, 3, 5, edges +  8);
+
+    insert_weight_iam_graph(&graph, 4, 5, edges +  9);
+
+    insert_weight_iam_graph(&graph, 5, 6, edges + 10);
+
+    insert_weight_iam_graph(&graph, 6, 7, edges + 11);
+    insert_weight_iam_graph(&graph, 6, 8, edges + 12);
+
+    insert_weight_iam_graph(&graph, 7, 8, edges + 13);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dijkstra_iam_graph(&graph, &table, 0, 8);
+
+    ASSERT_EQ(14, ((int *)(table.costs))[8]);
+    ASSERT_EQ(2, table.previous[8]);
+    ASSERT_EQ(1, table.previous[2]);
+    ASSERT_EQ(0, table.previous[1]);
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST A_STAR_01(void) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=5GT5hYzjNoo
+
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int const edges[] = { 4, 8, 8, 11, 7, 4, 2, 9, 14, 10, 2, 1, 6, 7 };
+    insert_weight_iam_graph(&graph, 0, 1, edges +  0);
+    insert_weight_iam_graph(&graph, 0, 7, edges +  1);
+
+    insert_weight_iam_graph(&graph, 1, 2, edges +  2);
+    insert_weight_iam_graph(&graph, 1, 7, edges +  3);
+
+    insert_weight_iam_graph(&graph, 2, 3, edges +  4);
+    insert_weight_iam_graph(&graph, 2, 5, edges +  5);
+    insert_weight_iam_graph(&graph, 2, 8, edges +  6);
+
+    insert_weight_iam_graph(&graph, 3, 4, edges +  7);
+    insert_weight_iam_graph(&graph, 3, 5, edges +  8);
+
+    insert_weight_iam_graph(&graph, 4, 5, edges +  9);
+
+    insert_weight_iam_graph(&graph, 5, 6, edges + 10);
+
+    insert_weight_iam_graph(&graph, 6, 7, edges + 11);
+    insert_weight_iam_graph(&graph, 6, 8, edges + 12);
+
+    insert_weight_iam_graph(&graph, 7, 8, edges + 13);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    a_star_iam_graph(&graph, &table, 0, 4, _iam_zero_heuristic, NULL);
+
+    ASSERT_EQ(21, ((int *)(table.costs))[4]);
+
+    size_t const path[] = { 4, 5, 6, 7, 0, };
+    for (size_t i = 0; i < sizeof(path) / sizeof(path[0]) - 1; ++i) {
+        ASSERT_EQ(path[i + 1], table.previous[path[i]]);
+    }
+    ASSERT_EQ(IAM_SPECIAL, table.previous[0]);
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST WORKSPACE_01(void) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=5GT5hYzjNoo
+
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int const edges[] = { 4, 8, 8, 11, 7, 4, 2, 9, 14, 10, 2, 1, 6, 7 };
+    insert_weight_iam_graph(&graph, 0, 1, edges +  0);
+    insert_weight_iam_graph(&graph, 0, 7, edges +  1);
+
+    insert_weight_iam_graph(&graph, 1, 2, edges +  2);
+    insert_weight_iam_graph(&graph, 1, 7, edges +  3);
+
+    insert_weight_iam_graph(&graph, 2, 3, edges +  4);
+    insert_weight_iam_graph(&graph, 2, 5, edges +  5);
+    insert_weight_iam_graph(&graph, 2, 8, edges +  6);
+
+    insert_weight_iam_graph(&graph, 3, 4, edges +  7);
+    insert_weight_iam_graph(&graph, 3, 5, edges +  8);
+
+    insert_weight_iam_graph(&graph, 4, 5, edges +  9);
+
+    insert_weight_iam_graph(&graph, 5, 6, edges + 10);
+
+    insert_weight_iam_graph(&graph, 6, 7, edges + 11);
+    insert_weight_iam_graph(&graph, 6, 8, edges + 12);
+
+    insert_weight_iam_graph(&graph, 7, 8, edges + 13);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    graph_workspace_s workspace = create_graph_workspace(graph.vertex_length, &table);
+
+    // every search with same workspace matches a search with a new table
+    for (size_t i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        dijkstra_workspace_iam_graph(&graph, &workspace, i, IAM_SPECIAL);
+        dijkstra_iam_graph(&graph, &table, i, IAM_SPECIAL);
+
+        ASSERT_MEM_EQ(table.costs, workspace.table.costs, DIJKSTRA_03_SIZE * sizeof(int));
+        ASSERT_MEM_EQ(table.previous, workspace.table.previous, DIJKSTRA_03_SIZE * sizeof(size_t));
+
+        destroy_iam_table(&table);
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    }
+
+    // point to point search resets what full search reached
+    dijkstra_workspace_iam_graph(&graph, &workspace, 0, 1);
+    ASSERT_EQ(4, ((int *)(workspace.table.costs))[1]);
+    ASSERT_EQ(0, workspace.table.previous[1]);
+    ASSERT_EQ(INT_MAX, ((int *)(workspace.table.costs))[4]);
+    ASSERT_EQ(IAM_SPECIAL, workspace.table.previous[4]);
+    ASSERT(workspace.touched_length < DIJKSTRA_03_SIZE);
+
+    a_star_workspace_iam_graph(&graph, &workspace, 0, 4, _iam_zero_heuristic, NULL);
+    ASSERT_EQ(21, ((int *)(workspace.table.costs))[4]);
+    ASSERT_EQ(5, workspace.table.previous[4]);
+
+    destroy_graph_workspace(&workspace);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST WORKSPACE_02(void) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=5GT5hYzjNoo
+
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int const edges[] = { 4, 8, 8, 11, 7, 4, 2, 9, 14, 10, 2, 1, 6, 7 };
+    insert_weight_iam_graph(&graph, 0, 1, edges +  0);
+    insert_weight_iam_graph(&graph, 0, 7, edges +  1);
+
+    insert_weight_iam_graph(&graph, 1, 2, edges +  2);
+    insert_weight_iam_graph(&graph, 1, 7, edges +  3);
+
+    insert_weight_iam_graph(&graph, 2, 3, edges +  4);
+    insert_weight_iam_graph(&graph, 2, 5, edges +  5);
+    insert_weight_iam_graph(&graph, 2, 8, edges +  6);
+
+    insert_weight_iam_graph(&graph, 3, 4, edges +  7);
+    insert_weight_iam_graph(&graph, 3, 5, edges +  8);
+
+    insert_weight_iam_graph(&graph, 4, 5, edges +  9);
+
+    insert_weight_iam_graph(&graph, 5, 6, edges + 10);
+
+    insert_weight_iam_graph(&graph, 6, 7, edges + 11);
+    insert_weight_iam_graph(&graph, 6, 8, edges + 12);
+
+    insert_weight_iam_graph(&graph, 7, 8, edges + 13);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    graph_workspace_s workspace = create_graph_workspace(graph.vertex_length, &table);
+
+    // minimum spanning tree weight stays same between reused searches from any vertex
+    for (size_t i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        prim_workspace_iam_graph(&graph, &workspace, i);
+
+        int total = 0;
+        for (size_t j = 0; j < DIJKSTRA_03_SIZE; ++j) {
+            total += ((int *)(workspace.table.costs))[j];
+        }
+        ASSERT_EQ(37, total);
+        ASSERT_EQ(IAM_SPECIAL, workspace.table.previous[i]);
+    }
+
+    // traversals reach every vertex of connected graph, with start being the only one without previous
+    bfs_workspace_iam_graph(&graph, &workspace, 0, IAM_SPECIAL);
+    ASSERT_EQ(DIJKSTRA_03_SIZE, workspace.touched_length);
+    ASSERT_EQ(IAM_SPECIAL, workspace.table.previous[0]);
+    ASSERT_EQ(0, workspace.table.previous[7]);
+
+    dfs_workspace_iam_graph(&graph, &workspace, 8, IAM_SPECIAL);
+    ASSERT_EQ(DIJKSTRA_03_SIZE, workspace.touched_length);
+    ASSERT_EQ(IAM_SPECIAL, workspace.table.previous[8]);
+    ASSERT_NEQ(IAM_SPECIAL, workspace.table.previous[0]);
+
+    destroy_graph_workspace(&workspace);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+/// @brief Counts edges on path from vertex back to search's start vertex.
+size_t _iam_hops(table_s const * const table, size_t const vertex) {
+    size_t hops = 0;
+    for (size_t i = table->previous[vertex]; IAM_SPECIAL != i; i = table->previous[i]) {
+        hops++;
+    }
+    return hops;
+}
+
+/// @brief Counts managed elements into size argument.
+bool _iam_count(void * const element, void * const count) {
+    (void)(element);
+    (*(size_t *)(count))++;
+    return true;
+}
+
+/// @brief Inserts pseudo random edges between vertices with about 'density' percent of all possible edges.
+void _iam_random_graph(iam_graph_s * const graph, size_t const size, unsigned const density) {
+    for (int i = 0; i < (int)(size); ++i) {
+        insert_vertex_iam_graph(graph, &i);
+    }
+
+    unsigned state = 11;
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = i + 1; j < size; ++j) {
+            state = state * 1103515245u + 12345u;
+            if ((state >> 16) % 100 < density) {
+                int const weight = (int)((state >> 8) % 20) + 1;
+                insert_weight_iam_graph(graph, i, j, &weight);
+            }
+        }
+    }
+}
+
+TEST REMOVE_EDGE_07(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < TRIANGLE_GRAPH_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int edge = 1;
+    insert_weight_iam_graph(&graph, 0, 1, &edge);
+    insert_weight_iam_graph(&graph, 0, 2, &edge);
+
+    // removed edge is no longer counted by either of its vertices
+    remove_weight_iam_graph(&graph, 0, 1, &edge);
+    ASSERT_EQ(1, degree_iam_graph(&graph, 0));
+    ASSERT_EQ(0, degree_iam_graph(&graph, 1));
+    ASSERT_EQ(1, degree_iam_graph(&graph, 2));
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST PARALLEL_BFS_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, 9, 30);
+
+    int zero = 0, inf = INT_MAX;
+    table_s sequential = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s parallel = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    bfs_iam_graph(&graph, &sequential, 0, IAM_SPECIAL);
+    parallel_bfs_iam_graph(&graph, &parallel, 0, IAM_SPECIAL, 4);
+
+    // parents may differ, but every vertex is reached on the same level
+    for (size_t i = 0; i < graph.vertex_length; ++i) {
+        ASSERT_EQ(IAM_SPECIAL == sequential.previous[i], IAM_SPECIAL == parallel.previous[i]);
+        ASSERT_EQ(_iam_hops(&sequential, i), _iam_hops(&parallel, i));
+    }
+
+    destroy_iam_table(&sequential);
+    destroy_iam_table(&parallel);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST PARALLEL_BFS_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // dense graph makes frontier's edges outgrow unexplored ones, so levels are also expanded bottom-up
+    _iam_random_graph(&graph, 300, 5);
+
+    int zero = 0, inf = INT_MAX;
+    table_s sequential = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s single = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    bfs_iam_graph(&graph, &sequential, 7, IAM_SPECIAL);
+    parallel_bfs_iam_graph(&graph, &single, 7, IAM_SPECIAL, 1);
+
+    for (size_t i = 0; i < graph.vertex_length; ++i) {
+        ASSERT_EQ(_iam_hops(&sequential, i), _iam_hops(&single, i));
+        ASSERT_EQ(((int *)(sequential.costs))[i] == INT_MAX, ((int *)(single.costs))[i] == INT_MAX);
+    }
+
+    // table doesn't depend on number of threads
+    size_t const threads[] = { 2, 3, 8, 64, };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(size_t); ++t) {
+        table_s parallel = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+        parallel_bfs_iam_graph(&graph, &parallel, 7, IAM_SPECIAL, threads[t]);
+
+        ASSERT_MEM_EQ(single.costs, parallel.costs, graph.vertex_length * sizeof(int));
+        ASSERT_MEM_EQ(single.previous, parallel.previous, graph.vertex_length * sizeof(size_t));
+
+        destroy_iam_table(&parallel);
+    }
+
+    destroy_iam_table(&sequential);
+    destroy_iam_table(&single);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST PARALLEL_BFS_03(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // path graph has one vertex per level and a single path to its end
+    for (int i = 0; i < 100; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+    for (size_t i = 0; i < 99; ++i) {
+        int const weight = 1;
+        insert_weight_iam_graph(&graph, i, i + 1, &weight);
+    }
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    parallel_bfs_iam_graph(&graph, &table, 0, 50, 4);
+
+    // search stops after level with end vertex
+    ASSERT_EQ(50, _iam_hops(&table, 50));
+    ASSERT_EQ(IAM_SPECIAL, table.previous[51]);
+
+    size_t count = 0;
+    ASSERT(each_path_iam_list(&table, 50, _iam_count, &count));
+    ASSERT_EQ(51, count);
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+/// @brief Checks if two Kruskal tables have same sets with same root costs.
+bool _iam_same_forest(table_s const * const one, table_s const * const two, size_t const length) {
+    for (size_t i = 0; i < length; ++i) {
+        size_t const root_one = one->previous[i], root_two = two->previous[i];
+        if (two->previous[root_one] != root_two || one->previous[root_two] != root_one) {
+            return false;
+        }
+        if (((int *)(one->costs))[root_one] != ((int *)(two->costs))[root_two]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST IS_CYCLIC_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < SQUARE_GRAPH_SIZE + 2; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    // two separate paths don't have a cycle
+    int const edge = 1;
+    insert_weight_iam_graph(&graph, 0, 1, &edge);
+    insert_weight_iam_graph(&graph, 1, 2, &edge);
+    insert_weight_iam_graph(&graph, 2, 3, &edge);
+    insert_weight_iam_graph(&graph, 4, 5, &edge);
+    ASSERT_FALSE(is_cyclic_iam_graph(&graph));
+
+    // closing the square creates a cycle in first component only
+    insert_weight_iam_graph(&graph, 3, 0, &edge);
+    ASSERT(is_cyclic_iam_graph(&graph));
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST IS_CYCLIC_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // cycle is only in component that doesn't contain first vertex
+    for (int i = 0; i < TRIANGLE_GRAPH_SIZE + 1; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int const edge = 1;
+    insert_weight_iam_graph(&graph, 1, 2, &edge);
+    insert_weight_iam_graph(&graph, 2, 3, &edge);
+    insert_weight_iam_graph(&graph, 3, 1, &edge);
+    ASSERT(is_cyclic_iam_graph(&graph));
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST KRUSKAL_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, 40, 10);
+
+    // vertex without edges remains its own set
+    int const lonely = 40;
+    insert_vertex_iam_graph(&graph, &lonely);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s prim = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+    prim_iam_graph(&graph, &prim, 0);
+
+    // vertices share a root exactly when Prim reaches them, root's cost is weight of Prim's spanning tree
+    size_t const root = table.previous[0];
+    int weight = 0;
+    for (size_t i = 0; i < graph.vertex_length; ++i) {
+        bool const reached = ((int *)(prim.costs))[i] != INT_MAX;
+        ASSERT_EQ(reached, root == table.previous[i]);
+        weight += reached ? ((int *)(prim.costs))[i] : 0;
+        ASSERT(i == root || 0 == ((int *)(table.costs))[i]);
+    }
+    ASSERT_EQ(weight, ((int *)(table.costs))[root]);
+    ASSERT_EQ(40, table.previous[40]);
+    ASSERT_EQ(0, ((int *)(table.costs))[40]);
+
+    destroy_iam_table(&table);
+    destroy_iam_table(&prim);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST KRUSKAL_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // complete graph of equal weights sorts many equal edges
+    for (int i = 0; i < 100; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+    int const edge = 1;
+    for (size_t i = 0; i < 100; ++i) {
+        for (size_t j = i + 1; j < 100; ++j) {
+            insert_weight_iam_graph(&graph, i, j, &edge);
+        }
+    }
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+
+    size_t const root = table.previous[0];
+    for (size_t i = 0; i < graph.vertex_length; ++i) {
+        ASSERT_EQ(root, table.previous[i]);
+    }
+    ASSERT_EQ(99, ((int *)(table.costs))[root]);
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST FILTER_KRUSKAL_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // many more edges than filter size, so heavier edges get filtered
+    _iam_random_graph(&graph, 200, 30);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s filter = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+    filter_kruskal_iam_graph(&graph, &filter);
+
+    ASSERT(_iam_same_forest(&table, &filter, graph.vertex_length));
+
+    destroy_iam_table(&table);
+    destroy_iam_table(&filter);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST FILTER_KRUSKAL_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // sparse graph keeps several components
+    _iam_random_graph(&graph, 100, 2);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s filter = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+    filter_kruskal_iam_graph(&graph, &filter);
+
+    ASSERT(_iam_same_forest(&table, &filter, graph.vertex_length));
+
+    destroy_iam_table(&table);
+    destroy_iam_table(&filter);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST RADIX_KRUSKAL_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, 200, 30);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s radix = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+    radix_kruskal_iam_graph(&graph, &radix, intkey, NULL);
+
+    ASSERT(_iam_same_forest(&table, &radix, graph.vertex_length));
+
+    destroy_iam_table(&table);
+    destroy_iam_table(&radix);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST RADIX_KRUSKAL_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < TRIANGLE_GRAPH_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    // negative weights must be keyed before positive ones
+    int const weights[] = { -5, 3, -2, };
+    insert_weight_iam_graph(&graph, 0, 1, &weights[0]);
+    insert_weight_iam_graph(&graph, 1, 2, &weights[1]);
+    insert_weight_iam_graph(&graph, 2, 0, &weights[2]);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    radix_kruskal_iam_graph(&graph, &table, intkey, NULL);
+    ASSERT_EQ(-7, ((int *)(table.costs))[table.previous[0]]);
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BORUVKA_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, 200, 30);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+
+    // same forest for single thread, several threads and more threads than vertices
+    size_t const threads[] = { 1, 4, 300, };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(size_t); ++t) {
+        table_s boruvka = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+        boruvka_iam_graph(&graph, &boruvka, threads[t]);
+        ASSERT(_iam_same_forest(&table, &boruvka, graph.vertex_length));
+
+        destroy_iam_table(&boruvka);
+    }
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BORUVKA_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // sparse graph with several components and lonely vertices
+    _iam_random_graph(&graph, 100, 2);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s boruvka = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_iam_graph(&graph, &table);
+    boruvka_iam_graph(&graph, &boruvka, 3);
+
+    ASSERT(_iam_same_forest(&table, &boruvka, graph.vertex_length));
+
+    destroy_iam_table(&table);
+    destroy_iam_table(&boruvka);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BORUVKA_03(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // equal weights in a square must not join a cycle
+    for (int i = 0; i < SQUARE_GRAPH_SIZE; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    int const edge = 1;
+    insert_weight_iam_graph(&graph, 0, 1, &edge);
+    insert_weight_iam_graph(&graph, 1, 2, &edge);
+    insert_weight_iam_graph(&graph, 2, 3, &edge);
+    insert_weight_iam_graph(&graph, 3, 0, &edge);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    boruvka_iam_graph(&graph, &table, 2);
+    ASSERT_EQ(SQUARE_GRAPH_SIZE - 1, ((int *)(table.costs))[table.previous[0]]);
+
+    destroy_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+/// @brief Checks if all pairs table of integer costs matches Dijkstra's algorithm from every vertex.
+bool _iam_all_pairs_dijkstra(iam_graph_s const * const graph, table_s const * const all) {
+    size_t const n = graph->vertex_length;
+    int zero = 0, inf = INT_MAX;
+
+    bool same = true;
+    for (size_t i = 0; i < n && same; ++i) {
+        table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+        dijkstra_iam_graph(graph, &table, i, IAM_SPECIAL);
+
+        for (size_t j = 0; j < n && same; ++j) {
+            int const cost = ((int *)(all->costs))[i * n + j];
+            same = ((int *)(table.costs))[j] == cost;
+
+            // previous vertex of path must be one edge short of its cost
+            size_t const previous = all->previous[i * n + j];
+            if (same && i != j && INT_MAX != cost) {
+                int weight = 0;
+                get_weight_iam_graph(graph, previous, j, &weight);
+                same = ((int *)(all->costs))[i * n + previous] + weight == cost;
+            } else if (same) {
+                same = IAM_SPECIAL == previous;
+            }
+        }
+
+        destroy_iam_table(&table);
+    }
+
+    return same;
+}
+
+/// @brief Sums integer costs through a function that isn't 'intsum'.
+void * _iam_sum(void * const sum, void const * const addent, void * arg) {
+    return intsum(sum, addent, arg);
+}
+
+TEST FLOYD_WARSHALL_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    // vertices span several tiles with last one partially filled
+    _iam_random_graph(&graph, IAM_GRAPH_TILE * 2 + 7, 5);
+
+    int zero = 0, inf = INT_MAX;
+    size_t const threads[] = { 1, 2, 8, };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(size_t); ++t) {
+        table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+        floyd_warshall_iam_graph(&graph, &table, threads[t]);
+        ASSERT(_iam_all_pairs_dijkstra(&graph, &table));
+
+        destroy_all_iam_table(&table);
+    }
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST FLOYD_WARSHALL_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, IAM_GRAPH_TILE + 3, 5);
+
+    // unknown sum function relaxes costs through function pointers
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, _iam_sum, NULL, intdst, NULL, &zero, &inf);
+
+    floyd_warshall_iam_graph(&graph, &table, 3);
+    ASSERT(_iam_all_pairs_dijkstra(&graph, &table));
+
+    destroy_all_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST FLOYD_WARSHALL_03(void) {
+    double none = 0.0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(double), doublecmp, NULL, &none);
+
+    for (int i = 0; i < SQUARE_GRAPH_SIZE + 1; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    // path around the square is cheaper than its diagonal, last vertex is unreachable
+    double const side = 0.5, diagonal = 1.5;
+    insert_weight_iam_graph(&graph, 0, 1, &side);
+    insert_weight_iam_graph(&graph, 1, 2, &side);
+    insert_weight_iam_graph(&graph, 2, 3, &side);
+    insert_weight_iam_graph(&graph, 3, 0, &side);
+    insert_weight_iam_graph(&graph, 0, 2, &diagonal);
+
+    double zero = 0.0, inf = DBL_MAX;
+    table_s table = compose_table(sizeof(double), doublecmp, NULL, doublecpy, NULL, doublesum, NULL, doubledst, NULL, &zero, &inf);
+
+    floyd_warshall_iam_graph(&graph, &table, 2);
+
+    double const * costs = (double *)(table.costs);
+    size_t const n = graph.vertex_length;
+    ASSERT_EQ(1.0, costs[0 * n + 2]);
+    ASSERT_EQ(1.0, costs[1 * n + 3]);
+    ASSERT_EQ(0.5, costs[3 * n + 0]);
+    ASSERT_EQ(DBL_MAX, costs[0 * n + 4]);
+    ASSERT_EQ(IAM_SPECIAL, table.previous[0 * n + 4]);
+    ASSERT_EQ(0.0, costs[4 * n + 4]);
+
+    destroy_all_iam_table(&table);
+    destroy_iam_graph(&graph, intdst, NULL, doubledst, NULL);
+
+    PASS();
+}
+
+TEST BIDIRECTIONAL_BFS_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, 150, 3);
+
+    int zero = 0, inf = INT_MAX;
+    for (size_t end = 0; end < graph.vertex_length; end += 7) {
+        table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+        table_s search = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+        bidirectional_bfs_iam_graph(&graph, &table, 3, end);
+        bfs_iam_graph(&graph, &search, 3, IAM_SPECIAL);
+
+        // path has as many edges as breadth first search's and each of its steps is an edge
+        bool const reached = 3 == end || IAM_SPECIAL != search.previous[end];
+        ASSERT_EQ(reached, 3 == end || IAM_SPECIAL != table.previous[end]);
+        if (reached) {
+            ASSERT_EQ(_iam_hops(&search, end), _iam_hops(&table, end));
+            for (size_t v = end; 3 != v; v = table.previous[v]) {
+                ASSERT(contains_weight_iam_graph(&graph, v, table.previous[v]));
+            }
+
+            size_t count = 0;
+            ASSERT(each_path_iam_list(&table, end, _iam_count, &count));
+            ASSERT_EQ(_iam_hops(&search, end) + 1, count);
+        }
+
+        destroy_iam_table(&table);
+        destroy_iam_table(&search);
+    }
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BIDIRECTIONAL_DIJKSTRA_01(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    _iam_random_graph(&graph, 150, 3);
+
+    int zero = 0, inf = INT_MAX;
+    for (size_t end = 0; end < graph.vertex_length; end += 7) {
+        table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+        table_s search = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+        bidirectional_dijkstra_iam_graph(&graph, &table, 3, end);
+        dijkstra_iam_graph(&graph, &search, 3, IAM_SPECIAL);
+
+        // end's cost is shortest path's and each step's cost adds its edge to previous one
+        ASSERT_EQ(((int *)(search.costs))[end], ((int *)(table.costs))[end]);
+        for (size_t v = end; 3 != v && INT_MAX != ((int *)(table.costs))[end]; v = table.previous[v]) {
+            int weight = 0;
+            get_weight_iam_graph(&graph, v, table.previous[v], &weight);
+            ASSERT_EQ(((int *)(table.costs))[table.previous[v]] + weight, ((int *)(table.costs))[v]);
+        }
+
+        destroy_iam_table(&table);
+        destroy_iam_table(&search);
+    }
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BIDIRECTIONAL_DIJKSTRA_02(void) {
+    int none = 0;
+    iam_graph_s graph = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < SQUARE_GRAPH_SIZE + 1; ++i) {
+        insert_vertex_iam_graph(&graph, &i);
+    }
+
+    // cheap path around the square instead of its expensive diagonal, last vertex is unreachable
+    int const side = 1, diagonal = 5;
+    insert_weight_iam_graph(&graph, 0, 1, &side);
+    insert_weight_iam_graph(&graph, 1, 2, &side);
+    insert_weight_iam_graph(&graph, 2, 3, &side);
+    insert_weight_iam_graph(&graph, 0, 3, &diagonal);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    bidirectional_dijkstra_iam_graph(&graph, &table, 0, 3);
+    ASSERT_EQ(3, ((int *)(table.costs))[3]);
+    ASSERT_EQ(2, table.previous[3]);
+    ASSERT_EQ(1, table.previous[2]);
+    ASSERT_EQ(0, table.previous[1]);
+    destroy_iam_table(&table);
+
+    table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    bidirectional_dijkstra_iam_graph(&graph, &table, 0, SQUARE_GRAPH_SIZE);
+    ASSERT_EQ(INT_MAX, ((int *)(table.costs))[SQUARE_GRAPH_SIZE]);
+    ASSERT_EQ(IAM_SPECIAL, table.previous[SQUARE_GRAPH_SIZE]);
+    destroy_iam_table(&table);
+
+    table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    bidirectional_dijkstra_iam_graph(&graph, &table, 2, 2);
+    ASSERT_EQ(0, ((int *)(table.costs))[2]);
+    ASSERT_EQ(IAM_SPECIAL, table.previous[2]);
+    destroy_iam_table(&table);
+
+    destroy_iam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (iam_graph_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -1518,9 +2476,18 @@ SUITE (iam_graph_test) {
     RUN_TEST(GET_VERTEX_05); RUN_TEST(GET_VERTEX_06);
     RUN_TEST(INSERT_EDGE_01); RUN_TEST(INSERT_EDGE_02); RUN_TEST(INSERT_EDGE_03);
     RUN_TEST(REMOVE_EDGE_01); RUN_TEST(REMOVE_EDGE_02); RUN_TEST(REMOVE_EDGE_03); RUN_TEST(REMOVE_EDGE_04);
-    RUN_TEST(REMOVE_EDGE_05); RUN_TEST(REMOVE_EDGE_06);
+    RUN_TEST(REMOVE_EDGE_05); RUN_TEST(REMOVE_EDGE_06); RUN_TEST(REMOVE_EDGE_07);
     RUN_TEST(CONTAINS_EDGE_01); RUN_TEST(CONTAINS_EDGE_02); RUN_TEST(CONTAINS_EDGE_03); RUN_TEST(CONTAINS_EDGE_04);
     RUN_TEST(CONTAINS_EDGE_05); RUN_TEST(CONTAINS_EDGE_06); RUN_TEST(CONTAINS_EDGE_07); RUN_TEST(CONTAINS_EDGE_08);
     RUN_TEST(CONTAINS_EDGE_09);
     RUN_TEST(DIJKSTRA_01); RUN_TEST(DIJKSTRA_02); RUN_TEST(DIJKSTRA_03);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(DIJKSTRA_04); RUN_TEST(A_STAR_01);
+    RUN_TEST(WORKSPACE_01); RUN_TEST(WORKSPACE_02);
+    RUN_TEST(PARALLEL_BFS_01); RUN_TEST(PARALLEL_BFS_02); RUN_TEST(PARALLEL_BFS_03);
+    RUN_TEST(IS_CYCLIC_01); RUN_TEST(IS_CYCLIC_02); RUN_TEST(KRUSKAL_01); RUN_TEST(KRUSKAL_02);
+    RUN_TEST(FILTER_KRUSKAL_01); RUN_TEST(FILTER_KRUSKAL_02); RUN_TEST(RADIX_KRUSKAL_01); RUN_TEST(RADIX_KRUSKAL_02);
+    RUN_TEST(BORUVKA_01); RUN_TEST(BORUVKA_02); RUN_TEST(BORUVKA_03);
+    RUN_TEST(FLOYD_WARSHALL_01); RUN_TEST(FLOYD_WARSHALL_02); RUN_TEST(FLOYD_WARSHALL_03);
+    RUN_TEST(BIDIRECTIONAL_BFS_01); RUN_TEST(BIDIRECTIONAL_DIJKSTRA_01); RUN_TEST(BIDIRECTIONAL_DIJKSTRA_02);
 }
@@ -0,0 +1,653 @@
+#include <limits.h>
+
+#include <graph/icsr_graph.h>
+#include <graph/iam_graph.h>
+#include <graph/table.h>
+
+#include <suite.h>
+
+#define DIJKSTRA_01_SIZE 7
+#define DIJKSTRA_02_SIZE 8
+#define DIJKSTRA_03_SIZE 9
+#define PARITY_SIZE 200
+
+/// @brief Inserts first Dijkstra test graph into structure.
+/// @param graph Structure to insert into.
+void _icsr_dijkstra_01(icsr_graph_s * const graph) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=CmIQ29cUGiE
+    for (int i = 0; i < DIJKSTRA_01_SIZE; ++i) {
+        insert_vertex_icsr_graph(graph, &i);
+    }
+
+    int const edges[] = { 2, 5, 3, 7, 1, 4, 3, 4, 1, 1, 3, };
+    insert_weight_icsr_graph(graph, 0, 1, edges +  0);
+    insert_weight_icsr_graph(graph, 0, 3, edges +  1);
+    insert_weight_icsr_graph(graph, 0, 5, edges +  2);
+
+    insert_weight_icsr_graph(graph, 1, 2, edges +  3);
+    insert_weight_icsr_graph(graph, 1, 4, edges +  4);
+    insert_weight_icsr_graph(graph, 1, 5, edges +  5);
+
+    insert_weight_icsr_graph(graph, 2, 4, edges +  6);
+    insert_weight_icsr_graph(graph, 2, 6, edges +  7);
+
+    insert_weight_icsr_graph(graph, 3, 4, edges +  8);
+    insert_weight_icsr_graph(graph, 3, 6, edges +  9);
+
+    insert_weight_icsr_graph(graph, 4, 6, edges + 10);
+}
+
+/// @brief Heuristic that never overestimates, making A* behave like Dijkstra.
+void _icsr_zero_heuristic(void * const result, void const * const a, void const * const b, void * arg) {
+    (void)(a); (void)(b); (void)(arg);
+    *(int *)(result) = 0;
+}
+
+TEST CREATE_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    ASSERT_NEQ(NULL, graph.allocator);
+    ASSERT_EQ(0, graph.capacity);
+    ASSERT_EQ(0, graph.edge_capacity);
+    ASSERT_NEQ(0, graph.weight_size);
+    ASSERT_NEQ(0, graph.vertex_size);
+    ASSERT_EQ(NULL, graph.weights);
+    ASSERT_EQ(NULL, graph.vertices);
+    ASSERT_EQ(NULL, graph.offsets);
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+    clear_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    ASSERT(is_empty_icsr_graph(&graph));
+    ASSERT_EQ(0, graph.edge_length);
+    ASSERT(is_compact_icsr_graph(&graph));
+
+    _icsr_dijkstra_01(&graph);
+    ASSERT_EQ(11, graph.edge_length);
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    icsr_graph_s replica = copy_icsr_graph(&graph, intcpy, NULL, intcpy, NULL);
+    ASSERT(is_compact_icsr_graph(&replica));
+    ASSERT_EQ(graph.vertex_length, replica.vertex_length);
+    ASSERT_EQ(graph.edge_length, replica.edge_length);
+
+    for (size_t i = 0; i < DIJKSTRA_01_SIZE; ++i) {
+        ASSERT_EQ(degree_icsr_graph(&graph, i), degree_icsr_graph(&replica, i));
+        for (size_t j = i + 1; j < DIJKSTRA_01_SIZE; ++j) {
+            ASSERT_EQ(contains_weight_icsr_graph(&graph, i, j), contains_weight_icsr_graph(&replica, i, j));
+        }
+    }
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+    destroy_icsr_graph(&replica, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST INSERT_EDGE_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < ICSR_GRAPH_CHUNK + 1; ++i) {
+        insert_vertex_icsr_graph(&graph, &i);
+    }
+
+    for (size_t i = 0; i < ICSR_GRAPH_CHUNK + 1; ++i) {
+        for (size_t j = i + 1; j < ICSR_GRAPH_CHUNK + 1; ++j) {
+            int const weight = (int)(i + j);
+            insert_weight_icsr_graph(&graph, i, j, &weight);
+        }
+    }
+    ASSERT_FALSE(is_compact_icsr_graph(&graph));
+
+    compact_icsr_graph(&graph);
+    ASSERT(is_compact_icsr_graph(&graph));
+
+    for (size_t i = 0; i < ICSR_GRAPH_CHUNK + 1; ++i) {
+        ASSERT_EQ(ICSR_GRAPH_CHUNK, degree_icsr_graph(&graph, i));
+        for (size_t j = i + 1; j < ICSR_GRAPH_CHUNK + 1; ++j) {
+            int weight = -1;
+            get_weight_icsr_graph(&graph, j, i, &weight);
+            ASSERT_EQ((int)(i + j), weight);
+        }
+    }
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST CONTAINS_EDGE_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    // edge inserted after compaction is found in buffer
+    int const weight = 42;
+    insert_weight_icsr_graph(&graph, 5, 6, &weight);
+
+    ASSERT(contains_weight_icsr_graph(&graph, 0, 1));
+    ASSERT(contains_weight_icsr_graph(&graph, 1, 0));
+    ASSERT(contains_weight_icsr_graph(&graph, 6, 5));
+    ASSERT_FALSE(contains_weight_icsr_graph(&graph, 0, 2));
+    ASSERT_FALSE(contains_weight_icsr_graph(&graph, 0, 6));
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REMOVE_EDGE_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int weight = -1;
+    remove_weight_icsr_graph(&graph, 4, 1, &weight);
+    ASSERT_EQ(1, weight);
+    ASSERT_EQ(10, graph.edge_length);
+    ASSERT_EQ(3, degree_icsr_graph(&graph, 1));
+    ASSERT_FALSE(contains_weight_icsr_graph(&graph, 1, 4));
+    ASSERT_FALSE(is_compact_icsr_graph(&graph));
+
+    get_weight_icsr_graph(&graph, 4, 6, &weight);
+    ASSERT_EQ(3, weight);
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REMOVE_VERTEX_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+
+    // vertex 1 is removed with its 4 edges and last vertex 6 takes its index
+    int vertex = -1;
+    ASSERT_EQ(DIJKSTRA_01_SIZE - 1, remove_vertex_icsr_graph(&graph, 1, &vertex, intdst, NULL));
+    ASSERT_EQ(1, vertex);
+    ASSERT_EQ(7, graph.edge_length);
+
+    get_vertex_icsr_graph(&graph, 1, &vertex);
+    ASSERT_EQ(6, vertex);
+    ASSERT_EQ(3, degree_icsr_graph(&graph, 1));
+    ASSERT_EQ(1, degree_icsr_graph(&graph, 5));
+
+    int weight = -1;
+    get_weight_icsr_graph(&graph, 1, 3, &weight);
+    ASSERT_EQ(1, weight);
+    ASSERT_FALSE(contains_weight_icsr_graph(&graph, 0, 1));
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST EACH_NEIGHBOR_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int increment = DIJKSTRA_01_SIZE;
+    each_neighbor_icsr_graph(&graph, 0, intincrement, &increment);
+
+    int const vertices[DIJKSTRA_01_SIZE] = { 0, 8, 2, 10, 4, 12, 6, };
+    for (size_t i = 0; i < DIJKSTRA_01_SIZE; ++i) {
+        int vertex = -1;
+        get_vertex_icsr_graph(&graph, i, &vertex);
+        ASSERT_EQ(vertices[i], vertex);
+    }
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BFS_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    bfs_icsr_graph(&graph, &table, 0, ICSR_SPECIAL);
+
+    int const costs[DIJKSTRA_01_SIZE] = { 0, 2, 7, 5, 1, 3, 1, };
+    ASSERT_MEM_EQ(costs, table.costs, DIJKSTRA_01_SIZE * sizeof(int));
+
+    size_t const previous[DIJKSTRA_01_SIZE] = { ICSR_SPECIAL, 0, 1, 0, 1, 0, 3, };
+    ASSERT_MEM_EQ(previous, table.previous, DIJKSTRA_01_SIZE * sizeof(size_t));
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DFS_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dfs_icsr_graph(&graph, &table, 0, ICSR_SPECIAL);
+
+    int const costs[DIJKSTRA_01_SIZE] = { 0, 2, 4, 5, 1, 3, 1, };
+    ASSERT_MEM_EQ(costs, table.costs, DIJKSTRA_01_SIZE * sizeof(int));
+
+    size_t const previous[DIJKSTRA_01_SIZE] = { ICSR_SPECIAL, 0, 6, 0, 3, 0, 3, };
+    ASSERT_MEM_EQ(previous, table.previous, DIJKSTRA_01_SIZE * sizeof(size_t));
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dijkstra_icsr_graph(&graph, &table, 0, ICSR_SPECIAL);
+
+    int const costs[DIJKSTRA_01_SIZE] = { 0, 2, 6, 4, 3, 3, 5 };
+    ASSERT_MEM_EQ(costs, table.costs, DIJKSTRA_01_SIZE * sizeof(int));
+
+    size_t const previous[DIJKSTRA_01_SIZE] = { ICSR_SPECIAL, 0, 4, 4, 1, 0, 3 };
+    ASSERT_MEM_EQ(previous, table.previous, DIJKSTRA_01_SIZE * sizeof(size_t));
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_02(void) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=5GT5hYzjNoo
+
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < DIJKSTRA_02_SIZE; ++i) {
+        insert_vertex_icsr_graph(&graph, &i);
+    }
+
+    int const edges[] = { 8, 2, 5, 2, 13, 2, 5, 1, 6, 3, 1, 2, 3, 6 };
+    insert_weight_icsr_graph(&graph, 0, 1, edges +  0);
+    insert_weight_icsr_graph(&graph, 0, 2, edges +  1);
+    insert_weight_icsr_graph(&graph, 0, 3, edges +  2);
+
+    insert_weight_icsr_graph(&graph, 1, 3, edges +  3);
+    insert_weight_icsr_graph(&graph, 1, 5, edges +  4);
+
+    insert_weight_icsr_graph(&graph, 2, 3, edges +  5);
+    insert_weight_icsr_graph(&graph, 2, 4, edges +  6);
+
+    insert_weight_icsr_graph(&graph, 3, 4, edges +  7);
+    insert_weight_icsr_graph(&graph, 3, 5, edges +  8);
+    insert_weight_icsr_graph(&graph, 3, 6, edges +  9);
+
+    insert_weight_icsr_graph(&graph, 4, 6, edges + 10);
+
+    insert_weight_icsr_graph(&graph, 5, 6, edges + 11);
+    insert_weight_icsr_graph(&graph, 5, 7, edges + 12);
+
+    insert_weight_icsr_graph(&graph, 6, 7, edges + 13);
+
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dijkstra_icsr_graph(&graph, &table, 0, ICSR_SPECIAL);
+
+    int const costs[DIJKSTRA_02_SIZE] = { 0, 6, 2, 4, 5, 8, 6, 11, };
+    ASSERT_MEM_EQ(costs, table.costs, DIJKSTRA_02_SIZE * sizeof(int));
+
+    size_t const previous[DIJKSTRA_02_SIZE] = { ICSR_SPECIAL, 3, 0, 2, 3, 6, 4, 5, };
+    ASSERT_MEM_EQ(previous, table.previous, DIJKSTRA_02_SIZE * sizeof(size_t));
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_03(void) {
+    // GRAPH SOURCE: https://www.youtube.com/watch?v=5GT5hYzjNoo
+
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        insert_vertex_icsr_graph(&graph, &i);
+    }
+
+    int const edges[] = { 4, 8, 8, 11, 7, 4, 2, 9, 14, 10, 2, 1, 6, 7 };
+    insert_weight_icsr_graph(&graph, 0, 1, edges +  0);
+    insert_weight_icsr_graph(&graph, 0, 7, edges +  1);
+
+    insert_weight_icsr_graph(&graph, 1, 2, edges +  2);
+    insert_weight_icsr_graph(&graph, 1, 7, edges +  3);
+
+    insert_weight_icsr_graph(&graph, 2, 3, edges +  4);
+    insert_weight_icsr_graph(&graph, 2, 5, edges +  5);
+    insert_weight_icsr_graph(&graph, 2, 8, edges +  6);
+
+    insert_weight_icsr_graph(&graph, 3, 4, edges +  7);
+    insert_weight_icsr_graph(&graph, 3, 5, edges +  8);
+
+    insert_weight_icsr_graph(&graph, 4, 5, edges +  9);
+
+    insert_weight_icsr_graph(&graph, 5, 6, edges + 10);
+
+    insert_weight_icsr_graph(&graph, 6, 7, edges + 11);
+    insert_weight_icsr_graph(&graph, 6, 8, edges + 12);
+
+    insert_weight_icsr_graph(&graph, 7, 8, edges + 13);
+
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dijkstra_icsr_graph(&graph, &table, 0, ICSR_SPECIAL);
+
+    int const costs[DIJKSTRA_03_SIZE] = { 0, 4, 12, 19, 21, 11, 9, 8, 14, };
+    ASSERT_MEM_EQ(costs, table.costs, DIJKSTRA_03_SIZE * sizeof(int));
+
+    size_t const previous[DIJKSTRA_03_SIZE] = { ICSR_SPECIAL, 0, 1, 2, 5, 6, 7, 0, 2, };
+    ASSERT_MEM_EQ(previous, table.previous, DIJKSTRA_03_SIZE * sizeof(size_t));
+
+    destroy_icsr_table(&table);
+
+    // same graph's minimum spanning tree weighs 37
+    table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    prim_icsr_graph(&graph, &table, 0);
+
+    int total = 0;
+    for (size_t i = 0; i < DIJKSTRA_03_SIZE; ++i) {
+        total += ((int *)(table.costs))[i];
+    }
+    ASSERT_EQ(37, total);
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_04(void) {
+    // sparse graph produces same table as matrix graph with same edges
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+    int none = 0;
+    iam_graph_s matrix = create_iam_graph(sizeof(int), sizeof(int), intcmp, NULL, &none);
+
+    for (int i = 0; i < PARITY_SIZE; ++i) {
+        insert_vertex_icsr_graph(&graph, &i);
+        insert_vertex_iam_graph(&matrix, &i);
+    }
+
+    unsigned state = 42;
+    for (size_t i = 0; i < 4 * PARITY_SIZE; ++i) {
+        state = state * 1103515245u + 12345u;
+        size_t const one = (state >> 8) % PARITY_SIZE;
+        state = state * 1103515245u + 12345u;
+        size_t const two = (state >> 8) % PARITY_SIZE;
+
+        if (one == two || contains_weight_iam_graph(&matrix, one, two)) {
+            continue;
+        }
+
+        int const weight = (int)((state >> 16) % 20) + 1;
+        insert_weight_icsr_graph(&graph, one, two, &weight);
+        insert_weight_iam_graph(&matrix, one, two, &weight);
+    }
+
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s sparse = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    table_s dense = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dijkstra_icsr_graph(&graph, &sparse, 0, ICSR_SPECIAL);
+    dijkstra_iam_graph(&matrix, &dense, 0, IAM_SPECIAL);
+    ASSERT_MEM_EQ(dense.costs, sparse.costs, PARITY_SIZE * sizeof(int));
+
+    destroy_icsr_table(&sparse);
+    destroy_iam_table(&dense);
+
+    sparse = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    dense = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    bfs_icsr_graph(&graph, &sparse, 0, ICSR_SPECIAL);
+    bfs_iam_graph(&matrix, &dense, 0, IAM_SPECIAL);
+    ASSERT_MEM_EQ(dense.previous, sparse.previous, PARITY_SIZE * sizeof(size_t));
+
+    destroy_icsr_table(&sparse);
+    destroy_iam_table(&dense);
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+    destroy_iam_graph(&matrix, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST A_STAR_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    a_star_icsr_graph(&graph, &table, 0, 6, _icsr_zero_heuristic, NULL);
+
+    ASSERT_EQ(5, ((int *)(table.costs))[6]);
+    ASSERT_EQ(3, table.previous[6]);
+    ASSERT_EQ(4, table.previous[3]);
+    ASSERT_EQ(1, table.previous[4]);
+    ASSERT_EQ(0, table.previous[1]);
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST KRUSKAL_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+
+    // vertex without edges remains its own set
+    int const lonely = DIJKSTRA_01_SIZE;
+    insert_vertex_icsr_graph(&graph, &lonely);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    kruskal_icsr_graph(&graph, &table);
+
+    // every connected vertex points straight at root, whose cost is spanning tree's weight
+    size_t const root = table.previous[0];
+    for (size_t i = 0; i < DIJKSTRA_01_SIZE; ++i) {
+        ASSERT_EQ(root, table.previous[i]);
+        ASSERT_EQ(i == root ? 11 : 0, ((int *)(table.costs))[i]);
+    }
+    ASSERT_EQ(DIJKSTRA_01_SIZE, table.previous[DIJKSTRA_01_SIZE]);
+    ASSERT_EQ(0, ((int *)(table.costs))[DIJKSTRA_01_SIZE]);
+
+    destroy_icsr_table(&table);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST RESERVE_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    reserve_icsr_graph(&graph, 100, 200);
+    size_t const capacity = graph.capacity, edge_capacity = graph.edge_capacity;
+    ASSERT(capacity >= 100);
+    ASSERT(edge_capacity >= 200);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_vertex_icsr_graph(&graph, &i);
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        int const weight = 1;
+        insert_weight_icsr_graph(&graph, i, (i + 1) % 100, &weight);
+        insert_weight_icsr_graph(&graph, i, (i + 2) % 100, &weight);
+    }
+    ASSERT_EQ(capacity, graph.capacity);
+    ASSERT_EQ(edge_capacity, graph.edge_capacity);
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+
+    shrink_to_fit_icsr_graph(&graph);
+    ASSERT_EQ(graph.vertex_length, graph.capacity);
+    ASSERT_EQ(graph.edge_length, graph.edge_capacity);
+
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST WORKSPACE_01(void) {
+    // reused workspace produces same tables as new ones for many point to point queries
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < PARITY_SIZE; ++i) {
+        insert_vertex_icsr_graph(&graph, &i);
+    }
+
+    unsigned state = 7;
+    for (size_t i = 0; i < 2 * PARITY_SIZE; ++i) {
+        state = state * 1103515245u + 12345u;
+        size_t const one = (state >> 8) % PARITY_SIZE;
+        state = state * 1103515245u + 12345u;
+        size_t const two = (state >> 8) % PARITY_SIZE;
+
+        if (one == two || contains_weight_icsr_graph(&graph, one, two)) {
+            continue;
+        }
+
+        int const weight = (int)((state >> 16) % 20) + 1;
+        insert_weight_icsr_graph(&graph, one, two, &weight);
+    }
+
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    graph_workspace_s workspace = create_graph_workspace(graph.vertex_length, &table);
+
+    for (size_t q = 0; q < PARITY_SIZE; ++q) {
+        state = state * 1103515245u + 12345u;
+        size_t const start = (state >> 8) % PARITY_SIZE;
+        state = state * 1103515245u + 12345u;
+        size_t const end = (q % 4) ? (state >> 8) % PARITY_SIZE : ICSR_SPECIAL;
+
+        dijkstra_workspace_icsr_graph(&graph, &workspace, start, end);
+        dijkstra_icsr_graph(&graph, &table, start, end);
+
+        ASSERT_MEM_EQ(table.costs, workspace.table.costs, PARITY_SIZE * sizeof(int));
+        ASSERT_MEM_EQ(table.previous, workspace.table.previous, PARITY_SIZE * sizeof(size_t));
+        destroy_icsr_table(&table);
+
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+        bfs_workspace_icsr_graph(&graph, &workspace, start, end);
+        bfs_icsr_graph(&graph, &table, start, end);
+
+        ASSERT_MEM_EQ(table.previous, workspace.table.previous, PARITY_SIZE * sizeof(size_t));
+        destroy_icsr_table(&table);
+
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    }
+
+    destroy_graph_workspace(&workspace);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST WORKSPACE_02(void) {
+    icsr_graph_s graph = create_icsr_graph(sizeof(int), sizeof(int));
+
+    _icsr_dijkstra_01(&graph);
+    compact_icsr_graph(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    graph_workspace_s workspace = create_graph_workspace(graph.vertex_length, &table);
+
+    // A* and Prim results don't depend on what earlier searches left in workspace
+    for (size_t i = 0; i < 3; ++i) {
+        a_star_workspace_icsr_graph(&graph, &workspace, 0, 6, _icsr_zero_heuristic, NULL);
+        ASSERT_EQ(5, ((int *)(workspace.table.costs))[6]);
+        ASSERT_EQ(3, workspace.table.previous[6]);
+
+        prim_workspace_icsr_graph(&graph, &workspace, 0);
+        prim_icsr_graph(&graph, &table, 0);
+        ASSERT_MEM_EQ(table.costs, workspace.table.costs, DIJKSTRA_01_SIZE * sizeof(int));
+        ASSERT_MEM_EQ(table.previous, workspace.table.previous, DIJKSTRA_01_SIZE * sizeof(size_t));
+
+        destroy_icsr_table(&table);
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    }
+
+    destroy_graph_workspace(&workspace);
+    destroy_icsr_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+SUITE (icsr_graph_test) {
+    RUN_TEST(CREATE_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01);
+    RUN_TEST(INSERT_EDGE_01); RUN_TEST(CONTAINS_EDGE_01); RUN_TEST(REMOVE_EDGE_01); RUN_TEST(REMOVE_VERTEX_01);
+    RUN_TEST(EACH_NEIGHBOR_01);
+    RUN_TEST(BFS_01); RUN_TEST(DFS_01);
+    RUN_TEST(DIJKSTRA_01); RUN_TEST(DIJKSTRA_02); RUN_TEST(DIJKSTRA_03); RUN_TEST(DIJKSTRA_04);
+    RUN_TEST(A_STAR_01); RUN_TEST(KRUSKAL_01);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(WORKSPACE_01); RUN_TEST(WORKSPACE_02);
+}
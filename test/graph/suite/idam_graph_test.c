@@ -0,0 +1,519 @@
+#include <limits.h>
+
+#include <graph/idam_graph.h>
+#include <graph/table.h>
+
+#include <suite.h>
+
+#define DIRECTED_01_SIZE 7
+#define WIDE_SIZE 150
+#define PARITY_SIZE 200
+
+/// @brief Inserts first directed test graph into structure, every edge goes from smaller to bigger index.
+/// @param graph Structure to insert into.
+void _idam_directed_01(idam_graph_s * const graph) {
+    for (int i = 0; i < DIRECTED_01_SIZE; ++i) {
+        insert_vertex_idam_graph(graph, &i);
+    }
+
+    int const edges[] = { 2, 5, 3, 7, 1, 4, 3, 4, 1, 1, 3, };
+    insert_weight_idam_graph(graph, 0, 1, edges +  0);
+    insert_weight_idam_graph(graph, 0, 3, edges +  1);
+    insert_weight_idam_graph(graph, 0, 5, edges +  2);
+
+    insert_weight_idam_graph(graph, 1, 2, edges +  3);
+    insert_weight_idam_graph(graph, 1, 4, edges +  4);
+    insert_weight_idam_graph(graph, 1, 5, edges +  5);
+
+    insert_weight_idam_graph(graph, 2, 4, edges +  6);
+    insert_weight_idam_graph(graph, 2, 6, edges +  7);
+
+    insert_weight_idam_graph(graph, 3, 4, edges +  8);
+    insert_weight_idam_graph(graph, 3, 6, edges +  9);
+
+    insert_weight_idam_graph(graph, 4, 6, edges + 10);
+}
+
+/// @brief Sums vertices into integer argument.
+bool _idam_sum(void * const element, void * const sum) {
+    *(int *)(sum) += *(int *)(element);
+    return true;
+}
+
+TEST CREATE_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    ASSERT_NEQ(NULL, graph.allocator);
+    ASSERT_EQ(0, graph.capacity);
+    ASSERT_NEQ(0, graph.weight_size);
+    ASSERT_NEQ(0, graph.vertex_size);
+    ASSERT_EQ(NULL, graph.weights);
+    ASSERT_EQ(NULL, graph.vertices);
+    ASSERT_EQ(NULL, graph.bits);
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+    clear_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    ASSERT(is_empty_idam_graph(&graph));
+    ASSERT_EQ(0, graph.edge_length);
+
+    _idam_directed_01(&graph);
+    ASSERT_EQ(11, graph.edge_length);
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    idam_graph_s replica = copy_idam_graph(&graph, intcpy, NULL, intcpy, NULL);
+    ASSERT_EQ(graph.vertex_length, replica.vertex_length);
+    ASSERT_EQ(graph.edge_length, replica.edge_length);
+
+    for (size_t i = 0; i < DIRECTED_01_SIZE; ++i) {
+        ASSERT_EQ(in_degree_idam_graph(&graph, i), in_degree_idam_graph(&replica, i));
+        ASSERT_EQ(out_degree_idam_graph(&graph, i), out_degree_idam_graph(&replica, i));
+        for (size_t j = 0; j < DIRECTED_01_SIZE; ++j) {
+            if (i == j) { continue; }
+            ASSERT_EQ(contains_weight_idam_graph(&graph, i, j), contains_weight_idam_graph(&replica, i, j));
+        }
+    }
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+    destroy_idam_graph(&replica, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST INSERT_EDGE_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    // edges are directed, so reverse edge is separate and has its own weight
+    ASSERT(contains_weight_idam_graph(&graph, 0, 1));
+    ASSERT_FALSE(contains_weight_idam_graph(&graph, 1, 0));
+
+    int weight = 9;
+    insert_weight_idam_graph(&graph, 1, 0, &weight);
+    ASSERT_EQ(12, graph.edge_length);
+
+    get_weight_idam_graph(&graph, 0, 1, &weight);
+    ASSERT_EQ(2, weight);
+    get_weight_idam_graph(&graph, 1, 0, &weight);
+    ASSERT_EQ(9, weight);
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REMOVE_EDGE_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    int weight = -1;
+    remove_weight_idam_graph(&graph, 3, 6, &weight);
+    ASSERT_EQ(1, weight);
+    ASSERT_EQ(10, graph.edge_length);
+    ASSERT_FALSE(contains_weight_idam_graph(&graph, 3, 6));
+    ASSERT_EQ(1, out_degree_idam_graph(&graph, 3));
+    ASSERT_EQ(2, in_degree_idam_graph(&graph, 6));
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DEGREE_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    size_t const in[DIRECTED_01_SIZE] = { 0, 1, 1, 1, 3, 2, 3, };
+    size_t const out[DIRECTED_01_SIZE] = { 3, 3, 2, 2, 1, 0, 0, };
+    for (size_t i = 0; i < DIRECTED_01_SIZE; ++i) {
+        ASSERT_EQ(in[i], in_degree_idam_graph(&graph, i));
+        ASSERT_EQ(out[i], out_degree_idam_graph(&graph, i));
+    }
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REMOVE_VERTEX_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    // vertex 1 is removed with its 4 edges and last vertex 6 takes its index
+    int vertex = -1;
+    ASSERT_EQ(DIRECTED_01_SIZE - 1, remove_vertex_idam_graph(&graph, 1, &vertex, intdst, NULL));
+    ASSERT_EQ(1, vertex);
+    ASSERT_EQ(7, graph.edge_length);
+
+    get_vertex_idam_graph(&graph, 1, &vertex);
+    ASSERT_EQ(6, vertex);
+    ASSERT_EQ(3, in_degree_idam_graph(&graph, 1));
+    ASSERT_EQ(0, out_degree_idam_graph(&graph, 1));
+    ASSERT_EQ(2, in_degree_idam_graph(&graph, 4));
+    ASSERT_EQ(2, out_degree_idam_graph(&graph, 0));
+
+    int weight = -1;
+    get_weight_idam_graph(&graph, 3, 1, &weight);
+    ASSERT_EQ(1, weight);
+    ASSERT_FALSE(contains_weight_idam_graph(&graph, 0, 1));
+    ASSERT_FALSE(contains_weight_idam_graph(&graph, 1, 3));
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REMOVE_VERTEX_02(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    // last vertex' column lies in a different bitset word than removed vertex' one
+    for (int i = 0; i < WIDE_SIZE; ++i) {
+        insert_vertex_idam_graph(&graph, &i);
+    }
+    for (size_t i = 0; i < WIDE_SIZE - 1; ++i) {
+        int const weight = (int)(i);
+        insert_weight_idam_graph(&graph, i, WIDE_SIZE - 1, &weight);
+        insert_weight_idam_graph(&graph, WIDE_SIZE - 1, i, &weight);
+    }
+
+    int vertex = -1;
+    remove_vertex_idam_graph(&graph, 10, &vertex, intdst, NULL);
+    ASSERT_EQ(10, vertex);
+    ASSERT_EQ(2 * (WIDE_SIZE - 2), graph.edge_length);
+    ASSERT_EQ(WIDE_SIZE - 2, in_degree_idam_graph(&graph, 10));
+    ASSERT_EQ(WIDE_SIZE - 2, out_degree_idam_graph(&graph, 10));
+
+    for (size_t i = 0; i < WIDE_SIZE - 1; ++i) {
+        if (10 == i) { continue; }
+
+        int weight = -1;
+        get_weight_idam_graph(&graph, i, 10, &weight);
+        ASSERT_EQ((int)(i), weight);
+        get_weight_idam_graph(&graph, 10, i, &weight);
+        ASSERT_EQ((int)(i), weight);
+    }
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST EACH_NEIGHBOR_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < WIDE_SIZE; ++i) {
+        insert_vertex_idam_graph(&graph, &i);
+    }
+
+    // neighbors are spread over every word of row, including last partial one
+    int expected = 0;
+    for (int i = 7; i < WIDE_SIZE; i += 7) {
+        int const weight = 1;
+        insert_weight_idam_graph(&graph, 0, (size_t)(i), &weight);
+        expected += i;
+    }
+    int const weight = 1;
+    insert_weight_idam_graph(&graph, 0, WIDE_SIZE - 1, &weight);
+    insert_weight_idam_graph(&graph, 1, 0, &weight);
+    expected += WIDE_SIZE - 1;
+
+    int sum = 0;
+    each_neighbor_idam_graph(&graph, 0, _idam_sum, &sum);
+    ASSERT_EQ(expected, sum);
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST TOPOLOGICAL_SORT_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    size_t order[DIRECTED_01_SIZE] = { 0 };
+    ASSERT(topological_sort_idam_graph(&graph, order));
+
+    size_t const expected[DIRECTED_01_SIZE] = { 0, 1, 3, 2, 5, 4, 6, };
+    ASSERT_MEM_EQ(expected, order, DIRECTED_01_SIZE * sizeof(size_t));
+
+    // edge back to first vertex creates cycle through every vertex
+    int const weight = 1;
+    insert_weight_idam_graph(&graph, 6, 0, &weight);
+    ASSERT_FALSE(topological_sort_idam_graph(&graph, order));
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST STRONGLY_CONNECTED_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < 6; ++i) {
+        insert_vertex_idam_graph(&graph, &i);
+    }
+
+    int const weight = 1;
+    insert_weight_idam_graph(&graph, 0, 1, &weight);
+    insert_weight_idam_graph(&graph, 1, 2, &weight);
+    insert_weight_idam_graph(&graph, 2, 0, &weight);
+    insert_weight_idam_graph(&graph, 2, 3, &weight);
+    insert_weight_idam_graph(&graph, 3, 4, &weight);
+    insert_weight_idam_graph(&graph, 4, 3, &weight);
+
+    // components are numbered in reverse topological order
+    size_t components[6] = { 0 };
+    ASSERT_EQ(3, strongly_connected_idam_graph(&graph, components));
+
+    size_t const expected[6] = { 1, 1, 1, 0, 0, 2, };
+    ASSERT_MEM_EQ(expected, components, 6 * sizeof(size_t));
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST STRONGLY_CONNECTED_02(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    // single long cycle is deeper than recursion would comfortably allow per vertex
+    for (int i = 0; i < PARITY_SIZE; ++i) {
+        insert_vertex_idam_graph(&graph, &i);
+    }
+    for (size_t i = 0; i < PARITY_SIZE; ++i) {
+        int const weight = 1;
+        insert_weight_idam_graph(&graph, i, (i + 1) % PARITY_SIZE, &weight);
+    }
+
+    size_t components[PARITY_SIZE] = { 0 };
+    ASSERT_EQ(1, strongly_connected_idam_graph(&graph, components));
+    for (size_t i = 0; i < PARITY_SIZE; ++i) {
+        ASSERT_EQ(0, components[i]);
+    }
+
+    // removing one edge turns cycle into path of single vertex components
+    int weight = -1;
+    remove_weight_idam_graph(&graph, PARITY_SIZE - 1, 0, &weight);
+    ASSERT_EQ(PARITY_SIZE, strongly_connected_idam_graph(&graph, components));
+    for (size_t i = 0; i < PARITY_SIZE - 1; ++i) {
+        ASSERT(components[i] > components[i + 1]);
+    }
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST BFS_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    bfs_idam_graph(&graph, &table, 0, IDAM_SPECIAL);
+
+    int const costs[DIRECTED_01_SIZE] = { 0, 2, 7, 5, 1, 3, 1, };
+    ASSERT_MEM_EQ(costs, table.costs, DIRECTED_01_SIZE * sizeof(int));
+
+    size_t const previous[DIRECTED_01_SIZE] = { IDAM_SPECIAL, 0, 1, 0, 1, 0, 3, };
+    ASSERT_MEM_EQ(previous, table.previous, DIRECTED_01_SIZE * sizeof(size_t));
+
+    destroy_idam_table(&table);
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    dijkstra_idam_graph(&graph, &table, 0, IDAM_SPECIAL);
+
+    int const costs[DIRECTED_01_SIZE] = { 0, 2, 9, 5, 3, 3, 6, };
+    ASSERT_MEM_EQ(costs, table.costs, DIRECTED_01_SIZE * sizeof(int));
+
+    size_t const previous[DIRECTED_01_SIZE] = { IDAM_SPECIAL, 0, 1, 0, 1, 0, 4, };
+    ASSERT_MEM_EQ(previous, table.previous, DIRECTED_01_SIZE * sizeof(size_t));
+
+    int sum = 0;
+    ASSERT(each_path_idam_graph(&table, 6, _idam_sum, &sum));
+    ASSERT_EQ(0 + 1 + 4 + 6, sum);
+
+    destroy_idam_table(&table);
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DIJKSTRA_02(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+
+    // last vertex has no outgoing edges, so nothing else is reachable from it
+    dijkstra_idam_graph(&graph, &table, 6, IDAM_SPECIAL);
+
+    int const costs[DIRECTED_01_SIZE] = { INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, 0, };
+    ASSERT_MEM_EQ(costs, table.costs, DIRECTED_01_SIZE * sizeof(int));
+
+    int sum = 0;
+    ASSERT_FALSE(each_path_idam_graph(&table, 0, _idam_sum, &sum));
+
+    destroy_idam_table(&table);
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST RESERVE_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    reserve_idam_graph(&graph, 100);
+    size_t const capacity = graph.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_vertex_idam_graph(&graph, &i);
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        int const weight = (int)(i);
+        insert_weight_idam_graph(&graph, i, (i + 1) % 100, &weight);
+        insert_weight_idam_graph(&graph, i, (i + 70) % 100, &weight);
+    }
+    ASSERT_EQ(capacity, graph.capacity);
+
+    // bigger capacity moves rows to new strides while keeping every edge
+    reserve_idam_graph(&graph, 300);
+    ASSERT(graph.capacity >= 300);
+    ASSERT_EQ(200, graph.edge_length);
+    for (size_t i = 0; i < 100; ++i) {
+        int weight = -1;
+        get_weight_idam_graph(&graph, i, (i + 70) % 100, &weight);
+        ASSERT_EQ((int)(i), weight);
+        ASSERT_FALSE(contains_weight_idam_graph(&graph, i, (i + 2) % 100));
+    }
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    _idam_directed_01(&graph);
+
+    shrink_to_fit_idam_graph(&graph);
+    ASSERT_EQ(graph.vertex_length, graph.capacity);
+    ASSERT_EQ(11, graph.edge_length);
+
+    int weight = -1;
+    get_weight_idam_graph(&graph, 4, 6, &weight);
+    ASSERT_EQ(3, weight);
+
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST WORKSPACE_01(void) {
+    // reused workspace produces same tables as new ones for many point to point queries
+    idam_graph_s graph = create_idam_graph(sizeof(int), sizeof(int));
+
+    for (int i = 0; i < PARITY_SIZE; ++i) {
+        insert_vertex_idam_graph(&graph, &i);
+    }
+
+    unsigned state = 7;
+    for (size_t i = 0; i < 4 * PARITY_SIZE; ++i) {
+        state = state * 1103515245u + 12345u;
+        size_t const one = (state >> 8) % PARITY_SIZE;
+        state = state * 1103515245u + 12345u;
+        size_t const two = (state >> 8) % PARITY_SIZE;
+
+        if (one == two || contains_weight_idam_graph(&graph, one, two)) {
+            continue;
+        }
+
+        int const weight = (int)((state >> 16) % 20) + 1;
+        insert_weight_idam_graph(&graph, one, two, &weight);
+    }
+
+    int zero = 0, inf = INT_MAX;
+    table_s table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    graph_workspace_s workspace = create_graph_workspace(graph.vertex_length, &table);
+
+    for (size_t q = 0; q < PARITY_SIZE; ++q) {
+        state = state * 1103515245u + 12345u;
+        size_t const start = (state >> 8) % PARITY_SIZE;
+        state = state * 1103515245u + 12345u;
+        size_t const end = (q % 4) ? (state >> 8) % PARITY_SIZE : IDAM_SPECIAL;
+
+        dijkstra_workspace_idam_graph(&graph, &workspace, start, end);
+        dijkstra_idam_graph(&graph, &table, start, end);
+
+        ASSERT_MEM_EQ(table.costs, workspace.table.costs, PARITY_SIZE * sizeof(int));
+        ASSERT_MEM_EQ(table.previous, workspace.table.previous, PARITY_SIZE * sizeof(size_t));
+        destroy_idam_table(&table);
+
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+        bfs_workspace_idam_graph(&graph, &workspace, start, end);
+        bfs_idam_graph(&graph, &table, start, end);
+
+        ASSERT_MEM_EQ(table.costs, workspace.table.costs, PARITY_SIZE * sizeof(int));
+        ASSERT_MEM_EQ(table.previous, workspace.table.previous, PARITY_SIZE * sizeof(size_t));
+        destroy_idam_table(&table);
+
+        table = compose_table(sizeof(int), intcmp, NULL, intcpy, NULL, intsum, NULL, intdst, NULL, &zero, &inf);
+    }
+
+    destroy_graph_workspace(&workspace);
+    destroy_idam_graph(&graph, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+SUITE (idam_graph_test) {
+    RUN_TEST(CREATE_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01);
+    RUN_TEST(INSERT_EDGE_01); RUN_TEST(REMOVE_EDGE_01); RUN_TEST(DEGREE_01);
+    RUN_TEST(REMOVE_VERTEX_01); RUN_TEST(REMOVE_VERTEX_02);
+    RUN_TEST(EACH_NEIGHBOR_01);
+    RUN_TEST(TOPOLOGICAL_SORT_01);
+    RUN_TEST(STRONGLY_CONNECTED_01); RUN_TEST(STRONGLY_CONNECTED_02);
+    RUN_TEST(BFS_01);
+    RUN_TEST(DIJKSTRA_01); RUN_TEST(DIJKSTRA_02);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(WORKSPACE_01);
+}
@@ -6,5 +6,7 @@
 #include <dodac.h>
 
 SUITE_EXTERN(iam_graph_test);
+SUITE_EXTERN(icsr_graph_test);
+SUITE_EXTERN(idam_graph_test);
 
 #endif // SUITE_H
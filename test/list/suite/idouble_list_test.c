@@ -1150,6 +1150,48 @@ TEST APPLY_06(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    idouble_list_s list = create_idouble_list(sizeof(int));
+
+    reserve_idouble_list(&list, 100);
+    size_t const capacity = list.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_at_idouble_list(&list, &i, list.length);
+    }
+    ASSERT_EQ(capacity, list.capacity);
+
+    destroy_idouble_list(&list, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    idouble_list_s list = create_idouble_list(sizeof(int));
+
+    for (int i = 0; i < 100; ++i) {
+        insert_at_idouble_list(&list, &i, list.length);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        remove_at_idouble_list(&list, 1, &a);
+    }
+
+    shrink_to_fit_idouble_list(&list);
+    ASSERT_EQ(list.length, list.capacity);
+    for (size_t i = 0; i < list.length; ++i) {
+        int a = -1;
+        get_idouble_list(&list, i, &a);
+        ASSERT_EQ(i ? (int)(i + 60) : 0, a);
+    }
+
+    destroy_idouble_list(&list, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (idouble_list_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -1169,4 +1211,5 @@ SUITE (idouble_list_test) {
     RUN_TEST(MAP_NEXT_01); RUN_TEST(MAP_NEXT_02); RUN_TEST(MAP_NEXT_03);
     RUN_TEST(MAP_PREV_01); RUN_TEST(MAP_PREV_02); RUN_TEST(MAP_PREV_03);
     RUN_TEST(APPLY_01); RUN_TEST(APPLY_02); RUN_TEST(APPLY_03); RUN_TEST(APPLY_04); RUN_TEST(APPLY_05); RUN_TEST(APPLY_06);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
 }
@@ -829,6 +829,82 @@ TEST APPLY_06(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    istraight_list_s list = create_istraight_list(sizeof(int));
+
+    reserve_istraight_list(&list, 100);
+    size_t const capacity = list.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_at_istraight_list(&list, &i, list.length);
+    }
+    ASSERT_EQ(capacity, list.capacity);
+
+    destroy_istraight_list(&list, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    istraight_list_s list = create_istraight_list(sizeof(int));
+
+    for (int i = 0; i < 100; ++i) {
+        insert_at_istraight_list(&list, &i, list.length);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        remove_at_istraight_list(&list, 1, &a);
+    }
+
+    shrink_to_fit_istraight_list(&list);
+    ASSERT_EQ(list.length, list.capacity);
+    for (size_t i = 0; i < list.length; ++i) {
+        int a = -1;
+        get_istraight_list(&list, i, &a);
+        ASSERT_EQ(i ? (int)(i + 60) : 0, a);
+    }
+
+    destroy_istraight_list(&list, intdst, NULL);
+
+    PASS();
+}
+
+TEST GROWTH_01(void) {
+    istraight_list_s list = create_istraight_list(sizeof(int));
+    growth_istraight_list(&list, compose_growth(2, 8, 0));
+
+    for (int i = 0; i < 100; ++i) {
+        insert_at_istraight_list(&list, &i, list.length);
+    }
+    size_t const capacity = list.capacity;
+
+    for (int i = 0; i < 100; ++i) {
+        int a = -1;
+        remove_at_istraight_list(&list, 0, &a);
+    }
+    ASSERT_EQ(capacity, list.capacity);
+
+    destroy_istraight_list(&list, intdst, NULL);
+
+    PASS();
+}
+
+TEST GROWTH_02(void) {
+    istraight_list_s list = create_istraight_list(sizeof(int));
+    growth_istraight_list(&list, compose_growth(4, 8, 4));
+
+    for (int i = 0; i < 9; ++i) {
+        insert_at_istraight_list(&list, &i, list.length);
+    }
+    ASSERT_EQ(32, list.capacity);
+
+    destroy_istraight_list(&list, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (istraight_list_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -843,4 +919,5 @@ SUITE (istraight_list_test) {
     RUN_TEST(EXTRACT_01); RUN_TEST(EXTRACT_02); RUN_TEST(EXTRACT_03);
     RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03);
     RUN_TEST(APPLY_01); RUN_TEST(APPLY_02); RUN_TEST(APPLY_03); RUN_TEST(APPLY_04); RUN_TEST(APPLY_05); RUN_TEST(APPLY_06);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01); RUN_TEST(GROWTH_01); RUN_TEST(GROWTH_02);
 }
@@ -0,0 +1,13 @@
+#include <suite.h>
+
+GREATEST_MAIN_DEFS();
+
+int main(const int argc, char **argv) {
+    GREATEST_MAIN_BEGIN();
+
+    RUN_SUITE(arena_memory_test);
+    RUN_SUITE(pool_memory_test);
+    RUN_SUITE(tracking_memory_test);
+
+    GREATEST_MAIN_END();
+}
@@ -0,0 +1,138 @@
+#include <memory/arena_memory.h>
+#include <sequence/istack.h>
+#include <tree/irb_tree.h>
+#include <dodac.h>
+
+#include <stdint.h>
+
+#include <suite.h>
+
+#define ARENA_MEMORY_CHUNK 1024
+
+TEST MAKE_01(void) {
+    memory_s arena = make_arena_memory(ARENA_MEMORY_CHUNK);
+
+    ASSERT_NEQ(NULL, arena.arg);
+    ASSERT_NEQ(NULL, arena.alloc);
+    ASSERT_NEQ(NULL, arena.realloc);
+    ASSERT_NEQ(NULL, arena.free);
+
+    destroy_arena_memory(&arena);
+
+    ASSERT_EQ(NULL, arena.arg);
+    ASSERT_EQ(NULL, arena.alloc);
+
+    PASS();
+}
+
+TEST ALLOC_01(void) {
+    memory_s arena = make_arena_memory(ARENA_MEMORY_CHUNK);
+
+    for (size_t i = 1; i < ARENA_MEMORY_CHUNK * 2; i += 7) {
+        char * memory = arena.alloc(i, arena.arg);
+        ASSERT_NEQ(NULL, memory);
+        ASSERT_EQ(0, (uintptr_t)(memory) % ARENA_MEMORY_ALIGN);
+        memset(memory, 0xAB, i);
+    }
+
+    ASSERT_EQ(NULL, arena.alloc(0, arena.arg));
+
+    destroy_arena_memory(&arena);
+
+    PASS();
+}
+
+TEST REALLOC_01(void) {
+    memory_s arena = make_arena_memory(ARENA_MEMORY_CHUNK);
+
+    int * first = arena.alloc(sizeof(int), arena.arg);
+    *first = 42;
+
+    int * grown = arena.realloc(first, sizeof(int) * 16, arena.arg);
+    ASSERT_EQ(first, grown); // last allocation extends in place
+    ASSERT_EQ(42, *grown);
+
+    int * other = arena.alloc(sizeof(int), arena.arg);
+    ASSERT_NEQ(NULL, other);
+
+    int * moved = arena.realloc(grown, sizeof(int) * 32, arena.arg);
+    ASSERT_NEQ(grown, moved); // not last anymore, so it gets copied
+    ASSERT_EQ(42, *moved);
+
+    destroy_arena_memory(&arena);
+
+    PASS();
+}
+
+TEST REALLOC_02(void) {
+    memory_s arena = make_arena_memory(ARENA_MEMORY_CHUNK);
+
+    int * array = NULL;
+    for (size_t i = 1; i <= ARENA_MEMORY_CHUNK; ++i) {
+        array = arena.realloc(array, i * sizeof(int), arena.arg);
+        array[i - 1] = (int)(i);
+    }
+
+    for (size_t i = 1; i <= ARENA_MEMORY_CHUNK; ++i) {
+        ASSERT_EQ((int)(i), array[i - 1]);
+    }
+
+    ASSERT_EQ(NULL, arena.realloc(array, 0, arena.arg));
+
+    destroy_arena_memory(&arena);
+
+    PASS();
+}
+
+TEST RESET_01(void) {
+    memory_s arena = make_arena_memory(ARENA_MEMORY_CHUNK);
+
+    void * first = arena.alloc(ARENA_MEMORY_CHUNK / 2, arena.arg);
+    for (size_t i = 0; i < 8; ++i) {
+        ASSERT_NEQ(NULL, arena.alloc(ARENA_MEMORY_CHUNK / 2, arena.arg));
+    }
+
+    reset_arena_memory(&arena);
+
+    ASSERT_EQ(first, arena.alloc(ARENA_MEMORY_CHUNK / 2, arena.arg));
+
+    destroy_arena_memory(&arena);
+
+    PASS();
+}
+
+TEST STRUCTURE_01(void) {
+    memory_s arena = make_arena_memory(ARENA_MEMORY_CHUNK);
+
+    for (int r = 0; r < 4; ++r) {
+        istack_s stack = make_istack(sizeof(int), &arena);
+        irb_tree_s tree = make_irb_tree(sizeof(int), intcmp, NULL, &arena);
+
+        for (int i = 0; i < ISTACK_CHUNK * 4; ++i) {
+            push_istack(&stack, &i);
+            insert_irb_tree(&tree, &i);
+        }
+
+        for (int i = ISTACK_CHUNK * 4 - 1; i >= 0; --i) {
+            int element = -1;
+            pop_istack(&stack, &element);
+            ASSERT_EQ(i, element);
+            ASSERT(contains_irb_tree(&tree, &i));
+        }
+
+        destroy_istack(&stack, intdst, NULL);
+        destroy_irb_tree(&tree, intdst, NULL);
+
+        reset_arena_memory(&arena);
+    }
+
+    destroy_arena_memory(&arena);
+
+    PASS();
+}
+
+SUITE (arena_memory_test) {
+    RUN_TEST(MAKE_01); RUN_TEST(ALLOC_01);
+    RUN_TEST(REALLOC_01); RUN_TEST(REALLOC_02);
+    RUN_TEST(RESET_01); RUN_TEST(STRUCTURE_01);
+}
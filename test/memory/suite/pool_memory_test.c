@@ -0,0 +1,141 @@
+#include <memory/pool_memory.h>
+#include <sequence/iqueue.h>
+#include <sequence/ideque.h>
+#include <dodac.h>
+
+#include <stdint.h>
+
+#include <suite.h>
+
+#define POOL_MEMORY_CHUNK 1024
+
+TEST MAKE_01(void) {
+    memory_s pool = make_pool_memory();
+
+    ASSERT_NEQ(NULL, pool.arg);
+    ASSERT_NEQ(NULL, pool.alloc);
+    ASSERT_NEQ(NULL, pool.realloc);
+    ASSERT_NEQ(NULL, pool.free);
+
+    destroy_pool_memory(&pool);
+
+    ASSERT_EQ(NULL, pool.arg);
+    ASSERT_EQ(NULL, pool.alloc);
+
+    PASS();
+}
+
+TEST ALLOC_01(void) {
+    memory_s pool = make_pool_memory();
+
+    for (size_t i = 1; i < POOL_MEMORY_CHUNK; i += 7) {
+        char * memory = pool.alloc(i, pool.arg);
+        ASSERT_NEQ(NULL, memory);
+        ASSERT_EQ(0, (uintptr_t)(memory) % POOL_MEMORY_ALIGN);
+        memset(memory, 0xAB, i);
+        pool.free(memory, pool.arg);
+    }
+
+    ASSERT_EQ(NULL, pool.alloc(0, pool.arg));
+
+    destroy_pool_memory(&pool);
+
+    PASS();
+}
+
+TEST FREE_01(void) {
+    memory_s pool = make_pool_memory();
+
+    void * first = pool.alloc(POOL_MEMORY_CHUNK, pool.arg);
+    void * other = pool.alloc(POOL_MEMORY_CHUNK / 2, pool.arg);
+    pool.free(first, pool.arg);
+    pool.free(other, pool.arg);
+
+    // freed blocks get reused by allocations with same rounded size
+    ASSERT_EQ(first, pool.alloc(POOL_MEMORY_CHUNK - 1, pool.arg));
+    ASSERT_EQ(other, pool.alloc(POOL_MEMORY_CHUNK / 2, pool.arg));
+
+    pool.free(first, pool.arg);
+    pool.free(other, pool.arg);
+
+    destroy_pool_memory(&pool);
+
+    PASS();
+}
+
+TEST REALLOC_01(void) {
+    memory_s pool = make_pool_memory();
+
+    int * array = NULL;
+    for (size_t i = 1; i <= POOL_MEMORY_CHUNK; ++i) {
+        array = pool.realloc(array, i * sizeof(int), pool.arg);
+        array[i - 1] = (int)(i);
+    }
+
+    for (size_t i = 1; i <= POOL_MEMORY_CHUNK; ++i) {
+        ASSERT_EQ((int)(i), array[i - 1]);
+    }
+
+    ASSERT_EQ(NULL, pool.realloc(array, 0, pool.arg));
+
+    destroy_pool_memory(&pool);
+
+    PASS();
+}
+
+TEST TRIM_01(void) {
+    memory_s pool = make_pool_memory();
+
+    void * blocks[16] = { 0 };
+    for (size_t i = 0; i < 16; ++i) {
+        blocks[i] = pool.alloc(POOL_MEMORY_CHUNK, pool.arg);
+    }
+    for (size_t i = 0; i < 16; ++i) {
+        pool.free(blocks[i], pool.arg);
+    }
+
+    trim_pool_memory(&pool);
+
+    void * memory = pool.alloc(POOL_MEMORY_CHUNK, pool.arg);
+    ASSERT_NEQ(NULL, memory);
+    pool.free(memory, pool.arg);
+
+    destroy_pool_memory(&pool);
+
+    PASS();
+}
+
+TEST STRUCTURE_01(void) {
+    memory_s pool = make_pool_memory();
+
+    iqueue_s queue = make_iqueue(sizeof(int), &pool);
+    ideque_s deque = make_ideque(sizeof(int), &pool);
+
+    for (int r = 0; r < 4; ++r) {
+        for (int i = 0; i < IQUEUE_CHUNK * 4; ++i) {
+            enqueue_iqueue(&queue, &i);
+            enqueue_back_ideque(&deque, &i);
+        }
+
+        for (int i = 0; i < IQUEUE_CHUNK * 4; ++i) {
+            int element = -1;
+            dequeue_iqueue(&queue, &element);
+            ASSERT_EQ(i, element);
+            dequeue_front_ideque(&deque, &element);
+            ASSERT_EQ(i, element);
+        }
+    }
+
+    destroy_iqueue(&queue, intdst, NULL);
+    destroy_ideque(&deque, intdst, NULL);
+
+    destroy_pool_memory(&pool);
+
+    PASS();
+}
+
+SUITE (pool_memory_test) {
+    RUN_TEST(MAKE_01); RUN_TEST(ALLOC_01);
+    RUN_TEST(FREE_01); RUN_TEST(REALLOC_01);
+    RUN_TEST(TRIM_01); RUN_TEST(STRUCTURE_01);
+}
@@ -0,0 +1,10 @@
+#ifndef SUITE_H
+#define SUITE_H
+
+#include <greatest.h>
+
+SUITE_EXTERN(arena_memory_test);
+SUITE_EXTERN(pool_memory_test);
+SUITE_EXTERN(tracking_memory_test);
+
+#endif // SUITE_H
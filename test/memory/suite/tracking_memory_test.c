@@ -0,0 +1,187 @@
+#include <memory/tracking_memory.h>
+#include <memory/arena_memory.h>
+#include <sequence/istack.h>
+#include <dodac.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <suite.h>
+
+#define TRACKING_MEMORY_CHUNK 1024
+
+TEST MAKE_01(void) {
+    memory_s tracking = make_tracking_memory(&standard);
+
+    ASSERT_NEQ(NULL, tracking.arg);
+    ASSERT_NEQ(NULL, tracking.alloc);
+    ASSERT_NEQ(NULL, tracking.realloc);
+    ASSERT_NEQ(NULL, tracking.free);
+
+    tracking_memory_stats_s stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(0, stats.live);
+    ASSERT_EQ(0, stats.peak);
+    ASSERT_EQ(0, stats.allocs);
+
+    destroy_tracking_memory(&tracking);
+
+    ASSERT_EQ(NULL, tracking.arg);
+    ASSERT_EQ(NULL, tracking.alloc);
+
+    PASS();
+}
+
+TEST ALLOC_01(void) {
+    memory_s tracking = make_tracking_memory(&standard);
+
+    void * first = tracking.alloc(100, tracking.arg);
+    void * other = tracking.alloc(28, tracking.arg);
+    ASSERT_EQ(0, (uintptr_t)(first) % TRACKING_MEMORY_ALIGN);
+
+    tracking_memory_stats_s stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(128, stats.live);
+    ASSERT_EQ(128, stats.peak);
+    ASSERT_EQ(2, stats.allocs);
+    ASSERT_EQ(1, stats.histogram[6]); // 100 is in [64, 128)
+    ASSERT_EQ(1, stats.histogram[4]); // 28 is in [16, 32)
+
+    tracking.free(first, tracking.arg);
+    tracking.free(other, tracking.arg);
+
+    stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(0, stats.live);
+    ASSERT_EQ(128, stats.peak);
+    ASSERT_EQ(2, stats.frees);
+
+    destroy_tracking_memory(&tracking);
+
+    PASS();
+}
+
+TEST REALLOC_01(void) {
+    memory_s tracking = make_tracking_memory(&standard);
+
+    int * array = NULL;
+    for (size_t i = 1; i <= TRACKING_MEMORY_CHUNK; ++i) {
+        array = tracking.realloc(array, i * sizeof(int), tracking.arg);
+        array[i - 1] = (int)(i);
+    }
+
+    for (size_t i = 1; i <= TRACKING_MEMORY_CHUNK; ++i) {
+        ASSERT_EQ((int)(i), array[i - 1]);
+    }
+
+    tracking_memory_stats_s stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(TRACKING_MEMORY_CHUNK * sizeof(int), stats.live);
+    ASSERT_EQ(TRACKING_MEMORY_CHUNK * sizeof(int), stats.peak);
+    ASSERT_EQ(TRACKING_MEMORY_CHUNK, stats.reallocs);
+
+    ASSERT_EQ(NULL, tracking.realloc(array, 0, tracking.arg));
+
+    stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(0, stats.live);
+    ASSERT_EQ(0, stats.frees);
+
+    destroy_tracking_memory(&tracking);
+
+    PASS();
+}
+
+TEST REALLOC_02(void) {
+    memory_s arena = make_arena_memory(TRACKING_MEMORY_CHUNK * 4);
+    memory_s tracking = make_tracking_memory(&arena);
+
+    int * first = tracking.alloc(sizeof(int) * 4, tracking.arg);
+    int * other = tracking.alloc(sizeof(int) * 4, tracking.arg);
+    memset(first, 0, sizeof(int) * 4);
+
+    // other is last arena allocation, so arena extends it in place without copying
+    other = tracking.realloc(other, sizeof(int) * 8, tracking.arg);
+    (void)(other);
+    ASSERT_EQ(0, stats_tracking_memory(&tracking).copied);
+
+    // first isn't last arena allocation, so arena copies it
+    first = tracking.realloc(first, sizeof(int) * 8, tracking.arg);
+    (void)(first);
+    ASSERT_EQ(sizeof(int) * 4, stats_tracking_memory(&tracking).copied);
+
+    destroy_tracking_memory(&tracking);
+    destroy_arena_memory(&arena);
+
+    PASS();
+}
+
+TEST RESET_01(void) {
+    memory_s tracking = make_tracking_memory(&standard);
+
+    void * first = tracking.alloc(TRACKING_MEMORY_CHUNK, tracking.arg);
+    void * other = tracking.alloc(TRACKING_MEMORY_CHUNK, tracking.arg);
+    tracking.free(other, tracking.arg);
+
+    reset_tracking_memory(&tracking);
+
+    tracking_memory_stats_s stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(TRACKING_MEMORY_CHUNK, stats.live);
+    ASSERT_EQ(TRACKING_MEMORY_CHUNK, stats.peak);
+    ASSERT_EQ(0, stats.allocs);
+    ASSERT_EQ(0, stats.frees);
+    ASSERT_EQ(0, stats.histogram[10]);
+
+    tracking.free(first, tracking.arg);
+    destroy_tracking_memory(&tracking);
+
+    PASS();
+}
+
+TEST DUMP_01(void) {
+    memory_s tracking = make_tracking_memory(&standard);
+
+    void * memory = tracking.alloc(100, tracking.arg);
+
+    FILE * stream = tmpfile();
+    ASSERT_NEQ(NULL, stream);
+
+    dump_tracking_memory(&tracking, stream);
+    rewind(stream);
+
+    char buffer[256] = { 0 };
+    ASSERT_NEQ(NULL, fgets(buffer, sizeof(buffer), stream));
+    fclose(stream);
+
+    ASSERT_EQ(0, strcmp("{\"live\":100,\"peak\":100,\"allocs\":1,\"reallocs\":0,\"frees\":0,\"copied\":0,\"histogram\":[[64,1]]}\n", buffer));
+
+    tracking.free(memory, tracking.arg);
+    destroy_tracking_memory(&tracking);
+
+    PASS();
+}
+
+TEST STRUCTURE_01(void) {
+    memory_s tracking = make_tracking_memory(&standard);
+
+    istack_s stack = make_istack(sizeof(int), &tracking);
+    for (int i = 0; i < ISTACK_CHUNK * 4; ++i) {
+        push_istack(&stack, &i);
+    }
+
+    tracking_memory_stats_s stats = stats_tracking_memory(&tracking);
+    ASSERT_NEQ(0, stats.live);
+    ASSERT(stats.allocs + stats.reallocs >= 1);
+
+    destroy_istack(&stack, intdst, NULL);
+
+    stats = stats_tracking_memory(&tracking);
+    ASSERT_EQ(0, stats.live);
+    ASSERT(stats.peak >= ISTACK_CHUNK * 4 * sizeof(int));
+
+    destroy_tracking_memory(&tracking);
+
+    PASS();
+}
+
+SUITE (tracking_memory_test) {
+    RUN_TEST(MAKE_01); RUN_TEST(ALLOC_01);
+    RUN_TEST(REALLOC_01); RUN_TEST(REALLOC_02);
+    RUN_TEST(RESET_01); RUN_TEST(DUMP_01);
+    RUN_TEST(STRUCTURE_01);
+}
@@ -7,6 +7,8 @@ int main(const int argc, char **argv) {
 
     RUN_SUITE(ibinary_heap_test);
     RUN_SUITE(isc_hash_map_test);
+    RUN_SUITE(ccsc_hash_map_test);
+    RUN_SUITE(idisjoint_set_test);
 
     RUN_SUITE(fbinary_heap_test);
     RUN_SUITE(fsc_hash_map_test);
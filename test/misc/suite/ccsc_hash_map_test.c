@@ -0,0 +1,336 @@
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#       undef _POSIX_C_SOURCE
+#       define _POSIX_C_SOURCE 200112L // imports pthreads in strict C99
+#   endif
+#   include <pthread.h>
+#endif
+
+#include <misc/ccsc_hash_map.h>
+#include <dodac.h>
+
+#include <suite.h>
+
+#define CCSC_HASH_MAP_CHUNK (ISC_HASH_MAP_CHUNK * 4)
+#define CCSC_HASH_MAP_THREADS 8
+#define CCSC_HASH_MAP_STRESS (CCSC_HASH_MAP_CHUNK * 16) // keys owned by each thread, enough to resize shards many times
+
+/// @brief Arguments and results of a single stress thread.
+typedef struct ccsc_hash_map_worker {
+    ccsc_hash_map_s * map;
+    int start;
+    bool failed;
+} ccsc_hash_map_worker_s;
+
+/// @brief Inserts, looks up, overwrites and removes own keys while peeking at other threads' keys.
+/// @param worker Worker arguments and results.
+void _ccsc_hash_map_work(ccsc_hash_map_worker_s * const worker);
+
+/// @brief Counts each visited element.
+bool _ccsc_hash_map_count(void * const element, void * const count);
+
+#if defined(_WIN32)
+DWORD WINAPI _ccsc_hash_map_thread(LPVOID argument) {
+    _ccsc_hash_map_work(argument);
+    return 0;
+}
+#else
+void * _ccsc_hash_map_thread(void * argument) {
+    _ccsc_hash_map_work(argument);
+    return NULL;
+}
+#endif
+
+TEST CREATE_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    ASSERT_EQ(CCSC_HASH_MAP_SHARDS, table.count);
+    ASSERT_EQ(sizeof(int), table.key_size);
+    ASSERT_EQ(sizeof(int), table.value_size);
+    ASSERT_NEQ(NULL, table.hash_key);
+    ASSERT_NEQ(NULL, table.shards);
+    ASSERT(is_empty_ccsc_hash_map(&table));
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST CREATE_02(void) {
+    ccsc_hash_map_s table = make_ccsc_hash_map(sizeof(int), sizeof(int), 1, inthshmurmur, NULL, intcmp, NULL, &standard);
+
+    ASSERT_EQ(1, table.count);
+    ASSERT_EQ(&standard, table.allocator);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i;
+        insert_ccsc_hash_map(&table, &i, &j);
+    }
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        ASSERT(contains_key_ccsc_hash_map(&table, &i));
+    }
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    ASSERT_EQ(0, table.count);
+    ASSERT_EQ(0, table.key_size);
+    ASSERT_EQ(0, table.value_size);
+    ASSERT_EQ(NULL, table.hash_key);
+    ASSERT_EQ(NULL, table.shards);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i;
+        insert_ccsc_hash_map(&table, &i, &j);
+    }
+
+    clear_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    ASSERT(is_empty_ccsc_hash_map(&table));
+    ASSERT_NEQ(0, table.key_size);
+    ASSERT_NEQ(0, table.value_size);
+    ASSERT_NEQ(NULL, table.shards);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        ASSERT_FALSE(contains_key_ccsc_hash_map(&table, &i));
+    }
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i;
+        insert_ccsc_hash_map(&table, &i, &j);
+    }
+
+    ccsc_hash_map_s replica = copy_ccsc_hash_map(&table, intcpy, NULL, intcpy, NULL);
+
+    ASSERT_EQ(table.allocator, replica.allocator);
+    ASSERT_EQ(table.hash_key, replica.hash_key);
+    ASSERT_EQ(table.key_size, replica.key_size);
+    ASSERT_EQ(table.value_size, replica.value_size);
+    ASSERT_EQ(table.count, replica.count);
+    ASSERT_NEQ(table.shards, replica.shards);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int value = -1;
+        get_value_ccsc_hash_map(&replica, &i, &value);
+        ASSERT_EQ(i, value);
+    }
+
+    destroy_ccsc_hash_map(&replica, intdst, NULL, intdst, NULL);
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshsame, NULL, intcmp, NULL);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i;
+        insert_ccsc_hash_map(&table, &i, &j);
+    }
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int value = -1;
+        get_value_ccsc_hash_map(&table, &i, &value);
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(is_empty_ccsc_hash_map(&table));
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i;
+        insert_ccsc_hash_map(&table, &i, &j);
+    }
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int key = -1, value = -1;
+        remove_ccsc_hash_map(&table, &i, &key, &value);
+
+        ASSERT_EQ(i, key);
+        ASSERT_EQ(i, value);
+        ASSERT_FALSE(contains_key_ccsc_hash_map(&table, &i));
+    }
+
+    ASSERT(is_empty_ccsc_hash_map(&table));
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST SET_VALUE_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i, buffer = -1;
+        set_ccsc_hash_map(&table, &i, &j, &buffer);
+        ASSERT_EQ(-1, buffer);
+    }
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = i * 2, buffer = -1;
+        set_ccsc_hash_map(&table, &i, &j, &buffer);
+        ASSERT_EQ(i, buffer);
+    }
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int value = -1;
+        get_value_ccsc_hash_map(&table, &i, &value);
+        ASSERT_EQ(i * 2, value);
+    }
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST EACH_01(void) {
+    ccsc_hash_map_s table = create_ccsc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int j = 1;
+        insert_ccsc_hash_map(&table, &i, &j);
+    }
+
+    int increment = 1;
+    each_value_ccsc_hash_map(&table, intincrement, &increment);
+
+    for (int i = 0; i < CCSC_HASH_MAP_CHUNK; ++i) {
+        int value = -1;
+        get_value_ccsc_hash_map(&table, &i, &value);
+        ASSERT_EQ(2, value);
+    }
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST THREADS_01(void) {
+    // few shards so each one holds many keys and has to grow while other threads use it
+    ccsc_hash_map_s table = make_ccsc_hash_map(sizeof(int), sizeof(int), 4, inthshmurmur, NULL, intcmp, NULL, &standard);
+
+    ccsc_hash_map_worker_s workers[CCSC_HASH_MAP_THREADS];
+#if defined(_WIN32)
+    HANDLE handles[CCSC_HASH_MAP_THREADS];
+#else
+    pthread_t handles[CCSC_HASH_MAP_THREADS];
+#endif
+
+    for (int t = 0; t < CCSC_HASH_MAP_THREADS; ++t) {
+        workers[t] = (ccsc_hash_map_worker_s) { .map = &table, .start = t * CCSC_HASH_MAP_STRESS, .failed = false, };
+#if defined(_WIN32)
+        handles[t] = CreateThread(NULL, 0, _ccsc_hash_map_thread, workers + t, 0, NULL);
+        ASSERT_NEQ(NULL, handles[t]);
+#else
+        ASSERT_EQ(0, pthread_create(handles + t, NULL, _ccsc_hash_map_thread, workers + t));
+#endif
+    }
+
+    for (int t = 0; t < CCSC_HASH_MAP_THREADS; ++t) {
+#if defined(_WIN32)
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+#else
+        pthread_join(handles[t], NULL);
+#endif
+        ASSERT_FALSE(workers[t].failed);
+    }
+
+    // every thread kept its even keys with doubled value and removed its odd keys
+    for (int i = 0; i < CCSC_HASH_MAP_THREADS * CCSC_HASH_MAP_STRESS; ++i) {
+        if (i % 2) {
+            ASSERT_FALSE(contains_key_ccsc_hash_map(&table, &i));
+        } else {
+            int value = -1;
+            get_value_ccsc_hash_map(&table, &i, &value);
+            ASSERT_EQ(i * 2, value);
+        }
+    }
+
+    size_t count = 0;
+    each_key_ccsc_hash_map(&table, _ccsc_hash_map_count, &count);
+    ASSERT_EQ((size_t)(CCSC_HASH_MAP_THREADS * CCSC_HASH_MAP_STRESS / 2), count);
+
+    destroy_ccsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+void _ccsc_hash_map_work(ccsc_hash_map_worker_s * const worker) {
+    int const start = worker->start, end = start + CCSC_HASH_MAP_STRESS;
+    int const total = CCSC_HASH_MAP_THREADS * CCSC_HASH_MAP_STRESS;
+
+    for (int i = start; i < end; ++i) {
+        int const value = i;
+        insert_ccsc_hash_map(worker->map, &i, &value);
+
+        // peek at a key owned by another thread, its presence depends on timing so only lock traffic matters
+        int const other = (i + CCSC_HASH_MAP_STRESS) % total;
+        (void)(contains_key_ccsc_hash_map(worker->map, &other));
+    }
+
+    for (int i = start; i < end; ++i) {
+        int value = -1;
+        get_value_ccsc_hash_map(worker->map, &i, &value);
+        worker->failed |= (value != i);
+    }
+
+    for (int i = start; i < end; ++i) {
+        if (i % 2) {
+            int key = -1, value = -1;
+            remove_ccsc_hash_map(worker->map, &i, &key, &value);
+            worker->failed |= (key != i || value != i);
+        } else {
+            int const value = i * 2;
+            int buffer = -1;
+            set_ccsc_hash_map(worker->map, &i, &value, &buffer);
+            worker->failed |= (buffer != i);
+        }
+    }
+}
+
+bool _ccsc_hash_map_count(void * const element, void * const count) {
+    (void)(element);
+    ++(*(size_t *)(count));
+
+    return true;
+}
+
+SUITE (ccsc_hash_map_test) {
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_02); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
+    RUN_TEST(COPY_01); RUN_TEST(INSERT_01); RUN_TEST(REMOVE_01);
+    RUN_TEST(SET_VALUE_01); RUN_TEST(EACH_01); RUN_TEST(THREADS_01);
+}
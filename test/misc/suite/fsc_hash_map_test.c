@@ -302,6 +302,81 @@ TEST SET_VALUE_02(void) {
     PASS();
 }
 
+TEST REINDEX_01(void) {
+    fsc_hash_map_s table = create_fsc_hash_map(sizeof(int), sizeof(int), FHASH_TABLE_CHUNK + 3, inthshsame, NULL, intcmp, NULL);
+    reindex_fsc_hash_map(&table, MASK_INDEX);
+
+    ASSERT_EQ(FHASH_TABLE_CHUNK - 1, table.mask);
+
+    for (int i = 0; i < FHASH_TABLE_CHUNK + 3; ++i) {
+        int j = i;
+        insert_fsc_hash_map(&table, &i, &j);
+    }
+
+    for (int i = 0; i < FHASH_TABLE_CHUNK + 3; ++i) {
+        int a = -1;
+        get_value_fsc_hash_map(&table, &i, &a);
+        ASSERT_EQ(i, a);
+    }
+
+    for (int i = 0; i < FHASH_TABLE_CHUNK + 3; ++i) {
+        int key = -1, value = -1;
+        remove_fsc_hash_map(&table, &i, &key, &value);
+
+        ASSERT_EQ(i, key);
+        ASSERT_EQ(i, value);
+    }
+
+    destroy_fsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REINDEX_02(void) {
+    fsc_hash_map_s table = create_fsc_hash_map(sizeof(int), sizeof(int), FHASH_TABLE_CHUNK, inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < FHASH_TABLE_CHUNK; ++i) {
+        int j = i;
+        insert_fsc_hash_map(&table, &i, &j);
+    }
+
+    reindex_fsc_hash_map(&table, MASK_INDEX);
+    for (int i = 0; i < FHASH_TABLE_CHUNK; ++i) {
+        ASSERT(contains_key_fsc_hash_map(&table, &i));
+    }
+
+    reindex_fsc_hash_map(&table, MODULO_INDEX);
+    for (int i = 0; i < FHASH_TABLE_CHUNK; ++i) {
+        ASSERT(contains_key_fsc_hash_map(&table, &i));
+    }
+
+    destroy_fsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST GET_VALUES_01(void) {
+    fsc_hash_map_s table = create_fsc_hash_map(sizeof(int), sizeof(int), FHASH_TABLE_CHUNK * 2 + 1, inthshmurmur, NULL, intcmp, NULL);
+
+    int keys[FHASH_TABLE_CHUNK * 2 + 1];
+    for (int i = 0; i < FHASH_TABLE_CHUNK * 2 + 1; ++i) {
+        int j = i * 2;
+        insert_fsc_hash_map(&table, &i, &j);
+        keys[i] = FHASH_TABLE_CHUNK * 2 - i;
+    }
+
+    int values[FHASH_TABLE_CHUNK * 2 + 1];
+    get_values_fsc_hash_map(&table, keys, FHASH_TABLE_CHUNK * 2 + 1, values);
+
+    for (int i = 0; i < FHASH_TABLE_CHUNK * 2 + 1; ++i) {
+        ASSERT_EQ(keys[i] * 2, values[i]);
+    }
+
+    destroy_fsc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (fsc_hash_map_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02);
@@ -310,4 +385,6 @@ SUITE (fsc_hash_map_test) {
     RUN_TEST(CONTAINS_01); RUN_TEST(CONTAINS_02);
     RUN_TEST(GET_VALUE_01); RUN_TEST(GET_VALUE_02);
     RUN_TEST(SET_VALUE_01); RUN_TEST(SET_VALUE_02);
+    RUN_TEST(REINDEX_01); RUN_TEST(REINDEX_02);
+    RUN_TEST(GET_VALUES_01);
 }
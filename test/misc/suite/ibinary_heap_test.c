@@ -482,6 +482,48 @@ TEST MAP_03(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    ibinary_heap_s test = create_ibinary_heap(sizeof(int), intcmp, NULL);
+
+    reserve_ibinary_heap(&test, 100);
+    size_t const capacity = test.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        push_ibinary_heap(&test, &i);
+    }
+    ASSERT_EQ(capacity, test.capacity);
+
+    destroy_ibinary_heap(&test, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    ibinary_heap_s test = create_ibinary_heap(sizeof(int), intcmp, NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        push_ibinary_heap(&test, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        pop_ibinary_heap(&test, &a);
+    }
+
+    shrink_to_fit_ibinary_heap(&test);
+    ASSERT_EQ(test.length, test.capacity);
+    for (int i = 60; i < 100; ++i) {
+        int a = -1;
+        pop_ibinary_heap(&test, &a);
+        ASSERT_EQ(i, a);
+    }
+
+    destroy_ibinary_heap(&test, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (ibinary_heap_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -491,4 +533,5 @@ SUITE (ibinary_heap_test) {
     RUN_TEST(REPLACE_01); RUN_TEST(REPLACE_02); RUN_TEST(REPLACE_03);
     RUN_TEST(MELD_01); RUN_TEST(MELD_02); RUN_TEST(MELD_03);
     RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
 }
@@ -0,0 +1,248 @@
+#include <misc/idisjoint_set.h>
+
+#include <suite.h>
+
+#define DISJOINT_SIZE 1000
+
+TEST CREATE_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    ASSERT_NEQ(NULL, set.allocator);
+    ASSERT_EQ(NULL, set.parents);
+    ASSERT_EQ(NULL, set.sizes);
+    ASSERT_EQ(0, set.length);
+    ASSERT_EQ(0, set.capacity);
+    ASSERT_EQ(0, set.count);
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < IDISJOINT_SET_CHUNK + 1; ++i) {
+        insert_idisjoint_set(&set);
+    }
+
+    destroy_idisjoint_set(&set);
+
+    ASSERT_EQ(NULL, set.allocator);
+    ASSERT_EQ(NULL, set.parents);
+    ASSERT_EQ(0, set.length);
+    ASSERT_EQ(0, set.count);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < IDISJOINT_SET_CHUNK + 1; ++i) {
+        insert_idisjoint_set(&set);
+    }
+    union_idisjoint_set(&set, 0, 1);
+
+    clear_idisjoint_set(&set);
+    ASSERT(is_empty_idisjoint_set(&set));
+    ASSERT_EQ(0, set.count);
+
+    ASSERT_EQ(0, insert_idisjoint_set(&set));
+    ASSERT_EQ(1, set.count);
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        insert_idisjoint_set(&set);
+    }
+    for (size_t i = 0; i + 2 < DISJOINT_SIZE; i += 2) {
+        union_idisjoint_set(&set, i, i + 2);
+    }
+
+    idisjoint_set_s replica = copy_idisjoint_set(&set);
+    ASSERT_EQ(set.length, replica.length);
+    ASSERT_EQ(set.count, replica.count);
+
+    // replica keeps sets after original changes
+    union_idisjoint_set(&set, 0, 1);
+    ASSERT(is_joint_idisjoint_set(&set, 2, 1));
+    ASSERT_FALSE(is_joint_idisjoint_set(&replica, 2, 1));
+    ASSERT(is_joint_idisjoint_set(&replica, 0, DISJOINT_SIZE - 2));
+
+    destroy_idisjoint_set(&set);
+    destroy_idisjoint_set(&replica);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        ASSERT_EQ(i, insert_idisjoint_set(&set));
+        ASSERT_EQ(i, find_idisjoint_set(&set, i));
+        ASSERT_EQ(1, size_idisjoint_set(&set, i));
+    }
+    ASSERT_EQ(DISJOINT_SIZE, set.count);
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST UNION_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < 6; ++i) {
+        insert_idisjoint_set(&set);
+    }
+
+    ASSERT(union_idisjoint_set(&set, 0, 1));
+    ASSERT(union_idisjoint_set(&set, 2, 3));
+    ASSERT(union_idisjoint_set(&set, 1, 3));
+    ASSERT_FALSE(union_idisjoint_set(&set, 0, 2));
+
+    ASSERT_EQ(3, set.count);
+    ASSERT_EQ(4, size_idisjoint_set(&set, 3));
+    ASSERT_EQ(1, size_idisjoint_set(&set, 4));
+    ASSERT(is_joint_idisjoint_set(&set, 0, 3));
+    ASSERT_FALSE(is_joint_idisjoint_set(&set, 0, 4));
+    ASSERT_FALSE(is_joint_idisjoint_set(&set, 4, 5));
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST UNION_02(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        insert_idisjoint_set(&set);
+    }
+
+    // chain of unions that would make a linked list without union by size
+    for (size_t i = 1; i < DISJOINT_SIZE; ++i) {
+        ASSERT(union_idisjoint_set(&set, i - 1, i));
+    }
+    ASSERT_EQ(1, set.count);
+
+    // smaller set always goes under bigger one, so every element is at most log2(n) parents away from root
+    size_t const root = find_idisjoint_set(&set, 0);
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        size_t depth = 0;
+        for (size_t current = i; current != set.parents[current]; current = set.parents[current]) {
+            depth++;
+        }
+        ASSERT(depth <= 10);
+        ASSERT_EQ(root, find_idisjoint_set(&set, i));
+    }
+    ASSERT_EQ(DISJOINT_SIZE, size_idisjoint_set(&set, DISJOINT_SIZE - 1));
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST FIND_MANY_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        insert_idisjoint_set(&set);
+    }
+
+    // elements are joined by their remainder of three
+    for (size_t i = 3; i < DISJOINT_SIZE; ++i) {
+        union_idisjoint_set(&set, i, i - 3);
+    }
+
+    size_t elements[DISJOINT_SIZE] = { 0 };
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        elements[i] = DISJOINT_SIZE - 1 - i;
+    }
+
+    size_t roots[DISJOINT_SIZE] = { 0 };
+    find_many_idisjoint_set(&set, elements, DISJOINT_SIZE, roots);
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        ASSERT_EQ(find_idisjoint_set(&set, elements[i] % 3), roots[i]);
+    }
+
+    // roots may be saved into elements array itself
+    find_many_idisjoint_set(&set, elements, DISJOINT_SIZE, elements);
+    ASSERT_MEM_EQ(roots, elements, DISJOINT_SIZE * sizeof(size_t));
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST UNION_MANY_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < 8; ++i) {
+        insert_idisjoint_set(&set);
+    }
+
+    // stream of edges where third and last pair are already connected
+    size_t const pairs[] = { 0, 1, 1, 2, 2, 0, 4, 5, 6, 7, 5, 4, };
+    ASSERT_EQ(4, union_many_idisjoint_set(&set, pairs, sizeof(pairs) / (2 * sizeof(size_t))));
+
+    // connected components are the count of remaining sets
+    ASSERT_EQ(4, set.count);
+    ASSERT(is_joint_idisjoint_set(&set, 0, 2));
+    ASSERT(is_joint_idisjoint_set(&set, 6, 7));
+    ASSERT_FALSE(is_joint_idisjoint_set(&set, 3, 4));
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST RESERVE_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    reserve_idisjoint_set(&set, DISJOINT_SIZE);
+    size_t const capacity = set.capacity;
+    ASSERT(capacity >= DISJOINT_SIZE);
+
+    for (size_t i = 0; i < DISJOINT_SIZE; ++i) {
+        insert_idisjoint_set(&set);
+    }
+    ASSERT_EQ(capacity, set.capacity);
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    idisjoint_set_s set = create_idisjoint_set();
+
+    for (size_t i = 0; i < IDISJOINT_SET_CHUNK + 1; ++i) {
+        insert_idisjoint_set(&set);
+    }
+    union_idisjoint_set(&set, 0, IDISJOINT_SET_CHUNK);
+
+    shrink_to_fit_idisjoint_set(&set);
+    ASSERT_EQ(set.length, set.capacity);
+    ASSERT(is_joint_idisjoint_set(&set, 0, IDISJOINT_SET_CHUNK));
+
+    destroy_idisjoint_set(&set);
+
+    PASS();
+}
+
+SUITE (idisjoint_set_test) {
+    RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01);
+    RUN_TEST(INSERT_01);
+    RUN_TEST(UNION_01); RUN_TEST(UNION_02);
+    RUN_TEST(FIND_MANY_01); RUN_TEST(UNION_MANY_01);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+}
@@ -425,6 +425,245 @@ TEST SET_VALUE_03(void) {
     PASS();
 }
 
+TEST REINDEX_01(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshsame, NULL, intcmp, NULL);
+    reindex_isc_hash_map(&table, MASK_INDEX);
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 3 + 1; ++i) {
+        int j = i;
+        insert_isc_hash_map(&table, &i, &j);
+        ASSERT_EQ(0, table.capacity & (table.capacity - 1));
+    }
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 3 + 1; ++i) {
+        int a = -1;
+        get_value_isc_hash_map(&table, &i, &a);
+        ASSERT_EQ(i, a);
+    }
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 3 + 1; ++i) {
+        int key = -1, value = -1;
+        remove_isc_hash_map(&table, &i, &key, &value);
+
+        ASSERT_EQ(i, key);
+        ASSERT_EQ(i, value);
+        ASSERT_EQ(0, table.capacity & (table.capacity - 1));
+    }
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST REINDEX_02(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK + 1; ++i) {
+        int j = i;
+        insert_isc_hash_map(&table, &i, &j);
+    }
+
+    reindex_isc_hash_map(&table, MASK_INDEX);
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK + 1; ++i) {
+        ASSERT(contains_key_isc_hash_map(&table, &i));
+    }
+
+    isc_hash_map_s replica = copy_isc_hash_map(&table, intcpy, NULL, intcpy, NULL);
+    ASSERT_EQ(MASK_INDEX, replica.indexing);
+
+    reindex_isc_hash_map(&table, MODULO_INDEX);
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK + 1; ++i) {
+        ASSERT(contains_key_isc_hash_map(&table, &i));
+        ASSERT(contains_key_isc_hash_map(&replica, &i));
+    }
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+    destroy_isc_hash_map(&replica, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST INCREMENTAL_01(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    incremental_isc_hash_map(&table, true);
+
+    bool rehashed = false;
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 16; ++i) {
+        int j = i;
+        insert_isc_hash_map(&table, &i, &j);
+        rehashed = rehashed || pending_rehash_isc_hash_map(&table);
+
+        for (int k = 0; k <= i; ++k) {
+            int a = -1;
+            get_value_isc_hash_map(&table, &k, &a);
+            ASSERT_EQ(k, a);
+        }
+    }
+    ASSERT(rehashed);
+
+    finish_rehash_isc_hash_map(&table);
+    ASSERT_EQ(0, pending_rehash_isc_hash_map(&table));
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST INCREMENTAL_02(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshsame, NULL, intcmp, NULL);
+    reindex_isc_hash_map(&table, MASK_INDEX);
+    incremental_isc_hash_map(&table, true);
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 16; ++i) {
+        int j = i;
+        insert_isc_hash_map(&table, &i, &j);
+    }
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 16; i += 2) {
+        int key = -1, value = -1;
+        remove_isc_hash_map(&table, &i, &key, &value);
+
+        ASSERT_EQ(i, key);
+        ASSERT_EQ(i, value);
+    }
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 16; ++i) {
+        ASSERT_EQ(i % 2, contains_key_isc_hash_map(&table, &i));
+    }
+
+    for (int i = 1; i < ISC_HASH_MAP_CHUNK * 16; i += 2) {
+        int key = -1, value = -1;
+        remove_isc_hash_map(&table, &i, &key, &value);
+
+        ASSERT_EQ(i, key);
+        ASSERT_EQ(i, value);
+    }
+
+    ASSERT(is_empty_isc_hash_map(&table));
+    ASSERT_EQ(0, pending_rehash_isc_hash_map(&table));
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST INCREMENTAL_03(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    incremental_isc_hash_map(&table, true);
+
+    int i = 0;
+    for (; !pending_rehash_isc_hash_map(&table) || i < ISC_HASH_MAP_CHUNK; ++i) {
+        int j = i, buffer = -1;
+        set_isc_hash_map(&table, &i, &j, &buffer);
+    }
+
+    isc_hash_map_s replica = copy_isc_hash_map(&table, intcpy, NULL, intcpy, NULL);
+    ASSERT_EQ(pending_rehash_isc_hash_map(&table), pending_rehash_isc_hash_map(&replica));
+
+    incremental_isc_hash_map(&table, false);
+    ASSERT_EQ(0, pending_rehash_isc_hash_map(&table));
+
+    for (int k = 0; k < i; ++k) {
+        ASSERT(contains_key_isc_hash_map(&table, &k));
+        ASSERT(contains_key_isc_hash_map(&replica, &k));
+    }
+
+    clear_isc_hash_map(&replica, intdst, NULL, intdst, NULL);
+    ASSERT_EQ(0, pending_rehash_isc_hash_map(&replica));
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+    destroy_isc_hash_map(&replica, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST GET_VALUES_01(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    int keys[ISC_HASH_MAP_CHUNK * 2 + 1];
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 2 + 1; ++i) {
+        int j = i * 2;
+        insert_isc_hash_map(&table, &i, &j);
+        keys[i] = ISC_HASH_MAP_CHUNK * 2 - i;
+    }
+
+    int values[ISC_HASH_MAP_CHUNK * 2 + 1];
+    get_values_isc_hash_map(&table, keys, ISC_HASH_MAP_CHUNK * 2 + 1, values);
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 2 + 1; ++i) {
+        ASSERT_EQ(keys[i] * 2, values[i]);
+    }
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST GET_VALUES_02(void) {
+    isc_hash_map_s table = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    incremental_isc_hash_map(&table, true);
+
+    int keys[ISC_HASH_MAP_CHUNK * 2 + 1];
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 2 + 1; ++i) {
+        int j = i * 2;
+        insert_isc_hash_map(&table, &i, &j);
+        keys[i] = ISC_HASH_MAP_CHUNK * 2 - i;
+    }
+
+    int values[ISC_HASH_MAP_CHUNK * 2 + 1];
+    get_values_isc_hash_map(&table, keys, ISC_HASH_MAP_CHUNK * 2 + 1, values);
+
+    for (int i = 0; i < ISC_HASH_MAP_CHUNK * 2 + 1; ++i) {
+        ASSERT_EQ(keys[i] * 2, values[i]);
+    }
+
+    destroy_isc_hash_map(&table, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST RESERVE_01(void) {
+    isc_hash_map_s map = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    reserve_isc_hash_map(&map, 100);
+    size_t const capacity = map.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        int const j = i;
+        insert_isc_hash_map(&map, &i, &j);
+    }
+    ASSERT_EQ(capacity, map.capacity);
+
+    destroy_isc_hash_map(&map, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    isc_hash_map_s map = create_isc_hash_map(sizeof(int), sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        int const j = i;
+        insert_isc_hash_map(&map, &i, &j);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int k = -1, v = -1;
+        remove_isc_hash_map(&map, &i, &k, &v);
+    }
+
+    shrink_to_fit_isc_hash_map(&map);
+    ASSERT_EQ(map.length, map.capacity);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i >= 60, contains_key_isc_hash_map(&map, &i));
+    }
+
+    destroy_isc_hash_map(&map, intdst, NULL, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (isc_hash_map_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -433,4 +672,8 @@ SUITE (isc_hash_map_test) {
     RUN_TEST(CONTAINS_01); RUN_TEST(CONTAINS_02); RUN_TEST(CONTAINS_03);
     RUN_TEST(GET_VALUE_01); RUN_TEST(GET_VALUE_02); RUN_TEST(GET_VALUE_03);
     RUN_TEST(SET_VALUE_01); RUN_TEST(SET_VALUE_02); RUN_TEST(SET_VALUE_03);
+    RUN_TEST(REINDEX_01); RUN_TEST(REINDEX_02);
+    RUN_TEST(INCREMENTAL_01); RUN_TEST(INCREMENTAL_02); RUN_TEST(INCREMENTAL_03);
+    RUN_TEST(GET_VALUES_01); RUN_TEST(GET_VALUES_02);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
 }
@@ -5,6 +5,8 @@
 
 SUITE_EXTERN(ibinary_heap_test);
 SUITE_EXTERN(isc_hash_map_test);
+SUITE_EXTERN(ccsc_hash_map_test);
+SUITE_EXTERN(idisjoint_set_test);
 
 SUITE_EXTERN(fbinary_heap_test);
 SUITE_EXTERN(fsc_hash_map_test);
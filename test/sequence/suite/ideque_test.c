@@ -838,6 +838,55 @@ TEST APPLY_06(void) {
     PASS();
 }
 
+TEST CACHE_01(void) {
+    ideque_s test = create_ideque(sizeof(int));
+    cache_ideque(&test, 2);
+
+    for (int r = 0; r < 4; ++r) {
+        for (int i = 0; i < IDEQUE_CHUNK * 2; ++i) {
+            enqueue_front_ideque(&test, &i);
+            enqueue_back_ideque(&test, &i);
+        }
+
+        for (int i = IDEQUE_CHUNK * 2 - 1; i >= 0; --i) {
+            int a = 0;
+            dequeue_front_ideque(&test, &a);
+            ASSERT_EQ(i, a);
+            dequeue_back_ideque(&test, &a);
+            ASSERT_EQ(i, a);
+        }
+
+        ASSERT_EQ(2, test.spares);
+    }
+
+    destroy_ideque(&test, intdst, NULL);
+
+    PASS();
+}
+
+TEST CACHE_02(void) {
+    ideque_s test = create_ideque(sizeof(int));
+    cache_ideque(&test, 4);
+
+    for (int i = 0; i < IDEQUE_CHUNK * 4; ++i) {
+        enqueue_back_ideque(&test, &i);
+    }
+
+    clear_ideque(&test, intdst, NULL);
+    ASSERT_EQ(4, test.spares);
+
+    cache_ideque(&test, 1);
+    ASSERT_EQ(1, test.spares);
+
+    cache_ideque(&test, 0);
+    ASSERT_EQ(0, test.spares);
+    ASSERT_EQ(NULL, test.spare);
+
+    destroy_ideque(&test, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (ideque_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -854,4 +903,5 @@ SUITE (ideque_test) {
     RUN_TEST(MAP_FRONT_01); RUN_TEST(MAP_FRONT_02); RUN_TEST(MAP_FRONT_03);
     RUN_TEST(MAP_BACK_01); RUN_TEST(MAP_BACK_02); RUN_TEST(MAP_BACK_03);
     RUN_TEST(APPLY_01); RUN_TEST(APPLY_02); RUN_TEST(APPLY_03); RUN_TEST(APPLY_04); RUN_TEST(APPLY_05); RUN_TEST(APPLY_06);
+    RUN_TEST(CACHE_01); RUN_TEST(CACHE_02);
 }
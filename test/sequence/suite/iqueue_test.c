@@ -421,6 +421,52 @@ TEST APPLY_06(void) {
     PASS();
 }
 
+TEST CACHE_01(void) {
+    iqueue_s test = create_iqueue(sizeof(int));
+    cache_iqueue(&test, 2);
+
+    for (int r = 0; r < 4; ++r) {
+        for (int i = 0; i < IQUEUE_CHUNK * 4; ++i) {
+            enqueue_iqueue(&test, &i);
+        }
+
+        for (int i = 0; i < IQUEUE_CHUNK * 4; ++i) {
+            int a = 0;
+            dequeue_iqueue(&test, &a);
+            ASSERT_EQ(i, a);
+        }
+
+        ASSERT_EQ(2, test.spares);
+    }
+
+    destroy_iqueue(&test, intdst, NULL);
+
+    PASS();
+}
+
+TEST CACHE_02(void) {
+    iqueue_s test = create_iqueue(sizeof(int));
+    cache_iqueue(&test, 4);
+
+    for (int i = 0; i < IQUEUE_CHUNK * 4; ++i) {
+        enqueue_iqueue(&test, &i);
+    }
+
+    clear_iqueue(&test, intdst, NULL);
+    ASSERT_EQ(4, test.spares);
+
+    cache_iqueue(&test, 1);
+    ASSERT_EQ(1, test.spares);
+
+    cache_iqueue(&test, 0);
+    ASSERT_EQ(0, test.spares);
+    ASSERT_EQ(NULL, test.spare);
+
+    destroy_iqueue(&test, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (iqueue_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -429,4 +475,5 @@ SUITE (iqueue_test) {
     RUN_TEST(DEQUEUE_01); RUN_TEST(DEQUEUE_02); RUN_TEST(DEQUEUE_03);
     RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03);
     RUN_TEST(APPLY_01); RUN_TEST(APPLY_02); RUN_TEST(APPLY_03); RUN_TEST(APPLY_04); RUN_TEST(APPLY_05); RUN_TEST(APPLY_06);
+    RUN_TEST(CACHE_01); RUN_TEST(CACHE_02);
 }
@@ -424,6 +424,82 @@ TEST APPLY_06(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    istack_s test = create_istack(sizeof(int));
+
+    reserve_istack(&test, 100);
+    size_t const capacity = test.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        push_istack(&test, &i);
+    }
+    ASSERT_EQ(capacity, test.capacity);
+
+    destroy_istack(&test, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    istack_s test = create_istack(sizeof(int));
+
+    for (int i = 0; i < 100; ++i) {
+        push_istack(&test, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        pop_istack(&test, &a);
+    }
+
+    shrink_to_fit_istack(&test);
+    ASSERT_EQ(test.length, test.capacity);
+    for (int i = 39; i >= 0; --i) {
+        int a = -1;
+        pop_istack(&test, &a);
+        ASSERT_EQ(i, a);
+    }
+
+    destroy_istack(&test, intdst, NULL);
+
+    PASS();
+}
+
+TEST GROWTH_01(void) {
+    istack_s test = create_istack(sizeof(int));
+    growth_istack(&test, compose_growth(2, 8, 0));
+
+    for (int i = 0; i < 100; ++i) {
+        push_istack(&test, &i);
+    }
+    size_t const capacity = test.capacity;
+
+    for (int i = 0; i < 100; ++i) {
+        int a = -1;
+        pop_istack(&test, &a);
+    }
+    ASSERT_EQ(capacity, test.capacity);
+
+    destroy_istack(&test, intdst, NULL);
+
+    PASS();
+}
+
+TEST GROWTH_02(void) {
+    istack_s test = create_istack(sizeof(int));
+    growth_istack(&test, compose_growth(4, 8, 4));
+
+    for (int i = 0; i < 9; ++i) {
+        push_istack(&test, &i);
+    }
+    ASSERT_EQ(32, test.capacity);
+
+    destroy_istack(&test, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (istack_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -432,4 +508,5 @@ SUITE (istack_test) {
     RUN_TEST(POP_01); RUN_TEST(POP_02); RUN_TEST(POP_03);
     RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03);
     RUN_TEST(APPLY_01); RUN_TEST(APPLY_02); RUN_TEST(APPLY_03); RUN_TEST(APPLY_04); RUN_TEST(APPLY_05); RUN_TEST(APPLY_06);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01); RUN_TEST(GROWTH_01); RUN_TEST(GROWTH_02);
 }
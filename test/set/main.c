@@ -7,7 +7,9 @@ int main(const int argc, char **argv) {
 
     RUN_SUITE(ibitwise_set_test);
     RUN_SUITE(isc_hash_set_test);
+    RUN_SUITE(ioa_hash_set_test);
     RUN_SUITE(irb_set_test);
+    RUN_SUITE(iroaring_set_test);
 
     RUN_SUITE(fbitwise_set_test);
     RUN_SUITE(fsc_hash_set_test);
@@ -309,6 +309,44 @@ TEST UNION_06(void) {
     PASS();
 }
 
+TEST UNION_07(void) {
+    // maximums aren't word multiples, so last partial word of each set must be combined too
+    fbitwise_set_s set_one = create_fbitwise_set((FBITWISE_SET_CHUNK * 5) + 7);
+    fbitwise_set_s set_two = create_fbitwise_set((FBITWISE_SET_CHUNK * 11) + 3);
+
+    for (size_t i = 0; i < set_one.max; i += 3) {
+        insert_fbitwise_set(&set_one, i);
+    }
+    for (size_t i = 0; i < set_two.max; i += 5) {
+        insert_fbitwise_set(&set_two, i);
+    }
+    insert_fbitwise_set(&set_one, set_one.max - 1);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < set_two.max; ++i) {
+        if (contains_fbitwise_set(&set_one, i) || contains_fbitwise_set(&set_two, i)) { expected++; }
+    }
+
+    fbitwise_set_s set_union = union_fbitwise_set(&set_one, &set_two);
+    ASSERT_EQ(expected, set_union.length);
+    ASSERT_EQ(set_two.max, set_union.max);
+    ASSERT(contains_fbitwise_set(&set_union, set_one.max - 1));
+
+    fbitwise_set_s set_intersect = intersect_fbitwise_set(&set_one, &set_two);
+    fbitwise_set_s set_exclude = exclude_fbitwise_set(&set_one, &set_two);
+    ASSERT_EQ(expected, set_exclude.length + set_intersect.length);
+    ASSERT(contains_fbitwise_set(&set_intersect, 0));
+    ASSERT_FALSE(contains_fbitwise_set(&set_exclude, 0));
+
+    destroy_fbitwise_set(&set_one);
+    destroy_fbitwise_set(&set_two);
+    destroy_fbitwise_set(&set_union);
+    destroy_fbitwise_set(&set_intersect);
+    destroy_fbitwise_set(&set_exclude);
+
+    PASS();
+}
+
 TEST INTERSECT_01(void) {
     fbitwise_set_s set_one = create_fbitwise_set(FBITWISE_SET_CHUNK);
     fbitwise_set_s set_two = create_fbitwise_set(FBITWISE_SET_CHUNK);
@@ -879,6 +917,29 @@ TEST IS_SUBSET_06(void) {
     PASS();
 }
 
+TEST IS_SUBSET_07(void) {
+    fbitwise_set_s superset = create_fbitwise_set((FBITWISE_SET_CHUNK * 9) + 1);
+    fbitwise_set_s subset = create_fbitwise_set((FBITWISE_SET_CHUNK * 9) + 1);
+
+    for (size_t i = 0; i < superset.max; i += 2) {
+        insert_fbitwise_set(&superset, i);
+    }
+    for (size_t i = 0; i < subset.max; i += 4) {
+        insert_fbitwise_set(&subset, i);
+    }
+    ASSERT(is_subset_fbitwise_set(&superset, &subset));
+
+    // element in last partial word isn't in superset
+    remove_fbitwise_set(&superset, superset.max - 1);
+    ASSERT_FALSE(is_subset_fbitwise_set(&superset, &subset));
+    ASSERT_FALSE(is_disjoint_fbitwise_set(&superset, &subset));
+
+    destroy_fbitwise_set(&superset);
+    destroy_fbitwise_set(&subset);
+
+    PASS();
+}
+
 TEST IS_PROPER_SUBSET_01(void) {
     fbitwise_set_s set_one = create_fbitwise_set(FBITWISE_SET_CHUNK);
     fbitwise_set_s set_two = create_fbitwise_set(FBITWISE_SET_CHUNK);
@@ -1106,7 +1167,7 @@ SUITE (fbitwise_set_test) {
     RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_02);
     RUN_TEST(CONTAINS_01); RUN_TEST(CONTAINS_02);
     RUN_TEST(UNION_01); RUN_TEST(UNION_02); RUN_TEST(UNION_03);
-    RUN_TEST(UNION_04); RUN_TEST(UNION_05); RUN_TEST(UNION_06);
+    RUN_TEST(UNION_04); RUN_TEST(UNION_05); RUN_TEST(UNION_06); RUN_TEST(UNION_07);
     RUN_TEST(INTERSECT_01); RUN_TEST(INTERSECT_02); RUN_TEST(INTERSECT_03);
     RUN_TEST(INTERSECT_04); RUN_TEST(INTERSECT_05); RUN_TEST(INTERSECT_06);
     RUN_TEST(SUBTRACT_01); RUN_TEST(SUBTRACT_02); RUN_TEST(SUBTRACT_03);
@@ -1114,7 +1175,7 @@ SUITE (fbitwise_set_test) {
     RUN_TEST(EXCLUDE_01); RUN_TEST(EXCLUDE_02); RUN_TEST(EXCLUDE_03);
     RUN_TEST(EXCLUDE_04); RUN_TEST(EXCLUDE_05); RUN_TEST(EXCLUDE_06);
     RUN_TEST(IS_SUBSET_01); RUN_TEST(IS_SUBSET_02); RUN_TEST(IS_SUBSET_03);
-    RUN_TEST(IS_SUBSET_04); RUN_TEST(IS_SUBSET_05); RUN_TEST(IS_SUBSET_06);
+    RUN_TEST(IS_SUBSET_04); RUN_TEST(IS_SUBSET_05); RUN_TEST(IS_SUBSET_06); RUN_TEST(IS_SUBSET_07);
     RUN_TEST(IS_PROPER_SUBSET_01); RUN_TEST(IS_PROPER_SUBSET_02); RUN_TEST(IS_PROPER_SUBSET_03);
     RUN_TEST(IS_PROPER_SUBSET_04); RUN_TEST(IS_PROPER_SUBSET_05); RUN_TEST(IS_PROPER_SUBSET_06);
     RUN_TEST(IS_DISJOINT_01); RUN_TEST(IS_DISJOINT_02); RUN_TEST(IS_DISJOINT_03);
@@ -1115,6 +1115,109 @@ TEST IS_DISJOINT_06(void) {
     PASS();
 }
 
+TEST REINDEX_01(void) {
+    fsc_hash_set_s set = create_fsc_hash_set(sizeof(int), FSC_HASH_SET_CHUNK + 3, inthshsame, NULL, intcmp, NULL);
+    reindex_fsc_hash_set(&set, MASK_INDEX);
+
+    ASSERT_EQ(FSC_HASH_SET_CHUNK - 1, set.mask);
+
+    for (int i = 0; i < FSC_HASH_SET_CHUNK + 3; ++i) {
+        insert_fsc_hash_set(&set, &i);
+    }
+
+    for (int i = 0; i < FSC_HASH_SET_CHUNK + 3; ++i) {
+        ASSERT(contains_fsc_hash_set(&set, &i));
+    }
+
+    for (int i = 0; i < FSC_HASH_SET_CHUNK + 3; ++i) {
+        int buf = 0;
+        remove_fsc_hash_set(&set, &i, &buf);
+        ASSERT_EQ(i, buf);
+    }
+
+    destroy_fsc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST REINDEX_02(void) {
+    fsc_hash_set_s set_one = create_fsc_hash_set(sizeof(int), FSC_HASH_SET_CHUNK, inthshmurmur, NULL, intcmp, NULL);
+    fsc_hash_set_s set_two = create_fsc_hash_set(sizeof(int), FSC_HASH_SET_CHUNK, inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < FSC_HASH_SET_CHUNK; ++i) {
+        insert_fsc_hash_set(&set_one, &i);
+    }
+
+    for (int i = FSC_HASH_SET_CHUNK / 2; i < FSC_HASH_SET_CHUNK; ++i) {
+        insert_fsc_hash_set(&set_two, &i);
+    }
+
+    reindex_fsc_hash_set(&set_one, MASK_INDEX);
+    for (int i = 0; i < FSC_HASH_SET_CHUNK; ++i) {
+        ASSERT(contains_fsc_hash_set(&set_one, &i));
+    }
+
+    fsc_hash_set_s set_subtract = subtract_fsc_hash_set(&set_one, &set_two, intcpy, NULL);
+    ASSERT_EQ(MASK_INDEX, set_subtract.indexing);
+
+    for (int i = 0; i < FSC_HASH_SET_CHUNK; ++i) {
+        ASSERT_EQ(i < FSC_HASH_SET_CHUNK / 2, contains_fsc_hash_set(&set_subtract, &i));
+    }
+
+    reindex_fsc_hash_set(&set_one, MODULO_INDEX);
+    for (int i = 0; i < FSC_HASH_SET_CHUNK; ++i) {
+        ASSERT(contains_fsc_hash_set(&set_one, &i));
+    }
+
+    destroy_fsc_hash_set(&set_one, intdst, NULL);
+    destroy_fsc_hash_set(&set_two, intdst, NULL);
+    destroy_fsc_hash_set(&set_subtract, intdst, NULL);
+
+    PASS();
+}
+
+TEST CONTAINS_MANY_01(void) {
+    fsc_hash_set_s set = create_fsc_hash_set(sizeof(int), FSC_HASH_SET_CHUNK * 2 + 1, inthshmurmur, NULL, intcmp, NULL);
+
+    int elements[FSC_HASH_SET_CHUNK * 2 + 1];
+    for (int i = 0; i < FSC_HASH_SET_CHUNK * 2 + 1; ++i) {
+        elements[i] = i;
+        if (i % 2) { insert_fsc_hash_set(&set, &i); }
+    }
+
+    bool results[FSC_HASH_SET_CHUNK * 2 + 1];
+    contains_many_fsc_hash_set(&set, elements, FSC_HASH_SET_CHUNK * 2 + 1, results);
+
+    for (int i = 0; i < FSC_HASH_SET_CHUNK * 2 + 1; ++i) {
+        ASSERT_EQ(contains_fsc_hash_set(&set, &i), results[i]);
+        ASSERT_EQ((bool)(i % 2), results[i]);
+    }
+
+    destroy_fsc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST CONTAINS_MANY_02(void) {
+    fsc_hash_set_s set = create_fsc_hash_set(sizeof(int), FSC_HASH_SET_CHUNK * 2 + 1, inthshmurmur, NULL, intcmp, NULL);
+
+    int elements[FSC_HASH_SET_CHUNK];
+    bool results[FSC_HASH_SET_CHUNK];
+    for (int i = 0; i < FSC_HASH_SET_CHUNK; ++i) {
+        elements[i] = i;
+        results[i] = true;
+    }
+
+    contains_many_fsc_hash_set(&set, elements, FSC_HASH_SET_CHUNK, results);
+    for (int i = 0; i < FSC_HASH_SET_CHUNK; ++i) {
+        ASSERT_FALSE(results[i]);
+    }
+
+    destroy_fsc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (fsc_hash_set_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02);
@@ -1135,4 +1238,6 @@ SUITE (fsc_hash_set_test) {
     RUN_TEST(IS_PROPER_SUBSET_04); RUN_TEST(IS_PROPER_SUBSET_05); RUN_TEST(IS_PROPER_SUBSET_06);
     RUN_TEST(IS_DISJOINT_01); RUN_TEST(IS_DISJOINT_02); RUN_TEST(IS_DISJOINT_03);
     RUN_TEST(IS_DISJOINT_04); RUN_TEST(IS_DISJOINT_05); RUN_TEST(IS_DISJOINT_06);
+    RUN_TEST(REINDEX_01); RUN_TEST(REINDEX_02);
+    RUN_TEST(CONTAINS_MANY_01); RUN_TEST(CONTAINS_MANY_02);
 }
@@ -3,6 +3,9 @@
 
 #include <suite.h>
 
+#include <string.h>
+#include <limits.h>
+
 TEST CREATE_01(void) {
     ibitwise_set_s set = create_ibitwise_set();
 
@@ -440,6 +443,35 @@ TEST UNION_09(void) {
     PASS();
 }
 
+TEST UNION_10(void) {
+    ibitwise_set_s set_one = create_ibitwise_set();
+    ibitwise_set_s set_two = create_ibitwise_set();
+
+    // sets span many words so both vector and leftover word loops are used, second set is longer than first
+    size_t expected = 0;
+    for (size_t i = 0; i < (IBITWISE_SET_CHUNK * 9) + 3; ++i) {
+        if (!(i % 3)) { insert_ibitwise_set(&set_one, i); }
+    }
+    for (size_t i = 0; i < (IBITWISE_SET_CHUNK * 17) + 5; ++i) {
+        if (!(i % 5)) { insert_ibitwise_set(&set_two, i); }
+        if (contains_ibitwise_set(&set_one, i) || contains_ibitwise_set(&set_two, i)) { expected++; }
+    }
+
+    ibitwise_set_s set_union = union_ibitwise_set(&set_one, &set_two);
+    ASSERT_EQ(expected, set_union.length);
+    ASSERT_EQ(set_two.capacity, set_union.capacity);
+
+    for (size_t i = 0; i < set_union.capacity; ++i) {
+        ASSERT_EQ(contains_ibitwise_set(&set_one, i) || contains_ibitwise_set(&set_two, i), contains_ibitwise_set(&set_union, i));
+    }
+
+    destroy_ibitwise_set(&set_one);
+    destroy_ibitwise_set(&set_two);
+    destroy_ibitwise_set(&set_union);
+
+    PASS();
+}
+
 TEST INTERSECT_01(void) {
     ibitwise_set_s set_one = create_ibitwise_set();
     ibitwise_set_s set_two = create_ibitwise_set();
@@ -680,6 +712,33 @@ TEST INTERSECT_09(void) {
     PASS();
 }
 
+TEST INTERSECT_10(void) {
+    ibitwise_set_s set_one = create_ibitwise_set();
+    ibitwise_set_s set_two = create_ibitwise_set();
+
+    // sets only share elements in first chunk, so intersection is trimmed to it
+    size_t expected = 0;
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 9; ++i) {
+        if (!(i % 3)) { insert_ibitwise_set(&set_one, i); }
+        if (!(i % 2) && (i < IBITWISE_SET_CHUNK || (i % 3))) { insert_ibitwise_set(&set_two, i); }
+        if (i < IBITWISE_SET_CHUNK && !(i % 6)) { expected++; }
+    }
+
+    ibitwise_set_s set_intersect = intersect_ibitwise_set(&set_one, &set_two);
+    ASSERT_EQ(expected, set_intersect.length);
+    ASSERT_EQ(IBITWISE_SET_CHUNK, set_intersect.capacity);
+
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK; ++i) {
+        ASSERT_EQ(!(i % 6), contains_ibitwise_set(&set_intersect, i));
+    }
+
+    destroy_ibitwise_set(&set_one);
+    destroy_ibitwise_set(&set_two);
+    destroy_ibitwise_set(&set_intersect);
+
+    PASS();
+}
+
 TEST SUBTRACT_01(void) {
     ibitwise_set_s set_one = create_ibitwise_set();
     ibitwise_set_s set_two = create_ibitwise_set();
@@ -908,6 +967,32 @@ TEST SUBTRACT_09(void) {
     PASS();
 }
 
+TEST SUBTRACT_10(void) {
+    ibitwise_set_s minuend = create_ibitwise_set();
+    ibitwise_set_s subtrahend = create_ibitwise_set();
+
+    // minuend is longer than subtrahend, so its words beyond subtrahend are kept and counted
+    size_t expected = 0;
+    for (size_t i = 0; i < (IBITWISE_SET_CHUNK * 13) + 1; ++i) {
+        if (!(i % 3)) { insert_ibitwise_set(&minuend, i); }
+        if (i < IBITWISE_SET_CHUNK * 5 && !(i % 2)) { insert_ibitwise_set(&subtrahend, i); }
+        if (!(i % 3) && (i >= IBITWISE_SET_CHUNK * 5 || (i % 2))) { expected++; }
+    }
+
+    ibitwise_set_s set_subtract = subtract_ibitwise_set(&minuend, &subtrahend);
+    ASSERT_EQ(expected, set_subtract.length);
+
+    for (size_t i = 0; i < minuend.capacity; ++i) {
+        ASSERT_EQ(contains_ibitwise_set(&minuend, i) && !contains_ibitwise_set(&subtrahend, i), contains_ibitwise_set(&set_subtract, i));
+    }
+
+    destroy_ibitwise_set(&minuend);
+    destroy_ibitwise_set(&subtrahend);
+    destroy_ibitwise_set(&set_subtract);
+
+    PASS();
+}
+
 TEST EXCLUDE_01(void) {
     ibitwise_set_s set_one = create_ibitwise_set();
     ibitwise_set_s set_two = create_ibitwise_set();
@@ -1136,6 +1221,36 @@ TEST EXCLUDE_09(void) {
     PASS();
 }
 
+TEST EXCLUDE_10(void) {
+    ibitwise_set_s set_one = create_ibitwise_set();
+    ibitwise_set_s set_two = create_ibitwise_set();
+
+    // equal last chunks cancel out, so exclusion counts remaining elements and is trimmed
+    size_t expected = 0;
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 11; ++i) {
+        bool const last = i >= IBITWISE_SET_CHUNK * 7;
+        if ((!last && !(i % 3)) || (last && !(i % 2))) { insert_ibitwise_set(&set_one, i); }
+        if ((!last && !(i % 5)) || (last && !(i % 2))) { insert_ibitwise_set(&set_two, i); }
+    }
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 11; ++i) {
+        if (contains_ibitwise_set(&set_one, i) != contains_ibitwise_set(&set_two, i)) { expected++; }
+    }
+
+    ibitwise_set_s set_exclude = exclude_ibitwise_set(&set_one, &set_two);
+    ASSERT_EQ(expected, set_exclude.length);
+    ASSERT(set_exclude.capacity < set_one.capacity);
+
+    for (size_t i = 0; i < set_one.capacity; ++i) {
+        ASSERT_EQ(contains_ibitwise_set(&set_one, i) != contains_ibitwise_set(&set_two, i), contains_ibitwise_set(&set_exclude, i));
+    }
+
+    destroy_ibitwise_set(&set_one);
+    destroy_ibitwise_set(&set_two);
+    destroy_ibitwise_set(&set_exclude);
+
+    PASS();
+}
+
 TEST IS_SUBSET_01(void) {
     ibitwise_set_s set_one = create_ibitwise_set();
     ibitwise_set_s set_two = create_ibitwise_set();
@@ -1295,6 +1410,27 @@ TEST IS_SUBSET_09(void) {
     PASS();
 }
 
+TEST IS_SUBSET_10(void) {
+    ibitwise_set_s superset = create_ibitwise_set();
+    ibitwise_set_s subset = create_ibitwise_set();
+
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 9; ++i) {
+        if (!(i % 2)) { insert_ibitwise_set(&superset, i); }
+        if (!(i % 4)) { insert_ibitwise_set(&subset, i); }
+    }
+    ASSERT(is_subset_ibitwise_set(&superset, &subset));
+    ASSERT_FALSE(is_disjoint_ibitwise_set(&superset, &subset));
+
+    // single element in last word breaks subset
+    insert_ibitwise_set(&subset, (IBITWISE_SET_CHUNK * 9) - 1);
+    ASSERT_FALSE(is_subset_ibitwise_set(&superset, &subset));
+
+    destroy_ibitwise_set(&superset);
+    destroy_ibitwise_set(&subset);
+
+    PASS();
+}
+
 TEST IS_PROPER_SUBSET_01(void) {
     ibitwise_set_s set_one = create_ibitwise_set();
     ibitwise_set_s set_two = create_ibitwise_set();
@@ -1625,6 +1761,449 @@ TEST IS_DISJOINT_09(void) {
     PASS();
 }
 
+TEST REMOVE_04(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+
+    insert_ibitwise_set(&set, 0);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK * 2);
+    remove_ibitwise_set(&set, IBITWISE_SET_CHUNK * 2);
+
+    ASSERT_EQ(IBITWISE_SET_CHUNK, set.capacity);
+    ASSERT(contains_ibitwise_set(&set, 0));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST RESERVE_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+
+    reserve_ibitwise_set(&set, IBITWISE_SET_CHUNK * 2 + 1);
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 3, set.capacity);
+
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 3; ++i) {
+        insert_ibitwise_set(&set, i);
+    }
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 3, set.capacity);
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+
+    reserve_ibitwise_set(&set, IBITWISE_SET_CHUNK * 4);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK);
+
+    shrink_to_fit_ibitwise_set(&set);
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 2, set.capacity);
+    ASSERT(contains_ibitwise_set(&set, IBITWISE_SET_CHUNK));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+/// @brief Inserts every multiple of step below end into structure.
+void _ibitwise_fill(ibitwise_set_s * const set, size_t const step, size_t const end) {
+    for (size_t i = 0; i < end; i += step) {
+        insert_ibitwise_set(set, i);
+    }
+}
+
+/// @brief Checks if structures have the same elements, length and capacity.
+bool _ibitwise_same(ibitwise_set_s const * const one, ibitwise_set_s const * const two) {
+    return one->length == two->length && one->capacity == two->capacity &&
+        (!one->capacity || !memcmp(one->bits, two->bits, one->capacity / CHAR_BIT));
+}
+
+TEST UNION_INTO_01(void) {
+    ibitwise_set_s set_one = create_ibitwise_set();
+    ibitwise_set_s set_two = create_ibitwise_set();
+    _ibitwise_fill(&set_one, 3, IBITWISE_SET_CHUNK * 5);
+    _ibitwise_fill(&set_two, 7, IBITWISE_SET_CHUNK * 12);
+
+    // destination is expanded to fit larger source
+    ibitwise_set_s set_union = union_ibitwise_set(&set_one, &set_two);
+    union_into_ibitwise_set(&set_one, &set_two);
+    ASSERT(_ibitwise_same(&set_union, &set_one));
+
+    // union with itself changes nothing
+    union_into_ibitwise_set(&set_one, &set_one);
+    ASSERT(_ibitwise_same(&set_union, &set_one));
+
+    destroy_ibitwise_set(&set_one);
+    destroy_ibitwise_set(&set_two);
+    destroy_ibitwise_set(&set_union);
+
+    PASS();
+}
+
+TEST INTERSECT_INTO_01(void) {
+    ibitwise_set_s set_one = create_ibitwise_set();
+    ibitwise_set_s set_two = create_ibitwise_set();
+    _ibitwise_fill(&set_one, 3, IBITWISE_SET_CHUNK * 12);
+    _ibitwise_fill(&set_two, 2, IBITWISE_SET_CHUNK * 5);
+
+    // destination is trimmed to smaller source
+    ibitwise_set_s set_intersect = intersect_ibitwise_set(&set_one, &set_two);
+    intersect_into_ibitwise_set(&set_one, &set_two);
+    ASSERT(_ibitwise_same(&set_intersect, &set_one));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 5, set_one.capacity);
+
+    destroy_ibitwise_set(&set_one);
+    destroy_ibitwise_set(&set_two);
+    destroy_ibitwise_set(&set_intersect);
+
+    PASS();
+}
+
+TEST SUBTRACT_INTO_01(void) {
+    ibitwise_set_s minuend = create_ibitwise_set();
+    ibitwise_set_s subtrahend = create_ibitwise_set();
+    _ibitwise_fill(&minuend, 3, IBITWISE_SET_CHUNK * 9);
+    _ibitwise_fill(&subtrahend, 2, IBITWISE_SET_CHUNK * 13);
+
+    ibitwise_set_s set_subtract = subtract_ibitwise_set(&minuend, &subtrahend);
+    subtract_into_ibitwise_set(&minuend, &subtrahend);
+    ASSERT(_ibitwise_same(&set_subtract, &minuend));
+
+    // subtracting structure from itself empties it
+    subtract_into_ibitwise_set(&minuend, &minuend);
+    ASSERT(is_empty_ibitwise_set(&minuend));
+    ASSERT_EQ(0, minuend.capacity);
+
+    destroy_ibitwise_set(&minuend);
+    destroy_ibitwise_set(&subtrahend);
+    destroy_ibitwise_set(&set_subtract);
+
+    PASS();
+}
+
+TEST EXCLUDE_INTO_01(void) {
+    ibitwise_set_s set_one = create_ibitwise_set();
+    ibitwise_set_s set_two = create_ibitwise_set();
+    _ibitwise_fill(&set_one, 3, IBITWISE_SET_CHUNK * 4);
+    _ibitwise_fill(&set_two, 5, IBITWISE_SET_CHUNK * 10);
+
+    ibitwise_set_s set_exclude = exclude_ibitwise_set(&set_one, &set_two);
+    exclude_into_ibitwise_set(&set_one, &set_two);
+    ASSERT(_ibitwise_same(&set_exclude, &set_one));
+
+    // excluding same structure again restores first one's elements only
+    exclude_into_ibitwise_set(&set_one, &set_two);
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 10; ++i) {
+        ASSERT_EQ(i < IBITWISE_SET_CHUNK * 4 && !(i % 3), contains_ibitwise_set(&set_one, i));
+    }
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 4, set_one.capacity);
+
+    destroy_ibitwise_set(&set_one);
+    destroy_ibitwise_set(&set_two);
+    destroy_ibitwise_set(&set_exclude);
+
+    PASS();
+}
+
+TEST UNION_ALL_01(void) {
+    ibitwise_set_s sets[5] = { 0 };
+    for (size_t i = 0; i < 5; ++i) {
+        sets[i] = create_ibitwise_set();
+        _ibitwise_fill(sets + i, i + 2, IBITWISE_SET_CHUNK * (3 + (i * 20)));
+    }
+
+    // pairwise fold of unions must equal single pass union
+    ibitwise_set_s fold = copy_ibitwise_set(sets);
+    for (size_t i = 1; i < 5; ++i) {
+        union_into_ibitwise_set(&fold, sets + i);
+    }
+
+    ibitwise_set_s set_union = union_all_ibitwise_set(sets, 5);
+    ASSERT(_ibitwise_same(&fold, &set_union));
+
+    for (size_t i = 0; i < 5; ++i) {
+        destroy_ibitwise_set(sets + i);
+    }
+    destroy_ibitwise_set(&fold);
+    destroy_ibitwise_set(&set_union);
+
+    PASS();
+}
+
+TEST INTERSECT_ALL_01(void) {
+    ibitwise_set_s sets[5] = { 0 };
+    for (size_t i = 0; i < 5; ++i) {
+        sets[i] = create_ibitwise_set();
+        _ibitwise_fill(sets + i, (i % 2) + 2, IBITWISE_SET_CHUNK * (90 - (i * 10)));
+    }
+
+    ibitwise_set_s fold = copy_ibitwise_set(sets);
+    for (size_t i = 1; i < 5; ++i) {
+        intersect_into_ibitwise_set(&fold, sets + i);
+    }
+
+    ibitwise_set_s set_intersect = intersect_all_ibitwise_set(sets, 5);
+    ASSERT(_ibitwise_same(&fold, &set_intersect));
+
+    // single structure is copied
+    ibitwise_set_s single = intersect_all_ibitwise_set(sets + 4, 1);
+    ASSERT(_ibitwise_same(sets + 4, &single));
+
+    for (size_t i = 0; i < 5; ++i) {
+        destroy_ibitwise_set(sets + i);
+    }
+    destroy_ibitwise_set(&fold);
+    destroy_ibitwise_set(&set_intersect);
+    destroy_ibitwise_set(&single);
+
+    PASS();
+}
+
+TEST INTERSECT_ALL_02(void) {
+    ibitwise_set_s sets[3] = { create_ibitwise_set(), create_ibitwise_set(), create_ibitwise_set(), };
+
+    // first two structures are disjoint, so third one never changes the empty result
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 8; ++i) {
+        insert_ibitwise_set(sets + (i % 2), i);
+        insert_ibitwise_set(sets + 2, i);
+    }
+
+    ibitwise_set_s set_intersect = intersect_all_ibitwise_set(sets, 3);
+    ASSERT(is_empty_ibitwise_set(&set_intersect));
+    ASSERT_EQ(0, set_intersect.capacity);
+
+    for (size_t i = 0; i < 3; ++i) {
+        destroy_ibitwise_set(sets + i);
+    }
+    destroy_ibitwise_set(&set_intersect);
+
+    PASS();
+}
+
+TEST RANK_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    _ibitwise_fill(&set, 3, IBITWISE_SET_CHUNK * 20);
+
+    // every third index is an element, so rank is number of multiples of three below index
+    for (size_t i = 0; i < IBITWISE_SET_CHUNK * 20; ++i) {
+        ASSERT_EQ((i + 2) / 3, rank_ibitwise_set(&set, i));
+    }
+    ASSERT_EQ(set.length, rank_ibitwise_set(&set, IBITWISE_SET_CHUNK * 100));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST RANK_02(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    ASSERT_EQ(0, rank_ibitwise_set(&set, 42));
+
+    _ibitwise_fill(&set, 2, IBITWISE_SET_CHUNK * 10);
+    ASSERT_EQ(5, rank_ibitwise_set(&set, 10));
+
+    // index is rebuilt after structure changes
+    remove_ibitwise_set(&set, 4);
+    ASSERT_EQ(4, rank_ibitwise_set(&set, 10));
+    insert_ibitwise_set(&set, 1);
+    ASSERT_EQ(5, rank_ibitwise_set(&set, 10));
+
+    ibitwise_set_s other = create_ibitwise_set();
+    insert_ibitwise_set(&other, 3);
+    union_into_ibitwise_set(&set, &other);
+    ASSERT_EQ(6, rank_ibitwise_set(&set, 10));
+
+    destroy_ibitwise_set(&set);
+    destroy_ibitwise_set(&other);
+
+    PASS();
+}
+
+TEST SELECT_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    _ibitwise_fill(&set, 7, IBITWISE_SET_CHUNK * 30);
+
+    for (size_t i = 0; i < set.length; ++i) {
+        ASSERT_EQ(i * 7, select_ibitwise_set(&set, i));
+        ASSERT_EQ(i, rank_ibitwise_set(&set, select_ibitwise_set(&set, i)));
+    }
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST SELECT_02(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+
+    // elements far apart leave empty rank blocks between them
+    insert_ibitwise_set(&set, 5);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK * 50);
+    insert_ibitwise_set(&set, (IBITWISE_SET_CHUNK * 50) + 63);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK * 99);
+
+    ASSERT_EQ(5, select_ibitwise_set(&set, 0));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 50, select_ibitwise_set(&set, 1));
+    ASSERT_EQ((IBITWISE_SET_CHUNK * 50) + 63, select_ibitwise_set(&set, 2));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 99, select_ibitwise_set(&set, 3));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST NEXT_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    ASSERT_EQ(IBITWISE_SPECIAL, next_ibitwise_set(&set, 0));
+
+    insert_ibitwise_set(&set, 5);
+    insert_ibitwise_set(&set, 63);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK * 40);
+
+    ASSERT_EQ(5, next_ibitwise_set(&set, 0));
+    ASSERT_EQ(5, next_ibitwise_set(&set, 5));
+    ASSERT_EQ(63, next_ibitwise_set(&set, 6));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 40, next_ibitwise_set(&set, 64));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 40, next_ibitwise_set(&set, IBITWISE_SET_CHUNK * 40));
+    ASSERT_EQ(IBITWISE_SPECIAL, next_ibitwise_set(&set, (IBITWISE_SET_CHUNK * 40) + 1));
+    ASSERT_EQ(IBITWISE_SPECIAL, next_ibitwise_set(&set, IBITWISE_SET_CHUNK * 100));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST PREV_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    ASSERT_EQ(IBITWISE_SPECIAL, prev_ibitwise_set(&set, 10));
+
+    insert_ibitwise_set(&set, 5);
+    insert_ibitwise_set(&set, 64);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK * 40);
+
+    ASSERT_EQ(IBITWISE_SPECIAL, prev_ibitwise_set(&set, 4));
+    ASSERT_EQ(5, prev_ibitwise_set(&set, 5));
+    ASSERT_EQ(5, prev_ibitwise_set(&set, 63));
+    ASSERT_EQ(64, prev_ibitwise_set(&set, 64));
+    ASSERT_EQ(64, prev_ibitwise_set(&set, (IBITWISE_SET_CHUNK * 40) - 1));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 40, prev_ibitwise_set(&set, IBITWISE_SET_CHUNK * 40));
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 40, prev_ibitwise_set(&set, IBITWISE_SET_CHUNK * 100));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST INSERT_RANGE_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+
+    // range inside a single word
+    insert_range_ibitwise_set(&set, 3, 9);
+    ASSERT_EQ(6, set.length);
+    ASSERT_FALSE(contains_ibitwise_set(&set, 2));
+    for (size_t i = 3; i < 9; ++i) {
+        ASSERT(contains_ibitwise_set(&set, i));
+    }
+    ASSERT_FALSE(contains_ibitwise_set(&set, 9));
+
+    // range over many words that overlaps existing elements only adds missing ones
+    insert_ibitwise_set(&set, 500);
+    insert_range_ibitwise_set(&set, 5, IBITWISE_SET_CHUNK * 10 + 7);
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 10 + 7 - 3, set.length);
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 11, set.capacity);
+    for (size_t i = 3; i < IBITWISE_SET_CHUNK * 10 + 7; ++i) {
+        ASSERT(contains_ibitwise_set(&set, i));
+    }
+    ASSERT_FALSE(contains_ibitwise_set(&set, IBITWISE_SET_CHUNK * 10 + 7));
+
+    // empty range changes nothing
+    insert_range_ibitwise_set(&set, IBITWISE_SET_CHUNK * 20, IBITWISE_SET_CHUNK * 20);
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 11, set.capacity);
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST REMOVE_RANGE_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    insert_range_ibitwise_set(&set, 0, IBITWISE_SET_CHUNK * 10);
+
+    remove_range_ibitwise_set(&set, 70, 130);
+    ASSERT_EQ(IBITWISE_SET_CHUNK * 10 - 60, set.length);
+    ASSERT(contains_ibitwise_set(&set, 69));
+    ASSERT_FALSE(contains_ibitwise_set(&set, 70));
+    ASSERT_FALSE(contains_ibitwise_set(&set, 129));
+    ASSERT(contains_ibitwise_set(&set, 130));
+
+    // removing overlapping range only removes contained elements and trims empty trailing chunks
+    remove_range_ibitwise_set(&set, 100, IBITWISE_SET_CHUNK * 50);
+    ASSERT_EQ(70, set.length);
+    ASSERT_EQ(((69 / IBITWISE_SET_CHUNK) + 1) * IBITWISE_SET_CHUNK, set.capacity);
+
+    remove_range_ibitwise_set(&set, 0, IBITWISE_SET_CHUNK * 50);
+    ASSERT(is_empty_ibitwise_set(&set));
+    ASSERT_EQ(0, set.capacity);
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+TEST CONTAINS_RANGE_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    ASSERT(contains_range_ibitwise_set(&set, 5, 5));
+    ASSERT_FALSE(contains_range_ibitwise_set(&set, 5, 6));
+
+    insert_range_ibitwise_set(&set, 10, IBITWISE_SET_CHUNK * 4);
+    ASSERT(contains_range_ibitwise_set(&set, 10, IBITWISE_SET_CHUNK * 4));
+    ASSERT(contains_range_ibitwise_set(&set, 64, 128));
+    ASSERT_FALSE(contains_range_ibitwise_set(&set, 9, 20));
+    ASSERT_FALSE(contains_range_ibitwise_set(&set, 10, IBITWISE_SET_CHUNK * 4 + 1));
+
+    remove_ibitwise_set(&set, 200);
+    ASSERT_FALSE(contains_range_ibitwise_set(&set, 10, IBITWISE_SET_CHUNK * 4));
+    ASSERT(contains_range_ibitwise_set(&set, 10, 200));
+    ASSERT(contains_range_ibitwise_set(&set, 201, IBITWISE_SET_CHUNK * 4));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
+/// @brief Saves each run into array of runs and counts them.
+bool _ibitwise_run(void * const element, void * const runs) {
+    size_t * const array = runs;
+    size_t const * const run = element;
+
+    array[2 * array[0] + 1] = run[0];
+    array[2 * array[0] + 2] = run[1];
+    array[0]++;
+
+    return true;
+}
+
+TEST EACH_RUN_01(void) {
+    ibitwise_set_s set = create_ibitwise_set();
+    insert_ibitwise_set(&set, 0);
+    insert_range_ibitwise_set(&set, 60, 70);
+    insert_range_ibitwise_set(&set, 128, 192);
+    insert_ibitwise_set(&set, IBITWISE_SET_CHUNK * 10 - 1);
+
+    // first element is count of runs, followed by start and end pairs
+    size_t runs[9] = { 0 };
+    each_run_ibitwise_set(&set, _ibitwise_run, runs);
+
+    size_t const expected[9] = { 4, 0, 1, 60, 70, 128, 192, IBITWISE_SET_CHUNK * 10 - 1, IBITWISE_SET_CHUNK * 10, };
+    ASSERT_MEM_EQ(expected, runs, sizeof(expected));
+
+    destroy_ibitwise_set(&set);
+
+    PASS();
+}
+
 SUITE (ibitwise_set_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -1633,23 +2212,30 @@ SUITE (ibitwise_set_test) {
     RUN_TEST(CONTAINS_01); RUN_TEST(CONTAINS_02); RUN_TEST(CONTAINS_03);
     RUN_TEST(UNION_01); RUN_TEST(UNION_02); RUN_TEST(UNION_03);
     RUN_TEST(UNION_04); RUN_TEST(UNION_05); RUN_TEST(UNION_06);
-    RUN_TEST(UNION_07); RUN_TEST(UNION_08); RUN_TEST(UNION_09);
+    RUN_TEST(UNION_07); RUN_TEST(UNION_08); RUN_TEST(UNION_09); RUN_TEST(UNION_10);
     RUN_TEST(INTERSECT_01); RUN_TEST(INTERSECT_02); RUN_TEST(INTERSECT_03);
     RUN_TEST(INTERSECT_04); RUN_TEST(INTERSECT_05); RUN_TEST(INTERSECT_06);
-    RUN_TEST(INTERSECT_07); RUN_TEST(INTERSECT_08); RUN_TEST(INTERSECT_09);
+    RUN_TEST(INTERSECT_07); RUN_TEST(INTERSECT_08); RUN_TEST(INTERSECT_09); RUN_TEST(INTERSECT_10);
     RUN_TEST(SUBTRACT_01); RUN_TEST(SUBTRACT_02); RUN_TEST(SUBTRACT_03);
     RUN_TEST(SUBTRACT_04); RUN_TEST(SUBTRACT_05); RUN_TEST(SUBTRACT_06);
-    RUN_TEST(SUBTRACT_07); RUN_TEST(SUBTRACT_08); RUN_TEST(SUBTRACT_09);
+    RUN_TEST(SUBTRACT_07); RUN_TEST(SUBTRACT_08); RUN_TEST(SUBTRACT_09); RUN_TEST(SUBTRACT_10);
     RUN_TEST(EXCLUDE_01); RUN_TEST(EXCLUDE_02); RUN_TEST(EXCLUDE_03);
     RUN_TEST(EXCLUDE_04); RUN_TEST(EXCLUDE_05); RUN_TEST(EXCLUDE_06);
-    RUN_TEST(EXCLUDE_07); RUN_TEST(EXCLUDE_08); RUN_TEST(EXCLUDE_09);
+    RUN_TEST(EXCLUDE_07); RUN_TEST(EXCLUDE_08); RUN_TEST(EXCLUDE_09); RUN_TEST(EXCLUDE_10);
     RUN_TEST(IS_SUBSET_01); RUN_TEST(IS_SUBSET_02); RUN_TEST(IS_SUBSET_03);
     RUN_TEST(IS_SUBSET_04); RUN_TEST(IS_SUBSET_05); RUN_TEST(IS_SUBSET_06);
-    RUN_TEST(IS_SUBSET_07); RUN_TEST(IS_SUBSET_08); RUN_TEST(IS_SUBSET_09);
+    RUN_TEST(IS_SUBSET_07); RUN_TEST(IS_SUBSET_08); RUN_TEST(IS_SUBSET_09); RUN_TEST(IS_SUBSET_10);
     RUN_TEST(IS_PROPER_SUBSET_01); RUN_TEST(IS_PROPER_SUBSET_02); RUN_TEST(IS_PROPER_SUBSET_03);
     RUN_TEST(IS_PROPER_SUBSET_04); RUN_TEST(IS_PROPER_SUBSET_05); RUN_TEST(IS_PROPER_SUBSET_06);
     RUN_TEST(IS_PROPER_SUBSET_07); RUN_TEST(IS_PROPER_SUBSET_08); RUN_TEST(IS_PROPER_SUBSET_09);
     RUN_TEST(IS_DISJOINT_01); RUN_TEST(IS_DISJOINT_02); RUN_TEST(IS_DISJOINT_03);
     RUN_TEST(IS_DISJOINT_04); RUN_TEST(IS_DISJOINT_05); RUN_TEST(IS_DISJOINT_06);
     RUN_TEST(IS_DISJOINT_07); RUN_TEST(IS_DISJOINT_08); RUN_TEST(IS_DISJOINT_09);
+    RUN_TEST(REMOVE_04);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(UNION_INTO_01); RUN_TEST(INTERSECT_INTO_01); RUN_TEST(SUBTRACT_INTO_01); RUN_TEST(EXCLUDE_INTO_01);
+    RUN_TEST(UNION_ALL_01); RUN_TEST(INTERSECT_ALL_01); RUN_TEST(INTERSECT_ALL_02);
+    RUN_TEST(RANK_01); RUN_TEST(RANK_02); RUN_TEST(SELECT_01); RUN_TEST(SELECT_02);
+    RUN_TEST(NEXT_01); RUN_TEST(PREV_01);
+    RUN_TEST(INSERT_RANGE_01); RUN_TEST(REMOVE_RANGE_01); RUN_TEST(CONTAINS_RANGE_01); RUN_TEST(EACH_RUN_01);
 }
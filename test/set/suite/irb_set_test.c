@@ -1644,6 +1644,66 @@ TEST IS_DISJOINT_09(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    irb_set_s set = create_irb_set(sizeof(int), intcmp, NULL);
+
+    reserve_irb_set(&set, 100);
+    size_t const capacity = set.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_irb_set(&set, &i);
+    }
+    ASSERT_EQ(capacity, set.capacity);
+
+    destroy_irb_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    irb_set_s set = create_irb_set(sizeof(int), intcmp, NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_irb_set(&set, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        remove_irb_set(&set, &i, &a);
+    }
+
+    shrink_to_fit_irb_set(&set);
+    ASSERT_EQ(set.length, set.capacity);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i >= 60, contains_irb_set(&set, &i));
+    }
+
+    destroy_irb_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST EACH_01(void) {
+    irb_set_s set = create_irb_set(sizeof(int), intcmp, NULL);
+
+    for (int i = 0; i < IRB_SET_CHUNK; ++i) {
+        insert_irb_set(&set, &i);
+    }
+
+    int value = 1;
+    each_irb_set(&set, intincrement, &value);
+
+    for (int i = 0; i < IRB_SET_CHUNK; ++i) {
+        int const a = i + value;
+        ASSERT(contains_irb_set(&set, &a));
+    }
+
+    destroy_irb_set(&set, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (irb_set_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -1671,4 +1731,6 @@ SUITE (irb_set_test) {
     RUN_TEST(IS_DISJOINT_01); RUN_TEST(IS_DISJOINT_02); RUN_TEST(IS_DISJOINT_03);
     RUN_TEST(IS_DISJOINT_04); RUN_TEST(IS_DISJOINT_05); RUN_TEST(IS_DISJOINT_06);
     RUN_TEST(IS_DISJOINT_07); RUN_TEST(IS_DISJOINT_08); RUN_TEST(IS_DISJOINT_09);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(EACH_01);
 }
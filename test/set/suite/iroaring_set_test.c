@@ -0,0 +1,501 @@
+#include <set/iroaring_set.h>
+#include <set/ibitwise_set.h>
+
+#include <suite.h>
+
+/// @brief Inserts every step-th index in range into both roaring and reference structure.
+void _iroaring_fill(iroaring_set_s * const set, ibitwise_set_s * const reference, size_t const start, size_t const step, size_t const end) {
+    for (size_t i = start; i < end; i += step) {
+        insert_iroaring_set(set, i);
+        insert_ibitwise_set(reference, i);
+    }
+}
+
+/// @brief Compares iterated roaring structure's indexes with reference structure.
+struct iroaring_compare {
+    ibitwise_set_s const * reference;
+    size_t count, next; // number of iterated indexes and smallest index that may come next
+    bool same;
+};
+
+/// @brief Continues iterating while indexes are ascending and contained in reference structure.
+bool _iroaring_compare(void * const element, void * const compare) {
+    struct iroaring_compare * const c = compare;
+    size_t const index = *(size_t *)(element);
+
+    c->same = c->same && index >= c->next && contains_ibitwise_set(c->reference, index);
+    c->next = index + 1;
+    c->count++;
+
+    return c->same;
+}
+
+/// @brief Checks if roaring structure has the same elements as reference structure.
+bool _iroaring_same(iroaring_set_s const * const set, ibitwise_set_s const * const reference) {
+    struct iroaring_compare compare = { .reference = reference, .same = true, };
+    each_index_iroaring_set(set, _iroaring_compare, &compare);
+
+    return compare.same && compare.count == reference->length && set->length == reference->length;
+}
+
+/// @brief Builds two structures where each shared key is encoded differently in each of them.
+void _iroaring_mixed(iroaring_set_s * const one, ibitwise_set_s * const one_reference, iroaring_set_s * const two, ibitwise_set_s * const two_reference) {
+    // first structure has a bitmap, an array and a run, with last key missing
+    _iroaring_fill(one, one_reference, 0, 2, IROARING_SET_SPAN);
+    _iroaring_fill(one, one_reference, IROARING_SET_SPAN, 100, 2 * IROARING_SET_SPAN);
+    _iroaring_fill(one, one_reference, (2 * IROARING_SET_SPAN) + 1000, 1, (2 * IROARING_SET_SPAN) + 31000);
+    shrink_to_fit_iroaring_set(one);
+
+    // second structure has an array, two bitmaps and an array
+    _iroaring_fill(two, two_reference, 0, 50, IROARING_SET_SPAN);
+    _iroaring_fill(two, two_reference, IROARING_SET_SPAN, 3, 2 * IROARING_SET_SPAN);
+    _iroaring_fill(two, two_reference, 2 * IROARING_SET_SPAN, 5, 3 * IROARING_SET_SPAN);
+    _iroaring_fill(two, two_reference, 3 * IROARING_SET_SPAN, 7, (3 * IROARING_SET_SPAN) + 1000);
+}
+
+TEST CREATE_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+
+    ASSERT_EQ(0, set.length);
+    ASSERT_EQ(0, set.count);
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+    insert_iroaring_set(&set, 42);
+
+    destroy_iroaring_set(&set);
+
+    ASSERT_EQ(0, set.length);
+    ASSERT_EQ(NULL, set.containers);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+    for (size_t i = 0; i < IROARING_SET_SPAN * 3; i += 11) {
+        insert_iroaring_set(&set, i);
+    }
+
+    clear_iroaring_set(&set);
+
+    ASSERT(is_empty_iroaring_set(&set));
+    ASSERT_EQ(0, set.count);
+
+    // structure remains usable
+    insert_iroaring_set(&set, 7);
+    ASSERT(contains_iroaring_set(&set, 7));
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+
+    // far apart indexes only take a small container each
+    insert_iroaring_set(&set, 5);
+    insert_iroaring_set(&set, 4000000000u);
+
+    ASSERT_EQ(2, set.length);
+    ASSERT_EQ(2, set.count);
+    ASSERT_EQ(ARRAY_IROARING, set.containers[0].type);
+    ASSERT_EQ(ARRAY_IROARING, set.containers[1].type);
+
+    ASSERT(contains_iroaring_set(&set, 5));
+    ASSERT(contains_iroaring_set(&set, 4000000000u));
+    ASSERT_FALSE(contains_iroaring_set(&set, 6));
+    ASSERT_FALSE(contains_iroaring_set(&set, 4000000001u));
+    ASSERT_FALSE(contains_iroaring_set(&set, IROARING_SET_SPAN + 5));
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    iroaring_set_s set = create_iroaring_set();
+
+    // array turns into bitmap once it has more than 'IROARING_SET_ARRAY' values
+    for (size_t i = 0; i < IROARING_SET_ARRAY; ++i) {
+        insert_iroaring_set(&set, i * 2);
+    }
+    ASSERT_EQ(ARRAY_IROARING, set.containers[0].type);
+
+    insert_iroaring_set(&set, 1);
+    ASSERT_EQ(BITMAP_IROARING, set.containers[0].type);
+    ASSERT_EQ(IROARING_SET_ARRAY + 1, set.containers[0].cardinality);
+
+    for (size_t i = 0; i < IROARING_SET_ARRAY; ++i) {
+        ASSERT(contains_iroaring_set(&set, i * 2));
+        ASSERT_FALSE(contains_iroaring_set(&set, (i * 2) + 3));
+    }
+    ASSERT(contains_iroaring_set(&set, 1));
+
+    // and back into array once it fits into one
+    remove_iroaring_set(&set, 1);
+    ASSERT_EQ(ARRAY_IROARING, set.containers[0].type);
+    for (size_t i = 0; i < IROARING_SET_ARRAY; ++i) {
+        ASSERT(contains_iroaring_set(&set, i * 2));
+    }
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST INSERT_03(void) {
+    iroaring_set_s set = create_iroaring_set();
+
+    // containers are kept sorted by key no matter the insertion order
+    for (size_t i = 10; i > 0; --i) {
+        insert_iroaring_set(&set, (i * IROARING_SET_SPAN) + i);
+    }
+
+    ASSERT_EQ(10, set.count);
+    for (size_t i = 1; i < set.count; ++i) {
+        ASSERT(set.containers[i - 1].key < set.containers[i].key);
+    }
+    for (size_t i = 10; i > 0; --i) {
+        ASSERT(contains_iroaring_set(&set, (i * IROARING_SET_SPAN) + i));
+    }
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+    for (size_t i = 0; i < IROARING_SET_SPAN * 2; i += 3) {
+        insert_iroaring_set(&set, i);
+    }
+
+    for (size_t i = 0; i < IROARING_SET_SPAN * 2; i += 3) {
+        remove_iroaring_set(&set, i);
+        ASSERT_FALSE(contains_iroaring_set(&set, i));
+    }
+
+    // empty containers are removed
+    ASSERT(is_empty_iroaring_set(&set));
+    ASSERT_EQ(0, set.count);
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+    for (size_t i = 100; i < 30000; ++i) {
+        insert_iroaring_set(&set, i);
+    }
+    ASSERT_EQ(BITMAP_IROARING, set.containers[0].type);
+
+    // contiguous indexes become a single run
+    shrink_to_fit_iroaring_set(&set);
+    ASSERT_EQ(RUN_IROARING, set.containers[0].type);
+    ASSERT_EQ(1, set.containers[0].size);
+    ASSERT_EQ(set.count, set.capacity);
+
+    // removing from the middle splits run in two
+    remove_iroaring_set(&set, 500);
+    ASSERT_EQ(2, set.containers[0].size);
+    ASSERT_FALSE(contains_iroaring_set(&set, 500));
+    ASSERT(contains_iroaring_set(&set, 499));
+    ASSERT(contains_iroaring_set(&set, 501));
+
+    // removing from either end shortens run
+    remove_iroaring_set(&set, 100);
+    remove_iroaring_set(&set, 29999);
+    ASSERT_EQ(2, set.containers[0].size);
+    ASSERT_FALSE(contains_iroaring_set(&set, 100));
+    ASSERT_FALSE(contains_iroaring_set(&set, 29999));
+
+    // inserting into the gap merges runs again, next to run extends it and far away adds new one
+    insert_iroaring_set(&set, 500);
+    ASSERT_EQ(1, set.containers[0].size);
+    insert_iroaring_set(&set, 29999);
+    ASSERT_EQ(1, set.containers[0].size);
+    insert_iroaring_set(&set, 50000);
+    ASSERT_EQ(2, set.containers[0].size);
+
+    ASSERT_EQ(30000 - 101 + 1, set.length);
+    for (size_t i = 101; i < 30000; ++i) {
+        ASSERT(contains_iroaring_set(&set, i));
+    }
+    ASSERT(contains_iroaring_set(&set, 50000));
+
+    destroy_iroaring_set(&set);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_02(void) {
+    iroaring_set_s set = create_iroaring_set();
+    ibitwise_set_s reference = create_ibitwise_set();
+    _iroaring_fill(&set, &reference, 0, 2, IROARING_SET_SPAN);
+    _iroaring_fill(&set, &reference, IROARING_SET_SPAN, 1000, 2 * IROARING_SET_SPAN);
+
+    // scattered bitmap and sparse array don't turn into runs
+    shrink_to_fit_iroaring_set(&set);
+    ASSERT_EQ(BITMAP_IROARING, set.containers[0].type);
+    ASSERT_EQ(ARRAY_IROARING, set.containers[1].type);
+    ASSERT_EQ(set.containers[1].size, set.containers[1].capacity);
+    ASSERT(_iroaring_same(&set, &reference));
+
+    destroy_iroaring_set(&set);
+    destroy_ibitwise_set(&reference);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    iroaring_set_s set = create_iroaring_set();
+    ibitwise_set_s reference = create_ibitwise_set();
+    iroaring_set_s other = create_iroaring_set();
+    ibitwise_set_s other_reference = create_ibitwise_set();
+    _iroaring_mixed(&set, &reference, &other, &other_reference);
+
+    iroaring_set_s copy = copy_iroaring_set(&set);
+    ASSERT_EQ(set.length, copy.length);
+    ASSERT_EQ(set.count, copy.count);
+    for (size_t i = 0; i < set.count; ++i) {
+        ASSERT_EQ(set.containers[i].type, copy.containers[i].type);
+    }
+    ASSERT(_iroaring_same(&copy, &reference));
+    ASSERT(is_subset_iroaring_set(&copy, &set));
+    ASSERT(is_subset_iroaring_set(&set, &copy));
+
+    destroy_iroaring_set(&set);
+    destroy_ibitwise_set(&reference);
+    destroy_iroaring_set(&other);
+    destroy_ibitwise_set(&other_reference);
+    destroy_iroaring_set(&copy);
+
+    PASS();
+}
+
+TEST UNION_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    iroaring_set_s set_union = union_iroaring_set(&set_one, &set_two);
+    ibitwise_set_s reference_union = union_ibitwise_set(&reference_one, &reference_two);
+
+    ASSERT(_iroaring_same(&set_union, &reference_union));
+    ASSERT_EQ(4, set_union.count);
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_union);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+    destroy_ibitwise_set(&reference_union);
+
+    PASS();
+}
+
+TEST UNION_02(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+
+    // union of two arrays that doesn't fit into an array becomes a bitmap
+    _iroaring_fill(&set_one, &reference_one, 0, 2, 2 * IROARING_SET_ARRAY);
+    _iroaring_fill(&set_two, &reference_two, 1, 2, 2 * IROARING_SET_ARRAY);
+
+    iroaring_set_s set_union = union_iroaring_set(&set_one, &set_two);
+    ibitwise_set_s reference_union = union_ibitwise_set(&reference_one, &reference_two);
+
+    ASSERT(_iroaring_same(&set_union, &reference_union));
+    ASSERT_EQ(RUN_IROARING, set_union.containers[0].type);
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_union);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+    destroy_ibitwise_set(&reference_union);
+
+    PASS();
+}
+
+TEST INTERSECT_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    iroaring_set_s set_intersect = intersect_iroaring_set(&set_one, &set_two);
+    ibitwise_set_s reference_intersect = intersect_ibitwise_set(&reference_one, &reference_two);
+
+    ASSERT(_iroaring_same(&set_intersect, &reference_intersect));
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_intersect);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+    destroy_ibitwise_set(&reference_intersect);
+
+    PASS();
+}
+
+TEST SUBTRACT_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    iroaring_set_s set_subtract = subtract_iroaring_set(&set_one, &set_two);
+    ibitwise_set_s reference_subtract = subtract_ibitwise_set(&reference_one, &reference_two);
+    ASSERT(_iroaring_same(&set_subtract, &reference_subtract));
+
+    iroaring_set_s set_reverse = subtract_iroaring_set(&set_two, &set_one);
+    ibitwise_set_s reference_reverse = subtract_ibitwise_set(&reference_two, &reference_one);
+    ASSERT(_iroaring_same(&set_reverse, &reference_reverse));
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_subtract);
+    destroy_iroaring_set(&set_reverse);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+    destroy_ibitwise_set(&reference_subtract);
+    destroy_ibitwise_set(&reference_reverse);
+
+    PASS();
+}
+
+TEST EXCLUDE_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    iroaring_set_s set_exclude = exclude_iroaring_set(&set_one, &set_two);
+    ibitwise_set_s reference_exclude = exclude_ibitwise_set(&reference_one, &reference_two);
+    ASSERT(_iroaring_same(&set_exclude, &reference_exclude));
+
+    // excluding structure with itself empties it
+    iroaring_set_s set_self = exclude_iroaring_set(&set_one, &set_one);
+    ASSERT(is_empty_iroaring_set(&set_self));
+    ASSERT_EQ(0, set_self.count);
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_exclude);
+    destroy_iroaring_set(&set_self);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+    destroy_ibitwise_set(&reference_exclude);
+
+    PASS();
+}
+
+TEST IS_SUBSET_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    iroaring_set_s set_union = union_iroaring_set(&set_one, &set_two);
+    iroaring_set_s set_intersect = intersect_iroaring_set(&set_one, &set_two);
+
+    ASSERT(is_subset_iroaring_set(&set_union, &set_one));
+    ASSERT(is_subset_iroaring_set(&set_union, &set_two));
+    ASSERT(is_subset_iroaring_set(&set_one, &set_intersect));
+    ASSERT(is_subset_iroaring_set(&set_two, &set_intersect));
+    ASSERT(is_proper_subset_iroaring_set(&set_union, &set_one));
+    ASSERT_FALSE(is_subset_iroaring_set(&set_one, &set_two));
+    ASSERT_FALSE(is_subset_iroaring_set(&set_two, &set_one));
+    ASSERT_FALSE(is_proper_subset_iroaring_set(&set_one, &set_one));
+
+    // single missing index in a bitmap container breaks subset
+    insert_iroaring_set(&set_union, 3 * IROARING_SET_SPAN + 1);
+    remove_iroaring_set(&set_union, IROARING_SET_SPAN + 3);
+    ASSERT_FALSE(is_subset_iroaring_set(&set_union, &set_two));
+    ASSERT(is_subset_iroaring_set(&set_union, &set_one));
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_union);
+    destroy_iroaring_set(&set_intersect);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+
+    PASS();
+}
+
+TEST IS_DISJOINT_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    ASSERT_FALSE(is_disjoint_iroaring_set(&set_one, &set_two));
+
+    iroaring_set_s set_subtract = subtract_iroaring_set(&set_one, &set_two);
+    iroaring_set_s set_reverse = subtract_iroaring_set(&set_two, &set_one);
+    ASSERT(is_disjoint_iroaring_set(&set_subtract, &set_two));
+    ASSERT(is_disjoint_iroaring_set(&set_subtract, &set_reverse));
+    ASSERT(is_disjoint_iroaring_set(&set_reverse, &set_subtract));
+
+    // odd and even bitmaps are disjoint until they share an index
+    iroaring_set_s set_odd = create_iroaring_set(), set_even = create_iroaring_set();
+    ibitwise_set_s reference_odd = create_ibitwise_set(), reference_even = create_ibitwise_set();
+    _iroaring_fill(&set_odd, &reference_odd, 1, 2, IROARING_SET_SPAN);
+    _iroaring_fill(&set_even, &reference_even, 0, 2, IROARING_SET_SPAN);
+    ASSERT(is_disjoint_iroaring_set(&set_odd, &set_even));
+    insert_iroaring_set(&set_even, IROARING_SET_SPAN - 1);
+    ASSERT_FALSE(is_disjoint_iroaring_set(&set_odd, &set_even));
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_iroaring_set(&set_subtract);
+    destroy_iroaring_set(&set_reverse);
+    destroy_iroaring_set(&set_odd);
+    destroy_iroaring_set(&set_even);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+    destroy_ibitwise_set(&reference_odd);
+    destroy_ibitwise_set(&reference_even);
+
+    PASS();
+}
+
+TEST EACH_INDEX_01(void) {
+    iroaring_set_s set_one = create_iroaring_set(), set_two = create_iroaring_set();
+    ibitwise_set_s reference_one = create_ibitwise_set(), reference_two = create_ibitwise_set();
+    _iroaring_mixed(&set_one, &reference_one, &set_two, &reference_two);
+
+    // every index of each encoding is visited in ascending order
+    struct iroaring_compare compare = { .reference = &reference_one, .same = true, };
+    each_index_iroaring_set(&set_one, _iroaring_compare, &compare);
+    ASSERT(compare.same);
+    ASSERT_EQ(set_one.length, compare.count);
+    ASSERT_EQ((2 * IROARING_SET_SPAN) + 31000, compare.next);
+
+    ASSERT(_iroaring_same(&set_two, &reference_two));
+
+    destroy_iroaring_set(&set_one);
+    destroy_iroaring_set(&set_two);
+    destroy_ibitwise_set(&reference_one);
+    destroy_ibitwise_set(&reference_two);
+
+    PASS();
+}
+
+SUITE (iroaring_set_test) {
+    RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03);
+    RUN_TEST(REMOVE_01);
+    RUN_TEST(SHRINK_TO_FIT_01); RUN_TEST(SHRINK_TO_FIT_02);
+    RUN_TEST(COPY_01);
+    RUN_TEST(UNION_01); RUN_TEST(UNION_02);
+    RUN_TEST(INTERSECT_01); RUN_TEST(SUBTRACT_01); RUN_TEST(EXCLUDE_01);
+    RUN_TEST(IS_SUBSET_01); RUN_TEST(IS_DISJOINT_01);
+    RUN_TEST(EACH_INDEX_01);
+}
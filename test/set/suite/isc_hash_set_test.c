@@ -1650,6 +1650,185 @@ TEST IS_DISJOINT_09(void) {
     PASS();
 }
 
+TEST REINDEX_01(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshsame, NULL, intcmp, NULL);
+    reindex_isc_hash_set(&set, MASK_INDEX);
+
+    for (int i = 0; i < ISC_HASH_SET_CHUNK * 3 + 1; ++i) {
+        insert_isc_hash_set(&set, &i);
+        ASSERT_EQ(0, set.capacity & (set.capacity - 1));
+    }
+
+    for (int i = 0; i < ISC_HASH_SET_CHUNK * 3 + 1; ++i) {
+        ASSERT(contains_isc_hash_set(&set, &i));
+    }
+
+    for (int i = 0; i < ISC_HASH_SET_CHUNK * 3 + 1; ++i) {
+        int buf = 0;
+        remove_isc_hash_set(&set, &i, &buf);
+        ASSERT_EQ(i, buf);
+        ASSERT_EQ(0, set.capacity & (set.capacity - 1));
+    }
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST REINDEX_02(void) {
+    isc_hash_set_s set_one = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    isc_hash_set_s set_two = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < ISC_HASH_SET_CHUNK + 1; ++i) {
+        insert_isc_hash_set(&set_one, &i);
+    }
+
+    for (int i = ISC_HASH_SET_CHUNK / 2; i < ISC_HASH_SET_CHUNK * 2; ++i) {
+        insert_isc_hash_set(&set_two, &i);
+    }
+
+    reindex_isc_hash_set(&set_one, MASK_INDEX);
+    for (int i = 0; i < ISC_HASH_SET_CHUNK + 1; ++i) {
+        ASSERT(contains_isc_hash_set(&set_one, &i));
+    }
+
+    isc_hash_set_s set_union = union_isc_hash_set(&set_one, &set_two, intcpy, NULL);
+    isc_hash_set_s set_intersect = intersect_isc_hash_set(&set_one, &set_two, intcpy, NULL);
+
+    for (int i = 0; i < ISC_HASH_SET_CHUNK * 2; ++i) {
+        ASSERT(contains_isc_hash_set(&set_union, &i));
+        ASSERT_EQ(i >= ISC_HASH_SET_CHUNK / 2 && i < ISC_HASH_SET_CHUNK + 1, contains_isc_hash_set(&set_intersect, &i));
+    }
+
+    reindex_isc_hash_set(&set_one, MODULO_INDEX);
+    for (int i = 0; i < ISC_HASH_SET_CHUNK + 1; ++i) {
+        ASSERT(contains_isc_hash_set(&set_one, &i));
+    }
+
+    destroy_isc_hash_set(&set_one, intdst, NULL);
+    destroy_isc_hash_set(&set_two, intdst, NULL);
+    destroy_isc_hash_set(&set_union, intdst, NULL);
+    destroy_isc_hash_set(&set_intersect, intdst, NULL);
+
+    PASS();
+}
+
+TEST CONTAINS_MANY_01(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    int elements[ISC_HASH_SET_CHUNK * 2 + 1];
+    for (int i = 0; i < ISC_HASH_SET_CHUNK * 2 + 1; ++i) {
+        elements[i] = i;
+        if (i % 2) { insert_isc_hash_set(&set, &i); }
+    }
+
+    bool results[ISC_HASH_SET_CHUNK * 2 + 1];
+    contains_many_isc_hash_set(&set, elements, ISC_HASH_SET_CHUNK * 2 + 1, results);
+
+    for (int i = 0; i < ISC_HASH_SET_CHUNK * 2 + 1; ++i) {
+        ASSERT_EQ(contains_isc_hash_set(&set, &i), results[i]);
+        ASSERT_EQ((bool)(i % 2), results[i]);
+    }
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST CONTAINS_MANY_02(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    int elements[ISC_HASH_SET_CHUNK];
+    bool results[ISC_HASH_SET_CHUNK];
+    for (int i = 0; i < ISC_HASH_SET_CHUNK; ++i) {
+        elements[i] = i;
+        results[i] = true;
+    }
+
+    contains_many_isc_hash_set(&set, elements, ISC_HASH_SET_CHUNK, results);
+    for (int i = 0; i < ISC_HASH_SET_CHUNK; ++i) {
+        ASSERT_FALSE(results[i]);
+    }
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST RESERVE_01(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    reserve_isc_hash_set(&set, 100);
+    size_t const capacity = set.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_isc_hash_set(&set, &i);
+    }
+    ASSERT_EQ(capacity, set.capacity);
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_isc_hash_set(&set, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        remove_isc_hash_set(&set, &i, &a);
+    }
+
+    shrink_to_fit_isc_hash_set(&set);
+    ASSERT_EQ(set.length, set.capacity);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i >= 60, contains_isc_hash_set(&set, &i));
+    }
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST GROWTH_01(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    growth_isc_hash_set(&set, compose_growth(2, 8, 0));
+
+    for (int i = 0; i < 100; ++i) {
+        insert_isc_hash_set(&set, &i);
+    }
+    size_t const capacity = set.capacity;
+
+    for (int i = 0; i < 100; ++i) {
+        int a = -1;
+        remove_isc_hash_set(&set, &i, &a);
+    }
+    ASSERT_EQ(capacity, set.capacity);
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
+TEST GROWTH_02(void) {
+    isc_hash_set_s set = create_isc_hash_set(sizeof(int), inthshmurmur, NULL, intcmp, NULL);
+    growth_isc_hash_set(&set, compose_growth(4, 8, 4));
+
+    for (int i = 0; i < 9; ++i) {
+        insert_isc_hash_set(&set, &i);
+    }
+    ASSERT(9 <= set.capacity);
+
+    destroy_isc_hash_set(&set, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (isc_hash_set_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -1677,4 +1856,7 @@ SUITE (isc_hash_set_test) {
     RUN_TEST(IS_DISJOINT_01); RUN_TEST(IS_DISJOINT_02); RUN_TEST(IS_DISJOINT_03);
     RUN_TEST(IS_DISJOINT_04); RUN_TEST(IS_DISJOINT_05); RUN_TEST(IS_DISJOINT_06);
     RUN_TEST(IS_DISJOINT_07); RUN_TEST(IS_DISJOINT_08); RUN_TEST(IS_DISJOINT_09);
+    RUN_TEST(REINDEX_01); RUN_TEST(REINDEX_02);
+    RUN_TEST(CONTAINS_MANY_01); RUN_TEST(CONTAINS_MANY_02);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01); RUN_TEST(GROWTH_01); RUN_TEST(GROWTH_02);
 }
@@ -5,7 +5,9 @@
 
 SUITE_EXTERN(ibitwise_set_test);
 SUITE_EXTERN(isc_hash_set_test);
+SUITE_EXTERN(ioa_hash_set_test);
 SUITE_EXTERN(irb_set_test);
+SUITE_EXTERN(iroaring_set_test);
 
 SUITE_EXTERN(fbitwise_set_test);
 SUITE_EXTERN(fsc_hash_set_test);
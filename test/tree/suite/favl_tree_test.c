@@ -647,6 +647,35 @@ TEST REMOVE_PREDECESSOR_02(void) {
     PASS();
 }
 
+/// @brief Appends element to record array, whose first value is number of recorded elements.
+bool _favl_tree_record(void * const element, void * const record) {
+    int * const array = record;
+    array[++array[0]] = *(int *)(element);
+
+    return true;
+}
+
+TEST POST_ORDER_01(void) {
+    favl_tree_s tree = create_favl_tree(sizeof(int), FAVL_TREE_CHUNK, intcmp, NULL);
+
+    // level order insertion builds a perfect tree without any rebalancing
+    int const keys[] = { 4, 2, 6, 1, 3, 5, 7, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(int); ++i) {
+        insert_favl_tree(&tree, keys + i);
+    }
+
+    int record[8] = { 0 };
+    post_order_favl_tree(&tree, _favl_tree_record, record);
+
+    // children are visited before their parent, left subtree before right one
+    int const expected[8] = { 7, 1, 3, 2, 5, 7, 6, 4, };
+    ASSERT_MEM_EQ(expected, record, sizeof(expected));
+
+    destroy_favl_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (favl_tree_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02);
@@ -665,4 +694,5 @@ SUITE (favl_tree_test) {
     RUN_TEST(GET_PREDECESSOR_01); RUN_TEST(GET_PREDECESSOR_02);
     RUN_TEST(REMOVE_SUCCESSOR_01); RUN_TEST(REMOVE_SUCCESSOR_02);
     RUN_TEST(REMOVE_PREDECESSOR_01); RUN_TEST(REMOVE_PREDECESSOR_02);
+    RUN_TEST(POST_ORDER_01);
 }
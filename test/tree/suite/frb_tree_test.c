@@ -645,6 +645,56 @@ TEST REMOVE_PREDECESSOR_02(void) {
     PASS();
 }
 
+/// @brief Appends element to record array, whose first value is number of recorded elements.
+bool _frb_tree_record(void * const element, void * const record) {
+    int * const array = record;
+    array[++array[0]] = *(int *)(element);
+
+    return true;
+}
+
+TEST IN_ORDER_01(void) {
+    frb_tree_s tree = create_frb_tree(sizeof(int), FRB_TREE_CHUNK, intcmp, NULL);
+
+    // level order insertion builds a perfect tree without any rebalancing
+    int const keys[] = { 4, 2, 6, 1, 3, 5, 7, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(int); ++i) {
+        insert_frb_tree(&tree, keys + i);
+    }
+
+    int record[8] = { 0 };
+    in_order_frb_tree(&tree, _frb_tree_record, record);
+
+    // every key is visited once in ascending order
+    int const expected[8] = { 7, 1, 2, 3, 4, 5, 6, 7, };
+    ASSERT_MEM_EQ(expected, record, sizeof(expected));
+
+    destroy_frb_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
+TEST POST_ORDER_01(void) {
+    frb_tree_s tree = create_frb_tree(sizeof(int), FRB_TREE_CHUNK, intcmp, NULL);
+
+    // level order insertion builds a perfect tree without any rebalancing
+    int const keys[] = { 4, 2, 6, 1, 3, 5, 7, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(int); ++i) {
+        insert_frb_tree(&tree, keys + i);
+    }
+
+    int record[8] = { 0 };
+    post_order_frb_tree(&tree, _frb_tree_record, record);
+
+    // children are visited before their parent, left subtree before right one
+    int const expected[8] = { 7, 1, 3, 2, 5, 7, 6, 4, };
+    ASSERT_MEM_EQ(expected, record, sizeof(expected));
+
+    destroy_frb_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (frb_tree_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02);
@@ -663,4 +713,5 @@ SUITE (frb_tree_test) {
     RUN_TEST(GET_PREDECESSOR_01); RUN_TEST(GET_PREDECESSOR_02);
     RUN_TEST(REMOVE_SUCCESSOR_01); RUN_TEST(REMOVE_SUCCESSOR_02);
     RUN_TEST(REMOVE_PREDECESSOR_01); RUN_TEST(REMOVE_PREDECESSOR_02);
+    RUN_TEST(IN_ORDER_01); RUN_TEST(POST_ORDER_01);
 }
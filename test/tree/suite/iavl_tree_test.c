@@ -946,6 +946,75 @@ TEST REMOVE_PREDECESSOR_03(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    iavl_tree_s tree = create_iavl_tree(sizeof(int), intcmp, NULL);
+
+    reserve_iavl_tree(&tree, 100);
+    size_t const capacity = tree.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_iavl_tree(&tree, &i);
+    }
+    ASSERT_EQ(capacity, tree.capacity);
+
+    destroy_iavl_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    iavl_tree_s tree = create_iavl_tree(sizeof(int), intcmp, NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_iavl_tree(&tree, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        remove_iavl_tree(&tree, &i, &a);
+    }
+
+    shrink_to_fit_iavl_tree(&tree);
+    ASSERT_EQ(tree.length, tree.capacity);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i >= 60, contains_iavl_tree(&tree, &i));
+    }
+
+    destroy_iavl_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
+/// @brief Appends element to record array, whose first value is number of recorded elements.
+bool _iavl_tree_record(void * const element, void * const record) {
+    int * const array = record;
+    array[++array[0]] = *(int *)(element);
+
+    return true;
+}
+
+TEST POST_ORDER_01(void) {
+    iavl_tree_s tree = create_iavl_tree(sizeof(int), intcmp, NULL);
+
+    // level order insertion builds a perfect tree without any rebalancing
+    int const keys[] = { 4, 2, 6, 1, 3, 5, 7, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(int); ++i) {
+        insert_iavl_tree(&tree, keys + i);
+    }
+
+    int record[8] = { 0 };
+    post_order_iavl_tree(&tree, _iavl_tree_record, record);
+
+    // children are visited before their parent, left subtree before right one
+    int const expected[8] = { 7, 1, 3, 2, 5, 7, 6, 4, };
+    ASSERT_MEM_EQ(expected, record, sizeof(expected));
+
+    destroy_iavl_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (iavl_tree_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03);
@@ -964,4 +1033,6 @@ SUITE (iavl_tree_test) {
     RUN_TEST(GET_PREDECESSOR_01); RUN_TEST(GET_PREDECESSOR_02); RUN_TEST(GET_PREDECESSOR_03);
     RUN_TEST(REMOVE_SUCCESSOR_01); RUN_TEST(REMOVE_SUCCESSOR_02); RUN_TEST(REMOVE_SUCCESSOR_03);
     RUN_TEST(REMOVE_PREDECESSOR_01); RUN_TEST(REMOVE_PREDECESSOR_02); RUN_TEST(REMOVE_PREDECESSOR_03);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(POST_ORDER_01);
 }
@@ -944,6 +944,96 @@ TEST REMOVE_PREDECESSOR_03(void) {
     PASS();
 }
 
+TEST RESERVE_01(void) {
+    irb_tree_s tree = create_irb_tree(sizeof(int), intcmp, NULL);
+
+    reserve_irb_tree(&tree, 100);
+    size_t const capacity = tree.capacity;
+    ASSERT(capacity >= 100);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_irb_tree(&tree, &i);
+    }
+    ASSERT_EQ(capacity, tree.capacity);
+
+    destroy_irb_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
+TEST SHRINK_TO_FIT_01(void) {
+    irb_tree_s tree = create_irb_tree(sizeof(int), intcmp, NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        insert_irb_tree(&tree, &i);
+    }
+
+    for (int i = 0; i < 60; ++i) {
+        int a = -1;
+        remove_irb_tree(&tree, &i, &a);
+    }
+
+    shrink_to_fit_irb_tree(&tree);
+    ASSERT_EQ(tree.length, tree.capacity);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i >= 60, contains_irb_tree(&tree, &i));
+    }
+
+    destroy_irb_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
+/// @brief Appends element to record array, whose first value is number of recorded elements.
+bool _irb_tree_record(void * const element, void * const record) {
+    int * const array = record;
+    array[++array[0]] = *(int *)(element);
+
+    return true;
+}
+
+TEST IN_ORDER_01(void) {
+    irb_tree_s tree = create_irb_tree(sizeof(int), intcmp, NULL);
+
+    // level order insertion builds a perfect tree without any rebalancing
+    int const keys[] = { 4, 2, 6, 1, 3, 5, 7, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(int); ++i) {
+        insert_irb_tree(&tree, keys + i);
+    }
+
+    int record[8] = { 0 };
+    in_order_irb_tree(&tree, _irb_tree_record, record);
+
+    // every key is visited once in ascending order
+    int const expected[8] = { 7, 1, 2, 3, 4, 5, 6, 7, };
+    ASSERT_MEM_EQ(expected, record, sizeof(expected));
+
+    destroy_irb_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
+TEST POST_ORDER_01(void) {
+    irb_tree_s tree = create_irb_tree(sizeof(int), intcmp, NULL);
+
+    // level order insertion builds a perfect tree without any rebalancing
+    int const keys[] = { 4, 2, 6, 1, 3, 5, 7, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(int); ++i) {
+        insert_irb_tree(&tree, keys + i);
+    }
+
+    int record[8] = { 0 };
+    post_order_irb_tree(&tree, _irb_tree_record, record);
+
+    // children are visited before their parent, left subtree before right one
+    int const expected[8] = { 7, 1, 3, 2, 5, 7, 6, 4, };
+    ASSERT_MEM_EQ(expected, record, sizeof(expected));
+
+    destroy_irb_tree(&tree, intdst, NULL);
+
+    PASS();
+}
+
 SUITE (irb_tree_test) {
     RUN_TEST(CREATE_01); RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01);
     RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03);
@@ -962,4 +1052,6 @@ SUITE (irb_tree_test) {
     RUN_TEST(GET_PREDECESSOR_01); RUN_TEST(GET_PREDECESSOR_02); RUN_TEST(GET_PREDECESSOR_03);
     RUN_TEST(REMOVE_SUCCESSOR_01); RUN_TEST(REMOVE_SUCCESSOR_02); RUN_TEST(REMOVE_SUCCESSOR_03);
     RUN_TEST(REMOVE_PREDECESSOR_01); RUN_TEST(REMOVE_PREDECESSOR_02); RUN_TEST(REMOVE_PREDECESSOR_03);
+    RUN_TEST(RESERVE_01); RUN_TEST(SHRINK_TO_FIT_01);
+    RUN_TEST(IN_ORDER_01); RUN_TEST(POST_ORDER_01);
 }